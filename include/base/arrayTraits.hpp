@@ -165,6 +165,32 @@ namespace tlapack {
         {}
     };
 
+    /**
+     * @brief Rectangular full packed access
+     * 
+     * Pairs (i,j) stored by a n-by-n matrix in the rectangular full packed
+     * format, see rfpMatrix. If uplo is Lower, they are the lower triangle
+     * of the first n1 columns and the upper triangle of the trailing
+     * (n-n1)-by-(n-n1) block. If uplo is Upper, they are the lower triangle
+     * of the leading n1-by-n1 block and the upper triangle of the last n-n1
+     * columns.
+     * 
+     *      Lower, n1 = 2:      Upper, n1 = 2:
+     *      x 0 0 0 0           x 0 x x x
+     *      x x 0 0 0           x x x x x
+     *      x x x x x           0 0 x x x
+     *      x x 0 x x           0 0 0 x x
+     *      x x 0 0 x           0 0 0 0 x
+     */
+    struct rfp_t : dense_t {
+        Uplo uplo;          ///< Triangle of the matrix that is stored.
+        std::size_t n1;     ///< Number of columns of the first triangle.
+
+        constexpr rfp_t(Uplo uplo, std::size_t n1)
+        : uplo(uplo), n1(n1)
+        {}
+    };
+
     // constant expressions
     constexpr dense_t dense = { };
     constexpr upperHessenberg_t upperHessenberg = { };
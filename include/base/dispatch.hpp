@@ -0,0 +1,117 @@
+/// @file dispatch.hpp
+/// @brief Size threshold between the template BLAS and the optimized BLAS
+//
+// Copyright (c) 2022, University of Colorado Denver. All rights reserved.
+//
+// This file is part of <T>LAPACK.
+// <T>LAPACK is free software: you can redistribute it and/or modify it under
+// the terms of the BSD 3-Clause license. See the accompanying LICENSE file.
+
+#ifndef __TLAPACK_DISPATCH_HH__
+#define __TLAPACK_DISPATCH_HH__
+
+#include <array>
+#include <atomic>
+#include <cstdint>
+#include <iomanip>
+#include <iostream>
+
+#include "base/tuning.hpp"
+
+namespace tlapack {
+
+    /// Default of optblas_nmin(): the 2-by-2 to 7-by-7 products of the
+    /// eigenvalue routines, e.g., in schur_swap, use the template BLAS
+    constexpr std::size_t optblas_nmin_default = 8;
+
+    /**
+     * @brief Smallest problem size for which the wrappers of the optimized
+     * BLAS call the optimized library.
+     *
+     * With USE_BLASPP_WRAPPERS, the calls of gemm, gemv, ger, trmm and trsm
+     * whose largest dimension is smaller than this threshold use the
+     * template implementation, which avoids the overhead of the library
+     * call. The threshold is the parameter optblas_nmin of the routine in
+     * the tuning table, e.g.,
+     *
+     *      gemm  optblas_nmin  d  inf  16
+     *
+     * or optblas_nmin_default if there is no such entry. A threshold of 0
+     * sends all calls to the optimized library.
+     *
+     * Not noexcept: the first call loads the tuning table, which may
+     * allocate memory.
+     */
+    template <typename T>
+    inline std::size_t optblas_nmin(const char *routine)
+    {
+        std::size_t value;
+        if (tuning().lookup(routine, "optblas_nmin", tuning_type<T>(), 0, value))
+            return value;
+        return optblas_nmin_default;
+    }
+
+    /// Number of calls of a routine that went to each implementation
+    struct optblas_counter {
+        const char *routine;
+        std::atomic<std::uint64_t> template_calls{0};   ///< Calls below the threshold
+        std::atomic<std::uint64_t> optblas_calls{0};    ///< Calls to the optimized library
+    };
+
+    /// Routines whose calls are dispatched by size
+    enum class optblas_routine { gemm = 0, gemv, ger, trmm, trsm, count };
+
+    /// Counters of all dispatched routines, in the order of optblas_routine
+    inline std::array<optblas_counter, std::size_t(optblas_routine::count)> &optblas_counters() noexcept
+    {
+        static std::array<optblas_counter, std::size_t(optblas_routine::count)> counters = {
+            {{"gemm"}, {"gemv"}, {"ger"}, {"trmm"}, {"trsm"}}};
+        return counters;
+    }
+
+    /// Sets all counters of optblas_counters() to zero
+    inline void reset_optblas_counters() noexcept
+    {
+        for (auto &c : optblas_counters())
+        {
+            c.template_calls = 0;
+            c.optblas_calls = 0;
+        }
+    }
+
+    /// Prints the counters of the routines that were called
+    inline void print_optblas_counters(std::ostream &out)
+    {
+        out << "routine      template      optblas" << std::endl;
+        for (const auto &c : optblas_counters())
+        {
+            const std::uint64_t t = c.template_calls, o = c.optblas_calls;
+            if (t + o == 0)
+                continue;
+            out << std::left << std::setw(8) << c.routine << std::right
+                << std::setw(13) << t << std::setw(13) << o << std::endl;
+        }
+    }
+
+    namespace internal {
+
+        /**
+         * Returns true if the call of routine r with largest dimension n
+         * should use the template implementation, and counts the call.
+         * Calls that the wrapper cannot forward to the library, e.g., with
+         * mixed layouts, use the template implementation too.
+         */
+        template <typename T>
+        inline bool use_template_blas(optblas_routine r, std::size_t n, bool can_forward = true)
+        {
+            optblas_counter &c = optblas_counters()[std::size_t(r)];
+            const bool small = !can_forward || n < optblas_nmin<T>(c.routine);
+            (small ? c.template_calls : c.optblas_calls).fetch_add(1, std::memory_order_relaxed);
+            return small;
+        }
+
+    } // namespace internal
+
+} // namespace tlapack
+
+#endif // __TLAPACK_DISPATCH_HH__
@@ -0,0 +1,304 @@
+/// @file host.hpp
+/// @brief Cache sizes of the host and the default block sizes derived from them
+//
+// Copyright (c) 2022, University of Colorado Denver. All rights reserved.
+//
+// This file is part of <T>LAPACK.
+// <T>LAPACK is free software: you can redistribute it and/or modify it under
+// the terms of the BSD 3-Clause license. See the accompanying LICENSE file.
+
+#ifndef __TLAPACK_HOST_HH__
+#define __TLAPACK_HOST_HH__
+
+#include <algorithm>
+#include <cmath>
+#include <cstdio>
+#include <cstdlib>
+#include <cstring>
+#include <ostream>
+#include <thread>
+
+#if (defined(__x86_64__) || defined(__i386__)) && (defined(__GNUC__) || defined(__clang__))
+    #include <cpuid.h>
+    #define TLAPACK_HOST_HAS_CPUID
+#endif
+
+namespace tlapack {
+
+    /// Caches, cores and SIMD width of the host
+    struct host_info {
+        std::size_t l1d = 32 * 1024;        ///< L1 data cache of a core, in bytes
+        std::size_t l2 = 256 * 1024;        ///< L2 cache of a core, in bytes
+        std::size_t l3 = 8 * 1024 * 1024;   ///< L3 cache, in bytes, 0 if there is none
+        std::size_t cache_line = 64;        ///< Cache line, in bytes
+        unsigned cores = 1;                 ///< Number of hardware threads
+        std::size_t simd_width = 16;        ///< Width of the SIMD registers used by the compiled code, in bytes
+        const char *source = "defaults";    ///< Where the cache sizes come from: sysfs, cpuid or defaults
+    };
+
+    namespace internal {
+
+        /// Reads the first word of the file at path into buf. Uses C stdio
+        /// and fixed buffers, so that probing does not call operator new.
+        inline bool read_word(const char *path, char *buf, int size)
+        {
+            std::FILE *f = std::fopen(path, "r");
+            if (!f)
+                return false;
+            const bool ok = std::fgets(buf, size, f) != nullptr;
+            std::fclose(f);
+            if (!ok)
+                return false;
+            buf[std::strcspn(buf, " \t\n")] = '\0';
+            return buf[0] != '\0';
+        }
+
+        /// Reads the cache sizes from /sys/devices/system/cpu/cpu0/cache
+        inline bool probe_sysfs(host_info &h)
+        {
+#if defined(__linux__)
+            bool found = false;
+            char path[96], level[16], type[32], size[32], line[16];
+            for (int index = 0; index < 16; ++index)
+            {
+                const auto read = [&](const char *name, char *buf, int n) {
+                    std::snprintf(path, sizeof(path), "/sys/devices/system/cpu/cpu0/cache/index%d/%s", index, name);
+                    return read_word(path, buf, n);
+                };
+                if (!read("level", level, sizeof(level)) || !read("type", type, sizeof(type)) ||
+                    !read("size", size, sizeof(size)) || std::strcmp(type, "Instruction") == 0)
+                    continue;
+
+                char *unit = nullptr;
+                std::size_t bytes = std::strtoull(size, &unit, 10);
+                if (*unit == 'K')
+                    bytes *= 1024;
+                else if (*unit == 'M')
+                    bytes *= 1024 * 1024;
+                if (bytes == 0)
+                    continue;
+
+                const int lvl = std::atoi(level);
+                if (lvl == 1)
+                {
+                    h.l1d = bytes;
+                    if (read("coherency_line_size", line, sizeof(line)))
+                    {
+                        const std::size_t line_size = std::strtoull(line, nullptr, 10);
+                        if (line_size > 0)
+                            h.cache_line = line_size;
+                    }
+                }
+                else if (lvl == 2)
+                    h.l2 = bytes;
+                else if (lvl == 3)
+                    h.l3 = bytes;
+                found = true;
+            }
+            return found;
+#else
+            return false;
+#endif
+        }
+
+        /// Reads the cache sizes with the deterministic cache parameters of cpuid
+        inline bool probe_cpuid(host_info &h)
+        {
+#ifdef TLAPACK_HOST_HAS_CPUID
+            unsigned eax, ebx, ecx, edx;
+            if (!__get_cpuid(0, &eax, &ebx, &ecx, &edx) || eax < 4)
+                return false;
+            bool found = false;
+            for (unsigned i = 0; i < 16; ++i)
+            {
+                __cpuid_count(4, i, eax, ebx, ecx, edx);
+                const unsigned type = eax & 0x1f;
+                if (type == 0)
+                    break;
+                if (type == 2) // Instruction cache
+                    continue;
+                const unsigned level = (eax >> 5) & 0x7;
+                const std::size_t ways = ((ebx >> 22) & 0x3ff) + 1;
+                const std::size_t partitions = ((ebx >> 12) & 0x3ff) + 1;
+                const std::size_t line = (ebx & 0xfff) + 1;
+                const std::size_t sets = std::size_t(ecx) + 1;
+                const std::size_t bytes = ways * partitions * line * sets;
+                if (level == 1)
+                {
+                    h.l1d = bytes;
+                    h.cache_line = line;
+                }
+                else if (level == 2)
+                    h.l2 = bytes;
+                else if (level == 3)
+                    h.l3 = bytes;
+                found = true;
+            }
+            return found;
+#else
+            return false;
+#endif
+        }
+
+    } // namespace internal
+
+    /**
+     * @brief Probes the host. Use host() for the probed values.
+     *
+     * The cache sizes are read from sysfs on Linux, otherwise with cpuid
+     * on x86. If both fail, host_info keeps its default values. The SIMD
+     * width is the one the code is compiled for.
+     */
+    inline host_info probe_host()
+    {
+        host_info h;
+        if (internal::probe_sysfs(h))
+            h.source = "sysfs";
+        else if (internal::probe_cpuid(h))
+            h.source = "cpuid";
+        h.cores = std::max(1u, std::thread::hardware_concurrency());
+
+#if defined(__AVX512F__)
+        h.simd_width = 64;
+#elif defined(__AVX__)
+        h.simd_width = 32;
+#elif defined(__SSE2__) || defined(__ARM_NEON) || defined(__ALTIVEC__)
+        h.simd_width = 16;
+#else
+        h.simd_width = sizeof(double);
+#endif
+        return h;
+    }
+
+    /**
+     * @brief Caches, cores and SIMD width of the host, probed on first use.
+     *
+     * The probe reads small files with C stdio and does not call operator
+     * new, so that it may run inside the routines of <T>LAPACK, e.g., with
+     * TLAPACK_NO_HIDDEN_ALLOCATION.
+     */
+    inline const host_info &host()
+    {
+        static const host_info h = probe_host();
+        return h;
+    }
+
+    /// Default parameters derived from the host by the analytical model
+    struct host_defaults_t {
+        std::size_t potrf_nb;       ///< Block size of potrf
+        std::size_t gehrd_nb;       ///< Block size of gehrd
+        std::size_t gemm_mc;        ///< Rows of the block of A that gemm keeps in L2
+        std::size_t gemm_kc;        ///< Columns of the block of A, and rows of the block of B
+        std::size_t gemm_nc;        ///< Columns of the block of B that gemm keeps in L3
+        std::size_t transpose_nx;   ///< Size below which transpose stops the recursion
+        std::size_t lauum_nx;       ///< Size below which lauum_recursive uses lauu2
+        std::size_t trtri_nx;       ///< Size below which trtri_recursive uses trti2
+    };
+
+    namespace internal {
+
+        /// Rounds x down to a multiple of m, and clamps it to [lo, hi]
+        inline std::size_t round_clamp(double x, std::size_t m, std::size_t lo, std::size_t hi)
+        {
+            const std::size_t r = (x > 0) ? std::size_t(x) / m * m : 0;
+            return std::min(std::max(r, lo), hi);
+        }
+
+    } // namespace internal
+
+    /**
+     * @brief Parameters derived from the caches of h for scalars of
+     * elem_size bytes and problems of size n.
+     *
+     * - gemm: the block of A, mc-by-kc, fills half of L2 and the block of B,
+     *   kc-by-nc, fills half of L3. A column of the block of A and the
+     *   register tile of C, with mr = 2 SIMD registers of rows and nr = 4
+     *   columns, fill half of L1.
+     * - potrf: the nb-by-nb diagonal block and the panel updates reuse a
+     *   quarter of L2.
+     * - gehrd: the two n-by-nb panels of lahr2, V and Y, fit in half of L2.
+     * - transpose: the source and destination nx-by-nx blocks fill half of L1.
+     * - lauum, trtri: the nx-by-nx diagonal block of lauu2 or trti2 fills
+     *   half of L1.
+     */
+    inline host_defaults_t host_defaults(const host_info &h, std::size_t elem_size, std::size_t n)
+    {
+        using internal::round_clamp;
+        const double s = double(elem_size);
+        const std::size_t mr = std::max<std::size_t>(2, 2 * h.simd_width / elem_size);
+        const std::size_t nr = 4;
+
+        host_defaults_t d;
+        d.gemm_kc = round_clamp(0.5 * h.l1d / (s * (mr + nr)), 8, 32, 1024);
+        d.gemm_mc = round_clamp(0.5 * h.l2 / (s * d.gemm_kc), mr, mr, 4096);
+        d.gemm_nc = round_clamp(0.5 * std::max(h.l3, h.l2) / (s * d.gemm_kc), nr, nr, 8192);
+        d.potrf_nb = round_clamp(std::sqrt(0.25 * h.l2 / s), 8, 16, 256);
+        d.gehrd_nb = round_clamp(0.5 * h.l2 / (2 * s * std::max<std::size_t>(n, 1)), 8, 16, 64);
+        d.transpose_nx = round_clamp(std::sqrt(0.25 * h.l1d / s), 4, 4, 256);
+        d.lauum_nx = round_clamp(std::sqrt(0.5 * h.l1d / s), 4, 4, 128);
+        d.trtri_nx = d.lauum_nx;
+        return d;
+    }
+
+    /// Parameters derived from the host for the scalar type T and problems
+    /// of size n
+    template <typename T>
+    inline host_defaults_t host_defaults(std::size_t n)
+    {
+        return host_defaults(host(), sizeof(T), n);
+    }
+
+    /**
+     * Value of param of routine derived by the analytical model, for
+     * scalars of elem_size bytes and problems of size n. Returns false if
+     * the model does not cover the parameter.
+     */
+    inline bool host_model(const char *routine, const char *param, std::size_t elem_size, std::size_t n, std::size_t &value)
+    {
+        const host_defaults_t d = host_defaults(host(), elem_size, n);
+        const auto is = [&](const char *r, const char *p) {
+            return std::strcmp(routine, r) == 0 && std::strcmp(param, p) == 0;
+        };
+        if (is("potrf", "nb"))
+            value = d.potrf_nb;
+        else if (is("gehrd", "nb"))
+            value = d.gehrd_nb;
+        else if (is("gemm", "mc"))
+            value = d.gemm_mc;
+        else if (is("gemm", "kc"))
+            value = d.gemm_kc;
+        else if (is("gemm", "nc"))
+            value = d.gemm_nc;
+        else if (is("transpose", "nx"))
+            value = d.transpose_nx;
+        else if (is("lauum", "nx"))
+            value = d.lauum_nx;
+        else if (is("trtri", "nx"))
+            value = d.trtri_nx;
+        else
+            return false;
+        return true;
+    }
+
+    /// Prints the probed host and the derived parameters, e.g., for a log
+    inline void print_host_info(std::ostream &out, std::size_t n = 1000)
+    {
+        const host_info &h = host();
+        out << "host: L1d=" << h.l1d / 1024 << "K L2=" << h.l2 / 1024 << "K L3=" << h.l3 / 1024
+            << "K line=" << h.cache_line << " cores=" << h.cores << " simd=" << 8 * h.simd_width
+            << "bit (" << h.source << ")" << std::endl;
+        const char *names[] = {"s", "d", "c", "z"};
+        const std::size_t sizes[] = {4, 8, 8, 16};
+        for (int i = 0; i < 4; ++i)
+        {
+            const host_defaults_t d = host_defaults(h, sizes[i], n);
+            out << names[i] << " (n=" << n << "): potrf.nb=" << d.potrf_nb << " gehrd.nb=" << d.gehrd_nb
+                << " gemm.mc=" << d.gemm_mc << " gemm.kc=" << d.gemm_kc << " gemm.nc=" << d.gemm_nc
+                << " transpose.nx=" << d.transpose_nx << " lauum.nx=" << d.lauum_nx
+                << " trtri.nx=" << d.trtri_nx << std::endl;
+        }
+    }
+
+} // namespace tlapack
+
+#endif // __TLAPACK_HOST_HH__
@@ -0,0 +1,104 @@
+// Copyright (c) 2022, University of Colorado Denver. All rights reserved.
+//
+// This file is part of <T>LAPACK.
+// <T>LAPACK is free software: you can redistribute it and/or modify it under
+// the terms of the BSD 3-Clause license. See the accompanying LICENSE file.
+
+#ifndef __TLAPACK_PARALLEL_HH__
+#define __TLAPACK_PARALLEL_HH__
+
+#ifdef _OPENMP
+    #include <omp.h>
+#endif
+
+// -----------------------------------------------------------------------------
+// Macros for the OpenMP directives used in <T>LAPACK
+//
+// The directives expand to nothing if the code is not compiled with OpenMP
+// support. This way the parallel code paths are also the sequential ones and
+// no -Wunknown-pragmas warning is generated.
+
+#define TLAPACK_STRINGIFY( x ) #x
+
+#ifdef _OPENMP
+    /**
+     * @brief OpenMP directive.
+     *
+     * ex: TLAPACK_OMP( parallel for if(nt > 1) ) expands to
+     *     #pragma omp parallel for if(nt > 1)
+     */
+    #define TLAPACK_OMP( directive ) _Pragma( TLAPACK_STRINGIFY( omp directive ) )
+#else
+    #define TLAPACK_OMP( directive )
+#endif
+
+namespace tlapack {
+
+    /**
+     * @return The maximum number of threads available for a parallel region,
+     *  or 1 if <T>LAPACK is not compiled with OpenMP.
+     *
+     * @ingroup utils
+     */
+    inline int get_max_threads() {
+        #ifdef _OPENMP
+            return omp_get_max_threads();
+        #else
+            return 1;
+        #endif
+    }
+
+    /**
+     * @return The number of threads in the current team,
+     *  or 1 if <T>LAPACK is not compiled with OpenMP.
+     *
+     * @ingroup utils
+     */
+    inline int get_num_threads() {
+        #ifdef _OPENMP
+            return omp_get_num_threads();
+        #else
+            return 1;
+        #endif
+    }
+
+    /**
+     * @return true if called from inside an active parallel region.
+     *
+     * @ingroup utils
+     */
+    inline bool in_parallel() {
+        #ifdef _OPENMP
+            return omp_in_parallel();
+        #else
+            return false;
+        #endif
+    }
+
+    namespace internal {
+
+        /**
+         * Runs f, which creates OpenMP tasks, and waits for the tasks.
+         * Starts a parallel region if it is not called from one.
+         */
+        template< class f_t >
+        void run_tasks( const f_t& f )
+        {
+            if( in_parallel() ) {
+                f();
+                TLAPACK_OMP(taskwait)
+            }
+            else {
+                TLAPACK_OMP(parallel)
+                TLAPACK_OMP(single)
+                {
+                    f();
+                }
+            }
+        }
+
+    } // namespace internal
+
+} // namespace tlapack
+
+#endif // __TLAPACK_PARALLEL_HH__
@@ -0,0 +1,388 @@
+// Copyright (c) 2022, University of Colorado Denver. All rights reserved.
+//
+// This file is part of <T>LAPACK.
+// <T>LAPACK is free software: you can redistribute it and/or modify it under
+// the terms of the BSD 3-Clause license. See the accompanying LICENSE file.
+
+#ifndef __TLAPACK_PROFILE_HH__
+#define __TLAPACK_PROFILE_HH__
+
+#include <algorithm>
+#include <chrono>
+#include <cstddef>
+#include <cstring>
+#include <iomanip>
+#include <map>
+#include <memory>
+#include <mutex>
+#include <ostream>
+#include <string>
+#include <vector>
+
+#include "base/utils.hpp"
+#include "base/trace.hpp"
+
+// -----------------------------------------------------------------------------
+// Instrumentation of the <T>LAPACK routines
+//
+// If TLAPACK_PROFILE is defined, every BLAS and LAPACK template records its
+// calls in the collector of the calling thread. If TLAPACK_TRACE is defined,
+// every call is also recorded as an event of the timeline, see
+// base/trace.hpp. Otherwise, TLAPACK_PROFILE_SCOPE expands to nothing and
+// its arguments are not evaluated.
+
+#ifdef TLAPACK_PROFILE
+    #define TLAPACK_PROFILE_SCOPE_STATS_( name, T, flops, elements ) \
+        tlapack::profile_scope tlapack_profile_scope_( \
+            name, \
+            tlapack::profile_flops< T >( flops ), \
+            double( elements ) * sizeof( T ) );
+#else
+    #define TLAPACK_PROFILE_SCOPE_STATS_( name, T, flops, elements )
+#endif
+
+#ifdef TLAPACK_TRACE
+    #define TLAPACK_PROFILE_SCOPE_TRACE_( name, T, flops, elements ) \
+        tlapack::trace_scope tlapack_profile_trace_( \
+            name, \
+            tlapack::trace_arg( "flops", tlapack::profile_flops< T >( flops ) ) )
+#else
+    #define TLAPACK_PROFILE_SCOPE_TRACE_( name, T, flops, elements )
+#endif
+
+/**
+ * @brief Records the call of a routine until the end of the scope.
+ *
+ * @param name  Name of the routine, a string literal.
+ * @param T     Scalar type of the data.
+ * @param flops Nominal number of real floating-point operations.
+ *      Operations on complex data count 4 times as much.
+ * @param elements Nominal number of elements of type T read or written.
+ */
+#define TLAPACK_PROFILE_SCOPE( name, T, flops, elements ) \
+    TLAPACK_PROFILE_SCOPE_STATS_( name, T, flops, elements ) \
+    TLAPACK_PROFILE_SCOPE_TRACE_( name, T, flops, elements )
+
+namespace tlapack {
+
+    /**
+     * @brief Statistics of one routine.
+     *
+     * @ingroup utils
+     */
+    struct profile_entry {
+        std::string name;           ///< Name of the routine
+        std::size_t calls = 0;      ///< Number of calls
+        double flops = 0;           ///< Nominal floating-point operations
+        double bytes = 0;           ///< Nominal bytes read or written
+        double time = 0;            ///< Wall time in seconds, including nested calls
+        double self_time = 0;       ///< Wall time in seconds, excluding nested calls
+        std::size_t max_depth = 0;  ///< Deepest nesting level of a call, 0 for top-level calls
+    };
+
+    /**
+     * @brief Collector of the statistics of the calling thread.
+     *
+     * Each thread records its calls in its own collector, so recording
+     * does not synchronize threads. Use profile_report() to merge the
+     * statistics of all threads.
+     *
+     * All storage is allocated by the constructor, so recording does not
+     * allocate memory. Routines that do not fit in the max_routines slots
+     * are recorded under the name "(other)".
+     *
+     * @ingroup utils
+     */
+    class profile_collector {
+    public:
+
+        /// Maximum number of distinct routines recorded
+        static constexpr std::size_t max_routines = 256;
+
+        /// Maximum nesting depth recorded. Deeper calls are not recorded.
+        static constexpr std::size_t max_nesting = 64;
+
+        profile_collector()
+        {
+            entries_.resize( max_routines );
+            stack_.resize( max_nesting );
+        }
+
+        /// Starts the call of a routine
+        void enter( const char* name, double flops, double bytes )
+        {
+            if( depth_ < max_nesting ) {
+                frame& f = stack_[ depth_ ];
+                f.entry = find( name );
+                f.flops = flops;
+                f.bytes = bytes;
+                f.child_time = 0;
+                f.start = clock::now();
+            }
+            ++depth_;
+        }
+
+        /// Finishes the last routine started with enter()
+        void leave()
+        {
+            --depth_;
+            if( depth_ >= max_nesting ) return;
+
+            const frame& f = stack_[ depth_ ];
+            const double t = std::chrono::duration<double>( clock::now() - f.start ).count();
+            if( depth_ > 0 )
+                stack_[ depth_ - 1 ].child_time += t;
+
+            std::lock_guard<std::mutex> lock( mutex_ );
+            entry& e = entries_[ f.entry ];
+            e.calls += 1;
+            e.flops += f.flops;
+            e.bytes += f.bytes;
+            e.time += t;
+            e.self_time += t - f.child_time;
+            e.max_depth = std::max( e.max_depth, depth_ );
+        }
+
+        /// Statistics recorded so far
+        std::vector<profile_entry> entries() const
+        {
+            std::lock_guard<std::mutex> lock( mutex_ );
+            std::vector<profile_entry> r( n_entries_ );
+            for( std::size_t i = 0; i < n_entries_; ++i ) {
+                const entry& e = entries_[i];
+                r[i].name = e.name;
+                r[i].calls = e.calls;
+                r[i].flops = e.flops;
+                r[i].bytes = e.bytes;
+                r[i].time = e.time;
+                r[i].self_time = e.self_time;
+                r[i].max_depth = e.max_depth;
+            }
+            return r;
+        }
+
+        /// Clears the statistics. Calls in progress are still recorded.
+        void reset()
+        {
+            std::lock_guard<std::mutex> lock( mutex_ );
+            for( std::size_t i = 0; i < n_entries_; ++i ) {
+                const char* name = entries_[i].name;
+                entries_[i] = entry();
+                entries_[i].name = name;
+            }
+        }
+
+    private:
+
+        using clock = std::chrono::steady_clock;
+
+        struct entry {
+            const char* name = nullptr;
+            std::size_t calls = 0;
+            double flops = 0;
+            double bytes = 0;
+            double time = 0;
+            double self_time = 0;
+            std::size_t max_depth = 0;
+        };
+
+        struct frame {
+            std::size_t entry;
+            double flops;
+            double bytes;
+            double child_time;
+            clock::time_point start;
+        };
+
+        std::size_t find( const char* name )
+        {
+            // The same literal may have different addresses in different
+            // translation units, so compare the addresses first and then
+            // the contents
+            for( std::size_t i = 0; i < n_entries_; ++i )
+                if( entries_[i].name == name )
+                    return i;
+            for( std::size_t i = 0; i < n_entries_; ++i )
+                if( std::strcmp( entries_[i].name, name ) == 0 )
+                    return i;
+
+            std::lock_guard<std::mutex> lock( mutex_ );
+            if( n_entries_ == max_routines )
+                return max_routines - 1;
+            entries_[ n_entries_ ].name = ( n_entries_ == max_routines - 1 ) ? "(other)" : name;
+            return n_entries_++;
+        }
+
+        std::vector<entry> entries_;
+        std::size_t n_entries_ = 0;
+        std::vector<frame> stack_;
+        std::size_t depth_ = 0;
+        mutable std::mutex mutex_;
+    };
+
+    namespace internal {
+
+        /// Collectors of all threads that recorded calls
+        struct profile_registry {
+            std::mutex mutex;
+            std::vector< std::shared_ptr<profile_collector> > collectors;
+        };
+
+        inline profile_registry& get_profile_registry()
+        {
+            static profile_registry registry;
+            return registry;
+        }
+
+    } // namespace internal
+
+    /**
+     * @return The collector of the calling thread.
+     *      The collector is created on the first call in each thread and
+     *      outlives the thread, so the statistics of finished threads are
+     *      still in the report.
+     *
+     * @ingroup utils
+     */
+    inline profile_collector& thread_profile()
+    {
+        static thread_local std::shared_ptr<profile_collector> collector = []() {
+            auto c = std::make_shared<profile_collector>();
+            auto& registry = internal::get_profile_registry();
+            std::lock_guard<std::mutex> lock( registry.mutex );
+            registry.collectors.push_back( c );
+            return c;
+        }();
+        return *collector;
+    }
+
+    /**
+     * @return The statistics of all threads merged by routine, sorted by
+     *      decreasing self time.
+     *
+     * @ingroup utils
+     */
+    inline std::vector<profile_entry> profile_report()
+    {
+        std::map<std::string, profile_entry> merged;
+        {
+            auto& registry = internal::get_profile_registry();
+            std::lock_guard<std::mutex> lock( registry.mutex );
+            for( const auto& c : registry.collectors ) {
+                for( const auto& e : c->entries() ) {
+                    profile_entry& m = merged[ e.name ];
+                    m.name = e.name;
+                    m.calls += e.calls;
+                    m.flops += e.flops;
+                    m.bytes += e.bytes;
+                    m.time += e.time;
+                    m.self_time += e.self_time;
+                    m.max_depth = std::max( m.max_depth, e.max_depth );
+                }
+            }
+        }
+
+        std::vector<profile_entry> report;
+        for( auto& kv : merged )
+            if( kv.second.calls > 0 )
+                report.push_back( kv.second );
+        std::stable_sort( report.begin(), report.end(),
+            []( const profile_entry& a, const profile_entry& b ) {
+                return a.self_time > b.self_time;
+            } );
+        return report;
+    }
+
+    /**
+     * @brief Clears the statistics of all threads.
+     *
+     * @ingroup utils
+     */
+    inline void reset_profile()
+    {
+        auto& registry = internal::get_profile_registry();
+        std::lock_guard<std::mutex> lock( registry.mutex );
+        for( const auto& c : registry.collectors )
+            c->reset();
+    }
+
+    /**
+     * @brief Writes a table with the statistics of all threads.
+     *
+     * The rates are computed with the time including nested calls.
+     * The report is empty if TLAPACK_PROFILE is not defined.
+     *
+     * @ingroup utils
+     */
+    inline void print_profile( std::ostream& out )
+    {
+        const auto report = profile_report();
+        const auto flags = out.flags();
+        const auto precision = out.precision();
+
+        out << std::left << std::setw(28) << "routine" << std::right
+            << std::setw(12) << "calls"
+            << std::setw(12) << "time (s)"
+            << std::setw(12) << "self (s)"
+            << std::setw(12) << "GFLOP/s"
+            << std::setw(12) << "GB/s"
+            << std::setw(7) << "depth" << "\n";
+        out << std::fixed;
+        for( const auto& e : report ) {
+            out << std::left << std::setw(28) << e.name << std::right
+                << std::setw(12) << e.calls
+                << std::setprecision(6)
+                << std::setw(12) << e.time
+                << std::setw(12) << e.self_time
+                << std::setprecision(3)
+                << std::setw(12) << ( (e.time > 0) ? 1e-9 * e.flops / e.time : 0.0 )
+                << std::setw(12) << ( (e.time > 0) ? 1e-9 * e.bytes / e.time : 0.0 )
+                << std::setw(7) << e.max_depth << "\n";
+        }
+
+        out.flags( flags );
+        out.precision( precision );
+    }
+
+    /**
+     * @return Nominal number of real floating-point operations for data
+     *      of type T. Operations on complex data count 4 times as much as
+     *      the ones on real data, as in LAWN 41.
+     *
+     * @ingroup utils
+     */
+    template< class T >
+    inline constexpr double profile_flops( double flops ) noexcept
+    {
+        return ( is_complex<T>::value ) ? 4 * flops : flops;
+    }
+
+    /**
+     * @brief Records the call of a routine in the collector of the calling
+     *      thread from construction to destruction.
+     *
+     * @see TLAPACK_PROFILE_SCOPE
+     *
+     * @ingroup utils
+     */
+    class profile_scope {
+    public:
+
+        profile_scope( const char* name, double flops, double bytes )
+            : collector_( thread_profile() )
+        {
+            collector_.enter( name, flops, bytes );
+        }
+
+        ~profile_scope() { collector_.leave(); }
+
+        profile_scope( const profile_scope& ) = delete;
+        profile_scope& operator=( const profile_scope& ) = delete;
+
+    private:
+        profile_collector& collector_;
+    };
+
+} // namespace tlapack
+
+#endif // __TLAPACK_PROFILE_HH__
@@ -0,0 +1,308 @@
+// Copyright (c) 2022, University of Colorado Denver. All rights reserved.
+//
+// This file is part of <T>LAPACK.
+// <T>LAPACK is free software: you can redistribute it and/or modify it under
+// the terms of the BSD 3-Clause license. See the accompanying LICENSE file.
+
+#ifndef __TLAPACK_TRACE_HH__
+#define __TLAPACK_TRACE_HH__
+
+#include <atomic>
+#include <chrono>
+#include <cstddef>
+#include <cstdint>
+#include <fstream>
+#include <memory>
+#include <mutex>
+#include <ostream>
+#include <string>
+#include <vector>
+
+// -----------------------------------------------------------------------------
+// Timeline of the <T>LAPACK routines
+//
+// If TLAPACK_TRACE is defined, the major phases of the algorithms, e.g., the
+// iterations of multishift_qr and the panels of gehrd, and all calls to
+// routines instrumented with TLAPACK_PROFILE_SCOPE are recorded as events in
+// a ring buffer of the calling thread. write_chrome_trace() exports them in
+// the Chrome trace format, which can be loaded in Perfetto or
+// chrome://tracing. Otherwise, TLAPACK_TRACE_SCOPE expands to nothing and its
+// arguments are not evaluated.
+
+#define TLAPACK_TRACE_CONCAT_( a, b ) a ## b
+#define TLAPACK_TRACE_NAME_( line ) TLAPACK_TRACE_CONCAT_( tlapack_trace_scope_, line )
+
+#ifdef TLAPACK_TRACE
+    /**
+     * @brief Records an event from this point until the end of the scope.
+     *
+     * Usage: TLAPACK_TRACE_SCOPE( "name", trace_arg("m", m), ... ) with at
+     * most trace_event::max_args arguments.
+     */
+    #define TLAPACK_TRACE_SCOPE( ... ) \
+        tlapack::trace_scope TLAPACK_TRACE_NAME_( __LINE__ )( __VA_ARGS__ )
+#else
+    #define TLAPACK_TRACE_SCOPE( ... )
+#endif
+
+namespace tlapack {
+
+    /**
+     * @brief Integer argument of a trace event, e.g., a dimension.
+     *
+     * @ingroup utils
+     */
+    struct trace_arg {
+        const char* key = nullptr;  ///< Name of the argument, a string literal
+        std::int64_t value = 0;     ///< Value of the argument
+
+        constexpr trace_arg() noexcept = default;
+
+        template< class int_t >
+        constexpr trace_arg( const char* key, int_t value ) noexcept
+            : key( key ), value( static_cast<std::int64_t>( value ) ) { }
+    };
+
+    /**
+     * @brief Complete event of the timeline.
+     *
+     * @ingroup utils
+     */
+    struct trace_event {
+        static constexpr std::size_t max_args = 4;
+
+        const char* name = nullptr;     ///< Name of the event, a string literal
+        double start = 0;               ///< Start time in microseconds
+        double duration = 0;            ///< Duration in microseconds
+        trace_arg args[ max_args ];     ///< Arguments, the unused ones have key nullptr
+    };
+
+    /**
+     * @brief Ring buffer of the events of one thread.
+     *
+     * Only the owner thread writes to the buffer. Writing is lock-free:
+     * the event is stored in the next slot and the head is advanced with a
+     * release store. When the buffer is full, the oldest events are
+     * overwritten. All storage is allocated by the constructor.
+     *
+     * @ingroup utils
+     */
+    class trace_buffer {
+    public:
+
+        /// Number of events kept per thread
+        static constexpr std::size_t capacity = std::size_t(1) << 16;
+
+        explicit trace_buffer( std::size_t tid )
+            : events_( capacity ), tid_( tid ) { }
+
+        /// Appends an event. Only called by the owner thread.
+        void push( const trace_event& e ) noexcept
+        {
+            const std::uint64_t h = head_.load( std::memory_order_relaxed );
+            events_[ h % capacity ] = e;
+            head_.store( h + 1, std::memory_order_release );
+        }
+
+        /**
+         * @return Copy of the events in chronological order of their end.
+         *      Events written while copying may be torn, so call it when
+         *      no traced routine is running.
+         */
+        std::vector<trace_event> events() const
+        {
+            const std::uint64_t h = head_.load( std::memory_order_acquire );
+            const std::uint64_t first = ( h > capacity ) ? h - capacity : 0;
+            std::vector<trace_event> r;
+            r.reserve( h - first );
+            for( std::uint64_t i = first; i < h; ++i )
+                r.push_back( events_[ i % capacity ] );
+            return r;
+        }
+
+        /// Number of events lost because the buffer was full
+        std::uint64_t dropped() const noexcept
+        {
+            const std::uint64_t h = head_.load( std::memory_order_acquire );
+            return ( h > capacity ) ? h - capacity : 0;
+        }
+
+        /// Discards all events
+        void clear() noexcept { head_.store( 0, std::memory_order_release ); }
+
+        /// Identifier of the owner thread in the trace
+        std::size_t tid() const noexcept { return tid_; }
+
+    private:
+        std::vector<trace_event> events_;
+        std::atomic<std::uint64_t> head_{ 0 };
+        std::size_t tid_;
+    };
+
+    namespace internal {
+
+        /// Buffers of all threads that recorded events
+        struct trace_registry {
+            std::mutex mutex;
+            std::vector< std::shared_ptr<trace_buffer> > buffers;
+            const std::chrono::steady_clock::time_point epoch = std::chrono::steady_clock::now();
+        };
+
+        inline trace_registry& get_trace_registry()
+        {
+            static trace_registry registry;
+            return registry;
+        }
+
+        /// Microseconds since the creation of the registry
+        inline double trace_now()
+        {
+            return std::chrono::duration<double, std::micro>(
+                std::chrono::steady_clock::now() - get_trace_registry().epoch ).count();
+        }
+
+    } // namespace internal
+
+    /**
+     * @return The ring buffer of the calling thread.
+     *      The buffer is created on the first call in each thread and
+     *      outlives the thread, so the events of finished threads are still
+     *      exported.
+     *
+     * @ingroup utils
+     */
+    inline trace_buffer& thread_trace()
+    {
+        static thread_local std::shared_ptr<trace_buffer> buffer = []() {
+            auto& registry = internal::get_trace_registry();
+            std::lock_guard<std::mutex> lock( registry.mutex );
+            auto b = std::make_shared<trace_buffer>( registry.buffers.size() + 1 );
+            registry.buffers.push_back( b );
+            return b;
+        }();
+        return *buffer;
+    }
+
+    /**
+     * @brief Discards the events of all threads.
+     *
+     * @ingroup utils
+     */
+    inline void clear_trace()
+    {
+        auto& registry = internal::get_trace_registry();
+        std::lock_guard<std::mutex> lock( registry.mutex );
+        for( const auto& b : registry.buffers )
+            b->clear();
+    }
+
+    /**
+     * @brief Writes the events of all threads in the Chrome trace format.
+     *
+     * The output is a JSON object with one complete event ("ph": "X") per
+     * record. It can be loaded in Perfetto (ui.perfetto.dev) or
+     * chrome://tracing. If TLAPACK_TRACE is not defined, the list of events
+     * is empty.
+     *
+     * @ingroup utils
+     */
+    inline void write_chrome_trace( std::ostream& out )
+    {
+        auto& registry = internal::get_trace_registry();
+        std::lock_guard<std::mutex> lock( registry.mutex );
+
+        const auto flags = out.flags();
+        const auto precision = out.precision();
+        out << std::fixed;
+        out.precision( 3 );
+
+        out << "{\"traceEvents\":[";
+        bool first = true;
+        for( const auto& b : registry.buffers ) {
+            out << ( first ? "\n" : ",\n" );
+            first = false;
+            out << "{\"name\":\"thread_name\",\"ph\":\"M\",\"pid\":1,\"tid\":" << b->tid()
+                << ",\"args\":{\"name\":\"thread " << b->tid() << "\"}}";
+            for( const auto& e : b->events() ) {
+                out << ",\n{\"name\":\"" << e.name << "\",\"cat\":\"tlapack\",\"ph\":\"X\""
+                    << ",\"ts\":" << e.start << ",\"dur\":" << e.duration
+                    << ",\"pid\":1,\"tid\":" << b->tid() << ",\"args\":{";
+                for( std::size_t i = 0; i < trace_event::max_args && e.args[i].key; ++i )
+                    out << ( i > 0 ? "," : "" )
+                        << "\"" << e.args[i].key << "\":" << e.args[i].value;
+                out << "}}";
+            }
+        }
+        out << "\n],\"displayTimeUnit\":\"ns\"}\n";
+
+        out.flags( flags );
+        out.precision( precision );
+    }
+
+    /**
+     * @brief Writes the events of all threads to a file in the Chrome trace
+     *      format.
+     *
+     * @return true if the file was written.
+     *
+     * @see write_chrome_trace( std::ostream& )
+     *
+     * @ingroup utils
+     */
+    inline bool write_chrome_trace( const std::string& filename )
+    {
+        std::ofstream out( filename );
+        if( !out ) return false;
+        write_chrome_trace( out );
+        return bool( out );
+    }
+
+    /**
+     * @brief Records an event in the ring buffer of the calling thread from
+     *      construction to destruction.
+     *
+     * @see TLAPACK_TRACE_SCOPE
+     *
+     * @ingroup utils
+     */
+    class trace_scope {
+    public:
+
+        template< class... args_t >
+        explicit trace_scope( const char* name, const args_t&... args )
+            : buffer_( thread_trace() )
+        {
+            static_assert( sizeof...(args) <= trace_event::max_args,
+                "Too many arguments for a trace event" );
+            event_.name = name;
+            set_args( 0, args... );
+            event_.start = internal::trace_now();
+        }
+
+        ~trace_scope()
+        {
+            event_.duration = internal::trace_now() - event_.start;
+            buffer_.push( event_ );
+        }
+
+        trace_scope( const trace_scope& ) = delete;
+        trace_scope& operator=( const trace_scope& ) = delete;
+
+    private:
+
+        void set_args( std::size_t ) noexcept { }
+
+        template< class... args_t >
+        void set_args( std::size_t i, const trace_arg& a, const args_t&... args ) noexcept
+        {
+            event_.args[i] = a;
+            set_args( i + 1, args... );
+        }
+
+        trace_buffer& buffer_;
+        trace_event event_;
+    };
+
+} // namespace tlapack
+
+#endif // __TLAPACK_TRACE_HH__
@@ -0,0 +1,269 @@
+/// @file tuning.hpp
+/// @brief Tuned defaults of the options of the blocked algorithms
+//
+// Copyright (c) 2022, University of Colorado Denver. All rights reserved.
+//
+// This file is part of <T>LAPACK.
+// <T>LAPACK is free software: you can redistribute it and/or modify it under
+// the terms of the BSD 3-Clause license. See the accompanying LICENSE file.
+
+#ifndef __TLAPACK_TUNING_HH__
+#define __TLAPACK_TUNING_HH__
+
+#include <complex>
+#include <cstdint>
+#include <cstdlib>
+#include <cstring>
+#include <fstream>
+#include <istream>
+#include <ostream>
+#include <sstream>
+#include <string>
+#include <type_traits>
+#include <vector>
+
+#include "base/exceptionHandling.hpp"
+#include "base/host.hpp"
+
+namespace tlapack {
+
+    /// Tag of the constructor of tunable that sets the built-in default
+    struct tuning_default_t {};
+    constexpr tuning_default_t tuning_default = {};
+
+    /**
+     * @brief Parameter of an options struct whose default value may be
+     * replaced by a tuned value.
+     *
+     * A tunable converts to its value and remembers whether it was set by
+     * the user, e.g., opts.nb = 64. The routines use tuned() to get the
+     * value of the parameter: a value set by the user is always used as is.
+     * Otherwise, the value in the tuning table for the routine, the scalar
+     * type and the problem size is used, then the value derived from the
+     * caches of the host (see host_model()), and then the built-in default.
+     */
+    template <typename idx_t>
+    class tunable {
+    public:
+        /// Value set by the user
+        constexpr tunable(idx_t value) noexcept : value_(value), is_set_(true) {}
+
+        /// Built-in default
+        constexpr tunable(tuning_default_t, idx_t value) noexcept : value_(value), is_set_(false) {}
+
+        constexpr operator idx_t() const noexcept { return value_; }
+
+        /// True if the value was set by the user
+        constexpr bool is_set() const noexcept { return is_set_; }
+
+    private:
+        idx_t value_;
+        bool is_set_;
+    };
+
+    /// Character that identifies a scalar type in the tuning table, '*' for
+    /// types other than the four BLAS types
+    template <typename T> constexpr char tuning_type() noexcept { return '*'; }
+    template <> constexpr char tuning_type<float>() noexcept { return 's'; }
+    template <> constexpr char tuning_type<double>() noexcept { return 'd'; }
+    template <> constexpr char tuning_type<std::complex<float>>() noexcept { return 'c'; }
+    template <> constexpr char tuning_type<std::complex<double>>() noexcept { return 'z'; }
+
+    /// Entry of the tuning table
+    struct tuning_entry {
+        std::string routine;    ///< Routine, e.g., potrf
+        std::string param;      ///< Parameter, e.g., nb
+        char type;              ///< Scalar type, see tuning_type(), '*' for any type
+        std::size_t n_max;      ///< Largest problem size the entry applies to
+        std::size_t value;      ///< Value of the parameter
+    };
+
+    /**
+     * @brief Tuned values of the parameters of the routines.
+     *
+     * The values are given per routine, parameter, scalar type and size
+     * bucket. An entry with n_max applies to the problem sizes n <= n_max
+     * not covered by an entry with a smaller n_max. Entries of a specific
+     * scalar type have precedence over the entries of type '*'.
+     *
+     * The text format of the table has one entry per line,
+     *
+     *      # routine     param   type  n_max  value
+     *      potrf         nb      d     256    32
+     *      potrf         nb      d     inf    64
+     *
+     * where n_max = inf covers all sizes. Lines that start with # are
+     * comments.
+     *
+     * lookup() does not allocate memory and may run concurrently in several
+     * threads. The other member functions modify the table and must not run
+     * concurrently with any routine of <T>LAPACK.
+     */
+    class tuning_table {
+    public:
+        /// Value of n_max that covers all problem sizes
+        static constexpr std::size_t inf = SIZE_MAX;
+
+        /**
+         * Finds the value of param for routine, scalar type and problem
+         * size n. Returns false if the table has no entry for it.
+         */
+        bool lookup(const char *routine, const char *param, char type, std::size_t n, std::size_t &value) const noexcept
+        {
+            const tuning_entry *best = nullptr;
+            for (const auto &e : entries_)
+            {
+                if (n > e.n_max || (e.type != type && e.type != '*') ||
+                    std::strcmp(e.routine.c_str(), routine) != 0 || std::strcmp(e.param.c_str(), param) != 0)
+                    continue;
+                if (!best || (e.type != '*' && best->type == '*') ||
+                    (e.type == best->type && e.n_max < best->n_max))
+                    best = &e;
+            }
+            if (best)
+                value = best->value;
+            return best != nullptr;
+        }
+
+        /// Adds an entry, or replaces the value of an existing one
+        void set(const std::string &routine, const std::string &param, char type, std::size_t n_max, std::size_t value)
+        {
+            for (auto &e : entries_)
+                if (e.routine == routine && e.param == param && e.type == type && e.n_max == n_max)
+                {
+                    e.value = value;
+                    return;
+                }
+            entries_.push_back({routine, param, type, n_max, value});
+        }
+
+        /// Removes all entries
+        void clear() noexcept { entries_.clear(); }
+
+        const std::vector<tuning_entry> &entries() const noexcept { return entries_; }
+
+        /**
+         * Adds the entries in the text format of the class. Returns false
+         * if a line could not be read; the other lines are still added.
+         */
+        bool read(std::istream &in)
+        {
+            bool ok = true;
+            std::string line;
+            while (std::getline(in, line))
+            {
+                std::istringstream ss(line);
+                std::string routine, param, type, n_max;
+                std::size_t value;
+                if (!(ss >> routine) || routine[0] == '#')
+                    continue;
+                if (!(ss >> param >> type >> n_max >> value) || type.size() != 1)
+                {
+                    ok = false;
+                    continue;
+                }
+                set(routine, param, type[0], (n_max == "inf") ? inf : std::strtoull(n_max.c_str(), nullptr, 10), value);
+            }
+            return ok;
+        }
+
+        /// Adds the entries of a file. Returns false if it cannot be read.
+        bool load(const char *filename)
+        {
+            std::ifstream file(filename);
+            return file && read(file);
+        }
+
+        /// Writes the entries in the text format of the class
+        void write(std::ostream &out) const
+        {
+            out << "# routine param type n_max value\n";
+            for (const auto &e : entries_)
+            {
+                out << e.routine << " " << e.param << " " << e.type << " ";
+                if (e.n_max == inf)
+                    out << "inf";
+                else
+                    out << e.n_max;
+                out << " " << e.value << "\n";
+            }
+        }
+
+    private:
+        std::vector<tuning_entry> entries_;
+    };
+
+    /**
+     * @brief Tuning table used by the routines of <T>LAPACK.
+     *
+     * On first use, the table is loaded from the file named by the
+     * environment variable TLAPACK_TUNING_FILE or, if it is not set, from
+     * the file given by the macro TLAPACK_TUNING_FILE at compile time. The
+     * table is empty if there is no such file. A file that cannot be read
+     * is reported by tlapack_warning().
+     */
+    inline tuning_table &tuning()
+    {
+        static tuning_table table = []() {
+            tuning_table t;
+            const char *filename = std::getenv("TLAPACK_TUNING_FILE");
+#ifdef TLAPACK_TUNING_FILE
+            if (!filename)
+                filename = TLAPACK_TUNING_FILE;
+#endif
+            if (filename && *filename && !t.load(filename))
+                tlapack_warning(1, std::string("Could not read the tuning file ") + filename);
+            return t;
+        }();
+        return table;
+    }
+
+    /**
+     * Replaces the tuning table by the contents of a file. Returns false if
+     * it cannot be read.
+     */
+    inline bool load_tuning(const char *filename)
+    {
+        tuning().clear();
+        return tuning().load(filename);
+    }
+
+    /**
+     * @brief Value of a parameter of routine for the scalar type T and the
+     * problem size n.
+     *
+     * @return The value set by the user, if any, otherwise the value in the
+     *      tuning table, otherwise the value of the analytical model of the
+     *      host, otherwise the built-in default. The analytical model is not
+     *      used if TLAPACK_NO_HOST_MODEL is defined.
+     *
+     * Not noexcept: the first call loads the tuning table, which may
+     * allocate memory.
+     */
+    template <typename T, typename idx_t>
+    inline idx_t tuned(const tunable<idx_t> &p, const char *routine, const char *param, std::size_t n)
+    {
+        if (p.is_set())
+            return p;
+        std::size_t value;
+        if (tuning().lookup(routine, param, tuning_type<T>(), n, value))
+            return idx_t(value);
+#ifndef TLAPACK_NO_HOST_MODEL
+        if (host_model(routine, param, sizeof(T), n, value))
+            return idx_t(value);
+#endif
+        return p;
+    }
+
+    /// Parameters that are not tunable, e.g., of user-defined option
+    /// structs, are used as they are
+    template <typename T, typename param_t,
+              typename std::enable_if<std::is_arithmetic<param_t>::value, int>::type = 0>
+    inline param_t tuned(const param_t &p, const char *, const char *, std::size_t) noexcept
+    {
+        return p;
+    }
+
+} // namespace tlapack
+
+#endif // __TLAPACK_TUNING_HH__
@@ -731,6 +731,76 @@ using disable_if_allow_optblas_t = enable_if_t<(
     ! allow_optblas_v< T1, Ts... >
 ), int >;
 
+namespace internal {
+
+    /**
+     * @brief Trait to determine if a given list of data allows optimization
+     * using a optimized BLAS library, where the matrices may have different
+     * layouts. The wrappers see a matrix stored in the other layout as its
+     * transpose.
+     *
+     * A matrix whose layout is only known at run time, i.e., such that
+     * legacy_matrix() exists and layout<> is Layout::Unspecified, is also
+     * allowed. The wrappers check its layout before calling the optimized
+     * BLAS.
+     */
+    template<class...>
+    struct allow_optblas_mixed {
+        static constexpr bool value = false;
+    };
+
+    template<class P>
+    struct allow_optblas_mixed<P> {
+        static constexpr bool value = allow_optblas_v<P>;
+    };
+
+    template< class matrix_t, class = int >
+    struct has_runtime_layout : std::false_type { };
+
+    template< class matrix_t >
+    struct has_runtime_layout< matrix_t,
+        enable_if_t<
+            is_matrix< matrix_t > &&
+            !is_same_v<
+                decltype( legacy_matrix( std::declval<matrix_t>() ) )
+            , void >
+        , int >
+    > {
+        static constexpr bool value = ( layout<matrix_t> == Layout::Unspecified );
+    };
+
+    template<class C, class T>
+    struct allow_optblas_mixed< pair<C,T> > {
+        static constexpr bool value =
+            allow_optblas_v< pair<C,T> > || (
+                has_runtime_layout<C>::value &&
+                allow_optblas_v<T> &&
+                is_same_v< type_t<C>, typename std::decay<T>::type >
+            );
+    };
+
+    template<class P1, class P2, class... Ps>
+    struct allow_optblas_mixed<P1, P2, Ps...> {
+        static constexpr bool value =
+            allow_optblas_mixed<P1>::value &&
+            allow_optblas_mixed<P2, Ps...>::value;
+    };
+}
+
+/// Alias for @c allow_optblas_mixed<>::value.
+template<class... Ts>
+constexpr bool allow_optblas_mixed_v = internal::allow_optblas_mixed< Ts... >::value;
+
+template<class T1, class... Ts>
+using enable_if_allow_optblas_mixed_t = enable_if_t<(
+    allow_optblas_mixed_v< T1, Ts... >
+), int >;
+
+template<class T1, class... Ts>
+using disable_if_allow_optblas_mixed_t = enable_if_t<(
+    ! allow_optblas_mixed_v< T1, Ts... >
+), int >;
+
 #define TLAPACK_OPT_TYPE( T ) \
     namespace internal { \
         template<> struct allow_optblas< T > { \
@@ -874,6 +944,55 @@ bool access_granted( band_t a, band_t p )
             (p.upper_bandwidth >= a.upper_bandwidth);
 }
 
+/**
+ * @brief Check if a given access type is compatible with the access policy.
+ * 
+ * Specific implementation for rfp_t. The positions stored in the
+ * rectangular full packed format are not a triangle, so only the access
+ * of the same rfp_t is granted.
+ * 
+ * @see bool access_granted( access_t a, accessPolicy_t p )
+ * 
+ * @ingroup utils
+ */
+template< class access_t >
+inline constexpr
+bool access_granted( access_t a, rfp_t p )
+{
+    return false;
+}
+
+/**
+ * @brief Check if a given access type is compatible with the access policy.
+ * 
+ * Specific implementation for rfp_t.
+ * 
+ * @see bool access_granted( access_t a, accessPolicy_t p )
+ * 
+ * @ingroup utils
+ */
+template< class accessPolicy_t >
+inline constexpr
+bool access_granted( rfp_t a, accessPolicy_t p )
+{
+    return ((MatrixAccessPolicy) p == MatrixAccessPolicy::Dense);
+}
+
+/**
+ * @brief Check if a given access type is compatible with the access policy.
+ * 
+ * Specific implementation for rfp_t.
+ * 
+ * @see bool access_granted( access_t a, accessPolicy_t p )
+ * 
+ * @ingroup utils
+ */
+inline constexpr
+bool access_granted( rfp_t a, rfp_t p )
+{
+    return (p.uplo == a.uplo) && (p.n1 == a.n1);
+}
+
 /**
  * @return ! access_granted( a, p ).
  * 
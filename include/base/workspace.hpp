@@ -0,0 +1,314 @@
+// Copyright (c) 2022, University of Colorado Denver. All rights reserved.
+//
+// This file is part of <T>LAPACK.
+// <T>LAPACK is free software: you can redistribute it and/or modify it under
+// the terms of the BSD 3-Clause license. See the accompanying LICENSE file.
+
+#ifndef __TLAPACK_WORKSPACE_HH__
+#define __TLAPACK_WORKSPACE_HH__
+
+#include <cstddef>
+#include <cstdint>
+#include <new>
+#include <memory>
+#include <type_traits>
+#include <algorithm>
+
+namespace tlapack {
+
+    /**
+     * @brief Error thrown when a routine needs workspace that was not
+     *      provided by the caller and hidden allocations are disabled.
+     *
+     * @see workspace_arena
+     *
+     * @ingroup utils
+     */
+    class workspace_error : public std::bad_alloc {
+    public:
+        const char* what() const noexcept override
+        {
+            return "<T>LAPACK: the workspace provided by the caller is not large enough"
+                " and TLAPACK_NO_HIDDEN_ALLOCATION is defined";
+        }
+    };
+
+    /**
+     * @brief Stack-like arena of workspace memory.
+     *
+     * Routines that do not receive a large enough workspace in their opts
+     * struct borrow it from an arena with push() and give it back with pop(),
+     * in LIFO order. Nested calls, e.g., agressive_early_deflation calling
+     * multishift_qr calling gehrd, stack their workspaces on top of each
+     * other in the same buffer.
+     *
+     * If a push does not fit in the buffer, the memory is taken from the
+     * heap and the arena records the peak usage. The next time the arena
+     * becomes empty, the buffer is enlarged to that peak. So, after the
+     * first call, repeated calls with the same sizes do not allocate.
+     *
+     * If TLAPACK_NO_HIDDEN_ALLOCATION is defined, the arena only allocates
+     * memory in the constructor and in reserve(). A push that does not fit
+     * throws workspace_error instead of taking memory from the heap. Use
+     * the get_worksize_xxx() queries to reserve enough memory up front.
+     *
+     * The arena is not thread safe. Use one arena per thread, e.g., the
+     * default arena returned by default_arena().
+     *
+     * @ingroup utils
+     */
+    class workspace_arena {
+    public:
+
+        /// Alignment in bytes of the pointers returned by push()
+        static constexpr std::size_t alignment = 64;
+
+        /// Creates an empty arena
+        workspace_arena() noexcept = default;
+
+        /// Creates an arena with a buffer of the given size in bytes
+        explicit workspace_arena( std::size_t bytes ) { reserve( bytes ); }
+
+        /**
+         * Creates an arena that uses an external buffer of the given size in
+         * bytes. The buffer is not freed by the arena. If the buffer turns
+         * out to be too small, it is replaced by an internal buffer.
+         */
+        workspace_arena( void* buffer, std::size_t bytes ) noexcept
+        {
+            const std::uintptr_t addr = reinterpret_cast<std::uintptr_t>( buffer );
+            const std::size_t offset = (alignment - addr % alignment) % alignment;
+            if( buffer && bytes > offset ) {
+                buffer_ = static_cast<char*>( buffer ) + offset;
+                capacity_ = bytes - offset;
+            }
+            owns_ = false;
+        }
+
+        workspace_arena( const workspace_arena& ) = delete;
+        workspace_arena& operator=( const workspace_arena& ) = delete;
+
+        ~workspace_arena()
+        {
+            if( owns_ && buffer_ )
+                free_block( buffer_ );
+        }
+
+        /**
+         * Ensures that the buffer has at least the given size in bytes.
+         * Only has effect if the arena is empty.
+         */
+        void reserve( std::size_t bytes )
+        {
+            if( depth_ > 0 || bytes <= capacity_ ) return;
+            if( owns_ && buffer_ )
+                free_block( buffer_ );
+            buffer_ = allocate_block( bytes );
+            capacity_ = bytes;
+            owns_ = true;
+        }
+
+        /**
+         * @brief Borrows space for n objects of type T.
+         *
+         * @return Pointer aligned to workspace_arena::alignment bytes.
+         *      The memory must be given back with pop().
+         */
+        template< class T >
+        T* push( std::size_t n )
+        {
+            const std::size_t hsize = round_up( sizeof(header) );
+            const std::size_t need = push_size<T>( n );
+
+            char* base;
+            header h = { top_, need, nullptr };
+            if( top_ + need <= capacity_ ) {
+                base = buffer_ + top_;
+                top_ += need;
+            }
+            else {
+            #ifdef TLAPACK_NO_HIDDEN_ALLOCATION
+                throw workspace_error();
+            #else
+                base = allocate_block( need );
+                h.block = base;
+            #endif
+            }
+
+            ::new( static_cast<void*>( base + hsize - sizeof(header) ) ) header( h );
+            ++depth_;
+            live_ += need;
+            high_water_ = std::max( high_water_, live_ );
+
+            T* ptr = reinterpret_cast<T*>( base + hsize );
+            if( !std::is_trivially_default_constructible<T>::value )
+                for( std::size_t i = 0; i < n; ++i )
+                    ::new( static_cast<void*>( ptr + i ) ) T();
+            return ptr;
+        }
+
+        /**
+         * @brief Gives back the space borrowed by the last call to push().
+         *
+         * @param[in] ptr Pointer returned by the last call to push().
+         */
+        void pop( const void* ptr ) noexcept
+        {
+            const header h = *reinterpret_cast<const header*>(
+                static_cast<const char*>( ptr ) - sizeof(header) );
+
+            --depth_;
+            live_ -= h.size;
+            if( h.block )
+                free_block( h.block );
+            else
+                top_ = h.prev_top;
+
+            // Enlarge the buffer to the peak usage while it is empty
+            if( depth_ == 0 && high_water_ > capacity_ ) {
+                if( owns_ && buffer_ )
+                    free_block( buffer_ );
+                buffer_ = nullptr;
+                capacity_ = 0;
+                try {
+                    buffer_ = allocate_block( high_water_ );
+                    capacity_ = high_water_;
+                } catch( const std::bad_alloc& ) {}
+                owns_ = true;
+            }
+        }
+
+        /**
+         * @return Number of bytes taken from the arena by push<T>( n ),
+         *      including the bookkeeping and the alignment padding.
+         */
+        template< class T >
+        static constexpr std::size_t push_size( std::size_t n ) noexcept
+        {
+            return round_up( sizeof(header) ) + round_up( n * sizeof(T) );
+        }
+
+        /// Size of the buffer in bytes
+        std::size_t capacity() const noexcept { return capacity_; }
+
+        /// Number of bytes currently borrowed, including alignment padding
+        std::size_t used() const noexcept { return live_; }
+
+        /// Peak number of bytes borrowed at the same time
+        std::size_t high_water() const noexcept { return high_water_; }
+
+        /// Number of live push() calls
+        std::size_t depth() const noexcept { return depth_; }
+
+        /// Number of heap allocations done by the arena
+        std::size_t n_allocations() const noexcept { return n_allocations_; }
+
+    private:
+
+        struct header {
+            std::size_t prev_top;   ///< top of the buffer before the push
+            std::size_t size;       ///< bytes taken by the push
+            char* block;            ///< heap block, if the push did not fit
+        };
+
+        static constexpr std::size_t round_up( std::size_t bytes ) noexcept
+        {
+            return (bytes + alignment - 1) / alignment * alignment;
+        }
+
+        char* allocate_block( std::size_t bytes )
+        {
+            // Over-allocate to align the block and store the original pointer
+            char* raw = static_cast<char*>( ::operator new( bytes + alignment + sizeof(void*) ) );
+            ++n_allocations_;
+            const std::uintptr_t addr = reinterpret_cast<std::uintptr_t>( raw + sizeof(void*) );
+            char* block = raw + sizeof(void*) + (alignment - addr % alignment) % alignment;
+            reinterpret_cast<void**>( block )[-1] = raw;
+            return block;
+        }
+
+        static void free_block( char* block ) noexcept
+        {
+            ::operator delete( reinterpret_cast<void**>( block )[-1] );
+        }
+
+        char* buffer_ = nullptr;
+        std::size_t capacity_ = 0;
+        std::size_t top_ = 0;
+        std::size_t depth_ = 0;
+        std::size_t live_ = 0;
+        std::size_t high_water_ = 0;
+        std::size_t n_allocations_ = 0;
+        bool owns_ = true;
+    };
+
+    /**
+     * @return The workspace arena of the calling thread. It is used by
+     *      the routines whose opts struct does not provide an arena.
+     *
+     * @ingroup utils
+     */
+    inline workspace_arena& default_arena() noexcept
+    {
+        static thread_local workspace_arena arena;
+        return arena;
+    }
+
+    /**
+     * @brief Workspace of a routine.
+     *
+     * Uses the workspace provided by the caller if it has at least the
+     * required size. Otherwise, borrows the workspace from the given arena,
+     * or from the default arena of the calling thread if arena is nullptr.
+     * The borrowed workspace is given back when the object is destroyed.
+     *
+     * @ingroup utils
+     */
+    template< class T >
+    class local_workspace {
+    public:
+
+        /// Borrows n objects of type T from the arena
+        explicit local_workspace( std::size_t n, workspace_arena* arena = nullptr )
+            : local_workspace( (T*) nullptr, std::size_t(0), n, arena ) { }
+
+        template< class idx_t >
+        local_workspace( T* work, idx_t lwork, idx_t required, workspace_arena* arena )
+        {
+            if( work && required <= lwork ) {
+                // Provided workspace is large enough, use it
+                data_ = work;
+                size_ = static_cast<std::size_t>( lwork );
+            }
+            else {
+                // No workspace provided or not large enough, borrow it
+                arena_ = (arena) ? arena : &default_arena();
+                size_ = static_cast<std::size_t>( required );
+                data_ = arena_->push<T>( size_ );
+            }
+        }
+
+        local_workspace( const local_workspace& ) = delete;
+        local_workspace& operator=( const local_workspace& ) = delete;
+
+        ~local_workspace()
+        {
+            if( arena_ )
+                arena_->pop( data_ );
+        }
+
+        /// Pointer to the workspace
+        T* data() const noexcept { return data_; }
+
+        /// Size of the workspace in number of objects of type T
+        std::size_t size() const noexcept { return size_; }
+
+    private:
+        T* data_ = nullptr;
+        std::size_t size_ = 0;
+        workspace_arena* arena_ = nullptr;
+    };
+
+} // namespace tlapack
+
+#endif // __TLAPACK_WORKSPACE_HH__
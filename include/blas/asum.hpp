@@ -9,6 +9,7 @@
 #define __TLAPACK_BLAS_ASUM_HH__
 
 #include "base/utils.hpp"
+#include "base/profile.hpp"
 
 namespace tlapack {
 
@@ -33,6 +34,8 @@ auto asum( vector_t const& x )
     // constants
     const idx_t n = size(x);
 
+    TLAPACK_PROFILE_SCOPE( "asum", type_t<vector_t>, n, n );
+
     real_t result = 0;
     for (idx_t i = 0; i < n; ++i)
         result += abs1( x[i] );
@@ -9,6 +9,7 @@
 #define __TLAPACK_BLAS_AXPY_HH__
 
 #include "base/utils.hpp"
+#include "base/profile.hpp"
 
 namespace tlapack {
 
@@ -38,6 +39,8 @@ void axpy(
     // constants
     const idx_t n = size(x);
 
+    TLAPACK_PROFILE_SCOPE( "axpy", type_t<vectorY_t>, 2.0*n, 3.0*n );
+
     // check arguments
     tlapack_check_false( size(y) < n );
 
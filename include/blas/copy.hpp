@@ -9,6 +9,7 @@
 #define __TLAPACK_BLAS_COPY_HH__
 
 #include "base/utils.hpp"
+#include "base/profile.hpp"
 
 namespace tlapack {
 
@@ -34,6 +35,8 @@ void copy( const vectorX_t& x, vectorY_t& y )
     // constants
     const idx_t n = size(x);
 
+    TLAPACK_PROFILE_SCOPE( "copy", type_t<vectorY_t>, 0, 2.0*n );
+
     // check arguments
     tlapack_check_false( size(y) < n );
 
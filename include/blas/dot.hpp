@@ -9,6 +9,7 @@
 #define __TLAPACK_BLAS_DOT_HH__
 
 #include "base/utils.hpp"
+#include "base/profile.hpp"
 
 namespace tlapack {
 
@@ -39,6 +40,8 @@ auto dot( const vectorX_t& x, const vectorY_t& y )
     // constants
     const idx_t n = size(x);
 
+    TLAPACK_PROFILE_SCOPE( "dot", type_t<vectorY_t>, 2.0*n, 2.0*n );
+
     // check arguments
     tlapack_check_false( size(y) != n );
 
@@ -9,6 +9,7 @@
 #define __TLAPACK_BLAS_DOTU_HH__
 
 #include "base/utils.hpp"
+#include "base/profile.hpp"
 
 namespace tlapack {
 
@@ -39,6 +40,8 @@ auto dotu( const vectorX_t& x, const vectorY_t& y )
     // constants
     const idx_t n = size(x);
 
+    TLAPACK_PROFILE_SCOPE( "dotu", type_t<vectorY_t>, 2.0*n, 2.0*n );
+
     // check arguments
     tlapack_check_false( size(y) != n );
 
@@ -0,0 +1,140 @@
+// Copyright (c) 2017-2021, University of Tennessee. All rights reserved.
+// Copyright (c) 2021-2022, University of Colorado Denver. All rights reserved.
+//
+// This file is part of <T>LAPACK.
+// <T>LAPACK is free software: you can redistribute it and/or modify it under
+// the terms of the BSD 3-Clause license. See the accompanying LICENSE file.
+
+#ifndef __TLAPACK_BLAS_GBMV_HH__
+#define __TLAPACK_BLAS_GBMV_HH__
+
+#include "base/utils.hpp"
+#include "base/profile.hpp"
+
+namespace tlapack {
+
+/**
+ * General band matrix-vector multiply:
+ * \[
+ *     y := \alpha op(A) x + \beta y,
+ * \]
+ * where $op(A)$ is one of
+ *     $op(A) = A$,
+ *     $op(A) = A^T$,
+ *     $op(A) = A^H$, or
+ *     $op(A) = conj(A)$,
+ * alpha and beta are scalars, x and y are vectors, and A is an m-by-n band
+ * matrix with kl = lowerband(A) subdiagonals and ku = upperband(A)
+ * superdiagonals, e.g., a legacyBandedMatrix.
+ *
+ * Only the elements in the band are referenced.
+ *
+ * @param[in] trans
+ *     The operation to be performed:
+ *     - Op::NoTrans:   $y = \alpha A   x + \beta y$,
+ *     - Op::Trans:     $y = \alpha A^T x + \beta y$,
+ *     - Op::ConjTrans: $y = \alpha A^H x + \beta y$,
+ *     - Op::Conj:  $y = \alpha conj(A) x + \beta y$.
+ *
+ * @param[in] alpha Scalar.
+ * @param[in] A An m-by-n band matrix.
+ * @param[in] x A n-element vector if trans = Op::NoTrans or Op::Conj,
+ *      a m-element vector otherwise.
+ * @param[in] beta Scalar.
+ * @param[in,out] y A m-element vector if trans = Op::NoTrans or Op::Conj,
+ *      a n-element vector otherwise.
+ *
+ * @ingroup gbmv
+ */
+template<
+    class matrixA_t,
+    class vectorX_t, class vectorY_t,
+    class alpha_t, class beta_t
+>
+void gbmv(
+    Op trans,
+    const alpha_t& alpha, const matrixA_t& A, const vectorX_t& x,
+    const beta_t& beta, vectorY_t& y )
+{
+    // data traits
+    using TA    = type_t< matrixA_t >;
+    using TX    = type_t< vectorX_t >;
+    using idx_t = size_type< matrixA_t >;
+
+    using std::min;
+
+    // constants
+    const idx_t m  = nrows(A);
+    const idx_t n  = ncols(A);
+    const idx_t kl = lowerband(A);
+    const idx_t ku = upperband(A);
+    const bool noTranspose = (trans == Op::NoTrans || trans == Op::Conj);
+    const idx_t leny = (noTranspose) ? m : n;
+
+    TLAPACK_PROFILE_SCOPE( "gbmv", type_t<vectorY_t>, 2.0*n*(kl+ku+1), double(n)*(kl+ku+1) + m + 2.0*n );
+
+    // check arguments
+    tlapack_check_false( trans != Op::NoTrans &&
+                   trans != Op::Trans &&
+                   trans != Op::ConjTrans &&
+                   trans != Op::Conj );
+    tlapack_check_false( (idx_t) size(x) != ((noTranspose) ? n : m) );
+    tlapack_check_false( (idx_t) size(y) != leny );
+
+    tlapack_check_false( access_denied( band_t( kl, ku ), read_policy(A) ) );
+
+    // quick return
+    if (m == 0 || n == 0 || (alpha == alpha_t(0) && beta == beta_t(1)))
+        return;
+
+    // form y := beta*y
+    if (beta != beta_t(1)) {
+        if (beta == beta_t(0)) {
+            for (idx_t i = 0; i < leny; ++i)
+                y[i] = 0;
+        }
+        else {
+            for (idx_t i = 0; i < leny; ++i)
+                y[i] *= beta;
+        }
+    }
+    if (alpha == alpha_t(0))
+        return;
+
+    // Column j of A has the elements A(i,j) for i0 <= i < i1
+    for (idx_t j = 0; j < n; ++j) {
+        const idx_t i0 = (j > ku) ? j - ku : 0;
+        const idx_t i1 = min( m, j + kl + 1 );
+
+        if (trans == Op::NoTrans) {
+            // form y += alpha * A * x
+            auto tmp = alpha*x[j];
+            for (idx_t i = i0; i < i1; ++i)
+                y[i] += tmp * A(i,j);
+        }
+        else if (trans == Op::Conj) {
+            // form y += alpha * conj( A ) * x
+            auto tmp = alpha*x[j];
+            for (idx_t i = i0; i < i1; ++i)
+                y[i] += tmp * conj( A(i,j) );
+        }
+        else if (trans == Op::Trans) {
+            // form y += alpha * A^T * x
+            scalar_type<TA,TX> tmp( 0 );
+            for (idx_t i = i0; i < i1; ++i)
+                tmp += A(i,j) * x[i];
+            y[j] += alpha*tmp;
+        }
+        else {
+            // form y += alpha * A^H * x
+            scalar_type<TA,TX> tmp( 0 );
+            for (idx_t i = i0; i < i1; ++i)
+                tmp += conj( A(i,j) ) * x[i];
+            y[j] += alpha*tmp;
+        }
+    }
+}
+
+}  // namespace tlapack
+
+#endif        //  #ifndef __TLAPACK_BLAS_GBMV_HH__
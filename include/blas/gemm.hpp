@@ -9,58 +9,25 @@
 #define __TLAPACK_BLAS_GEMM_HH__
 
 #include "base/utils.hpp"
+#include "base/profile.hpp"
+#include "base/tuning.hpp"
 
 namespace tlapack {
 
-/**
- * General matrix-matrix multiply:
- * \[
- *     C := \alpha op(A) \times op(B) + \beta C,
- * \]
- * where $op(X)$ is one of
- *     $op(X) = X$,
- *     $op(X) = X^T$, or
- *     $op(X) = X^H$,
- * alpha and beta are scalars, and A, B, and C are matrices, with
- * $op(A)$ an m-by-k matrix, $op(B)$ a k-by-n matrix, and C an m-by-n matrix.
- *
- * @param[in] transA
- *     The operation $op(A)$ to be used:
- *     - Op::NoTrans:   $op(A) = A$.
- *     - Op::Trans:     $op(A) = A^T$.
- *     - Op::ConjTrans: $op(A) = A^H$.
- *
- * @param[in] transB
- *     The operation $op(B)$ to be used:
- *     - Op::NoTrans:   $op(B) = B$.
- *     - Op::Trans:     $op(B) = B^T$.
- *     - Op::ConjTrans: $op(B) = B^H$.
- *
- * @param[in] alpha Scalar.
- * @param[in] A $op(A)$ is an m-by-k matrix.
- * @param[in] B $op(B)$ is an k-by-n matrix.
- * @param[in] beta Scalar.
- * @param[in,out] C A m-by-n matrix. If beta = 0,
- *                C need not be initialized.
- * 
- * @ingroup gemm
- */
+namespace internal {
+
+/// Template implementation of gemm(). The wrappers of the optimized
+/// BLAS use it for the problems smaller than optblas_nmin() and for the
+/// calls they cannot forward to the library.
 template<
     class matrixA_t,
     class matrixB_t,
     class matrixC_t,
     class alpha_t,
     class beta_t,
-    class T = type_t<matrixC_t>,
-    disable_if_allow_optblas_t<
-        pair< matrixA_t, T >,
-        pair< matrixB_t, T >,
-        pair< matrixC_t, T >,
-        pair< alpha_t,   T >,
-        pair< beta_t,    T >
-    > = 0
+    class T = type_t<matrixC_t>
 >
-void gemm(
+void gemm_template(
     Op transA,
     Op transB,
     const alpha_t& alpha,
@@ -83,6 +50,8 @@ void gemm(
     const idx_t n = (transB == Op::NoTrans) ? ncols(B) : nrows(B);
     const idx_t k = (transA == Op::NoTrans) ? ncols(A) : nrows(A);
 
+    TLAPACK_PROFILE_SCOPE( "gemm", TC, 2.0*m*n*k, double(m)*k + double(k)*n + 2.0*m*n );
+
     // check arguments
     tlapack_check_false( transA != Op::NoTrans &&
                    transA != Op::Trans &&
@@ -99,48 +68,58 @@ void gemm(
     tlapack_check_false( access_denied( dense, write_policy(C) ) );
 
     if (transA == Op::NoTrans) {
-        if (transB == Op::NoTrans) {
-            for(idx_t j = 0; j < n; ++j) {
-                if( beta == beta_t(0) )
-                    for(idx_t i = 0; i < m; ++i)
-                        C(i,j) = TC(0);
-                else
-                    for(idx_t i = 0; i < m; ++i)
-                        C(i,j) *= beta;
-                for(idx_t l = 0; l < k; ++l) {
-                    const auto alphaTimesblj = alpha*B(l,j);
-                    for(idx_t i = 0; i < m; ++i)
-                        C(i,j) += A(i,l)*alphaTimesblj;
-                }
-            }
+        for(idx_t j = 0; j < n; ++j) {
+            if( beta == beta_t(0) )
+                for(idx_t i = 0; i < m; ++i)
+                    C(i,j) = TC(0);
+            else
+                for(idx_t i = 0; i < m; ++i)
+                    C(i,j) *= beta;
         }
-        else if (transB == Op::Trans) {
-            for(idx_t j = 0; j < n; ++j) {
-                if( beta == beta_t(0) )
-                    for(idx_t i = 0; i < m; ++i)
-                        C(i,j) = TC(0);
-                else
-                    for(idx_t i = 0; i < m; ++i)
-                        C(i,j) *= beta;
-                for(idx_t l = 0; l < k; ++l) {
-                    const auto alphaTimesbjl = alpha*B(j,l);
-                    for(idx_t i = 0; i < m; ++i)
-                        C(i,j) += A(i,l)*alphaTimesbjl;
-                }
-            }
+
+        // Blocks of A, mc-by-kc, and of B, kc-by-nc, that stay in the caches
+        // while they are used. The sums of each C(i,j) are done in the same
+        // order as without blocks.
+        idx_t mc = m, kc = k, nc = n;
+        if( m*k > idx_t(16384) ) {
+            mc = std::max<idx_t>( 1, tuned<TC>( tunable<idx_t>( tuning_default, 128 ), "gemm", "mc", k ) );
+            kc = std::max<idx_t>( 1, tuned<TC>( tunable<idx_t>( tuning_default, 256 ), "gemm", "kc", k ) );
+            nc = std::max<idx_t>( 1, tuned<TC>( tunable<idx_t>( tuning_default, 2048 ), "gemm", "nc", k ) );
         }
-        else { // transB == Op::ConjTrans
-            for(idx_t j = 0; j < n; ++j) {
-                if( beta == beta_t(0) )
-                    for(idx_t i = 0; i < m; ++i)
-                        C(i,j) = TC(0);
-                else
-                    for(idx_t i = 0; i < m; ++i)
-                        C(i,j) *= beta;
-                for(idx_t l = 0; l < k; ++l) {
-                    const auto alphaTimesbjl = alpha*conj(B(j,l));
-                    for(idx_t i = 0; i < m; ++i)
-                        C(i,j) += A(i,l)*alphaTimesbjl;
+
+        for(idx_t jc = 0; jc < n; jc += nc) {
+            const idx_t jn = std::min<idx_t>( jc+nc, n );
+            for(idx_t pc = 0; pc < k; pc += kc) {
+                const idx_t ln = std::min<idx_t>( pc+kc, k );
+                for(idx_t ic = 0; ic < m; ic += mc) {
+                    const idx_t in = std::min<idx_t>( ic+mc, m );
+                    if (transB == Op::NoTrans) {
+                        for(idx_t j = jc; j < jn; ++j) {
+                            for(idx_t l = pc; l < ln; ++l) {
+                                const auto alphaTimesblj = alpha*B(l,j);
+                                for(idx_t i = ic; i < in; ++i)
+                                    C(i,j) += A(i,l)*alphaTimesblj;
+                            }
+                        }
+                    }
+                    else if (transB == Op::Trans) {
+                        for(idx_t j = jc; j < jn; ++j) {
+                            for(idx_t l = pc; l < ln; ++l) {
+                                const auto alphaTimesbjl = alpha*B(j,l);
+                                for(idx_t i = ic; i < in; ++i)
+                                    C(i,j) += A(i,l)*alphaTimesbjl;
+                            }
+                        }
+                    }
+                    else { // transB == Op::ConjTrans
+                        for(idx_t j = jc; j < jn; ++j) {
+                            for(idx_t l = pc; l < ln; ++l) {
+                                const auto alphaTimesbjl = alpha*conj(B(j,l));
+                                for(idx_t i = ic; i < in; ++i)
+                                    C(i,j) += A(i,l)*alphaTimesbjl;
+                            }
+                        }
+                    }
                 }
             }
         }
@@ -229,6 +208,71 @@ void gemm(
     }
 }
 
+}  // namespace internal
+
+/**
+ * General matrix-matrix multiply:
+ * \[
+ *     C := \alpha op(A) \times op(B) + \beta C,
+ * \]
+ * where $op(X)$ is one of
+ *     $op(X) = X$,
+ *     $op(X) = X^T$, or
+ *     $op(X) = X^H$,
+ * alpha and beta are scalars, and A, B, and C are matrices, with
+ * $op(A)$ an m-by-k matrix, $op(B)$ a k-by-n matrix, and C an m-by-n matrix.
+ *
+ * @param[in] transA
+ *     The operation $op(A)$ to be used:
+ *     - Op::NoTrans:   $op(A) = A$.
+ *     - Op::Trans:     $op(A) = A^T$.
+ *     - Op::ConjTrans: $op(A) = A^H$.
+ *
+ * @param[in] transB
+ *     The operation $op(B)$ to be used:
+ *     - Op::NoTrans:   $op(B) = B$.
+ *     - Op::Trans:     $op(B) = B^T$.
+ *     - Op::ConjTrans: $op(B) = B^H$.
+ *
+ * @param[in] alpha Scalar.
+ * @param[in] A $op(A)$ is an m-by-k matrix.
+ * @param[in] B $op(B)$ is an k-by-n matrix.
+ * @param[in] beta Scalar.
+ * @param[in,out] C A m-by-n matrix. If beta = 0,
+ *                C need not be initialized.
+ *
+ * If op(A) = A, the loops run over blocks of A and B whose sizes are the
+ * tunable parameters mc, kc and nc of "gemm", see tuned().
+ * 
+ * @ingroup gemm
+ */
+template<
+    class matrixA_t,
+    class matrixB_t,
+    class matrixC_t,
+    class alpha_t,
+    class beta_t,
+    class T = type_t<matrixC_t>,
+    disable_if_allow_optblas_mixed_t<
+        pair< matrixA_t, T >,
+        pair< matrixB_t, T >,
+        pair< matrixC_t, T >,
+        pair< alpha_t,   T >,
+        pair< beta_t,    T >
+    > = 0
+>
+void gemm(
+    Op transA,
+    Op transB,
+    const alpha_t& alpha,
+    const matrixA_t& A,
+    const matrixB_t& B,
+    const beta_t& beta,
+    matrixC_t& C )
+{
+    internal::gemm_template( transA, transB, alpha, A, B, beta, C );
+}
+
 }  // namespace tlapack
 
 #endif        //  #ifndef __TLAPACK_BLAS_GEMM_HH__
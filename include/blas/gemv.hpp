@@ -9,50 +9,21 @@
 #define __TLAPACK_BLAS_GEMV_HH__
 
 #include "base/utils.hpp"
+#include "base/profile.hpp"
 
 namespace tlapack {
 
-/**
- * General matrix-vector multiply:
- * \[
- *     y := \alpha op(A) x + \beta y,
- * \]
- * where $op(A)$ is one of
- *     $op(A) = A$,
- *     $op(A) = A^T$,
- *     $op(A) = A^H$, or
- *     $op(A) = conj(A)$,
- * alpha and beta are scalars, x and y are vectors, and A is a matrix.
- *
- * @param[in] trans
- *     The operation to be performed:
- *     - Op::NoTrans:   $y = \alpha A   x + \beta y$,
- *     - Op::Trans:     $y = \alpha A^T x + \beta y$,
- *     - Op::ConjTrans: $y = \alpha A^H x + \beta y$,
- *     - Op::Conj:  $y = \alpha conj(A) x + \beta y$.
- *
- * @param[in] alpha Scalar.
- * @param[in] A $op(A)$ is an m-by-n matrix.
- * @param[in] x A n-element vector.
- * @param[in] beta Scalar.
- * @param[in,out] y A m-element vector.
- * 
- * @ingroup gemv
- */
+namespace internal {
+
+/// Template implementation of gemv(). The wrappers of the optimized
+/// BLAS use it for the problems smaller than optblas_nmin().
 template<
     class matrixA_t,
     class vectorX_t, class vectorY_t, 
     class alpha_t, class beta_t,
-    class T = type_t<vectorY_t>,
-    disable_if_allow_optblas_t<
-        pair< alpha_t,    T >,
-        pair< matrixA_t, T >,
-        pair< vectorX_t, T >,
-        pair< vectorY_t, T >,
-        pair< beta_t,    T >
-    > = 0
+    class T = type_t<vectorY_t>
 >
-void gemv(
+void gemv_template(
     Op trans,
     const alpha_t& alpha, const matrixA_t& A, const vectorX_t& x,
     const beta_t& beta, vectorY_t& y )
@@ -70,6 +41,8 @@ void gemv(
                     ? ncols(A)
                     : nrows(A);
 
+    TLAPACK_PROFILE_SCOPE( "gemv", type_t<vectorY_t>, 2.0*m*n, double(m)*n + m + 2.0*n );
+
     // check arguments
     tlapack_check_false( trans != Op::NoTrans &&
                    trans != Op::Trans &&
@@ -140,6 +113,56 @@ void gemv(
     }
 }
 
+}  // namespace internal
+
+/**
+ * General matrix-vector multiply:
+ * \[
+ *     y := \alpha op(A) x + \beta y,
+ * \]
+ * where $op(A)$ is one of
+ *     $op(A) = A$,
+ *     $op(A) = A^T$,
+ *     $op(A) = A^H$, or
+ *     $op(A) = conj(A)$,
+ * alpha and beta are scalars, x and y are vectors, and A is a matrix.
+ *
+ * @param[in] trans
+ *     The operation to be performed:
+ *     - Op::NoTrans:   $y = \alpha A   x + \beta y$,
+ *     - Op::Trans:     $y = \alpha A^T x + \beta y$,
+ *     - Op::ConjTrans: $y = \alpha A^H x + \beta y$,
+ *     - Op::Conj:  $y = \alpha conj(A) x + \beta y$.
+ *
+ * @param[in] alpha Scalar.
+ * @param[in] A $op(A)$ is an m-by-n matrix.
+ * @param[in] x A n-element vector.
+ * @param[in] beta Scalar.
+ * @param[in,out] y A m-element vector.
+ * 
+ * @ingroup gemv
+ */
+template<
+    class matrixA_t,
+    class vectorX_t, class vectorY_t, 
+    class alpha_t, class beta_t,
+    class T = type_t<vectorY_t>,
+    disable_if_allow_optblas_mixed_t<
+        pair< alpha_t,    T >,
+        pair< matrixA_t, T >,
+        pair< vectorX_t, T >,
+        pair< vectorY_t, T >,
+        pair< beta_t,    T >
+    > = 0
+>
+void gemv(
+    Op trans,
+    const alpha_t& alpha, const matrixA_t& A, const vectorX_t& x,
+    const beta_t& beta, vectorY_t& y )
+{
+    internal::gemv_template( trans, alpha, A, x, beta, y );
+}
+
 }  // namespace tlapack
 
 #endif        //  #ifndef __TLAPACK_BLAS_GEMV_HH__
@@ -9,9 +9,48 @@
 #define __TLAPACK_BLAS_GER_HH__
 
 #include "base/utils.hpp"
+#include "base/profile.hpp"
 
 namespace tlapack {
 
+namespace internal {
+
+/// Template implementation of ger(). The wrappers of the optimized
+/// BLAS use it for the problems smaller than optblas_nmin().
+template<
+    class matrixA_t,
+    class vectorX_t, class vectorY_t,
+    class alpha_t,
+    class T = type_t<matrixA_t>
+>
+void ger_template(
+    const alpha_t& alpha,
+    const vectorX_t& x, const vectorY_t& y,
+    matrixA_t& A )
+{
+    // data traits
+    using idx_t = size_type< matrixA_t >;
+
+    // constants
+    const idx_t m = nrows(A);
+    const idx_t n = ncols(A);
+
+    TLAPACK_PROFILE_SCOPE( "ger", type_t<matrixA_t>, 2.0*m*n, 2.0*m*n + m + n );
+
+    // check arguments
+    tlapack_check_false( size(x) != m );
+    tlapack_check_false( size(y) != n );
+    tlapack_check_false( access_denied( dense, write_policy(A) ) );
+
+    for (idx_t j = 0; j < n; ++j) {
+        auto tmp = alpha * conj( y[j] );
+        for (idx_t i = 0; i < m; ++i)
+            A(i,j) += x[i] * tmp;
+    }
+}
+
+}  // namespace internal
+
 /**
  * General matrix rank-1 update:
  * \[
@@ -32,7 +71,7 @@ template<
     class vectorX_t, class vectorY_t,
     class alpha_t,
     class T = type_t<matrixA_t>,
-    disable_if_allow_optblas_t<
+    disable_if_allow_optblas_mixed_t<
         pair< alpha_t, T >,
         pair< matrixA_t, T >,
         pair< vectorX_t, T >,
@@ -44,23 +83,7 @@ void ger(
     const vectorX_t& x, const vectorY_t& y,
     matrixA_t& A )
 {
-    // data traits
-    using idx_t = size_type< matrixA_t >;
-
-    // constants
-    const idx_t m = nrows(A);
-    const idx_t n = ncols(A);
-
-    // check arguments
-    tlapack_check_false( size(x) != m );
-    tlapack_check_false( size(y) != n );
-    tlapack_check_false( access_denied( dense, write_policy(A) ) );
-
-    for (idx_t j = 0; j < n; ++j) {
-        auto tmp = alpha * conj( y[j] );
-        for (idx_t i = 0; i < m; ++i)
-            A(i,j) += x[i] * tmp;
-    }
+    internal::ger_template( alpha, x, y, A );
 }
 
 }  // namespace tlapack
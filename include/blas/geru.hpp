@@ -9,6 +9,7 @@
 #define __TLAPACK_BLAS_GERU_HH__
 
 #include "base/utils.hpp"
+#include "base/profile.hpp"
 #include "blas/ger.hpp"
 
 namespace tlapack {
@@ -52,6 +53,8 @@ void geru(
     const idx_t m = nrows(A);
     const idx_t n = ncols(A);
 
+    TLAPACK_PROFILE_SCOPE( "geru", type_t<matrixA_t>, 2.0*m*n, 2.0*m*n + m + n );
+
     // check arguments
     tlapack_check_false( size(x) != m );
     tlapack_check_false( size(y) != n );
@@ -9,6 +9,7 @@
 #define __TLAPACK_BLAS_HEMM_HH__
 
 #include "base/utils.hpp"
+#include "base/profile.hpp"
 
 namespace tlapack {
 
@@ -79,6 +80,8 @@ void hemm(
     const idx_t m = nrows(B);
     const idx_t n = ncols(B);
 
+    TLAPACK_PROFILE_SCOPE( "hemm", type_t<matrixC_t>, 2.0*m*n*((side == Side::Left) ? m : n), 0.5*((side == Side::Left) ? m*(m+1) : n*(n+1)) + 3.0*m*n );
+
     // check arguments
     tlapack_check_false( side != Side::Left &&
                    side != Side::Right );
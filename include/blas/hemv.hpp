@@ -9,6 +9,7 @@
 #define __TLAPACK_BLAS_HEMV_HH__
 
 #include "base/utils.hpp"
+#include "base/profile.hpp"
 
 namespace tlapack {
 
@@ -65,6 +66,8 @@ void hemv(
     // constants
     const idx_t n = nrows(A);
 
+    TLAPACK_PROFILE_SCOPE( "hemv", type_t<vectorY_t>, 2.0*n*n, 0.5*n*(n+1) + 3.0*n );
+
     // check arguments
     tlapack_check_false( uplo != Uplo::Lower &&
                    uplo != Uplo::Upper );
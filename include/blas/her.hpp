@@ -9,6 +9,7 @@
 #define __TLAPACK_BLAS_HER_HH__
 
 #include "base/utils.hpp"
+#include "base/profile.hpp"
 
 namespace tlapack {
 
@@ -60,6 +61,8 @@ void her(
     // constants
     const idx_t n = nrows(A);
 
+    TLAPACK_PROFILE_SCOPE( "her", type_t<matrixA_t>, 1.0*n*n, double(n)*(n+1) + n );
+
     // check arguments
     tlapack_check_false( uplo != Uplo::Lower &&
                    uplo != Uplo::Upper );
@@ -9,6 +9,7 @@
 #define __TLAPACK_BLAS_HERK_HH__
 
 #include "base/utils.hpp"
+#include "base/profile.hpp"
 
 namespace tlapack {
 
@@ -79,6 +80,8 @@ void herk(
     const idx_t n = (trans == Op::NoTrans) ? nrows(A) : ncols(A);
     const idx_t k = (trans == Op::NoTrans) ? ncols(A) : nrows(A);
 
+    TLAPACK_PROFILE_SCOPE( "herk", type_t<matrixC_t>, double(k)*n*(n+1), double(n)*k + double(n)*(n+1) );
+
     // check arguments
     tlapack_check_false( uplo != Uplo::Lower &&
                    uplo != Uplo::Upper &&
@@ -9,6 +9,7 @@
 #define __TLAPACK_BLAS_IAMAX_HH__
 
 #include "base/utils.hpp"
+#include "base/profile.hpp"
 #include "base/constants.hpp"
 
 namespace tlapack {
@@ -200,6 +201,8 @@ inline
 size_type<vector_t>
 iamax( const vector_t& x, const ErrorCheck& ec = {} )
 {
+    TLAPACK_PROFILE_SCOPE( "iamax", type_t<vector_t>, size(x), size(x) );
+
     return ( ec.nan == true ) ? iamax_ec(x) : iamax_nc(x);
 }
 
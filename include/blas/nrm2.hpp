@@ -17,6 +17,7 @@
 #define __TLAPACK_BLAS_NRM2_HH__
 
 #include "base/utils.hpp"
+#include "base/profile.hpp"
 #include "base/constants.hpp"
 
 namespace tlapack {
@@ -40,6 +41,8 @@ auto nrm2( const vector_t& x )
     // constants
     const idx_t n = size(x);
 
+    TLAPACK_PROFILE_SCOPE( "nrm2", type_t<vector_t>, 2.0*n, n );
+
     // constants
     const real_t zero( 0 );
     const real_t one( 1 );
@@ -9,6 +9,7 @@
 #define __TLAPACK_BLAS_ROT_HH__
 
 #include "base/utils.hpp"
+#include "base/profile.hpp"
 
 namespace tlapack {
 
@@ -49,6 +50,8 @@ void rot(
     // constants
     const idx_t n = size(x);
 
+    TLAPACK_PROFILE_SCOPE( "rot", type_t<vectorY_t>, 6.0*n, 4.0*n );
+
     // check arguments
     tlapack_check_false( size(y) != n );
 
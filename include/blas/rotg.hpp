@@ -66,10 +66,14 @@ void rotg(
         T sigma = (anorm > bnorm)
             ? sgn(a)
             : sgn(b);
-        T r = sigma * scl * sqrt( (a/scl) * (a/scl) + (b/scl) * (b/scl) );
-        c = a / r;
-        s = b / r;
-        a = r;
+        // c and s are computed from the scaled values so that they keep
+        // full precision when r is subnormal
+        const T as = a / scl;
+        const T bs = b / scl;
+        const T rs = sigma * sqrt( as * as + bs * bs );
+        c = as / rs;
+        s = bs / rs;
+        a = scl * rs;
         if ( anorm > bnorm )
             b = s;
         else if ( c != zero )
@@ -9,6 +9,7 @@
 #define __TLAPACK_BLAS_ROTM_HH__
 
 #include "base/utils.hpp"
+#include "base/profile.hpp"
 
 namespace tlapack {
 
@@ -79,6 +80,8 @@ void rotm( vectorX_t& x, vectorY_t& y, const T h[4] )
     // constants
     const idx_t n = size(x);
 
+    TLAPACK_PROFILE_SCOPE( "rotm", type_t<vectorY_t>, 6.0*n, 4.0*n );
+
     // check arguments
     tlapack_check_false( size(y) != n );
 
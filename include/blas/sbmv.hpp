@@ -0,0 +1,120 @@
+// Copyright (c) 2017-2021, University of Tennessee. All rights reserved.
+// Copyright (c) 2021-2022, University of Colorado Denver. All rights reserved.
+//
+// This file is part of <T>LAPACK.
+// <T>LAPACK is free software: you can redistribute it and/or modify it under
+// the terms of the BSD 3-Clause license. See the accompanying LICENSE file.
+
+#ifndef __TLAPACK_BLAS_SBMV_HH__
+#define __TLAPACK_BLAS_SBMV_HH__
+
+#include "base/utils.hpp"
+#include "base/profile.hpp"
+
+namespace tlapack {
+
+/**
+ * Symmetric band matrix-vector multiply:
+ * \[
+ *     y := \alpha A x + \beta y,
+ * \]
+ * where alpha and beta are scalars, x and y are vectors,
+ * and A is an n-by-n symmetric band matrix with k superdiagonals, e.g.,
+ * a legacyBandedMatrix.
+ *
+ * @param[in] uplo
+ *     What part of the matrix A is referenced,
+ *     the opposite triangle being assumed from symmetry.
+ *     - Uplo::Lower: only the lower band of A is referenced, and
+ *       k = lowerband(A).
+ *     - Uplo::Upper: only the upper band of A is referenced, and
+ *       k = upperband(A).
+ *
+ * @param[in] alpha Scalar.
+ * @param[in] A A n-by-n symmetric band matrix.
+ * @param[in] x A n-element vector.
+ * @param[in] beta Scalar.
+ * @param[in,out] y A n-element vector.
+ *
+ * @ingroup sbmv
+ */
+template<
+    class matrixA_t,
+    class vectorX_t, class vectorY_t,
+    class alpha_t, class beta_t
+>
+void sbmv(
+    Uplo uplo,
+    const alpha_t& alpha, const matrixA_t& A, const vectorX_t& x,
+    const beta_t& beta, vectorY_t& y )
+{
+    // data traits
+    using TA    = type_t< matrixA_t >;
+    using TX    = type_t< vectorX_t >;
+    using idx_t = size_type< matrixA_t >;
+
+    // using
+    using scalar_t = scalar_type<TA,TX>;
+    using std::min;
+
+    // constants
+    const idx_t n = nrows(A);
+    const idx_t k = (uplo == Uplo::Upper) ? upperband(A) : lowerband(A);
+
+    TLAPACK_PROFILE_SCOPE( "sbmv", type_t<vectorY_t>, 4.0*n*k + 2.0*n, double(n)*(k+1) + 3.0*n );
+
+    // check arguments
+    tlapack_check_false( uplo != Uplo::Lower &&
+                   uplo != Uplo::Upper );
+    tlapack_check_false( ncols(A) != n );
+    tlapack_check_false( (idx_t) size(x) != n );
+    tlapack_check_false( (idx_t) size(y) != n );
+
+    tlapack_check_false( access_denied(
+        (uplo == Uplo::Upper) ? band_t( 0, k ) : band_t( k, 0 ),
+        read_policy(A) ) );
+
+    // form y = beta*y
+    if (beta != beta_t(1)) {
+        if (beta == beta_t(0)) {
+            for (idx_t i = 0; i < n; ++i)
+                y[i] = 0;
+        }
+        else {
+            for (idx_t i = 0; i < n; ++i)
+                y[i] *= beta;
+        }
+    }
+
+    if (uplo == Uplo::Upper) {
+        // A is stored in upper band
+        // form y += alpha * A * x
+        for (idx_t j = 0; j < n; ++j) {
+            auto tmp1 = alpha*x[j];
+            auto tmp2 = scalar_t(0);
+            for (idx_t i = (j > k) ? j - k : 0; i < j; ++i) {
+                y[i] += tmp1 * A(i,j);
+                tmp2 += A(i,j) * x[i];
+            }
+            y[j] += tmp1 * A(j,j) + alpha * tmp2;
+        }
+    }
+    else {
+        // A is stored in lower band
+        // form y += alpha * A * x
+        for (idx_t j = 0; j < n; ++j) {
+            auto tmp1 = alpha*x[j];
+            auto tmp2 = scalar_t(0);
+            const idx_t i1 = min( n, j + k + 1 );
+            for (idx_t i = j+1; i < i1; ++i) {
+                y[i] += tmp1 * A(i,j);
+                tmp2 += A(i,j) * x[i];
+            }
+            y[j] += tmp1 * A(j,j) + alpha * tmp2;
+        }
+    }
+}
+
+}  // namespace tlapack
+
+#endif        //  #ifndef __TLAPACK_BLAS_SBMV_HH__
@@ -9,6 +9,7 @@
 #define __TLAPACK_BLAS_SCAL_HH__
 
 #include "base/utils.hpp"
+#include "base/profile.hpp"
 
 namespace tlapack {
 
@@ -34,6 +35,8 @@ void scal( const alpha_t& alpha, vector_t& x )
     // constants
     const idx_t n = size(x);
 
+    TLAPACK_PROFILE_SCOPE( "scal", type_t<vector_t>, n, 2.0*n );
+
     for (idx_t i = 0; i < n; ++i)
         x[i] *= alpha;
 }
@@ -9,6 +9,7 @@
 #define __TLAPACK_BLAS_SYR_HH__
 
 #include "base/utils.hpp"
+#include "base/profile.hpp"
 
 namespace tlapack {
 
@@ -52,6 +53,8 @@ void syr(
     // constants
     const idx_t n = nrows(A);
 
+    TLAPACK_PROFILE_SCOPE( "syr", type_t<matrixA_t>, 1.0*n*n, double(n)*(n+1) + n );
+
     // check arguments
     tlapack_check_false( uplo != Uplo::Lower &&
                    uplo != Uplo::Upper );
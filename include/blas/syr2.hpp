@@ -9,6 +9,7 @@
 #define __TLAPACK_BLAS_SYR2_HH__
 
 #include "base/utils.hpp"
+#include "base/profile.hpp"
 
 namespace tlapack {
 
@@ -57,6 +58,8 @@ void syr2(
     // constants
     const idx_t n = nrows(A);
 
+    TLAPACK_PROFILE_SCOPE( "syr2", type_t<matrixA_t>, 2.0*n*n, double(n)*(n+1) + 2.0*n );
+
     // check arguments
     tlapack_check_false( uplo != Uplo::Lower &&
                    uplo != Uplo::Upper );
@@ -9,6 +9,7 @@
 #define __TLAPACK_BLAS_SYR2K_HH__
 
 #include "base/utils.hpp"
+#include "base/profile.hpp"
 
 namespace tlapack {
 
@@ -74,6 +75,8 @@ void syr2k(
     const idx_t n = (trans == Op::NoTrans) ? nrows(A) : ncols(A);
     const idx_t k = (trans == Op::NoTrans) ? ncols(A) : nrows(A);
 
+    TLAPACK_PROFILE_SCOPE( "syr2k", type_t<matrixC_t>, 2.0*k*n*(n+1), 2.0*n*k + double(n)*(n+1) );
+
     // check arguments
     tlapack_check_false( uplo != Uplo::Lower &&
                    uplo != Uplo::Upper &&
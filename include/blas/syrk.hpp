@@ -9,53 +9,20 @@
 #define __TLAPACK_BLAS_SYRK_HH__
 
 #include "base/utils.hpp"
+#include "base/profile.hpp"
 
 namespace tlapack {
 
-/**
- * Symmetric rank-k update:
- * \[
- *     C := \alpha A A^T + \beta C,
- * \]
- * or
- * \[
- *     C := \alpha A^T A + \beta C,
- * \]
- * where alpha and beta are scalars, C is an n-by-n symmetric matrix,
- * and A is an n-by-k or k-by-n matrix.
- *
- * @param[in] uplo
- *     What part of the matrix C is referenced,
- *     the opposite triangle being assumed from symmetry:
- *     - Uplo::Lower: only the lower triangular part of C is referenced.
- *     - Uplo::Upper: only the upper triangular part of C is referenced.
- *
- * @param[in] trans
- *     The operation to be performed:
- *     - Op::NoTrans: $C = \alpha A A^T + \beta C$.
- *     - Op::Trans:   $C = \alpha A^T A + \beta C$.
- *
- * @param[in] alpha Scalar.
- * @param[in] A A n-by-k matrix.
- *     - If trans = NoTrans: a n-by-k matrix.
- *     - Otherwise:          a k-by-n matrix.
- * @param[in] beta Scalar.
- * @param[in,out] C A n-by-n symmetric matrix.
- *
- * @ingroup syrk
- */
+namespace internal {
+
+/// Template implementation of syrk(). The wrappers of the optimized
+/// BLAS use it for the calls they cannot forward to the library.
 template<
     class matrixA_t, class matrixC_t, 
     class alpha_t, class beta_t,
-    class T = type_t<matrixC_t>,
-    disable_if_allow_optblas_t<
-        pair< matrixA_t, T >,
-        pair< matrixC_t, T >,
-        pair< alpha_t,   T >,
-        pair< beta_t,    T >
-    > = 0
+    class T = type_t<matrixC_t>
 >
-void syrk(
+void syrk_template(
     Uplo uplo,
     Op trans,
     const alpha_t& alpha, const matrixA_t& A,
@@ -69,6 +36,8 @@ void syrk(
     const idx_t n = (trans == Op::NoTrans) ? nrows(A) : ncols(A);
     const idx_t k = (trans == Op::NoTrans) ? ncols(A) : nrows(A);
 
+    TLAPACK_PROFILE_SCOPE( "syrk", type_t<matrixC_t>, double(k)*n*(n+1), double(n)*k + double(n)*(n+1) );
+
     // check arguments
     tlapack_check_false( uplo != Uplo::Lower &&
                    uplo != Uplo::Upper &&
@@ -142,6 +111,60 @@ void syrk(
     }
 }
 
+}  // namespace internal
+
+/**
+ * Symmetric rank-k update:
+ * \[
+ *     C := \alpha A A^T + \beta C,
+ * \]
+ * or
+ * \[
+ *     C := \alpha A^T A + \beta C,
+ * \]
+ * where alpha and beta are scalars, C is an n-by-n symmetric matrix,
+ * and A is an n-by-k or k-by-n matrix.
+ *
+ * @param[in] uplo
+ *     What part of the matrix C is referenced,
+ *     the opposite triangle being assumed from symmetry:
+ *     - Uplo::Lower: only the lower triangular part of C is referenced.
+ *     - Uplo::Upper: only the upper triangular part of C is referenced.
+ *
+ * @param[in] trans
+ *     The operation to be performed:
+ *     - Op::NoTrans: $C = \alpha A A^T + \beta C$.
+ *     - Op::Trans:   $C = \alpha A^T A + \beta C$.
+ *
+ * @param[in] alpha Scalar.
+ * @param[in] A A n-by-k matrix.
+ *     - If trans = NoTrans: a n-by-k matrix.
+ *     - Otherwise:          a k-by-n matrix.
+ * @param[in] beta Scalar.
+ * @param[in,out] C A n-by-n symmetric matrix.
+ *
+ * @ingroup syrk
+ */
+template<
+    class matrixA_t, class matrixC_t, 
+    class alpha_t, class beta_t,
+    class T = type_t<matrixC_t>,
+    disable_if_allow_optblas_mixed_t<
+        pair< matrixA_t, T >,
+        pair< matrixC_t, T >,
+        pair< alpha_t,   T >,
+        pair< beta_t,    T >
+    > = 0
+>
+void syrk(
+    Uplo uplo,
+    Op trans,
+    const alpha_t& alpha, const matrixA_t& A,
+    const beta_t& beta, matrixC_t& C )
+{
+    internal::syrk_template( uplo, trans, alpha, A, beta, C );
+}
+
 }  // namespace tlapack
 
 #endif        //  #ifndef __TLAPACK_BLAS_SYRK_HH__
@@ -0,0 +1,159 @@
+// Copyright (c) 2017-2021, University of Tennessee. All rights reserved.
+// Copyright (c) 2021-2022, University of Colorado Denver. All rights reserved.
+//
+// This file is part of <T>LAPACK.
+// <T>LAPACK is free software: you can redistribute it and/or modify it under
+// the terms of the BSD 3-Clause license. See the accompanying LICENSE file.
+
+#ifndef __TLAPACK_BLAS_TBSV_HH__
+#define __TLAPACK_BLAS_TBSV_HH__
+
+#include "base/utils.hpp"
+#include "base/profile.hpp"
+
+namespace tlapack {
+
+/**
+ * Solve the triangular band matrix-vector equation
+ * \[
+ *     op(A) x = b,
+ * \]
+ * where $op(A)$ is one of
+ *     $op(A) = A$,
+ *     $op(A) = A^T$,
+ *     $op(A) = A^H$, or
+ *     $op(A) = conj(A)$,
+ * x and b are vectors, and A is an n-by-n, unit or non-unit, upper or lower
+ * triangular band matrix with k diagonals besides the main diagonal, e.g.,
+ * a legacyBandedMatrix.
+ *
+ * No test for singularity or near-singularity is included in this
+ * routine. Such tests must be performed before calling this routine.
+ *
+ * @param[in] uplo
+ *     What part of the matrix A is referenced,
+ *     the opposite triangle being assumed to be zero.
+ *     - Uplo::Lower: A is lower triangular, and k = lowerband(A).
+ *     - Uplo::Upper: A is upper triangular, and k = upperband(A).
+ *
+ * @param[in] trans
+ *     The equation to be solved:
+ *     - Op::NoTrans:   $A   x = b$,
+ *     - Op::Trans:     $A^T x = b$,
+ *     - Op::ConjTrans: $A^H x = b$,
+ *     - Op::Conj:      $conj(A) x = b$.
+ *
+ * @param[in] diag
+ *     Whether A has a unit or non-unit diagonal:
+ *     - Diag::Unit:    A is assumed to be unit triangular.
+ *                      The diagonal elements of A are not referenced.
+ *     - Diag::NonUnit: A is not assumed to be unit triangular.
+ *
+ * @param[in] A     A n-by-n band matrix.
+ * @param[in,out] x
+ *      On entry, the n-element vector b.
+ *      On exit,  the n-element vector x.
+ *
+ * @ingroup tbsv
+ */
+template< class matrixA_t, class vectorX_t >
+void tbsv(
+    Uplo uplo,
+    Op trans,
+    Diag diag,
+    const matrixA_t& A,
+    vectorX_t& x )
+{
+    // data traits
+    using TA    = type_t< matrixA_t >;
+    using TX    = type_t< vectorX_t >;
+    using idx_t = size_type< matrixA_t >;
+
+    using scalar_t = scalar_type<TA,TX>;
+    using std::min;
+
+    // constants
+    const idx_t n = nrows(A);
+    const idx_t k = (uplo == Uplo::Upper) ? upperband(A) : lowerband(A);
+    const bool nonunit = (diag == Diag::NonUnit);
+    const bool conjA = (trans == Op::ConjTrans || trans == Op::Conj);
+
+    TLAPACK_PROFILE_SCOPE( "tbsv", type_t<vectorX_t>, 2.0*n*k + n, double(n)*(k+1) + 2.0*n );
+
+    // check arguments
+    tlapack_check_false( uplo != Uplo::Lower &&
+                   uplo != Uplo::Upper );
+    tlapack_check_false( trans != Op::NoTrans &&
+                   trans != Op::Trans &&
+                   trans != Op::ConjTrans &&
+                   trans != Op::Conj );
+    tlapack_check_false( diag != Diag::NonUnit &&
+                   diag != Diag::Unit );
+    tlapack_check_false( nrows(A) != ncols(A) );
+    tlapack_check_false( (idx_t) size(x) != n );
+
+    tlapack_check_false( access_denied(
+        (uplo == Uplo::Upper) ? band_t( 0, k ) : band_t( k, 0 ),
+        read_policy(A) ) );
+
+    // A(i,j) or conj( A(i,j) )
+    const auto a = [&]( idx_t i, idx_t j ) -> TA {
+        return (conjA) ? TA( conj( A(i,j) ) ) : A(i,j);
+    };
+
+    if (trans == Op::NoTrans || trans == Op::Conj) {
+        // Form x := op(A)^{-1} * x
+        if (uplo == Uplo::Upper) {
+            // upper
+            for (idx_t j = n - 1; j != idx_t(-1); --j) {
+                // note: NOT skipping if x[j] is zero, for consistent NAN handling
+                if (nonunit)
+                    x[j] /= a(j,j);
+                auto tmp = x[j];
+                for (idx_t i = (j > k) ? j - k : 0; i < j; ++i)
+                    x[i] -= tmp * a(i,j);
+            }
+        }
+        else {
+            // lower
+            for (idx_t j = 0; j < n; ++j) {
+                if (nonunit)
+                    x[j] /= a(j,j);
+                auto tmp = x[j];
+                const idx_t i1 = min( n, j + k + 1 );
+                for (idx_t i = j + 1; i < i1; ++i)
+                    x[i] -= tmp * a(i,j);
+            }
+        }
+    }
+    else {
+        // Form x := op(A)^{-1} * x, op(A) = A^T or A^H
+        if (uplo == Uplo::Upper) {
+            // upper
+            for (idx_t j = 0; j < n; ++j) {
+                scalar_t tmp = x[j];
+                for (idx_t i = (j > k) ? j - k : 0; i < j; ++i)
+                    tmp -= a(i,j) * x[i];
+                if (nonunit)
+                    tmp /= a(j,j);
+                x[j] = tmp;
+            }
+        }
+        else {
+            // lower
+            for (idx_t j = n - 1; j != idx_t(-1); --j) {
+                scalar_t tmp = x[j];
+                const idx_t i1 = min( n, j + k + 1 );
+                for (idx_t i = j + 1; i < i1; ++i)
+                    tmp -= a(i,j) * x[i];
+                if (nonunit)
+                    tmp /= a(j,j);
+                x[j] = tmp;
+            }
+        }
+    }
+}
+
+}  // namespace tlapack
+
+#endif        //  #ifndef __TLAPACK_BLAS_TBSV_HH__
@@ -9,65 +9,19 @@
 #define __TLAPACK_BLAS_TRMM_HH__
 
 #include "base/utils.hpp"
+#include "base/profile.hpp"
 
 namespace tlapack {
 
-/**
- * Triangular matrix-matrix multiply:
- * \[
- *     B := \alpha op(A) B,
- * \]
- * or
- * \[
- *     B := \alpha B op(A),
- * \]
- * where $op(A)$ is one of
- *     $op(A) = A$,
- *     $op(A) = A^T$, or
- *     $op(A) = A^H$,
- * B is an m-by-n matrix, and A is an m-by-m or n-by-n, unit or non-unit,
- * upper or lower triangular matrix.
- *
- * @param[in] side
- *     Whether $op(A)$ is on the left or right of B:
- *     - Side::Left:  $B = \alpha op(A) B$.
- *     - Side::Right: $B = \alpha B op(A)$.
- *
- * @param[in] uplo
- *     What part of the matrix A is referenced,
- *     the opposite triangle being assumed to be zero:
- *     - Uplo::Lower: A is lower triangular.
- *     - Uplo::Upper: A is upper triangular.
- *     - Uplo::General is illegal (see @ref gemm instead).
- *
- * @param[in] trans
- *     The form of $op(A)$:
- *     - Op::NoTrans:   $op(A) = A$.
- *     - Op::Trans:     $op(A) = A^T$.
- *     - Op::ConjTrans: $op(A) = A^H$.
- *
- * @param[in] diag
- *     Whether A has a unit or non-unit diagonal:
- *     - Diag::Unit:    A is assumed to be unit triangular.
- *     - Diag::NonUnit: A is not assumed to be unit triangular.
- *
- * @param[in] alpha Scalar.
- * @param[in] A
- *     - If side = Left: a m-by-m matrix.
- *     - If side = Right: a n-by-n matrix.
- * @param[in,out] B A m-by-n matrix.
- *
- * @ingroup trmm
- */
+namespace internal {
+
+/// Template implementation of trmm(). The wrappers of the optimized
+/// BLAS use it for the problems smaller than optblas_nmin() and for the
+/// calls they cannot forward to the library.
 template< class matrixA_t, class matrixB_t, class alpha_t,
-    class T = type_t<matrixB_t>,
-    disable_if_allow_optblas_t<
-        pair< matrixA_t, T >,
-        pair< matrixB_t, T >,
-        pair< alpha_t,   T >
-    > = 0
+    class T = type_t<matrixB_t>
 >
-void trmm(
+void trmm_template(
     Side side,
     Uplo uplo,
     Op trans,
@@ -88,6 +42,8 @@ void trmm(
     const idx_t m = nrows(B);
     const idx_t n = ncols(B);
 
+    TLAPACK_PROFILE_SCOPE( "trmm", type_t<matrixB_t>, 1.0*m*n*((side == Side::Left) ? m : n), 0.5*((side == Side::Left) ? m*(m+1) : n*(n+1)) + 2.0*m*n );
+
     // check arguments
     tlapack_check_false( side != Side::Left &&
                    side != Side::Right );
@@ -286,6 +242,75 @@ void trmm(
     }
 }
 
+}  // namespace internal
+
+/**
+ * Triangular matrix-matrix multiply:
+ * \[
+ *     B := \alpha op(A) B,
+ * \]
+ * or
+ * \[
+ *     B := \alpha B op(A),
+ * \]
+ * where $op(A)$ is one of
+ *     $op(A) = A$,
+ *     $op(A) = A^T$, or
+ *     $op(A) = A^H$,
+ * B is an m-by-n matrix, and A is an m-by-m or n-by-n, unit or non-unit,
+ * upper or lower triangular matrix.
+ *
+ * @param[in] side
+ *     Whether $op(A)$ is on the left or right of B:
+ *     - Side::Left:  $B = \alpha op(A) B$.
+ *     - Side::Right: $B = \alpha B op(A)$.
+ *
+ * @param[in] uplo
+ *     What part of the matrix A is referenced,
+ *     the opposite triangle being assumed to be zero:
+ *     - Uplo::Lower: A is lower triangular.
+ *     - Uplo::Upper: A is upper triangular.
+ *     - Uplo::General is illegal (see @ref gemm instead).
+ *
+ * @param[in] trans
+ *     The form of $op(A)$:
+ *     - Op::NoTrans:   $op(A) = A$.
+ *     - Op::Trans:     $op(A) = A^T$.
+ *     - Op::ConjTrans: $op(A) = A^H$.
+ *
+ * @param[in] diag
+ *     Whether A has a unit or non-unit diagonal:
+ *     - Diag::Unit:    A is assumed to be unit triangular.
+ *     - Diag::NonUnit: A is not assumed to be unit triangular.
+ *
+ * @param[in] alpha Scalar.
+ * @param[in] A
+ *     - If side = Left: a m-by-m matrix.
+ *     - If side = Right: a n-by-n matrix.
+ * @param[in,out] B A m-by-n matrix.
+ *
+ * @ingroup trmm
+ */
+template< class matrixA_t, class matrixB_t, class alpha_t,
+    class T = type_t<matrixB_t>,
+    disable_if_allow_optblas_mixed_t<
+        pair< matrixA_t, T >,
+        pair< matrixB_t, T >,
+        pair< alpha_t,   T >
+    > = 0
+>
+void trmm(
+    Side side,
+    Uplo uplo,
+    Op trans,
+    Diag diag,
+    const alpha_t& alpha,
+    const matrixA_t& A,
+    matrixB_t& B )
+{
+    internal::trmm_template( side, uplo, trans, diag, alpha, A, B );
+}
+
 }  // namespace tlapack
 
 #endif        //  #ifndef __TLAPACK_BLAS_TRMM_HH__
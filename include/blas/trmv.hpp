@@ -9,6 +9,7 @@
 #define __TLAPACK_BLAS_TRMV_HH__
 
 #include "base/utils.hpp"
+#include "base/profile.hpp"
 
 namespace tlapack {
 
@@ -71,6 +72,8 @@ void trmv(
     const idx_t n = nrows(A);
     const bool nonunit = (diag == Diag::NonUnit);
 
+    TLAPACK_PROFILE_SCOPE( "trmv", type_t<vectorX_t>, 1.0*n*n, 0.5*n*(n+1) + 2.0*n );
+
     // check arguments
     tlapack_check_false( uplo != Uplo::Lower &&
                    uplo != Uplo::Upper );
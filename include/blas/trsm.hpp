@@ -9,69 +9,19 @@
 #define __TLAPACK_BLAS_TRSM_HH__
 
 #include "base/utils.hpp"
+#include "base/profile.hpp"
 
 namespace tlapack {
 
-/**
- * Solve the triangular matrix-vector equation
- * \[
- *     op(A) X = \alpha B,
- * \]
- * or
- * \[
- *     X op(A) = \alpha B,
- * \]
- * where $op(A)$ is one of
- *     $op(A) = A$,
- *     $op(A) = A^T$, or
- *     $op(A) = A^H$,
- * X and B are m-by-n matrices, and A is an m-by-m or n-by-n, unit or non-unit,
- * upper or lower triangular matrix.
- *
- * No test for singularity or near-singularity is included in this
- * routine. Such tests must be performed before calling this routine.
- *
- * @param[in] side
- *     Whether $op(A)$ is on the left or right of X:
- *     - Side::Left:  $op(A) X = B$.
- *     - Side::Right: $X op(A) = B$.
- *
- * @param[in] uplo
- *     What part of the matrix A is referenced,
- *     the opposite triangle being assumed to be zero:
- *     - Uplo::Lower: A is lower triangular.
- *     - Uplo::Upper: A is upper triangular.
- *
- * @param[in] trans
- *     The form of $op(A)$:
- *     - Op::NoTrans:   $op(A) = A$.
- *     - Op::Trans:     $op(A) = A^T$.
- *     - Op::ConjTrans: $op(A) = A^H$.
- *
- * @param[in] diag
- *     Whether A has a unit or non-unit diagonal:
- *     - Diag::Unit:    A is assumed to be unit triangular.
- *     - Diag::NonUnit: A is not assumed to be unit triangular.
- *
- * @param[in] alpha Scalar.
- * @param[in] A
- *     - If side = Left: a m-by-m matrix.
- *     - If side = Right: a n-by-n matrix.
- * @param[in,out] B
- *      On entry, the m-by-n matrix B.
- *      On exit,  the m-by-n matrix X.
- *
- * @ingroup trsm
- */
+namespace internal {
+
+/// Template implementation of trsm(). The wrappers of the optimized
+/// BLAS use it for the problems smaller than optblas_nmin() and for the
+/// calls they cannot forward to the library.
 template< class matrixA_t, class matrixB_t, class alpha_t,
-    class T = type_t<matrixB_t>,
-    disable_if_allow_optblas_t<
-        pair< matrixA_t, T >,
-        pair< matrixB_t, T >,
-        pair< alpha_t,   T >
-    > = 0
+    class T = type_t<matrixB_t>
 >
-void trsm(
+void trsm_template(
     Side side,
     Uplo uplo,
     Op trans,
@@ -87,6 +37,8 @@ void trsm(
     const idx_t m = nrows(B);
     const idx_t n = ncols(B);
 
+    TLAPACK_PROFILE_SCOPE( "trsm", type_t<matrixB_t>, 1.0*m*n*((side == Side::Left) ? m : n), 0.5*((side == Side::Left) ? m*(m+1) : n*(n+1)) + 2.0*m*n );
+
     // check arguments
     tlapack_check_false( side != Side::Left &&
                    side != Side::Right );
@@ -277,6 +229,79 @@ void trsm(
     }
 }
 
+}  // namespace internal
+
+/**
+ * Solve the triangular matrix-vector equation
+ * \[
+ *     op(A) X = \alpha B,
+ * \]
+ * or
+ * \[
+ *     X op(A) = \alpha B,
+ * \]
+ * where $op(A)$ is one of
+ *     $op(A) = A$,
+ *     $op(A) = A^T$, or
+ *     $op(A) = A^H$,
+ * X and B are m-by-n matrices, and A is an m-by-m or n-by-n, unit or non-unit,
+ * upper or lower triangular matrix.
+ *
+ * No test for singularity or near-singularity is included in this
+ * routine. Such tests must be performed before calling this routine.
+ *
+ * @param[in] side
+ *     Whether $op(A)$ is on the left or right of X:
+ *     - Side::Left:  $op(A) X = B$.
+ *     - Side::Right: $X op(A) = B$.
+ *
+ * @param[in] uplo
+ *     What part of the matrix A is referenced,
+ *     the opposite triangle being assumed to be zero:
+ *     - Uplo::Lower: A is lower triangular.
+ *     - Uplo::Upper: A is upper triangular.
+ *
+ * @param[in] trans
+ *     The form of $op(A)$:
+ *     - Op::NoTrans:   $op(A) = A$.
+ *     - Op::Trans:     $op(A) = A^T$.
+ *     - Op::ConjTrans: $op(A) = A^H$.
+ *
+ * @param[in] diag
+ *     Whether A has a unit or non-unit diagonal:
+ *     - Diag::Unit:    A is assumed to be unit triangular.
+ *     - Diag::NonUnit: A is not assumed to be unit triangular.
+ *
+ * @param[in] alpha Scalar.
+ * @param[in] A
+ *     - If side = Left: a m-by-m matrix.
+ *     - If side = Right: a n-by-n matrix.
+ * @param[in,out] B
+ *      On entry, the m-by-n matrix B.
+ *      On exit,  the m-by-n matrix X.
+ *
+ * @ingroup trsm
+ */
+template< class matrixA_t, class matrixB_t, class alpha_t,
+    class T = type_t<matrixB_t>,
+    disable_if_allow_optblas_mixed_t<
+        pair< matrixA_t, T >,
+        pair< matrixB_t, T >,
+        pair< alpha_t,   T >
+    > = 0
+>
+void trsm(
+    Side side,
+    Uplo uplo,
+    Op trans,
+    Diag diag,
+    const alpha_t& alpha,
+    const matrixA_t& A,
+    matrixB_t& B )
+{
+    internal::trsm_template( side, uplo, trans, diag, alpha, A, B );
+}
+
 }  // namespace tlapack
 
 #endif        //  #ifndef __TLAPACK_BLAS_TRSM_HH__
@@ -13,18 +13,105 @@
 #include <complex>
 
 #include "base/utils.hpp"
+#include "base/profile.hpp"
 #include "base/types.hpp"
 #include "lapack/larfg.hpp"
 #include "lapack/larf.hpp"
 #include "lapack/lahqr.hpp"
 #include "lapack/lahqr_eig22.hpp"
 #include "lapack/gehd2.hpp"
+#include "lapack/gehrd.hpp"
 #include "lapack/unghr.hpp"
 #include "lapack/multishift_qr.hpp"
 
 namespace tlapack
 {
 
+    /**
+     * Returns the size of the workspace opts._work such that the nested
+     * calls to multishift_qr and gehrd in agressive_early_deflation do not
+     * borrow workspace from the arena.
+     * The arguments are the same as for agressive_early_deflation itself.
+     *
+     * @return idx_t The size of the required workspace
+     */
+    template <
+        class matrix_t,
+        class vector_t,
+        typename idx_t = size_type<matrix_t>,
+        enable_if_t<is_complex<type_t<vector_t>>::value, bool> = true>
+    idx_t get_work_agressive_early_deflation(bool want_t, bool want_z, idx_t ilo, idx_t ihi, idx_t nw, matrix_t &A, vector_t &s, matrix_t &Z, const francis_opts_t<size_type<matrix_t>, type_t<matrix_t>> &opts)
+    {
+        using T = type_t<matrix_t>;
+        using pair = std::pair<idx_t, idx_t>;
+        using std::min;
+
+        const idx_t n = ncols(A);
+        const idx_t nw_max = (n - 3) / 3;
+        const idx_t jw = min(min(nw, ihi - ilo), nw_max);
+
+        // 1x1 deflation window, no workspace needed
+        if (jw <= 1)
+            return 0;
+
+        // Same workspace matrices as in agressive_early_deflation
+        auto V = slice(A, pair{n - jw, n}, pair{0, jw});
+        auto TW = slice(A, pair{n - jw, n}, pair{jw, 2 * jw});
+        auto WV = slice(A, pair{jw + 3, n - jw}, pair{0, jw});
+        auto s_window = slice(s, pair{ihi - jw, ihi});
+        auto tau = slice(WV, pair{0, jw}, 0);
+
+        const idx_t qr_workspace = (jw < tuned<T>(opts.nmin, "multishift_qr", "nmin", jw))
+            ? 0
+            : get_work_multishift_qr(true, true, 0, jw, TW, s_window, V, opts);
+        gehrd_opts_t<idx_t, T> gehrd_opts;
+        return std::max<idx_t>(qr_workspace, get_work_gehrd(0, jw, TW, tau, gehrd_opts));
+    }
+
+    /**
+     * Returns the number of bytes the nested calls to multishift_qr and
+     * gehrd in agressive_early_deflation borrow from the workspace arena.
+     * The arguments are the same as for agressive_early_deflation itself.
+     *
+     * @return 0 if opts provides a workspace of at least
+     *      get_work_agressive_early_deflation() elements.
+     */
+    template <
+        class matrix_t,
+        class vector_t,
+        typename idx_t = size_type<matrix_t>,
+        enable_if_t<is_complex<type_t<vector_t>>::value, bool> = true>
+    std::size_t get_worksize_agressive_early_deflation(bool want_t, bool want_z, idx_t ilo, idx_t ihi, idx_t nw, matrix_t &A, vector_t &s, matrix_t &Z, const francis_opts_t<size_type<matrix_t>, type_t<matrix_t>> &opts)
+    {
+        using T = type_t<matrix_t>;
+        using pair = std::pair<idx_t, idx_t>;
+        using std::min;
+
+        const idx_t n = ncols(A);
+        const idx_t nw_max = (n - 3) / 3;
+        const idx_t jw = min(min(nw, ihi - ilo), nw_max);
+
+        // 1x1 deflation window, no workspace needed
+        if (jw <= 1)
+            return 0;
+
+        // Same workspace matrices as in agressive_early_deflation
+        auto V = slice(A, pair{n - jw, n}, pair{0, jw});
+        auto TW = slice(A, pair{n - jw, n}, pair{jw, 2 * jw});
+        auto WV = slice(A, pair{jw + 3, n - jw}, pair{0, jw});
+        auto s_window = slice(s, pair{ihi - jw, ihi});
+        auto tau = slice(WV, pair{0, jw}, 0);
+
+        // The calls are sequential, so the peak is the largest of the two
+        const std::size_t qr_worksize = (jw < tuned<T>(opts.nmin, "multishift_qr", "nmin", jw))
+            ? 0
+            : get_worksize_multishift_qr(true, true, 0, jw, TW, s_window, V, opts);
+        gehrd_opts_t<idx_t, T> gehrd_opts;
+        gehrd_opts.lwork = opts.lwork;
+        gehrd_opts._work = opts._work;
+        return std::max(qr_worksize, get_worksize_gehrd(0, jw, TW, tau, gehrd_opts));
+    }
+
     /** agressive_early_deflation accepts as input an upper Hessenberg matrix
      *  H and performs an orthogonal similarity transformation
      *  designed to detect and deflate fully converged eigenvalues from
@@ -103,6 +190,8 @@ namespace tlapack
         // First row index in the deflation window
         const idx_t kwtop = ihi - jw;
 
+        TLAPACK_PROFILE_SCOPE( "agressive_early_deflation", type_t<matrix_t>, 0, double(jw)*jw + double(n)*jw );
+
         // Assertions
         assert(nrows(A) == n);
         assert(ncols(Z) == n);
@@ -155,7 +244,7 @@ namespace tlapack
                 TW(i, j) = A_window(i, j);
         laset(Uplo::General, zero, one, V);
         int infqr;
-        if( jw < opts.nmin )
+        if( jw < tuned<T>(opts.nmin, "multishift_qr", "nmin", jw) )
             infqr = lahqr(true, true, 0, jw, TW, s_window, V);
         else{
             infqr = multishift_qr(true, true, 0, jw, TW, s_window, V, opts);
@@ -347,6 +436,7 @@ namespace tlapack
                 gehrd_opts_t<idx_t, T> gehrd_opts;
                 gehrd_opts.lwork = opts.lwork;
                 gehrd_opts._work = opts._work;
+                gehrd_opts.arena = opts.arena;
                 gehrd(0, ns, TW, tau, gehrd_opts);
                 auto work2 = slice(WV, pair{0, jw}, 1);
                 unmhr(Side::Right, Op::NoTrans, 0, ns, TW, tau, V, work2);
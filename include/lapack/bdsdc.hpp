@@ -0,0 +1,242 @@
+/// @file bdsdc.hpp
+//
+// Copyright (c) 2022, University of Colorado Denver. All rights reserved.
+//
+// This file is part of <T>LAPACK.
+// <T>LAPACK is free software: you can redistribute it and/or modify it under
+// the terms of the BSD 3-Clause license. See the accompanying LICENSE file.
+
+#ifndef __TLAPACK_BDSDC_HH__
+#define __TLAPACK_BDSDC_HH__
+
+#include "legacy_api/base/utils.hpp"
+#include "base/utils.hpp"
+#include "base/profile.hpp"
+#include "base/types.hpp"
+#include "base/workspace.hpp"
+#include "lapack/laset.hpp"
+#include "lapack/stedc.hpp"
+#include "lapack/bdsqr.hpp"
+#include "blas/gemv.hpp"
+#include "blas/nrm2.hpp"
+#include "blas/scal.hpp"
+
+namespace tlapack
+{
+
+    /**
+     * Options struct for bdsdc
+     */
+    template <typename idx_t, typename T>
+    struct bdsdc_opts_t {
+        // Subproblems of size at most smlsiz are solved by steqr in stedc
+        idx_t smlsiz = 25;
+        // If true, stedc solves independent subproblems in parallel.
+        // Has no effect if <T>LAPACK is not compiled with OpenMP.
+        bool parallel = false;
+        // Workspace pointer, if no workspace is provided, one will be allocated internally
+        T* _work=nullptr;
+        // Workspace size
+        idx_t lwork = 0;
+        // Arena used if no workspace is provided. If nullptr, the default
+        // arena of the calling thread is used.
+        workspace_arena* arena = nullptr;
+    };
+
+    /**
+     * Returns the required workspace for bdsdc.
+     * The arguments are the same as for bdsdc itself.
+     *
+     * @return idx_t The size of the required workspace
+     */
+    template <class vectorD_t, class vectorE_t, class matrixU_t, class matrixVT_t, typename idx_t = size_type<matrixU_t>, typename real_t = type_t<vectorD_t>>
+    idx_t get_work_bdsdc(bool want_vectors, vectorD_t &d, vectorE_t &e, matrixU_t &U, matrixVT_t &VT, const bdsdc_opts_t<idx_t, real_t> &opts = {})
+    {
+        const idx_t n = size(d);
+
+        // The Golub-Kahan tridiagonal matrix of order 2n, its eigenvectors,
+        // the workspace of stedc, and a copy of B for the fallback to bdsqr
+        return (want_vectors && n > 1)
+            ? 4*n + 4*n*n + (8*n*n + 10*n) + 2*n
+            : 0;
+    }
+
+    /** Computes the singular values and, optionally, the singular vectors of a
+     * real n-by-n upper bidiagonal matrix B using a divide and conquer
+     * method: $B = U S V^T$.
+     *
+     * The singular values and vectors of B are obtained from the eigensystem
+     * of the Golub-Kahan tridiagonal matrix
+     * \[
+     *      T_{GK} = P^T \begin{bmatrix} 0 & B^T \\ B & 0 \end{bmatrix} P,
+     * \]
+     * of order 2n, which has zero diagonal and off-diagonal
+     * (d[0], e[0], d[1], e[1], ..., d[n-1]). The eigenvalues of T_GK are
+     * the singular values of B and their negatives, and each eigenvector
+     * associated with sigma_i interleaves v_i and u_i. The eigensystem is
+     * computed by stedc, and the singular vectors are normalized and
+     * reorthogonalized against the ones of larger singular values.
+     *
+     * When B is numerically singular, the singular vectors of the null space
+     * cannot be recovered from T_GK, so bdsdc falls back to bdsqr.
+     *
+     * If want_vectors is false, U and VT are not referenced and the singular
+     * values are computed by bdsqr with O(n^2) work.
+     *
+     * @return  0 if success
+     * @return  > 0 if the algorithm failed to converge.
+     *
+     * @param[in] want_vectors bool.
+     *      If true, the singular vectors of B are computed.
+     * @param[in,out] d Real vector of length n.
+     *      On entry, the diagonal elements of B.
+     *      On exit, if successful, the singular values in decreasing order.
+     * @param[in,out] e Real vector of length n-1.
+     *      On entry, the superdiagonal elements of B.
+     *      On exit, e has been destroyed.
+     * @param[out] U n-by-n real matrix.
+     *      If want_vectors is true, the left singular vectors of B.
+     * @param[out] VT n-by-n real matrix.
+     *      If want_vectors is true, the transposed right singular vectors
+     *      of B.
+     *
+     * @param[in,out] opts Struct containing the options
+     *      See bdsdc_opts_t for more details
+     *
+     * @ingroup bdsvd
+     */
+    template <class vectorD_t, class vectorE_t, class matrixU_t, class matrixVT_t, typename idx_t = size_type<matrixU_t>, typename real_t = type_t<vectorD_t>>
+    int bdsdc(bool want_vectors, vectorD_t &d, vectorE_t &e, matrixU_t &U, matrixVT_t &VT, const bdsdc_opts_t<idx_t, real_t> &opts = {})
+    {
+        using pair = pair<idx_t, idx_t>;
+
+        // constants
+        const real_t zero(0);
+        const real_t one(1);
+        const idx_t n = size(d);
+        const real_t eps = ulp<real_t>();
+
+        TLAPACK_PROFILE_SCOPE( "bdsdc", real_t, 0, double(n)*n*((want_vectors) ? 2 : 0) + 2.0*n );
+
+        // check arguments
+        tlapack_check_false(n > 0 && (idx_t)size(e) < n - 1, -3);
+        tlapack_check_false(want_vectors && (nrows(U) != n || ncols(U) != n), -4);
+        tlapack_check_false(want_vectors && (nrows(VT) != n || ncols(VT) != n), -5);
+
+        // quick return
+        if (n <= 0)
+            return 0;
+
+        // Singular values only
+        if (!want_vectors)
+            return bdsqr(false, false, d, e, U, VT);
+
+        if (n == 1)
+        {
+            U(0, 0) = one;
+            VT(0, 0) = (d[0] < zero) ? -one : one;
+            d[0] = abs(d[0]);
+            return 0;
+        }
+
+        // Get the workspace
+        idx_t required_workspace = get_work_bdsdc(want_vectors, d, e, U, VT, opts);
+        // Use the provided workspace if it is large enough, otherwise borrow
+        // it from the arena
+        local_workspace<real_t> workspace( opts._work, opts.lwork, required_workspace, opts.arena );
+        real_t* _work = workspace.data();
+
+        const idx_t n2 = 2 * n;
+        auto dt = legacyVector<real_t>( n2, &_work[0] );
+        auto et = legacyVector<real_t>( n2 - 1, &_work[n2] );
+        auto Z = legacyMatrix<real_t, layout<matrixU_t>>( n2, n2, &_work[2 * n2], n2 );
+        auto d0 = legacyVector<real_t>( n, &_work[2 * n2 + n2 * n2 + 2 * n2 * n2 + 5 * n2] );
+        auto e0 = legacyVector<real_t>( n - 1, &_work[2 * n2 + n2 * n2 + 2 * n2 * n2 + 5 * n2 + n] );
+
+        // Form the Golub-Kahan tridiagonal matrix
+        real_t dmax = zero;
+        for (idx_t i = 0; i < n; ++i)
+        {
+            d0[i] = d[i];
+            dt[2 * i] = zero;
+            dt[2 * i + 1] = zero;
+            et[2 * i] = d[i];
+            dmax = std::max(dmax, abs(d[i]));
+        }
+        for (idx_t i = 0; i + 1 < n; ++i)
+        {
+            e0[i] = e[i];
+            et[2 * i + 1] = e[i];
+            dmax = std::max(dmax, abs(e[i]));
+        }
+
+        stedc_opts_t<idx_t, real_t> stedc_opts;
+        stedc_opts.smlsiz = opts.smlsiz;
+        stedc_opts.parallel = opts.parallel;
+        stedc_opts._work = &_work[2 * n2 + n2 * n2];
+        stedc_opts.lwork = 2 * n2 * n2 + 5 * n2;
+        stedc_opts.arena = opts.arena;
+        int info = stedc(true, dt, et, Z, stedc_opts);
+
+        // The i-th largest eigenvalue of T_GK is the i-th singular value of B
+        bool fallback = (info != 0) || (dt[n] <= n * eps * dmax);
+        const real_t sqrt_half = sqrt(real_t(0.5));
+        for (idx_t i = 0; i < n && !fallback; ++i)
+        {
+            const idx_t k = n2 - 1 - i;
+            d[i] = dt[k];
+            auto ui = slice(U, pair{0, n}, i);
+            auto vi = slice(VT, i, pair{0, n});
+            for (idx_t j = 0; j < n; ++j)
+            {
+                vi[j] = Z(2 * j, k);
+                ui[j] = Z(2 * j + 1, k);
+            }
+
+            // Reorthogonalize against the vectors of larger singular values
+            // using classical Gram-Schmidt twice
+            if (i > 0)
+            {
+                auto U0 = slice(U, pair{0, n}, pair{0, i});
+                auto VT0 = slice(VT, pair{0, i}, pair{0, n});
+                auto h = slice(dt, pair{0, i});
+                for (int pass = 0; pass < 2; ++pass)
+                {
+                    gemv(Op::Trans, one, U0, ui, zero, h);
+                    gemv(Op::NoTrans, -one, U0, h, one, ui);
+                    gemv(Op::NoTrans, one, VT0, vi, zero, h);
+                    gemv(Op::Trans, -one, VT0, h, one, vi);
+                }
+            }
+
+            // Each half of the eigenvector has norm 1/sqrt(2) if sigma_i is
+            // well separated from zero
+            const real_t unorm = nrm2(ui);
+            const real_t vnorm = nrm2(vi);
+            if (unorm < sqrt_half / 2 || vnorm < sqrt_half / 2)
+                fallback = true;
+            else
+            {
+                scal(one / unorm, ui);
+                scal(one / vnorm, vi);
+            }
+        }
+
+        if (fallback)
+        {
+            // Use the QR method on the original matrix
+            for (idx_t i = 0; i < n; ++i)
+                d[i] = d0[i];
+            for (idx_t i = 0; i + 1 < n; ++i)
+                e[i] = e0[i];
+            laset(dense, zero, one, U);
+            laset(dense, zero, one, VT);
+            info = bdsqr(true, true, d, e, U, VT);
+        }
+
+        return info;
+    }
+
+} // lapack
+
+#endif // __TLAPACK_BDSDC_HH__
@@ -0,0 +1,238 @@
+/// @file bdsqr.hpp
+/// Adapted from @see https://github.com/Reference-LAPACK/lapack/tree/master/SRC/dbdsqr.f
+//
+// Copyright (c) 2022, University of Colorado Denver. All rights reserved.
+//
+// This file is part of <T>LAPACK.
+// <T>LAPACK is free software: you can redistribute it and/or modify it under
+// the terms of the BSD 3-Clause license. See the accompanying LICENSE file.
+
+#ifndef __TLAPACK_BDSQR_HH__
+#define __TLAPACK_BDSQR_HH__
+
+#include "base/utils.hpp"
+#include "base/profile.hpp"
+#include "base/types.hpp"
+#include "lapack/lapy2.hpp"
+#include "blas/rot.hpp"
+#include "blas/scal.hpp"
+#include "blas/swap.hpp"
+
+namespace tlapack {
+
+/** Computes the singular values and, optionally, the singular vectors of a
+ * real n-by-n upper bidiagonal matrix B using the implicit QR method:
+ * $B = Q S P^T$.
+ *
+ * Each QR sweep uses the shift given by the eigenvalue of the trailing 2x2
+ * block of $B^T B$ closest to its last diagonal element. When a diagonal
+ * element of B is negligible, the corresponding superdiagonal element is
+ * annihilated by plane rotations from the left before the next sweep.
+ * Off-diagonal elements are deflated with the absolute criterion
+ * |e[i]| <= eps * max_j( |d[j]| + |e[j]| ).
+ *
+ * If want_u and want_vt are false, U and VT are not referenced and only the
+ * singular values are computed, with O(n^2) work.
+ *
+ * @return  0 if success
+ * @return  i if the algorithm failed to converge in 40 iterations for one
+ *            of the singular values. In this case, d and e contain the
+ *            elements of a bidiagonal matrix which is orthogonally
+ *            equivalent to B, and i is the number of singular values that
+ *            have not converged.
+ *
+ * @param[in] want_u bool.
+ *      If true, the left rotations are accumulated in U.
+ * @param[in] want_vt bool.
+ *      If true, the right rotations are accumulated in VT.
+ * @param[in,out] d Real vector of length n.
+ *      On entry, the diagonal elements of B.
+ *      On exit, if successful, the singular values in decreasing order.
+ * @param[in,out] e Real vector of length n-1.
+ *      On entry, the superdiagonal elements of B.
+ *      On exit, e has been destroyed.
+ * @param[in,out] U nru-by-n matrix.
+ *      On exit, if want_u is true, U is replaced by U Q.
+ *      Use the identity to obtain the left singular vectors of B.
+ * @param[in,out] VT n-by-ncvt matrix.
+ *      On exit, if want_vt is true, VT is replaced by P^T VT.
+ *      Use the identity to obtain the transposed right singular vectors
+ *      of B.
+ *
+ * @ingroup bdsvd
+ */
+template< class vectorD_t, class vectorE_t, class matrixU_t, class matrixVT_t >
+int bdsqr( bool want_u, bool want_vt, vectorD_t& d, vectorE_t& e, matrixU_t& U, matrixVT_t& VT )
+{
+    using real_t = type_t< vectorD_t >;
+    using idx_t  = size_type< vectorD_t >;
+    using pair   = pair<idx_t,idx_t>;
+
+    // constants
+    const real_t zero(0);
+    const real_t one(1);
+    const real_t two(2);
+    const idx_t n = size(d);
+    const real_t eps = ulp<real_t>();
+    const idx_t itmax = 40;
+
+    // check arguments
+    tlapack_check_false( n > 0 && (idx_t) size(e) < n-1, -4 );
+    tlapack_check_false( want_u && ncols(U) != n, -5 );
+    tlapack_check_false( want_vt && nrows(VT) != n, -6 );
+
+    // quick return
+    if (n <= 0) return 0;
+
+    const idx_t nru = (want_u) ? nrows(U) : 0;
+    const idx_t ncvt = (want_vt) ? ncols(VT) : 0;
+
+    TLAPACK_PROFILE_SCOPE( "bdsqr", real_t, 0, double(nru)*n + double(n)*ncvt + 2.0*n );
+
+    // Threshold for negligible elements
+    real_t anorm = zero;
+    for( idx_t i = 0; i < n; ++i )
+        anorm = std::max( anorm, abs(d[i]) + ((i+1 < n) ? abs(e[i]) : zero) );
+    const real_t tol = eps * anorm;
+
+    // The singular values are found one at a time, from the bottom of the
+    // matrix to the top
+    for( idx_t k = n; k-- > 0; ) {
+        for( idx_t its = 0; ; ++its ) {
+
+            // Look for a negligible superdiagonal element e[l-1] to split the
+            // matrix, or a negligible diagonal element d[l-1]
+            bool cancel = false;
+            idx_t l = k;
+            for( ; l > 0; --l ) {
+                if( abs( e[l-1] ) <= tol )
+                    break;
+                if( abs( d[l-1] ) <= tol ) {
+                    cancel = true;
+                    break;
+                }
+            }
+
+            if( cancel ) {
+                // d[l-1] is negligible, so e[l-1] can be annihilated by
+                // rotations from the left on rows l-1 and l, ..., l-1 and k
+                real_t c = zero;
+                real_t s = one;
+                for( idx_t i = l; i <= k; ++i ) {
+                    const real_t f = s * e[i-1];
+                    e[i-1] = c * e[i-1];
+                    if( abs( f ) <= tol )
+                        break;
+                    const real_t g = d[i];
+                    const real_t h = lapy2( f, g );
+                    d[i] = h;
+                    c = g / h;
+                    s = -f / h;
+                    if( want_u ) {
+                        auto u1 = slice( U, pair{0,nru}, l-1 );
+                        auto u2 = slice( U, pair{0,nru}, i );
+                        rot( u1, u2, c, s );
+                    }
+                }
+            }
+
+            real_t z = d[k];
+            if( l == k ) {
+                // Convergence: make the singular value nonnegative
+                if( z < zero ) {
+                    d[k] = -z;
+                    if( want_vt ) {
+                        auto vk = slice( VT, k, pair{0,ncvt} );
+                        scal( -one, vk );
+                    }
+                }
+                break;
+            }
+
+            if( its == itmax ) {
+                return k+1;
+            }
+
+            // Shift from the trailing 2x2 block of B^T B
+            real_t x = d[l];
+            real_t y = d[k-1];
+            real_t g = ( k-1 > l ) ? e[k-2] : zero;
+            real_t h = e[k-1];
+            real_t f = ( (y - z) * (y + z) + (g - h) * (g + h) ) / ( two * h * y );
+            g = lapy2( f, one );
+            f = ( (x - z) * (x + z) + h * ( (y / ( f + ((f >= zero) ? g : -g) )) - h ) ) / x;
+
+            // Chase the bulge from the top to the bottom of the block
+            real_t c = one;
+            real_t s = one;
+            for( idx_t j = l; j < k; ++j ) {
+                const idx_t i = j + 1;
+                g = e[j];
+                y = d[i];
+                h = s * g;
+                g = c * g;
+                z = lapy2( f, h );
+                if( j > l ) e[j-1] = z;
+                c = f / z;
+                s = h / z;
+                f = x * c + g * s;
+                g = g * c - x * s;
+                h = y * s;
+                y = y * c;
+                if( want_vt ) {
+                    auto v1 = slice( VT, j, pair{0,ncvt} );
+                    auto v2 = slice( VT, i, pair{0,ncvt} );
+                    rot( v1, v2, c, s );
+                }
+                z = lapy2( f, h );
+                d[j] = z;
+                if( z != zero ) {
+                    c = f / z;
+                    s = h / z;
+                }
+                f = c * g + s * y;
+                x = c * y - s * g;
+                if( want_u ) {
+                    auto u1 = slice( U, pair{0,nru}, j );
+                    auto u2 = slice( U, pair{0,nru}, i );
+                    rot( u1, u2, c, s );
+                }
+            }
+            if( l > 0 ) e[l-1] = zero;
+            e[k-1] = f;
+            d[k] = x;
+        }
+    }
+
+    // Sort the singular values in decreasing order
+    for( idx_t i = 0; i < n-1; ++i ) {
+        idx_t k = i;
+        real_t p = d[i];
+        for( idx_t j = i+1; j < n; ++j ) {
+            if( d[j] > p ) {
+                k = j;
+                p = d[j];
+            }
+        }
+        if( k != i ) {
+            d[k] = d[i];
+            d[i] = p;
+            if( want_u ) {
+                auto ui = slice( U, pair{0,nru}, i );
+                auto uk = slice( U, pair{0,nru}, k );
+                tlapack::swap( ui, uk );
+            }
+            if( want_vt ) {
+                auto vi = slice( VT, i, pair{0,ncvt} );
+                auto vk = slice( VT, k, pair{0,ncvt} );
+                tlapack::swap( vi, vk );
+            }
+        }
+    }
+
+    return 0;
+}
+
+} // lapack
+
+#endif // __TLAPACK_BDSQR_HH__
@@ -0,0 +1,297 @@
+/// @file chol_update.hpp Blocked rank-k update and downdate of a Cholesky factorization.
+//
+// Copyright (c) 2022, University of Colorado Denver. All rights reserved.
+//
+// This file is part of <T>LAPACK.
+// <T>LAPACK is free software: you can redistribute it and/or modify it under
+// the terms of the BSD 3-Clause license. See the accompanying LICENSE file.
+
+#ifndef __TLAPACK_CHOL_UPDATE_HH__
+#define __TLAPACK_CHOL_UPDATE_HH__
+
+#include "base/utils.hpp"
+#include "base/profile.hpp"
+#include "base/tuning.hpp"
+#include "base/workspace.hpp"
+#include "legacy_api/base/utils.hpp"
+
+#include "lapack/chol_update1.hpp"
+#include "lapack/lacpy.hpp"
+#include "lapack/laset.hpp"
+#include "lapack/transpose.hpp"
+#include "tblas.hpp"
+
+namespace tlapack {
+
+/// Options struct for chol_update and chol_downdate
+template< typename idx_t, typename T >
+struct chol_update_opts_t
+{
+    // Block size. The columns of X are processed in groups of nb, and the
+    // factor by blocks of as many rows or columns. chol_update1 is used on
+    // each column of X if nb <= 1
+    tunable<idx_t> nb = {tuning_default, 32};
+    // Workspace pointer, if no workspace is provided, one will be allocated internally
+    T* _work = nullptr;
+    // Workspace size
+    idx_t lwork = 0;
+    // Arena used if no workspace is provided. If nullptr, the default
+    // arena of the calling thread is used.
+    workspace_arena* arena = nullptr;
+};
+
+/**
+ * Returns the required workspace for chol_update and chol_downdate, i.e.,
+ * the size of the p-by-p matrix of the accumulated rotations and of the
+ * n-by-p product with the trailing rows, with p = 2 min(nb,k).
+ * The arguments are the same as for chol_update itself.
+ *
+ * @return idx_t The size of the required workspace
+ */
+template< class matrixA_t, class matrixX_t, typename idx_t = size_type<matrixA_t>, typename T = type_t<matrixA_t> >
+idx_t get_work_chol_update( const matrixA_t& A, const matrixX_t& X, const chol_update_opts_t<idx_t,T>& opts = {} )
+{
+    using std::min;
+
+    const idx_t n  = nrows(A);
+    const idx_t k  = ncols(X);
+    const idx_t nb = tuned<T>( opts.nb, "chol_update", "nb", n );
+    const idx_t p  = 2 * min( nb, k );
+
+    return ( nb <= 1 || k <= 1 ) ? 0 : p * (p + n);
+}
+
+/**
+ * Returns the number of bytes chol_update and chol_downdate borrow from
+ * the workspace arena. The arguments are the same as for chol_update
+ * itself.
+ *
+ * @return 0 if opts provides a workspace of at least get_work_chol_update()
+ *      elements, the size of the borrowed workspace otherwise.
+ */
+template< class matrixA_t, class matrixX_t, typename idx_t = size_type<matrixA_t>, typename T = type_t<matrixA_t> >
+std::size_t get_worksize_chol_update( const matrixA_t& A, const matrixX_t& X, const chol_update_opts_t<idx_t,T>& opts = {} )
+{
+    const idx_t required_workspace = get_work_chol_update( A, X, opts );
+    return ( required_workspace <= 0 || (opts._work && required_workspace <= opts.lwork) )
+        ? 0
+        : workspace_arena::push_size<T>( required_workspace );
+}
+
+namespace internal {
+
+/// Blocked rank-k update or downdate of a Cholesky factor.
+/// @see chol_update() and chol_downdate().
+template< class matrixA_t, class matrixX_t, typename idx_t, typename T >
+int chol_update_blocked( Uplo uplo, bool downdate, matrixA_t& A, matrixX_t& X,
+                         const chol_update_opts_t<idx_t,T>& opts, const ErrorCheck& ec )
+{
+    using real_t = real_type< T >;
+    using pair   = std::pair<idx_t,idx_t>;
+
+    using std::min;
+
+    // constants
+    const idx_t n  = nrows(A);
+    const idx_t k  = ncols(X);
+    const idx_t nb = tuned<T>( opts.nb, "chol_update", "nb", n );
+
+    // check arguments
+    tlapack_check_false( uplo != Uplo::Lower &&
+                         uplo != Uplo::Upper, -1 );
+    tlapack_check_false( access_denied( uplo, write_policy(A) ), -1 );
+    tlapack_check_false( nrows(A) != ncols(A), -2 );
+    tlapack_check_false( nrows(X) != n, -3 );
+
+    // quick return
+    if( n == 0 || k == 0 )
+        return 0;
+
+    // Use the rank-1 code on each column
+    if( nb <= 1 || k <= 1 ) {
+        for( idx_t l = 0; l < k; ++l ) {
+            auto x = col( X, l );
+            const int info = internal::chol_update1( uplo, downdate, A, x, ec );
+            if( info != 0 )
+                return info;
+        }
+        return 0;
+    }
+
+    TLAPACK_PROFILE_SCOPE( "chol_update", T, 4.0*k*n*n, 0.5*n*(n+1) + double(n)*k );
+
+    // Get the workspace
+    const idx_t required_workspace = get_work_chol_update( A, X, opts );
+    local_workspace<T> workspace( opts._work, opts.lwork, required_workspace, opts.arena );
+    T* _work = workspace.data();
+
+    // The entries L(j,i) of the lower triangular factor are conj(A(i,j))
+    // if A = U^H U
+    const auto rotate = [&]( const chol_rotation<T>& G, idx_t j, idx_t i, T& w ) {
+        if( uplo == Uplo::Upper ) {
+            T a = conj( A(i,j) );
+            G.apply( a, w );
+            A(i,j) = conj( a );
+        }
+        else
+            G.apply( A(j,i), w );
+    };
+
+    for( idx_t lc = 0; lc < k; lc += nb ) {
+
+        const idx_t kc = min( nb, k-lc );
+
+        for( idx_t ib = 0; ib < n; ib += kc ) {
+
+            const idx_t b  = min( kc, n-ib );
+            const idx_t ie = ib + b;
+            const idx_t m  = n - ie;
+            const idx_t p  = b + kc;
+
+            // The rotations that annihilate X(ib:ie,lc:lc+kc) act on the
+            // columns ib:ie of L and lc:lc+kc of X. They are applied to the
+            // rows ib:ie directly and accumulated in Q for the rows ie:n
+            auto Q = legacyMatrix<T>( p, p, _work, p );
+            laset( Uplo::General, T(0), T(1), Q );
+
+            for( idx_t i = ib; i < ie; ++i ) {
+                for( idx_t l = 0; l < kc; ++l ) {
+
+                    chol_rotation<T> G( downdate );
+                    real_t lii = real( A(i,i) );
+                    if( !G.generate( lii, X(i,lc+l) ) ) {
+                        tlapack_error_internal( ec, i+1,
+                            "The downdated matrix is not positive definite."
+                            " The factor was only partially updated." );
+                        return i+1;
+                    }
+                    A(i,i) = T( lii );
+                    X(i,lc+l) = T(0);
+
+                    for( idx_t j = i+1; j < ie; ++j )
+                        rotate( G, j, i, X(j,lc+l) );
+                    for( idx_t r = 0; r < p; ++r )
+                        G.apply( Q(r,i-ib), Q(r,b+l) );
+                }
+            }
+
+            // [ L(ie:n,ib:ie) X(ie:n,lc:lc+kc) ] = [ L(ie:n,ib:ie) X(ie:n,lc:lc+kc) ] Q
+            if( m > 0 ) {
+                auto Y   = legacyMatrix<T>( m, p, _work + p*p, m );
+                auto Y1  = slice( Y, pair{0,m}, pair{0,b} );
+                auto Y2  = slice( Y, pair{0,m}, pair{b,p} );
+                auto Q1  = slice( Q, pair{0,b}, pair{0,p} );
+                auto Q2  = slice( Q, pair{b,p}, pair{0,p} );
+                auto X2  = slice( X, pair{ie,n}, pair{lc,lc+kc} );
+
+                if( uplo == Uplo::Upper ) {
+                    auto A12 = slice( A, pair{ib,ie}, pair{ie,n} );
+                    gemm( Op::ConjTrans, Op::NoTrans, T(1), A12, Q1, T(0), Y );
+                    gemm( Op::NoTrans, Op::NoTrans, T(1), X2, Q2, T(1), Y );
+                    conjtranspose( Y1, A12 );
+                }
+                else {
+                    auto A21 = slice( A, pair{ie,n}, pair{ib,ie} );
+                    gemm( Op::NoTrans, Op::NoTrans, T(1), A21, Q1, T(0), Y );
+                    gemm( Op::NoTrans, Op::NoTrans, T(1), X2, Q2, T(1), Y );
+                    lacpy( Uplo::General, Y1, A21 );
+                }
+                lacpy( Uplo::General, Y2, X2 );
+            }
+        }
+    }
+
+    return 0;
+}
+
+} // namespace internal
+
+/** Updates the Cholesky factorization of a Hermitian positive definite
+ * matrix A after the rank-k modification
+ * \[
+ *      A + X X^H = U'^H U' \quad \text{or} \quad A + X X^H = L' L'^H,
+ * \]
+ * where A = U^H U or A = L L^H was computed by potrf().
+ *
+ * This is the blocked version of the algorithm. The columns of X are
+ * processed in groups of kc = min(nb,k). For each group, the factor is
+ * traversed by blocks of kc rows of U (columns of L), and the Givens
+ * rotations of chol_update1() that annihilate the corresponding kc-by-kc
+ * block of X are applied directly to the block and accumulated in a
+ * 2kc-by-2kc matrix. The rest of the rows of U and of the columns of X
+ * are then updated at once by gemm. The cost is about 4 k n^2 flops.
+ *
+ * @param[in] uplo
+ *      - Uplo::Upper: Upper triangle of A contains the matrix U;
+ *      - Uplo::Lower: Lower triangle of A contains the matrix L.
+ *      The other triangular part of A is not referenced.
+ *
+ * @param[in,out] A n-by-n matrix.
+ *      On entry, the factor U or L of A, with real positive diagonal.
+ *      On exit, the factor U' or L'.
+ *
+ * @param[in,out] X n-by-k matrix.
+ *      On entry, the matrix X. On exit, X is overwritten.
+ *
+ * @param[in] opts Options.
+ *      - @c opts.nb: Block size.
+ *      - @c opts._work, @c opts.lwork: Workspace, see get_work_chol_update().
+ *      - @c opts.arena: Arena used if no workspace is provided.
+ *
+ * @return = 0: successful exit.
+ *
+ * @ingroup posv_computational
+ */
+template< class matrixA_t, class matrixX_t, typename idx_t = size_type<matrixA_t>, typename T = type_t<matrixA_t> >
+int chol_update( Uplo uplo, matrixA_t& A, matrixX_t& X, const chol_update_opts_t<idx_t,T>& opts = {} )
+{
+    return internal::chol_update_blocked( uplo, false, A, X, opts, noErrorCheck );
+}
+
+/** Downdates the Cholesky factorization of a Hermitian positive definite
+ * matrix A after the rank-k modification
+ * \[
+ *      A - X X^H = U'^H U' \quad \text{or} \quad A - X X^H = L' L'^H,
+ * \]
+ * where A = U^H U or A = L L^H was computed by potrf().
+ *
+ * This is the blocked version of the algorithm, see chol_update(). The
+ * rotations are the hyperbolic rotations of chol_downdate1(). The cost is
+ * about 4 k n^2 flops.
+ *
+ * @param[in] uplo
+ *      - Uplo::Upper: Upper triangle of A contains the matrix U;
+ *      - Uplo::Lower: Lower triangle of A contains the matrix L.
+ *      The other triangular part of A is not referenced.
+ *
+ * @param[in,out] A n-by-n matrix.
+ *      On entry, the factor U or L of A, with real positive diagonal.
+ *      On exit, the factor U' or L'.
+ *
+ * @param[in,out] X n-by-k matrix.
+ *      On entry, the matrix X. On exit, X is overwritten.
+ *
+ * @param[in] opts Options.
+ *      - @c opts.nb: Block size.
+ *      - @c opts._work, @c opts.lwork: Workspace, see get_work_chol_update().
+ *      - @c opts.arena: Arena used if no workspace is provided.
+ *
+ * @param[in] ec Exception handling configuration at runtime.
+ *
+ * @return = 0: successful exit.
+ * @return i, 0 < i <= n, if $A - X X^H$ is not positive definite, which
+ *      was detected at the row i-1 of U' or the column i-1 of L'. The
+ *      contents of A and X are then unspecified.
+ *
+ * @ingroup posv_computational
+ */
+template< class matrixA_t, class matrixX_t, typename idx_t = size_type<matrixA_t>, typename T = type_t<matrixA_t> >
+int chol_downdate( Uplo uplo, matrixA_t& A, matrixX_t& X, const chol_update_opts_t<idx_t,T>& opts = {},
+                   const ErrorCheck& ec = {} )
+{
+    return internal::chol_update_blocked( uplo, true, A, X, opts, ec );
+}
+
+} // namespace tlapack
+
+#endif // __TLAPACK_CHOL_UPDATE_HH__
@@ -0,0 +1,220 @@
+/// @file chol_update1.hpp Rank-1 update and downdate of a Cholesky factorization.
+/// Adapted from @see https://netlib.org/linpack/dchud.f and the mixed downdating of
+/// Bojanczyk, Brent, Van Dooren and de Hoog, SIAM J. Sci. Stat. Comput. 8(3), 1987.
+//
+// Copyright (c) 2022, University of Colorado Denver. All rights reserved.
+//
+// This file is part of <T>LAPACK.
+// <T>LAPACK is free software: you can redistribute it and/or modify it under
+// the terms of the BSD 3-Clause license. See the accompanying LICENSE file.
+
+#ifndef __TLAPACK_CHOL_UPDATE1_HH__
+#define __TLAPACK_CHOL_UPDATE1_HH__
+
+#include "base/utils.hpp"
+#include "base/profile.hpp"
+
+#include "lapack/lapy2.hpp"
+
+namespace tlapack {
+
+namespace internal {
+
+/**
+ * Plane rotation used to update a column of a lower triangular Cholesky
+ * factor L with a column w of the low-rank term.
+ *
+ * For an update, it is the Givens rotation that annihilates w[i] against
+ * L(i,i):
+ * \[
+ *      a' = c a + \bar{z} w, \quad w' = c w - z a,
+ *      \quad c = L(i,i) / r, \quad z = w[i] / r,
+ *      \quad r = \sqrt{L(i,i)^2 + |w[i]|^2}.
+ * \]
+ * For a downdate, it is the hyperbolic rotation applied in the mixed
+ * form, which is stable in the sense of the Cholesky factorization:
+ * \[
+ *      a' = c ( a - \bar{z} w ), \quad w' = w / c - z a',
+ *      \quad z = w[i] / L(i,i), \quad c = 1 / \sqrt{1 - |z|^2}.
+ * \]
+ */
+template< typename T >
+struct chol_rotation
+{
+    using real_t = real_type<T>;
+
+    bool downdate;
+    real_t c = real_t(1);
+    real_t s = real_t(1);   ///< 1/c, only for downdates
+    T z = T(0);
+
+    explicit chol_rotation( bool downdate_ ) : downdate( downdate_ ) {}
+
+    /// Computes the rotation from the diagonal entry lii > 0 of the factor
+    /// and the entry wi of the low-rank term, and overwrites lii with the
+    /// new diagonal entry.
+    /// @return false if the downdated matrix is not positive definite.
+    bool generate( real_t& lii, const T& wi )
+    {
+        if( downdate ) {
+            z = wi / lii;
+            const real_t t = real_t(1) - ( real(z) * real(z) + imag(z) * imag(z) );
+            if( !( t > real_t(0) ) )
+                return false;
+            s = sqrt( t );
+            c = real_t(1) / s;
+            lii *= s;
+        }
+        else {
+            const real_t r = lapy2( lii, abs(wi) );
+            if( r > real_t(0) ) {
+                c = lii / r;
+                z = wi / r;
+                lii = r;
+            }
+        }
+        return true;
+    }
+
+    /// Applies the rotation to the entry a of the factor and the entry w
+    /// of the low-rank term in the same row.
+    void apply( T& a, T& w ) const
+    {
+        if( downdate ) {
+            a = c * ( a - conj(z) * w );
+            w = s * w - z * a;
+        }
+        else {
+            const T aux = a;
+            a = c * aux + conj(z) * w;
+            w = c * w - z * aux;
+        }
+    }
+};
+
+/// Rank-1 update or downdate of a Cholesky factor.
+/// @see chol_update1() and chol_downdate1().
+template< class matrix_t, class vector_t >
+int chol_update1( Uplo uplo, bool downdate, matrix_t& A, vector_t& x, const ErrorCheck& ec )
+{
+    using T      = type_t< matrix_t >;
+    using idx_t  = size_type< matrix_t >;
+    using real_t = real_type< T >;
+
+    // constants
+    const idx_t n = nrows(A);
+
+    // check arguments
+    tlapack_check_false( uplo != Uplo::Lower &&
+                         uplo != Uplo::Upper, -1 );
+    tlapack_check_false( access_denied( uplo, write_policy(A) ), -1 );
+    tlapack_check_false( nrows(A) != ncols(A), -2 );
+    tlapack_check_false( (idx_t) size(x) != n, -3 );
+
+    TLAPACK_PROFILE_SCOPE( "chol_update1", T, 3.0*n*n, 0.5*n*(n+1) + n );
+
+    // The entries L(j,i) of the lower triangular factor are conj(A(i,j))
+    // if A = U^H U
+    for( idx_t i = 0; i < n; ++i ) {
+
+        chol_rotation<T> G( downdate );
+        real_t lii = real( A(i,i) );
+        if( !G.generate( lii, x[i] ) ) {
+            tlapack_error_internal( ec, i+1,
+                "The downdated matrix is not positive definite."
+                " Only the first info-1 rows or columns of the factor were updated." );
+            return i+1;
+        }
+        A(i,i) = T( lii );
+        x[i] = T(0);
+
+        if( uplo == Uplo::Upper ) {
+            for( idx_t j = i+1; j < n; ++j ) {
+                T a = conj( A(i,j) );
+                G.apply( a, x[j] );
+                A(i,j) = conj( a );
+            }
+        }
+        else {
+            for( idx_t j = i+1; j < n; ++j )
+                G.apply( A(j,i), x[j] );
+        }
+    }
+
+    return 0;
+}
+
+} // namespace internal
+
+/** Updates the Cholesky factorization of a Hermitian positive definite
+ * matrix A after the rank-1 modification
+ * \[
+ *      A + x x^H = U'^H U' \quad \text{or} \quad A + x x^H = L' L'^H,
+ * \]
+ * where A = U^H U or A = L L^H was computed by potrf().
+ *
+ * The factor is modified in O(n^2) operations by a sequence of n Givens
+ * rotations.
+ *
+ * @param[in] uplo
+ *      - Uplo::Upper: Upper triangle of A contains the matrix U;
+ *      - Uplo::Lower: Lower triangle of A contains the matrix L.
+ *      The other triangular part of A is not referenced.
+ *
+ * @param[in,out] A n-by-n matrix.
+ *      On entry, the factor U or L of A, with real positive diagonal.
+ *      On exit, the factor U' or L'.
+ *
+ * @param[in,out] x Vector of size n.
+ *      On entry, the vector x. On exit, x is overwritten.
+ *
+ * @return = 0: successful exit.
+ *
+ * @ingroup posv_computational
+ */
+template< class matrix_t, class vector_t >
+int chol_update1( Uplo uplo, matrix_t& A, vector_t& x )
+{
+    return internal::chol_update1( uplo, false, A, x, noErrorCheck );
+}
+
+/** Downdates the Cholesky factorization of a Hermitian positive definite
+ * matrix A after the rank-1 modification
+ * \[
+ *      A - x x^H = U'^H U' \quad \text{or} \quad A - x x^H = L' L'^H,
+ * \]
+ * where A = U^H U or A = L L^H was computed by potrf().
+ *
+ * The factor is modified in O(n^2) operations by a sequence of n
+ * hyperbolic rotations, applied in the mixed form of Bojanczyk et al.
+ *
+ * @param[in] uplo
+ *      - Uplo::Upper: Upper triangle of A contains the matrix U;
+ *      - Uplo::Lower: Lower triangle of A contains the matrix L.
+ *      The other triangular part of A is not referenced.
+ *
+ * @param[in,out] A n-by-n matrix.
+ *      On entry, the factor U or L of A, with real positive diagonal.
+ *      On exit, the factor U' or L'.
+ *
+ * @param[in,out] x Vector of size n.
+ *      On entry, the vector x. On exit, x is overwritten.
+ *
+ * @param[in] ec Exception handling configuration at runtime.
+ *
+ * @return = 0: successful exit.
+ * @return i, 0 < i <= n, if $A - x x^H$ is not positive definite. The
+ *      rows 0 to i-2 of U' or the columns 0 to i-2 of L' were computed,
+ *      and the remaining part of A is not modified.
+ *
+ * @ingroup posv_computational
+ */
+template< class matrix_t, class vector_t >
+int chol_downdate1( Uplo uplo, matrix_t& A, vector_t& x, const ErrorCheck& ec = {} )
+{
+    return internal::chol_update1( uplo, true, A, x, ec );
+}
+
+} // namespace tlapack
+
+#endif // __TLAPACK_CHOL_UPDATE1_HH__
@@ -0,0 +1,193 @@
+/// @file gbbrd.hpp
+/// Adapted from @see https://github.com/Reference-LAPACK/lapack/tree/master/SRC/zgbbrd.f
+//
+// Copyright (c) 2022, University of Colorado Denver. All rights reserved.
+//
+// This file is part of <T>LAPACK.
+// <T>LAPACK is free software: you can redistribute it and/or modify it under
+// the terms of the BSD 3-Clause license. See the accompanying LICENSE file.
+
+#ifndef __TLAPACK_GBBRD_HH__
+#define __TLAPACK_GBBRD_HH__
+
+#include "base/utils.hpp"
+#include "base/profile.hpp"
+#include "base/types.hpp"
+#include "blas/rotg.hpp"
+#include "blas/rot.hpp"
+#include "blas/scal.hpp"
+
+namespace tlapack {
+
+/** Reduces a n-by-n upper band matrix B with kd superdiagonals to real upper
+ * bidiagonal form by a unitary transformation: $U^H B V$.
+ *
+ * This is the second stage of the two-stage reduction to bidiagonal form.
+ * Each element outside the bidiagonal is annihilated by a plane rotation
+ * from the right, and the bulge that is created below the diagonal is
+ * chased down the band by alternating rotations from the left and from the
+ * right. The reduction needs O(n^2 kd) operations and never touches elements
+ * outside of the band, up to one subdiagonal and one extra superdiagonal.
+ *
+ * @return  0 if success
+ *
+ * @param[in] want_u bool.
+ *      If true, the left rotations are accumulated in U.
+ * @param[in] want_v bool.
+ *      If true, the right rotations are accumulated in V.
+ * @param[in] kd Number of superdiagonals of B.
+ * @param[in,out] B n-by-n band matrix with at least 1 subdiagonal and kd+1
+ *      superdiagonals, e.g., a legacyBandedMatrix with kl = 1 and
+ *      ku = kd+1. On entry, the upper band matrix in the diagonal and the
+ *      first kd superdiagonals; the other elements must be zero.
+ *      On exit, B is destroyed.
+ * @param[out] d Real vector of length n.
+ *      The diagonal elements of the bidiagonal matrix.
+ * @param[out] e Real vector of length n-1.
+ *      The superdiagonal elements of the bidiagonal matrix.
+ * @param[in,out] U nu-by-n matrix.
+ *      On exit, if want_u is true, U is multiplied from the right by the
+ *      unitary matrix of left transformations. Otherwise, U is not
+ *      referenced.
+ * @param[in,out] V nv-by-n matrix.
+ *      On exit, if want_v is true, V is multiplied from the right by the
+ *      unitary matrix of right transformations. Otherwise, V is not
+ *      referenced.
+ *
+ * @ingroup gesvd_computational
+ */
+template< class band_t, class vectorD_t, class vectorE_t, class matrixU_t, class matrixV_t,
+          typename idx_t = size_type< band_t > >
+int gbbrd( bool want_u, bool want_v, idx_t kd, band_t& B,
+           vectorD_t& d, vectorE_t& e, matrixU_t& U, matrixV_t& V )
+{
+    using TB     = type_t< band_t >;
+    using real_t = real_type< TB >;
+    using pair   = pair<idx_t,idx_t>;
+    using std::min;
+
+    // constants
+    const real_t rzero(0);
+    const idx_t n = ncols(B);
+    const idx_t nu = (want_u) ? nrows(U) : 0;
+    const idx_t nv = (want_v) ? nrows(V) : 0;
+
+    TLAPACK_PROFILE_SCOPE( "gbbrd", TB, 6.0*n*n*kd, double(n)*(kd+1) + double(nu + nv)*n );
+
+    // check arguments
+    tlapack_check_false( nrows(B) != n, -4 );
+    tlapack_check_false( (idx_t) size(d) < n, -5 );
+    tlapack_check_false( n > 0 && (idx_t) size(e) < n-1, -6 );
+    tlapack_check_false( want_u && ncols(U) != n, -7 );
+    tlapack_check_false( want_v && ncols(V) != n, -8 );
+
+    // quick return
+    if (n <= 0) return 0;
+
+    for( idx_t i = 0; i + 2 < n; ++i ) {
+
+        // Annihilate B(i,i+k) for k = kd, ..., 2
+        for( idx_t k = min( kd, n-1-i ); k >= 2; --k ) {
+
+            idx_t r  = i;
+            idx_t c2 = i + k;
+            while( true ) {
+
+                const idx_t c1 = c2 - 1;
+
+                // Rotation from the right on columns c1 and c2 to annihilate
+                // B(r,c2). Creates the bulge B(c2,c1).
+                {
+                    real_t c;
+                    TB s;
+                    TB f = B(r,c1);
+                    TB g = B(r,c2);
+                    rotg( f, g, c, s );
+                    const idx_t i0 = (c2 > kd+1) ? c2 - kd - 1 : 0;
+                    for( idx_t j = i0; j <= c2; ++j ) {
+                        const TB x = B(j,c1);
+                        const TB y = B(j,c2);
+                        B(j,c1) = c * x + s * y;
+                        B(j,c2) = c * y - conj(s) * x;
+                    }
+                    B(r,c2) = TB(0);
+                    if( want_v ) {
+                        auto v1 = slice( V, pair{0,nv}, c1 );
+                        auto v2 = slice( V, pair{0,nv}, c2 );
+                        rot( v1, v2, c, s );
+                    }
+                }
+
+                // Rotation from the left on rows c1 and c2 to annihilate
+                // B(c2,c1). Creates the bulge B(c1,c1+kd+1).
+                {
+                    real_t c;
+                    TB s;
+                    TB f = B(c1,c1);
+                    TB g = B(c2,c1);
+                    rotg( f, g, c, s );
+                    const idx_t j1 = min( n-1, c1 + kd + 1 );
+                    for( idx_t j = c1; j <= j1; ++j ) {
+                        const TB x = B(c1,j);
+                        const TB y = B(c2,j);
+                        B(c1,j) = c * x + s * y;
+                        B(c2,j) = c * y - conj(s) * x;
+                    }
+                    B(c2,c1) = TB(0);
+                    if( want_u ) {
+                        auto u1 = slice( U, pair{0,nu}, c1 );
+                        auto u2 = slice( U, pair{0,nu}, c2 );
+                        rot( u1, u2, c, conj(s) );
+                    }
+                }
+
+                // Chase the bulge to the next block
+                if( c1 + kd + 1 >= n )
+                    break;
+                r  = c1;
+                c2 = c1 + kd + 1;
+            }
+        }
+    }
+
+    // Make the bidiagonal matrix real with diagonal unitary scalings
+    for( idx_t i = 0; i < n; ++i ) {
+
+        const TB a = B(i,i);
+        const real_t absa = abs( a );
+        if( imag(a) != rzero ) {
+            const TB phase = a / absa;
+            if( i+1 < n )
+                B(i,i+1) *= conj( phase );
+            if( want_u ) {
+                auto ui = slice( U, pair{0,nu}, i );
+                scal( phase, ui );
+            }
+            d[i] = absa;
+        }
+        else
+            d[i] = real( a );
+
+        if( i+1 < n ) {
+            const TB b = B(i,i+1);
+            const real_t absb = abs( b );
+            if( imag(b) != rzero ) {
+                const TB phase = b / absb;
+                B(i+1,i+1) *= conj( phase );
+                if( want_v ) {
+                    auto vi = slice( V, pair{0,nv}, i+1 );
+                    scal( conj( phase ), vi );
+                }
+                e[i] = absb;
+            }
+            else
+                e[i] = real( b );
+        }
+    }
+
+    return 0;
+}
+
+} // lapack
+
+#endif // __TLAPACK_GBBRD_HH__
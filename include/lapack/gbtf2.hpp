@@ -0,0 +1,180 @@
+/// @file gbtf2.hpp Computes the LU factorization of a general band matrix using the unblocked algorithm.
+//
+// Copyright (c) 2022, University of Colorado Denver. All rights reserved.
+//
+// This file is part of <T>LAPACK.
+// <T>LAPACK is free software: you can redistribute it and/or modify it under
+// the terms of the BSD 3-Clause license. See the accompanying LICENSE file.
+
+#ifndef __TLAPACK_GBTF2_HH__
+#define __TLAPACK_GBTF2_HH__
+
+#include "base/utils.hpp"
+#include "base/profile.hpp"
+
+namespace tlapack {
+
+namespace internal {
+
+/// Sets to zero the superdiagonals ku+1 to ku+kl of a band matrix A with
+/// kl = lowerband(A) subdiagonals and ku+kl = upperband(A) superdiagonals.
+/// They hold the fill-in of the band LU factorization.
+template< class matrix_t >
+void gb_zero_fillin( matrix_t& A )
+{
+    using T     = type_t< matrix_t >;
+    using idx_t = size_type< matrix_t >;
+    using std::min;
+
+    const idx_t m  = nrows(A);
+    const idx_t n  = ncols(A);
+    const idx_t kl = lowerband(A);
+    const idx_t kv = upperband(A);
+    const idx_t ku = kv - kl;
+
+    for( idx_t j = ku+1; j < n; ++j ) {
+        const idx_t i0 = (j > kv) ? j - kv : 0;
+        const idx_t i1 = min( m, j - ku );
+        for( idx_t i = i0; i < i1; ++i )
+            A(i,j) = T(0);
+    }
+}
+
+} // namespace internal
+
+/** Computes an LU factorization of a m-by-n band matrix A with kl
+ * subdiagonals and ku superdiagonals using partial pivoting with row
+ * interchanges.
+ *
+ * The factorization has the form
+ * \[
+ *     A = P L U
+ * \]
+ * where P is a permutation matrix, L is lower triangular with unit
+ * diagonal elements and kl subdiagonals, and U is upper triangular with
+ * kl+ku superdiagonals.
+ *
+ * This is the right-looking unblocked version of the algorithm, which only
+ * accesses the elements of the band.
+ *
+ * @param[in,out] A
+ *      m-by-n band matrix with kl = lowerband(A) subdiagonals and
+ *      kl+ku = upperband(A) superdiagonals, e.g., a legacyBandedMatrix.
+ *      On entry, the matrix A in the diagonal, the first kl subdiagonals
+ *      and the first ku superdiagonals. The superdiagonals ku+1 to ku+kl
+ *      hold the fill-in and need not be set.
+ *      On exit, U in the diagonal and the kl+ku superdiagonals, and the
+ *      multipliers of L in the kl subdiagonals. See gbtrs() for the use of
+ *      the factorization.
+ *
+ * @param[out] piv Vector of size min(m,n).
+ *      The pivot indices: for 0 <= j < min(m,n), the row j of the matrix
+ *      was interchanged with the row piv[j] when L(:,j) was computed.
+ *
+ * @param[in] ec Exception handling configuration at runtime.
+ *
+ * @return = 0: successful exit.
+ * @return i, 0 < i <= min(m,n), if U(i-1,i-1) is exactly zero. The
+ *      factorization has been completed, but U is singular.
+ *
+ * @ingroup gbsv_computational
+ */
+template< class matrix_t, class vector_t >
+int gbtf2( matrix_t& A, vector_t& piv, const ErrorCheck& ec = {} )
+{
+    using T      = type_t< matrix_t >;
+    using real_t = real_type< T >;
+    using idx_t  = size_type< matrix_t >;
+
+    using std::min;
+    using std::max;
+
+    // constants
+    const idx_t m  = nrows(A);
+    const idx_t n  = ncols(A);
+    const idx_t kl = lowerband(A);
+    const idx_t kv = upperband(A);
+    const idx_t k  = min( m, n );
+
+    // check arguments
+    tlapack_check_false( kv < kl, -1 );
+    tlapack_check_false( access_denied( band_t( kl, kv ), write_policy(A) ), -1 );
+    tlapack_check_false( (idx_t) size(piv) < k, -2 );
+
+    const idx_t ku = kv - kl;
+
+    TLAPACK_PROFILE_SCOPE( "gbtf2", T, 2.0*n*kl*(kl+ku+1), double(n)*(2*kl+ku+1) );
+
+    // quick return
+    if( m == 0 || n == 0 )
+        return 0;
+
+    internal::gb_zero_fillin( A );
+
+    // ju is the index of the last column affected by the current stage of
+    // the factorization
+    idx_t ju = 0;
+    int info = 0;
+
+    for( idx_t j = 0; j < k; ++j ) {
+
+        const idx_t km = min( kl, m-1-j );
+
+        // Find the pivot
+        idx_t p = j;
+        real_t amax = abs1( A(j,j) );
+        for( idx_t i = j+1; i <= j+km; ++i ) {
+            const real_t a = abs1( A(i,j) );
+            if( a > amax ) {
+                amax = a;
+                p = i;
+            }
+        }
+        piv[j] = p;
+
+        if( A(p,j) != T(0) ) {
+
+            ju = max( ju, min( p + ku, n-1 ) );
+
+            // Apply the interchange to the columns j to ju
+            if( p != j ) {
+                for( idx_t c = j; c <= ju; ++c ) {
+                    const T aux = A(j,c);
+                    A(j,c) = A(p,c);
+                    A(p,c) = aux;
+                }
+            }
+
+            if( km > 0 ) {
+
+                // Compute the multipliers
+                const T rajj = T(1) / A(j,j);
+                for( idx_t i = j+1; i <= j+km; ++i )
+                    A(i,j) *= rajj;
+
+                // Update the trailing submatrix within the band
+                for( idx_t c = j+1; c <= ju; ++c ) {
+                    const T ajc = A(j,c);
+                    for( idx_t i = j+1; i <= j+km; ++i )
+                        A(i,c) -= A(i,j) * ajc;
+                }
+            }
+        }
+        else if( info == 0 ) {
+            // The pivot is zero. Set info and continue the factorization
+            info = j+1;
+        }
+    }
+
+    if( info != 0 ) {
+        tlapack_error_internal( ec, info,
+            "U(info-1,info-1) is exactly zero."
+            " The factorization has been completed, but U is singular." );
+    }
+
+    return info;
+}
+
+} // namespace tlapack
+
+#endif // __TLAPACK_GBTF2_HH__
@@ -0,0 +1,245 @@
+/// @file gbtrf.hpp Computes the LU factorization of a general band matrix using a blocked algorithm.
+//
+// Copyright (c) 2022, University of Colorado Denver. All rights reserved.
+//
+// This file is part of <T>LAPACK.
+// <T>LAPACK is free software: you can redistribute it and/or modify it under
+// the terms of the BSD 3-Clause license. See the accompanying LICENSE file.
+
+#ifndef __TLAPACK_GBTRF_HH__
+#define __TLAPACK_GBTRF_HH__
+
+#include "base/utils.hpp"
+#include "base/profile.hpp"
+#include "base/tuning.hpp"
+#include "base/workspace.hpp"
+#include "legacy_api/base/utils.hpp"
+
+#include "lapack/gbtf2.hpp"
+#include "tblas.hpp"
+
+namespace tlapack {
+
+/// Options struct for gbtrf
+template< typename idx_t, typename T >
+struct gbtrf_opts_t
+{
+    // Block size. gbtrf uses the unblocked gbtf2 if nb <= 1 or nb > kl
+    tunable<idx_t> nb = {tuning_default, 32};
+    // Workspace pointer, if no workspace is provided, one will be allocated internally
+    T* _work = nullptr;
+    // Workspace size
+    idx_t lwork = 0;
+    // Arena used if no workspace is provided. If nullptr, the default
+    // arena of the calling thread is used.
+    workspace_arena* arena = nullptr;
+};
+
+/**
+ * Returns the required workspace for gbtrf, i.e., the size of the dense
+ * (nb+kl)-by-(nb+kl+ku) window copied out of the band of A at each step.
+ * The arguments are the same as for gbtrf itself.
+ *
+ * @return idx_t The size of the required workspace
+ */
+template< class matrix_t, class vector_t, typename idx_t = size_type<matrix_t>, typename T = type_t<matrix_t> >
+idx_t get_work_gbtrf( const matrix_t& A, const vector_t& piv, const gbtrf_opts_t<idx_t,T>& opts = {} )
+{
+    const idx_t n  = ncols(A);
+    const idx_t kl = lowerband(A);
+    const idx_t kv = upperband(A);
+    const idx_t nb = tuned<T>( opts.nb, "gbtrf", "nb", n );
+
+    return ( nb <= 1 || nb > kl ) ? 0 : (nb+kl) * (nb+kv);
+}
+
+/**
+ * Returns the number of bytes gbtrf borrows from the workspace arena.
+ * The arguments are the same as for gbtrf itself.
+ *
+ * @return 0 if opts provides a workspace of at least get_work_gbtrf()
+ *      elements, the size of the borrowed workspace otherwise.
+ */
+template< class matrix_t, class vector_t, typename idx_t = size_type<matrix_t>, typename T = type_t<matrix_t> >
+std::size_t get_worksize_gbtrf( const matrix_t& A, const vector_t& piv, const gbtrf_opts_t<idx_t,T>& opts = {} )
+{
+    const idx_t required_workspace = get_work_gbtrf( A, piv, opts );
+    return ( required_workspace <= 0 || (opts._work && required_workspace <= opts.lwork) )
+        ? 0
+        : workspace_arena::push_size<T>( required_workspace );
+}
+
+/** Computes an LU factorization of a m-by-n band matrix A with kl
+ * subdiagonals and ku superdiagonals using partial pivoting with row
+ * interchanges.
+ *
+ * The factorization has the form
+ * \[
+ *     A = P L U
+ * \]
+ * where P is a permutation matrix, L is lower triangular with unit
+ * diagonal elements and kl subdiagonals, and U is upper triangular with
+ * kl+ku superdiagonals.
+ *
+ * This is the blocked version of the algorithm. At each step, the
+ * (nb+kl)-by-(nb+kl+ku) window of A that is touched by a block of nb
+ * columns is copied to a dense workspace, so that the panel factorization
+ * and the updates use trsm and gemm on dense matrices, and copied back to
+ * the band afterwards. The memory used is O(n (kl+ku)) for A plus
+ * O((nb+kl) (nb+kl+ku)) for the workspace. gbtf2() is used if
+ * nb <= 1 or nb > kl.
+ *
+ * @param[in,out] A
+ *      m-by-n band matrix with kl = lowerband(A) subdiagonals and
+ *      kl+ku = upperband(A) superdiagonals, e.g., a legacyBandedMatrix.
+ *      On entry, the matrix A in the diagonal, the first kl subdiagonals
+ *      and the first ku superdiagonals. The superdiagonals ku+1 to ku+kl
+ *      hold the fill-in and need not be set.
+ *      On exit, U in the diagonal and the kl+ku superdiagonals, and the
+ *      multipliers of L in the kl subdiagonals, as computed by gbtf2().
+ *
+ * @param[out] piv Vector of size min(m,n).
+ *      The pivot indices: for 0 <= j < min(m,n), the row j of the matrix
+ *      was interchanged with the row piv[j] when L(:,j) was computed.
+ *
+ * @param[in] opts Options.
+ *      - @c opts.nb: Block size.
+ *      - @c opts._work, @c opts.lwork: Workspace, see get_work_gbtrf().
+ *      - @c opts.arena: Arena used if no workspace is provided.
+ *
+ * @param[in] ec Exception handling configuration at runtime.
+ *
+ * @return = 0: successful exit.
+ * @return i, 0 < i <= min(m,n), if U(i-1,i-1) is exactly zero. The
+ *      factorization has been completed, but U is singular.
+ *
+ * @ingroup gbsv_computational
+ */
+template< class matrix_t, class vector_t, typename idx_t = size_type<matrix_t>, typename T = type_t<matrix_t> >
+int gbtrf( matrix_t& A, vector_t& piv, const gbtrf_opts_t<idx_t,T>& opts = {}, const ErrorCheck& ec = {} )
+{
+    using pair   = std::pair<idx_t,idx_t>;
+
+    using std::min;
+
+    // constants
+    const idx_t m  = nrows(A);
+    const idx_t n  = ncols(A);
+    const idx_t kl = lowerband(A);
+    const idx_t kv = upperband(A);
+    const idx_t k  = min( m, n );
+    const idx_t nb = tuned<T>( opts.nb, "gbtrf", "nb", n );
+
+    // check arguments
+    tlapack_check_false( kv < kl, -1 );
+    tlapack_check_false( access_denied( band_t( kl, kv ), write_policy(A) ), -1 );
+    tlapack_check_false( (idx_t) size(piv) < k, -2 );
+
+    // quick return
+    if( m == 0 || n == 0 )
+        return 0;
+
+    // Use the unblocked code if the block is too small or larger than the
+    // number of subdiagonals
+    if( nb <= 1 || nb > kl )
+        return gbtf2( A, piv, ec );
+
+    TLAPACK_PROFILE_SCOPE( "gbtrf", T, 2.0*n*kl*(kv+1), double(n)*(kl+kv+1) );
+
+    internal::gb_zero_fillin( A );
+
+    // Get the workspace
+    const idx_t required_workspace = get_work_gbtrf( A, piv, opts );
+    local_workspace<T> workspace( opts._work, opts.lwork, required_workspace, opts.arena );
+    T* _work = workspace.data();
+
+    int info = 0;
+
+    for( idx_t j = 0; j < k; j += nb ) {
+
+        const idx_t jb = min( nb, k-j );
+
+        // The window A(j:j+mw,j:j+nw) contains all the entries of the band
+        // touched by the columns j to j+jb-1
+        const idx_t mw = min( m, j+jb+kl ) - j;
+        const idx_t nw = min( n, j+jb+kv ) - j;
+        auto W = legacyMatrix<T>( mw, nw, _work, mw );
+
+        // Copy the window to the workspace, with zeros out of the band
+        for( idx_t c = 0; c < nw; ++c )
+            for( idx_t r = 0; r < mw; ++r )
+                W(r,c) = ( r <= c + kl && c <= r + kv ) ? A(j+r,j+c) : T(0);
+
+        // Factor the panel W(0:mw,0:jb) applying the interchanges to the
+        // whole window
+        for( idx_t jj = 0; jj < jb; ++jj ) {
+
+            auto wcol = slice( W, pair{jj,mw}, jj );
+            const idx_t p = jj + iamax( wcol );
+            piv[j+jj] = j+p;
+
+            if( W(p,jj) != T(0) ) {
+                if( p != jj ) {
+                    auto w1 = row( W, jj );
+                    auto w2 = row( W, p );
+                    tlapack::swap( w1, w2 );
+                }
+                if( jj+1 < mw ) {
+                    auto l = slice( W, pair{jj+1,mw}, jj );
+                    scal( T(1) / W(jj,jj), l );
+                    if( jj+1 < jb ) {
+                        auto u = slice( W, jj, pair{jj+1,jb} );
+                        auto W22 = slice( W, pair{jj+1,mw}, pair{jj+1,jb} );
+                        geru( T(-1), l, u, W22 );
+                    }
+                }
+            }
+            else if( info == 0 ) {
+                info = j+jj+1;
+            }
+        }
+
+        // Update the columns jb to nw of the window
+        if( jb < nw ) {
+            auto W11 = slice( W, pair{0,jb}, pair{0,jb} );
+            auto W12 = slice( W, pair{0,jb}, pair{jb,nw} );
+            trsm( Side::Left, Uplo::Lower, Op::NoTrans, Diag::Unit, T(1), W11, W12 );
+            if( jb < mw ) {
+                auto W21 = slice( W, pair{jb,mw}, pair{0,jb} );
+                auto W22 = slice( W, pair{jb,mw}, pair{jb,nw} );
+                gemm( Op::NoTrans, Op::NoTrans, T(-1), W21, W12, T(1), W22 );
+            }
+        }
+
+        // The band storage cannot hold the interchanges of L. Undo them in
+        // the columns 0 to jj-1 of the panel, as gbtf2 does
+        for( idx_t jj = jb; jj-- > 1; ) {
+            const idx_t p = piv[j+jj] - j;
+            if( p != jj ) {
+                for( idx_t c = 0; c < jj; ++c ) {
+                    const T aux = W(jj,c);
+                    W(jj,c) = W(p,c);
+                    W(p,c) = aux;
+                }
+            }
+        }
+
+        // Copy the window back to the band
+        for( idx_t c = 0; c < nw; ++c )
+            for( idx_t r = 0; r < mw; ++r )
+                if( r <= c + kl && c <= r + kv )
+                    A(j+r,j+c) = W(r,c);
+    }
+
+    if( info != 0 ) {
+        tlapack_error_internal( ec, info,
+            "U(info-1,info-1) is exactly zero."
+            " The factorization has been completed, but U is singular." );
+    }
+
+    return info;
+}
+
+} // namespace tlapack
+
+#endif // __TLAPACK_GBTRF_HH__
@@ -0,0 +1,142 @@
+/// @file gbtrs.hpp Solves a general band system of linear equations using the LU factorization computed by gbtrf.
+//
+// Copyright (c) 2022, University of Colorado Denver. All rights reserved.
+//
+// This file is part of <T>LAPACK.
+// <T>LAPACK is free software: you can redistribute it and/or modify it under
+// the terms of the BSD 3-Clause license. See the accompanying LICENSE file.
+
+#ifndef __TLAPACK_GBTRS_HH__
+#define __TLAPACK_GBTRS_HH__
+
+#include "base/utils.hpp"
+#include "base/profile.hpp"
+
+#include "tblas.hpp"
+
+namespace tlapack {
+
+/** Solves a system of linear equations
+ * \[
+ *      op(A) X = B,
+ * \]
+ * with a general n-by-n band matrix A using the LU factorization
+ * $A = P L U$ computed by gbtrf() or gbtf2().
+ *
+ * @param[in] trans
+ *      The system to be solved:
+ *      - Op::NoTrans:   $A   X = B$,
+ *      - Op::Trans:     $A^T X = B$,
+ *      - Op::ConjTrans: $A^H X = B$.
+ *
+ * @param[in] A
+ *      n-by-n band matrix with kl = lowerband(A) subdiagonals and
+ *      kl+ku = upperband(A) superdiagonals, as returned by gbtrf().
+ *
+ * @param[in] piv Vector of size n.
+ *      The pivot indices returned by gbtrf().
+ *
+ * @param[in,out] B
+ *      On entry, the n-by-nrhs matrix B.
+ *      On exit,  the solution matrix X.
+ *
+ * @return = 0: successful exit.
+ *
+ * @ingroup gbsv_computational
+ */
+template< class matrixA_t, class vector_t, class matrixB_t >
+int gbtrs( Op trans, const matrixA_t& A, const vector_t& piv, matrixB_t& B )
+{
+    using TB    = type_t< matrixB_t >;
+    using idx_t = size_type< matrixA_t >;
+
+    using std::min;
+
+    // constants
+    const idx_t n    = ncols(A);
+    const idx_t nrhs = ncols(B);
+    const idx_t kl   = lowerband(A);
+    const idx_t kv   = upperband(A);
+
+    // check arguments
+    tlapack_check_false( trans != Op::NoTrans &&
+                         trans != Op::Trans &&
+                         trans != Op::ConjTrans, -1 );
+    tlapack_check_false( nrows(A) != n, -2 );
+    tlapack_check_false( kv < kl, -2 );
+    tlapack_check_false( access_denied( band_t( kl, kv ), read_policy(A) ), -2 );
+    tlapack_check_false( (idx_t) size(piv) < n, -3 );
+    tlapack_check_false( nrows(B) != n, -4 );
+
+    TLAPACK_PROFILE_SCOPE( "gbtrs", TB, 2.0*n*(2*kl+kv)*nrhs, double(n)*(kl+kv+1) + 2.0*n*nrhs );
+
+    // quick return
+    if( n == 0 || nrhs == 0 )
+        return 0;
+
+    if( trans == Op::NoTrans ) {
+
+        // Solve L X = B, applying the interchanges
+        if( kl > 0 ) {
+            for( idx_t j = 0; j+1 < n; ++j ) {
+                const idx_t lm = min( kl, n-1-j );
+                const idx_t p  = piv[j];
+                if( p != j ) {
+                    auto b1 = row( B, j );
+                    auto b2 = row( B, p );
+                    tlapack::swap( b1, b2 );
+                }
+                for( idx_t c = 0; c < nrhs; ++c ) {
+                    const TB bjc = B(j,c);
+                    for( idx_t i = j+1; i <= j+lm; ++i )
+                        B(i,c) -= A(i,j) * bjc;
+                }
+            }
+        }
+
+        // Solve U X = B
+        for( idx_t c = 0; c < nrhs; ++c ) {
+            auto b = col( B, c );
+            tbsv( Uplo::Upper, Op::NoTrans, Diag::NonUnit, A, b );
+        }
+    }
+    else {
+
+        // Solve U^T X = B or U^H X = B
+        for( idx_t c = 0; c < nrhs; ++c ) {
+            auto b = col( B, c );
+            tbsv( Uplo::Upper, trans, Diag::NonUnit, A, b );
+        }
+
+        // Solve L^T X = B or L^H X = B, applying the interchanges
+        if( kl > 0 ) {
+            for( idx_t j = n-1; j-- > 0; ) {
+                const idx_t lm = min( kl, n-1-j );
+                for( idx_t c = 0; c < nrhs; ++c ) {
+                    TB s = B(j,c);
+                    if( trans == Op::ConjTrans ) {
+                        for( idx_t i = j+1; i <= j+lm; ++i )
+                            s -= conj( A(i,j) ) * B(i,c);
+                    }
+                    else {
+                        for( idx_t i = j+1; i <= j+lm; ++i )
+                            s -= A(i,j) * B(i,c);
+                    }
+                    B(j,c) = s;
+                }
+                const idx_t p = piv[j];
+                if( p != j ) {
+                    auto b1 = row( B, j );
+                    auto b2 = row( B, p );
+                    tlapack::swap( b1, b2 );
+                }
+            }
+        }
+    }
+
+    return 0;
+}
+
+} // namespace tlapack
+
+#endif // __TLAPACK_GBTRS_HH__
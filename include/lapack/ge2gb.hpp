@@ -0,0 +1,180 @@
+/// @file ge2gb.hpp
+//
+// Copyright (c) 2022, University of Colorado Denver. All rights reserved.
+//
+// This file is part of <T>LAPACK.
+// <T>LAPACK is free software: you can redistribute it and/or modify it under
+// the terms of the BSD 3-Clause license. See the accompanying LICENSE file.
+
+#ifndef __TLAPACK_GE2GB_HH__
+#define __TLAPACK_GE2GB_HH__
+
+#include "legacy_api/base/utils.hpp"
+#include "base/utils.hpp"
+#include "base/profile.hpp"
+#include "base/types.hpp"
+#include "base/workspace.hpp"
+#include "lapack/geqr2.hpp"
+#include "lapack/gelq2.hpp"
+#include "lapack/larft.hpp"
+#include "lapack/larfb.hpp"
+
+namespace tlapack
+{
+
+    /**
+     * Options struct for ge2gb
+     */
+    template <typename idx_t, typename T>
+    struct ge2gb_opts_t {
+        // Blocksize, which is also the bandwidth of the reduced matrix
+        idx_t nb = 32;
+        // Workspace pointer, if no workspace is provided, one will be allocated internally
+        T* _work=nullptr;
+        // Workspace size
+        idx_t lwork = 0;
+        // Arena used if no workspace is provided. If nullptr, the default
+        // arena of the calling thread is used.
+        workspace_arena* arena = nullptr;
+    };
+
+    /**
+     * Returns the required workspace for ge2gb.
+     * The arguments are the same as for ge2gb itself.
+     *
+     * @return idx_t The size of the required workspace
+     */
+    template <class matrix_t, class vectorQ_t, class vectorP_t, typename idx_t = size_type<matrix_t>, typename TA = type_t<matrix_t>>
+    idx_t get_work_ge2gb(matrix_t &A, vectorQ_t &tauq, vectorP_t &taup, const ge2gb_opts_t<idx_t, TA> &opts = {})
+    {
+        const idx_t m = nrows(A);
+        const idx_t n = ncols(A);
+        idx_t nb = opts.nb;
+
+        // The triangular factor T and the workspace of larfb
+        return nb*nb + std::max(m, n)*nb;
+    }
+
+    /** Reduces a general m-by-n matrix A, m >= n, to upper band form with
+     * nb superdiagonals by a unitary transformation: $Q^H A P = B$.
+     *
+     * This is the first stage of the two-stage reduction to bidiagonal form.
+     * For each block column, a QR factorization of the panel A(k:m,k:k+nb)
+     * is computed and applied to the trailing matrix from the left, and an LQ
+     * factorization of the block row A(k:k+nb,k+nb:n) is computed and
+     * applied to the trailing matrix from the right. Both updates are done by
+     * larfb, so that almost all the work is done in level 3 BLAS.
+     *
+     * The matrix Q is represented as a product of elementary reflectors
+     * \[
+     *          Q = H_0 H_1 ... H_{n-1},
+     * \]
+     * stored as in a QR factorization of A. The matrix P is represented as a
+     * product of elementary reflectors
+     * \[
+     *          P = G_0 G_1 ... G_{n-nb-1},
+     * \]
+     * stored as in an LQ factorization of A(0:n-nb,nb:n), i.e., $P^H$ is the
+     * matrix Q returned by gelq2 for this submatrix.
+     *
+     * @return  0 if success
+     *
+     * @param[in,out] A m-by-n matrix, m >= n.
+     *      On exit, the elements A(i,j) with i <= j <= i+nb contain the upper
+     *      band matrix B. The elements below the diagonal, with the array
+     *      tauq, represent Q; the elements above the band, with the array
+     *      taup, represent P.
+     * @param[out] tauq Vector of length n.
+     *      The scalar factors of the elementary reflectors which represent Q.
+     * @param[out] taup Vector of length n.
+     *      The scalar factors of the elementary reflectors which represent P.
+     *      taup[n-nb] through taup[n-1] are set to zero.
+     *
+     * @param[in,out] opts Struct containing the options
+     *      See ge2gb_opts_t for more details
+     *
+     * @ingroup gesvd_computational
+     */
+    template <class matrix_t, class vectorQ_t, class vectorP_t, typename idx_t = size_type<matrix_t>, typename TA = type_t<matrix_t>>
+    int ge2gb(matrix_t &A, vectorQ_t &tauq, vectorP_t &taup, const ge2gb_opts_t<idx_t, TA> &opts = {})
+    {
+        using pair = pair<idx_t, idx_t>;
+        using std::min;
+
+        // constants
+        const idx_t m = nrows(A);
+        const idx_t n = ncols(A);
+        const idx_t nb = opts.nb;
+
+        TLAPACK_PROFILE_SCOPE( "ge2gb", TA, (m >= n) ? 4.0*n*n*(m - n/3.0) : 4.0*m*m*(n - m/3.0), double(m)*n );
+
+        // check arguments
+        tlapack_check_false(access_denied(dense, write_policy(A)), -1);
+        tlapack_check_false(m < n, -1);
+        tlapack_check_false((idx_t)size(tauq) < n, -2);
+        tlapack_check_false((idx_t)size(taup) < n, -3);
+        tlapack_check_false(nb <= 0, -4);
+
+        // quick return
+        if (n <= 0)
+            return 0;
+
+        // Get the workspace
+        idx_t required_workspace = get_work_ge2gb(A, tauq, taup, opts);
+        // Use the provided workspace if it is large enough, otherwise borrow
+        // it from the arena
+        local_workspace<TA> workspace( opts._work, opts.lwork, required_workspace, opts.arena );
+        TA* _work = workspace.data();
+
+        auto T = legacyMatrix<TA, layout<matrix_t>>( nb, nb, &_work[0], nb );
+        TA* _work2 = &_work[nb*nb];
+
+        for (idx_t k = 0; k < n; k += nb)
+        {
+            const idx_t kb = min(nb, n - k);
+
+            // QR factorization of the panel A(k:m,k:k+kb)
+            auto V = slice(A, pair{k, m}, pair{k, k + kb});
+            auto tauq1 = slice(tauq, pair{k, k + kb});
+            auto w = legacyVector<TA>( kb, _work2 );
+            geqr2(V, tauq1, w);
+
+            if (k + kb >= n)
+                break;
+
+            // Apply Q^H to A(k:m,k+kb:n) from the left
+            auto T1 = slice(T, pair{0, kb}, pair{0, kb});
+            larft(forward, columnwise_storage, V, tauq1, T1);
+            auto C = slice(A, pair{k, m}, pair{k + kb, n});
+            auto W = legacyMatrix<TA, layout<matrix_t>>( kb, n - k - kb, _work2, layout<matrix_t> == Layout::ColMajor ? kb : n - k - kb );
+            larfb(left_side, Op::ConjTrans, forward, columnwise_storage, V, T1, C, W);
+
+            // LQ factorization of the block row A(k:k+kb,k+kb:n)
+            auto L = slice(A, pair{k, k + kb}, pair{k + kb, n});
+            const idx_t kl = min(kb, n - k - kb);
+            auto taup1 = slice(taup, pair{k, k + kb});
+            for (idx_t j = kl; j < kb; ++j)
+                taup1[j] = TA(0);
+            auto taup2 = slice(taup1, pair{0, kl});
+            auto w2 = legacyVector<TA>( kb, _work2 );
+            gelq2(L, taup2, w2);
+
+            // Apply P to A(k+kb:m,k+kb:n) from the right
+            auto U = slice(L, pair{0, kl}, pair{0, n - k - kb});
+            auto T2 = slice(T, pair{0, kl}, pair{0, kl});
+            larft(forward, rowwise_storage, U, taup2, T2);
+            auto C2 = slice(A, pair{k + kb, m}, pair{k + kb, n});
+            auto W2 = legacyMatrix<TA, layout<matrix_t>>( m - k - kb, kl, _work2, layout<matrix_t> == Layout::ColMajor ? m - k - kb : kl );
+            larfb(right_side, Op::NoTrans, forward, rowwise_storage, U, T2, C2, W2);
+        }
+
+        // The last nb elements of taup are not used
+        for (idx_t j = (n > nb) ? n - nb : 0; j < n; ++j)
+            taup[j] = TA(0);
+
+        return 0;
+    }
+
+} // lapack
+
+#endif // __TLAPACK_GE2GB_HH__
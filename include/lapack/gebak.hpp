@@ -0,0 +1,103 @@
+/// @file gebak.hpp
+/// Adapted from @see https://github.com/Reference-LAPACK/lapack/tree/master/SRC/zgebak.f
+//
+// Copyright (c) 2022, University of Colorado Denver. All rights reserved.
+//
+// This file is part of <T>LAPACK.
+// <T>LAPACK is free software: you can redistribute it and/or modify it under
+// the terms of the BSD 3-Clause license. See the accompanying LICENSE file.
+
+#ifndef __TLAPACK_GEBAK_HH__
+#define __TLAPACK_GEBAK_HH__
+
+#include "base/utils.hpp"
+#include "base/profile.hpp"
+#include "base/types.hpp"
+#include "blas/scal.hpp"
+#include "blas/swap.hpp"
+
+namespace tlapack {
+
+/** Forms the right or left eigenvectors or Schur vectors of a general
+ * matrix by backward transformation on the computed vectors of the
+ * balanced matrix output by gebal.
+ *
+ * @return  0 if success
+ *
+ * @param[in] want_permute bool.
+ *      Must be the same as in the call to gebal.
+ * @param[in] want_scale bool.
+ *      Must be the same as in the call to gebal.
+ * @param[in] side
+ *      - Side::Right: V contains right eigenvectors or Schur vectors;
+ *      - Side::Left:  V contains left eigenvectors.
+ * @param[in] ilo integer
+ * @param[in] ihi integer
+ *      The integers ilo and ihi determined by gebal.
+ * @param[in] scale Real vector of length n.
+ *      Details of the permutation and scaling factors, as returned by gebal.
+ * @param[in,out] V n-by-m matrix.
+ *      On entry, the matrix of right or left vectors to be transformed.
+ *      On exit, V is overwritten by the transformed vectors.
+ *
+ * @ingroup geev_computational
+ */
+template< class vector_t, class matrix_t >
+int gebak(
+    bool want_permute, bool want_scale,
+    Side side,
+    size_type< matrix_t > ilo,
+    size_type< matrix_t > ihi,
+    const vector_t& scale,
+    matrix_t& V )
+{
+    using idx_t  = size_type< matrix_t >;
+    using real_t = type_t< vector_t >;
+    using pair   = pair<idx_t,idx_t>;
+
+    // constants
+    const real_t one(1);
+    const idx_t n = nrows(V);
+    const idx_t m = ncols(V);
+
+    TLAPACK_PROFILE_SCOPE( "gebak", type_t<matrix_t>, double(m)*n, double(m)*n + n );
+
+    // check arguments
+    tlapack_check_false( side != Side::Left && side != Side::Right, -3 );
+    tlapack_check_false( ihi > n || ilo > ihi, -5 );
+    tlapack_check_false( (idx_t) size(scale) < n, -6 );
+    tlapack_check_false( access_denied( dense, write_policy(V) ), -7 );
+
+    // quick return
+    if (n <= 0 || m <= 0) return 0;
+
+    // Backward balance
+    if( want_scale && ihi - ilo > 1 ) {
+        for( idx_t i = ilo; i < ihi; ++i ) {
+            auto vi = slice( V, i, pair{0,m} );
+            scal( (side == Side::Right) ? scale[i] : one / scale[i], vi );
+        }
+    }
+
+    // Backward permutation, in the reverse order of gebal: 0:ilo is
+    // traversed from ilo-1 down to 0, and ihi:n from ihi to n-1
+    if( want_permute ) {
+        for( idx_t ii = 0; ii < n; ++ii ) {
+            idx_t i = ii;
+            if( i >= ilo && i < ihi ) continue;
+            if( i < ilo ) i = ilo - 1 - ii;
+            const idx_t k = idx_t( scale[i] );
+            if( k != i ) {
+                auto vi = slice( V, i, pair{0,m} );
+                auto vk = slice( V, k, pair{0,m} );
+                tlapack::swap( vi, vk );
+            }
+        }
+    }
+
+    return 0;
+}
+
+} // lapack
+
+#endif // __TLAPACK_GEBAK_HH__
@@ -0,0 +1,257 @@
+/// @file gebal.hpp
+/// Adapted from @see https://github.com/Reference-LAPACK/lapack/tree/master/SRC/zgebal.f
+//
+// Copyright (c) 2022, University of Colorado Denver. All rights reserved.
+//
+// This file is part of <T>LAPACK.
+// <T>LAPACK is free software: you can redistribute it and/or modify it under
+// the terms of the BSD 3-Clause license. See the accompanying LICENSE file.
+
+#ifndef __TLAPACK_GEBAL_HH__
+#define __TLAPACK_GEBAL_HH__
+
+#include "base/utils.hpp"
+#include "base/profile.hpp"
+#include "base/types.hpp"
+#include "blas/scal.hpp"
+#include "blas/swap.hpp"
+
+namespace tlapack {
+
+/** Balances a general n-by-n matrix A.
+ *
+ * Balancing may reduce the 1-norm of the matrix, and improve the accuracy
+ * of the computed eigenvalues and the convergence of the QR algorithm.
+ * It involves, first, permuting A by a similarity transformation to
+ * isolate eigenvalues in rows and columns 0:ilo and ihi:n of A, i.e.,
+ * \[
+ *      P^T A P =
+ *      \begin{bmatrix} T_1 & X & Y \\ 0 & B & Z \\ 0 & 0 & T_2 \end{bmatrix},
+ * \]
+ * where T_1 and T_2 are upper triangular, and, second, applying a diagonal
+ * similarity transformation to rows and columns ilo:ihi to make the rows
+ * and columns as close in norm as possible:
+ * \[
+ *      D^{-1} P^T A P D.
+ * \]
+ * The scaling factors are powers of 2, so no rounding errors are
+ * introduced. For each index i, the 1-norms of the off-diagonal parts of
+ * row i and column i, and their largest entries, are computed in a single
+ * pass over the matrix.
+ *
+ * @return  0 if success
+ *
+ * @param[in] want_permute bool.
+ *      If true, A is permuted to isolate eigenvalues.
+ * @param[in] want_scale bool.
+ *      If true, A is scaled.
+ * @param[in,out] A n-by-n matrix.
+ *      On exit, A is overwritten by the balanced matrix.
+ *      A(i,j) = 0 if i > j and j = 0:ilo or i = ihi:n.
+ * @param[out] ilo integer
+ * @param[out] ihi integer
+ *      ilo and ihi are set such that A(i,j) = 0 if i > j and j = 0:ilo or
+ *      i = ihi:n. If want_permute is false, ilo = 0 and ihi = n.
+ * @param[out] scale Real vector of length n.
+ *      Details of the permutations and scaling factors applied to A.
+ *      If p[j] is the index of the row and column interchanged with row and
+ *      column j and d[j] is the scaling factor applied to row and column j,
+ *      then
+ *      - scale[j] = p[j] for j = 0:ilo,
+ *      - scale[j] = d[j] for j = ilo:ihi,
+ *      - scale[j] = p[j] for j = ihi:n.
+ *      The order in which the interchanges are made is n-1 to ihi, then 0
+ *      to ilo-1.
+ *
+ * @ingroup geev_computational
+ */
+template< class matrix_t, class vector_t >
+int gebal(
+    bool want_permute, bool want_scale,
+    matrix_t& A,
+    size_type< matrix_t >& ilo,
+    size_type< matrix_t >& ihi,
+    vector_t& scale )
+{
+    using TA     = type_t< matrix_t >;
+    using idx_t  = size_type< matrix_t >;
+    using real_t = real_type< TA >;
+    using pair   = pair<idx_t,idx_t>;
+
+    // constants
+    const real_t zero(0);
+    const real_t one(1);
+    const real_t radix(2);
+    const real_t factor(0.95);
+    const idx_t n = ncols(A);
+
+    TLAPACK_PROFILE_SCOPE( "gebal", type_t<matrix_t>, 0, double(n)*n + n );
+
+    const real_t sfmin1 = safe_min<real_t>() / ulp<real_t>();
+    const real_t sfmax1 = one / sfmin1;
+    const real_t sfmin2 = sfmin1 * radix;
+    const real_t sfmax2 = one / sfmin2;
+
+    // check arguments
+    tlapack_check_false( access_denied( dense, write_policy(A) ), -3 );
+    tlapack_check_false( nrows(A) != n, -3 );
+    tlapack_check_false( (idx_t) size(scale) < n, -6 );
+
+    ilo = 0;
+    ihi = n;
+
+    // quick return
+    if (n <= 0) return 0;
+
+    if( want_permute ) {
+
+        // Search for rows isolating an eigenvalue and push them down
+        idx_t l = n;
+        bool noconv = true;
+        while( noconv ) {
+            noconv = false;
+            for( idx_t i = l; i-- > 0; ) {
+                bool canswap = true;
+                for( idx_t j = 0; j < l; ++j ) {
+                    if( i != j && A(i,j) != TA(0) ) {
+                        canswap = false;
+                        break;
+                    }
+                }
+                if( canswap ) {
+                    scale[l-1] = real_t(i);
+                    if( i != l-1 ) {
+                        auto c1 = slice( A, pair{0,l}, i );
+                        auto c2 = slice( A, pair{0,l}, l-1 );
+                        tlapack::swap( c1, c2 );
+                        auto r1 = slice( A, i, pair{0,n} );
+                        auto r2 = slice( A, l-1, pair{0,n} );
+                        tlapack::swap( r1, r2 );
+                    }
+                    noconv = true;
+                    if( l == 1 ) {
+                        ilo = 0;
+                        ihi = 1;
+                        return 0;
+                    }
+                    --l;
+                }
+            }
+        }
+
+        // Search for columns isolating an eigenvalue and push them left
+        idx_t k = 0;
+        noconv = true;
+        while( noconv ) {
+            noconv = false;
+            for( idx_t j = k; j < l; ++j ) {
+                bool canswap = true;
+                for( idx_t i = k; i < l; ++i ) {
+                    if( i != j && A(i,j) != TA(0) ) {
+                        canswap = false;
+                        break;
+                    }
+                }
+                if( canswap ) {
+                    scale[k] = real_t(j);
+                    if( j != k ) {
+                        auto c1 = slice( A, pair{0,l}, j );
+                        auto c2 = slice( A, pair{0,l}, k );
+                        tlapack::swap( c1, c2 );
+                        auto r1 = slice( A, j, pair{k,n} );
+                        auto r2 = slice( A, k, pair{k,n} );
+                        tlapack::swap( r1, r2 );
+                    }
+                    noconv = true;
+                    ++k;
+                }
+            }
+        }
+
+        ilo = k;
+        ihi = l;
+    }
+
+    // Initialize the scaling factors
+    for( idx_t i = ilo; i < ihi; ++i )
+        scale[i] = one;
+
+    if( !want_scale || ihi - ilo <= 1 ) return 0;
+
+    // Iterative loop for norm reduction
+    bool noconv = true;
+    while( noconv ) {
+        noconv = false;
+        for( idx_t i = ilo; i < ihi; ++i ) {
+
+            // Off-diagonal 1-norms of column i and row i in the active block,
+            // and largest entries of column i in rows 0:ihi and of row i in
+            // columns ilo:n, all in a single pass
+            real_t c = zero, r = zero, ca = zero, ra = zero;
+            for( idx_t k = 0; k < ilo; ++k )
+                ca = std::max( ca, abs( A(k,i) ) );
+            for( idx_t k = ilo; k < ihi; ++k ) {
+                const real_t acol = abs( A(k,i) );
+                const real_t arow = abs( A(i,k) );
+                ca = std::max( ca, acol );
+                ra = std::max( ra, arow );
+                if( k != i ) {
+                    c += acol;
+                    r += arow;
+                }
+            }
+            for( idx_t k = ihi; k < n; ++k )
+                ra = std::max( ra, abs( A(i,k) ) );
+
+            // Guard against zero c or r due to underflow
+            if( c == zero || r == zero ) continue;
+
+            // Exit if NaN to avoid an infinite loop
+            if( isnan( c + ca + r + ra ) ) return -3;
+
+            real_t g = r / radix;
+            real_t f = one;
+            const real_t s = c + r;
+
+            while( c < g && std::max( f, std::max( c, ca ) ) < sfmax2
+                         && std::min( r, std::min( g, ra ) ) > sfmin2 ) {
+                f *= radix;
+                c *= radix;
+                ca *= radix;
+                r /= radix;
+                g /= radix;
+                ra /= radix;
+            }
+
+            g = c / radix;
+            while( g >= r && std::max( r, ra ) < sfmax2
+                          && std::min( std::min( f, c ), std::min( g, ca ) ) > sfmin2 ) {
+                f /= radix;
+                c /= radix;
+                g /= radix;
+                ca /= radix;
+                r *= radix;
+                ra *= radix;
+            }
+
+            // Now balance
+            if( c + r >= factor * s ) continue;
+            if( f < one && scale[i] < one && f * scale[i] <= sfmin1 ) continue;
+            if( f > one && scale[i] > one && scale[i] >= sfmax1 / f ) continue;
+
+            scale[i] *= f;
+            noconv = true;
+
+            auto ri = slice( A, i, pair{ilo,n} );
+            scal( one / f, ri );
+            auto ci = slice( A, pair{0,ihi}, i );
+            scal( f, ci );
+        }
+    }
+
+    return 0;
+}
+
+} // lapack
+
+#endif // __TLAPACK_GEBAL_HH__
@@ -0,0 +1,117 @@
+/// @file gebd2.hpp
+/// Adapted from @see https://github.com/Reference-LAPACK/lapack/tree/master/SRC/zgebd2.f
+//
+// Copyright (c) 2022, University of Colorado Denver. All rights reserved.
+//
+// This file is part of <T>LAPACK.
+// <T>LAPACK is free software: you can redistribute it and/or modify it under
+// the terms of the BSD 3-Clause license. See the accompanying LICENSE file.
+
+#ifndef __TLAPACK_GEBD2_HH__
+#define __TLAPACK_GEBD2_HH__
+
+#include "base/utils.hpp"
+#include "base/profile.hpp"
+#include "base/types.hpp"
+#include "lapack/larfg.hpp"
+#include "lapack/larf.hpp"
+
+namespace tlapack {
+
+/** Reduces a general m-by-n matrix A, m >= n, to real upper bidiagonal form B
+ * by a unitary transformation: $Q^H A P = B$.
+ *
+ * The matrices Q and P are represented as products of elementary reflectors
+ * \[
+ *          Q = H_0 H_1 ... H_{n-1} \quad\text{and}\quad P = G_0 G_1 ... G_{n-2}.
+ * \]
+ * Each H_i and G_i has the form
+ * \[
+ *          H_i = I - tauq * v * v' \quad\text{and}\quad G_i = I - taup * u * u',
+ * \]
+ * where tauq and taup are scalars, and v and u are vectors with
+ * \[
+ *          v[0] = ... = v[i-1] = 0; v[i] = 1,
+ * \]
+ * \[
+ *          u[0] = ... = u[i] = 0; u[i+1] = 1,
+ * \]
+ * with v[i+1] through v[m-1] stored on exit in A(i+1:m,i), conj(u[i+2])
+ * through conj(u[n-1]) stored on exit in A(i,i+2:n), tauq in tauq[i] and
+ * taup in taup[i].
+ *
+ * @return  0 if success
+ *
+ * @param[in,out] A m-by-n matrix, m >= n.
+ *      On exit, the diagonal and the first superdiagonal of A are
+ *      overwritten by the real upper bidiagonal matrix B. The elements below
+ *      the diagonal, with the array tauq, represent Q; the elements above
+ *      the first superdiagonal, with the array taup, represent P.
+ * @param[out] tauq Vector of length n.
+ *      The scalar factors of the elementary reflectors which represent Q.
+ * @param[out] taup Vector of length n.
+ *      The scalar factors of the elementary reflectors which represent P.
+ *      taup[n-1] is set to zero.
+ * @param work Vector of size m.
+ *
+ * @ingroup gesvd_computational
+ */
+template< class matrix_t, class vectorQ_t, class vectorP_t, class work_t >
+int gebd2( matrix_t& A, vectorQ_t& tauq, vectorP_t& taup, work_t& work )
+{
+    using idx_t = size_type< matrix_t >;
+    using pair  = pair<idx_t,idx_t>;
+
+    // constants
+    const idx_t m = nrows(A);
+    const idx_t n = ncols(A);
+
+    TLAPACK_PROFILE_SCOPE( "gebd2", type_t<matrix_t>, (m >= n) ? 4.0*n*n*(m - n/3.0) : 4.0*m*m*(n - m/3.0), double(m)*n );
+
+    // check arguments
+    tlapack_check_false( access_denied( dense, write_policy(A) ), -1 );
+    tlapack_check_false( m < n, -1 );
+    tlapack_check_false( (idx_t) size(tauq) < n, -2 );
+    tlapack_check_false( (idx_t) size(taup) < n, -3 );
+    tlapack_check_false( (idx_t) size(work) < m, -4 );
+
+    // quick return
+    if (n <= 0) return 0;
+
+    for( idx_t i = 0; i < n; ++i ) {
+
+        // Generate H_i to annihilate A(i+1:m,i)
+        auto v = slice( A, pair{i,m}, i );
+        larfg( v, tauq[i] );
+
+        if( i < n-1 ) {
+
+            // Apply H_i^H to A(i:m,i+1:n) from the left
+            auto C = slice( A, pair{i,m}, pair{i+1,n} );
+            auto w = slice( work, pair{0,n-i-1} );
+            larf( left_side, v, conj(tauq[i]), C, w );
+
+            // Generate G_i to annihilate A(i,i+2:n)
+            auto u = slice( A, i, pair{i+1,n} );
+            for( idx_t j = 0; j < n-i-1; ++j )
+                u[j] = conj( u[j] );
+            larfg( u, taup[i] );
+
+            // Apply G_i to A(i+1:m,i+1:n) from the right
+            auto C2 = slice( A, pair{i+1,m}, pair{i+1,n} );
+            auto w2 = slice( work, pair{0,m-i-1} );
+            larf( right_side, u, taup[i], C2, w2 );
+
+            for( idx_t j = 0; j < n-i-1; ++j )
+                u[j] = conj( u[j] );
+        }
+        else
+            taup[i] = type_t< vectorP_t >(0);
+    }
+
+    return 0;
+}
+
+} // lapack
+
+#endif // __TLAPACK_GEBD2_HH__
@@ -0,0 +1,169 @@
+/// @file gebrd.hpp
+/// Adapted from @see https://github.com/Reference-LAPACK/lapack/tree/master/SRC/zgebrd.f
+//
+// Copyright (c) 2022, University of Colorado Denver. All rights reserved.
+//
+// This file is part of <T>LAPACK.
+// <T>LAPACK is free software: you can redistribute it and/or modify it under
+// the terms of the BSD 3-Clause license. See the accompanying LICENSE file.
+
+#ifndef __TLAPACK_GEBRD_HH__
+#define __TLAPACK_GEBRD_HH__
+
+#include "legacy_api/base/utils.hpp"
+#include "base/utils.hpp"
+#include "base/profile.hpp"
+#include "base/types.hpp"
+#include "base/workspace.hpp"
+#include "lapack/gebd2.hpp"
+#include "lapack/labrd.hpp"
+#include "blas/gemm.hpp"
+
+namespace tlapack
+{
+
+    /**
+     * Options struct for gebrd
+     */
+    template <typename idx_t, typename T>
+    struct gebrd_opts_t {
+        // Blocksize used in the blocked reduction
+        idx_t nb = 32;
+        // If only nx_switch columns are left, the algorithm will use unblocked code
+        idx_t nx_switch = 128;
+        // Workspace pointer, if no workspace is provided, one will be allocated internally
+        T* _work=nullptr;
+        // Workspace size
+        idx_t lwork = 0;
+        // Arena used if no workspace is provided. If nullptr, the default
+        // arena of the calling thread is used.
+        workspace_arena* arena = nullptr;
+    };
+
+    /**
+     * Returns the required workspace for gebrd.
+     * The arguments are the same as for gebrd itself.
+     *
+     * @return idx_t The size of the required workspace
+     */
+    template <class matrix_t, class vectorQ_t, class vectorP_t, typename idx_t = size_type<matrix_t>, typename TA = type_t<matrix_t>>
+    idx_t get_work_gebrd(matrix_t &A, vectorQ_t &tauq, vectorP_t &taup, const gebrd_opts_t<idx_t, TA> &opts = {})
+    {
+        const idx_t m = nrows(A);
+        const idx_t n = ncols(A);
+        idx_t nb = opts.nb;
+
+        // X, Y and the bidiagonal elements of each panel, or the workspace
+        // of gebd2
+        return std::max( (m + n)*nb + 2*nb, m );
+    }
+
+    /** Reduces a general m-by-n matrix A, m >= n, to real upper bidiagonal
+     * form B by a unitary transformation: $Q^H A P = B$.
+     *
+     * The panels of nb rows and columns are reduced by labrd, and the
+     * trailing matrix is updated with the two matrix-matrix products
+     * \[
+     *      A := A - V Y^H - X U^H
+     * \]
+     * using gemm. See gebd2 for the representation of Q and P.
+     *
+     * @return  0 if success
+     *
+     * @param[in,out] A m-by-n matrix, m >= n.
+     *      On exit, the diagonal and the first superdiagonal of A are
+     *      overwritten by the real upper bidiagonal matrix B. The elements
+     *      below the diagonal, with the array tauq, represent Q; the elements
+     *      above the first superdiagonal, with the array taup, represent P.
+     * @param[out] tauq Vector of length n.
+     *      The scalar factors of the elementary reflectors which represent Q.
+     * @param[out] taup Vector of length n.
+     *      The scalar factors of the elementary reflectors which represent P.
+     *
+     * @param[in,out] opts Struct containing the options
+     *      See gebrd_opts_t for more details
+     *
+     * @ingroup gesvd_computational
+     */
+    template <class matrix_t, class vectorQ_t, class vectorP_t, typename idx_t = size_type<matrix_t>, typename TA = type_t<matrix_t>>
+    int gebrd(matrix_t &A, vectorQ_t &tauq, vectorP_t &taup, const gebrd_opts_t<idx_t, TA> &opts = {})
+    {
+        using pair = pair<idx_t, idx_t>;
+
+        // constants
+        const TA one(1);
+        const idx_t m = nrows(A);
+        const idx_t n = ncols(A);
+        const idx_t nb = std::min(opts.nb, n);
+        const idx_t nx = std::max(nb, opts.nx_switch);
+
+        TLAPACK_PROFILE_SCOPE( "gebrd", TA, (m >= n) ? 4.0*n*n*(m - n/3.0) : 4.0*m*m*(n - m/3.0), double(m)*n );
+
+        // check arguments
+        tlapack_check_false(access_denied(dense, write_policy(A)), -1);
+        tlapack_check_false(m < n, -1);
+        tlapack_check_false((idx_t)size(tauq) < n, -2);
+        tlapack_check_false((idx_t)size(taup) < n, -3);
+
+        // quick return
+        if (n <= 0)
+            return 0;
+
+        // Get the workspace
+        idx_t required_workspace = get_work_gebrd(A, tauq, taup, opts);
+        // Use the provided workspace if it is large enough, otherwise borrow
+        // it from the arena
+        local_workspace<TA> workspace( opts._work, opts.lwork, required_workspace, opts.arena );
+        TA* _work = workspace.data();
+
+        auto X = legacyMatrix<TA, layout<matrix_t>>( m, nb, &_work[0], layout<matrix_t> == Layout::ColMajor ? m : nb );
+        auto Y = legacyMatrix<TA, layout<matrix_t>>( n, nb, &_work[m*nb], layout<matrix_t> == Layout::ColMajor ? n : nb );
+        auto d = legacyVector<TA>( nb, &_work[(m+n)*nb] );
+        auto e = legacyVector<TA>( nb, &_work[(m+n)*nb + nb] );
+
+        idx_t i = 0;
+        for (; i + nx < n; i += nb)
+        {
+            // Reduce rows and columns i:i+nb to bidiagonal form and form the
+            // matrices X and Y which are needed to update the unreduced part
+            // of the matrix
+            auto A11 = slice(A, pair{i, m}, pair{i, n});
+            auto tauq1 = slice(tauq, pair{i, i + nb});
+            auto taup1 = slice(taup, pair{i, i + nb});
+            auto X1 = slice(X, pair{0, m - i}, pair{0, nb});
+            auto Y1 = slice(Y, pair{0, n - i}, pair{0, nb});
+            labrd(A11, d, e, tauq1, taup1, X1, Y1);
+
+            // Update the trailing submatrix A(i+nb:m,i+nb:n), using an update
+            // of the form:  A := A - V*Y**H - X*U**H
+            auto A22 = slice(A, pair{i + nb, m}, pair{i + nb, n});
+            gemm(Op::NoTrans, Op::ConjTrans, -one,
+                 slice(A, pair{i + nb, m}, pair{i, i + nb}),
+                 slice(Y, pair{nb, n - i}, pair{0, nb}),
+                 one, A22);
+            gemm(Op::NoTrans, Op::NoTrans, -one,
+                 slice(X, pair{nb, m - i}, pair{0, nb}),
+                 slice(A, pair{i, i + nb}, pair{i + nb, n}),
+                 one, A22);
+
+            // Copy the bidiagonal elements back into A
+            for (idx_t j = 0; j < nb; ++j)
+            {
+                A(i + j, i + j) = d[j];
+                A(i + j, i + j + 1) = e[j];
+            }
+        }
+
+        // Use unblocked code to reduce the remainder of the matrix
+        auto A22 = slice(A, pair{i, m}, pair{i, n});
+        auto tauq2 = slice(tauq, pair{i, n});
+        auto taup2 = slice(taup, pair{i, n});
+        auto w = legacyVector<TA>( m - i, &_work[0] );
+        gebd2(A22, tauq2, taup2, w);
+
+        return 0;
+    }
+
+} // lapack
+
+#endif // __TLAPACK_GEBRD_HH__
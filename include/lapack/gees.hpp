@@ -0,0 +1,242 @@
+/// @file gees.hpp
+/// Adapted from @see https://github.com/Reference-LAPACK/lapack/tree/master/SRC/zgees.f
+//
+// Copyright (c) 2022, University of Colorado Denver. All rights reserved.
+//
+// This file is part of <T>LAPACK.
+// <T>LAPACK is free software: you can redistribute it and/or modify it under
+// the terms of the BSD 3-Clause license. See the accompanying LICENSE file.
+
+#ifndef __TLAPACK_GEES_HH__
+#define __TLAPACK_GEES_HH__
+
+#include "legacy_api/base/utils.hpp"
+#include "base/utils.hpp"
+#include "base/profile.hpp"
+#include "base/types.hpp"
+#include "base/workspace.hpp"
+#include "lapack/gebal.hpp"
+#include "lapack/gebak.hpp"
+#include "lapack/gehrd.hpp"
+#include "lapack/unghr.hpp"
+#include "lapack/lacpy.hpp"
+#include "lapack/multishift_qr.hpp"
+
+namespace tlapack
+{
+
+    /**
+     * Options struct for gees
+     */
+    template <typename idx_t, typename T>
+    struct gees_opts_t {
+        // If true, the matrix is permuted to isolate eigenvalues before the
+        // reduction to Hessenberg form
+        bool permute = true;
+        // If true, the matrix is scaled by a diagonal similarity
+        // transformation before the reduction to Hessenberg form.
+        // In this case, Z is no longer unitary (see gees).
+        bool scale = false;
+        // Blocksize used in gehrd
+        tunable<idx_t> nb = {tuning_default, 32};
+        // If only nx_switch columns are left, gehrd will use unblocked code
+        tunable<idx_t> nx_switch = {tuning_default, 128};
+        // If true, gehrd splits its updates across OpenMP threads.
+        // Has no effect if <T>LAPACK is not compiled with OpenMP.
+        bool parallel = false;
+        // Options of the QR algorithm. On exit, contains the number of
+        // sweeps and AED steps that were performed.
+        francis_opts_t<idx_t, T> francis;
+        // Workspace pointer, if no workspace is provided, one will be allocated internally
+        T* _work=nullptr;
+        // Workspace size
+        idx_t lwork = 0;
+        // Real workspace pointer, if no workspace is provided, one will be allocated internally
+        real_type<T>* _rwork=nullptr;
+        // Real workspace size
+        idx_t lrwork = 0;
+        // Arena used if no workspace is provided. If nullptr, the default
+        // arena of the calling thread is used.
+        workspace_arena* arena = nullptr;
+    };
+
+    /**
+     * Returns the required workspaces for gees.
+     * The arguments are the same as for gees itself.
+     *
+     * @return std::pair<idx_t,idx_t> The sizes of the required workspace
+     *      and of the required real workspace
+     */
+    template <class matrix_t, class vector_t, typename idx_t = size_type<matrix_t>, typename TA = type_t<matrix_t>>
+    std::pair<idx_t,idx_t> get_work_gees(bool want_t, bool want_z, matrix_t &A, vector_t &w, matrix_t &Z, const gees_opts_t<idx_t, TA> &opts = {})
+    {
+        const idx_t n = ncols(A);
+
+        gehrd_opts_t<idx_t, TA> gehrd_opts;
+        gehrd_opts.nb = opts.nb;
+        gehrd_opts.nx_switch = opts.nx_switch;
+        gehrd_opts.parallel = opts.parallel;
+        auto tau = legacyVector<TA>( n, (TA*) nullptr );
+
+        // tau, and the workspaces of gehrd and unghr
+        const idx_t lwork = n + std::max( n, get_work_gehrd(0, n, A, tau, gehrd_opts) );
+        // The scaling factors and permutations of gebal
+        const idx_t lrwork = n;
+
+        return std::pair<idx_t,idx_t>( lwork, lrwork );
+    }
+
+    /** Computes the eigenvalues and, optionally, the Schur form and the Schur
+     * vectors of a general n-by-n matrix A: $A = Z T Z^H$.
+     *
+     * The matrix is balanced by gebal, reduced to upper Hessenberg form by
+     * gehrd, and the Schur form of the Hessenberg matrix is computed by
+     * multishift_qr. The Schur vectors are transformed back by gebak.
+     *
+     * Permuting A isolates the eigenvalues that can be read from the
+     * diagonal, and shrinks the active block of the QR algorithm. Scaling A
+     * reduces its norm, which usually improves the accuracy of the
+     * eigenvalues and reduces the number of QR sweeps on badly scaled
+     * matrices. If opts.scale is true, T is the Schur form of the scaled
+     * matrix $D^{-1} A D$ and Z = D Q, where Q contains its Schur vectors.
+     * So $A Z = Z T$ still holds, but Z is no longer unitary.
+     *
+     * @return  0 if success
+     * @return  i if the QR algorithm failed to compute all the eigenvalues.
+     *            Elements i:n of w contain those eigenvalues which have been
+     *            successfully computed.
+     *
+     * @param[in] want_t bool.
+     *      If true, the Schur form T is computed.
+     * @param[in] want_z bool.
+     *      If true, the Schur vectors Z are computed. Requires want_t.
+     * @param[in,out] A n-by-n matrix.
+     *      On exit, if want_t is true, the Schur form T. Otherwise, A is
+     *      destroyed.
+     * @param[out] w Complex vector of length n.
+     *      The eigenvalues of A, in the same order as they appear on the
+     *      diagonal of T.
+     * @param[out] Z n-by-n matrix.
+     *      If want_z is true, the Schur vectors of A. Otherwise, Z is not
+     *      referenced.
+     *
+     * @param[in,out] opts Struct containing the options
+     *      See gees_opts_t for more details
+     *
+     * @ingroup gees
+     */
+    template <class matrix_t, class vector_t, typename idx_t = size_type<matrix_t>, typename TA = type_t<matrix_t>>
+    int gees(bool want_t, bool want_z, matrix_t &A, vector_t &w, matrix_t &Z, gees_opts_t<idx_t, TA> &opts)
+    {
+        using real_t = real_type<TA>;
+
+        // constants
+        const TA zero(0);
+        const idx_t n = ncols(A);
+
+        TLAPACK_PROFILE_SCOPE( "gees", TA, 0, double(n)*n*((want_z) ? 2 : 1) );
+
+        // check arguments
+        tlapack_check_false(want_z && !want_t, -2);
+        tlapack_check_false(access_denied(dense, write_policy(A)), -3);
+        tlapack_check_false(ncols(A) != nrows(A), -3);
+        tlapack_check_false((idx_t)size(w) < n, -4);
+        tlapack_check_false(want_z && (ncols(Z) != n || nrows(Z) != n), -5);
+
+        // quick return
+        if (n <= 0)
+            return 0;
+
+        // Get the workspaces
+        const auto required_workspace = get_work_gees(want_t, want_z, A, w, Z, opts);
+        // Use the provided workspaces if they are large enough, otherwise
+        // borrow them from the arena
+        local_workspace<TA> workspace( opts._work, opts.lwork, required_workspace.first, opts.arena );
+        local_workspace<real_t> rworkspace( opts._rwork, opts.lrwork, required_workspace.second, opts.arena );
+        TA* _work = workspace.data();
+        real_t* _rwork = rworkspace.data();
+        const idx_t lwork = workspace.size();
+
+        auto tau = legacyVector<TA>( n, &_work[0] );
+        auto scale = legacyVector<real_t>( n, &_rwork[0] );
+
+        // Balance the matrix
+        idx_t ilo, ihi;
+        gebal(opts.permute, opts.scale, A, ilo, ihi, scale);
+
+        // Reduce the active block to Hessenberg form
+        gehrd_opts_t<idx_t, TA> gehrd_opts;
+        gehrd_opts.nb = opts.nb;
+        gehrd_opts.nx_switch = opts.nx_switch;
+        gehrd_opts.parallel = opts.parallel;
+        gehrd_opts._work = &_work[n];
+        gehrd_opts.lwork = lwork - n;
+        gehrd_opts.arena = opts.arena;
+        if (ihi > ilo + 1)
+            gehrd(ilo, ihi, A, tau, gehrd_opts);
+
+        // Generate the unitary matrix of the reduction
+        if (want_z)
+        {
+            lacpy(dense, A, Z);
+            auto work = legacyVector<TA>( n, &_work[n] );
+            unghr(ilo, ihi, Z, tau, work);
+        }
+
+        // Remove the reflectors from A
+        for (idx_t j = 0; j + 2 < n; ++j)
+            for (idx_t i = j + 2; i < n; ++i)
+                A(i, j) = zero;
+
+        // The eigenvalues isolated by gebal
+        for (idx_t i = 0; i < ilo; ++i)
+            w[i] = A(i, i);
+        for (idx_t i = ihi; i < n; ++i)
+            w[i] = A(i, i);
+
+        // Schur form of the active block
+        opts.francis.n_aed = 0;
+        opts.francis.n_sweep = 0;
+        opts.francis.n_shifts_total = 0;
+        int info = 0;
+        if (ihi > ilo)
+        {
+            // Unless the QR algorithm has its own arena, it borrows its
+            // workspace from the arena of gees
+            workspace_arena* francis_arena = opts.francis.arena;
+            if (!francis_arena)
+                opts.francis.arena = opts.arena;
+            info = multishift_qr(want_t, want_z, ilo, ihi, A, w, Z, opts.francis);
+            opts.francis.arena = francis_arena;
+        }
+
+        // Clean the lower triangular part that was used as workspace
+        if (want_t)
+            for (idx_t j = 0; j + 2 < n; ++j)
+                for (idx_t i = j + 2; i < n; ++i)
+                    A(i, j) = zero;
+
+        // Back-transform the Schur vectors
+        if (want_z)
+            gebak(opts.permute, opts.scale, Side::Right, ilo, ihi, scale, Z);
+
+        return info;
+    }
+
+    /** Computes the eigenvalues and, optionally, the Schur form and the Schur
+     * vectors of a general n-by-n matrix A using the default options.
+     *
+     * @see gees( bool want_t, bool want_z, matrix_t &A, vector_t &w, matrix_t &Z, gees_opts_t<idx_t, TA> &opts )
+     *
+     * @ingroup gees
+     */
+    template <class matrix_t, class vector_t>
+    int gees(bool want_t, bool want_z, matrix_t &A, vector_t &w, matrix_t &Z)
+    {
+        gees_opts_t<size_type<matrix_t>, type_t<matrix_t>> opts = {};
+        return gees(want_t, want_z, A, w, Z, opts);
+    }
+
+} // lapack
+
+#endif // __TLAPACK_GEES_HH__
@@ -12,6 +12,7 @@
 #include <iostream>
 
 #include "base/utils.hpp"
+#include "base/profile.hpp"
 #include "base/types.hpp"
 #include "lapack/larfg.hpp"
 #include "lapack/larf.hpp"
@@ -65,6 +66,8 @@ int gehd2( size_type< matrix_t > ilo, size_type< matrix_t > ihi, matrix_t& A, ve
     // constants
     const idx_t n = ncols(A);
 
+    TLAPACK_PROFILE_SCOPE( "gehd2", type_t<matrix_t>, (10.0/3.0)*(ihi-ilo)*(ihi-ilo)*(ihi-ilo), double(n)*n );
+
     // check arguments
     tlapack_check_false( access_denied( dense, write_policy(A) ), -3 );
     tlapack_check_false( ncols(A) != nrows(A), -3 );
@@ -11,7 +11,11 @@
 
 #include "legacy_api/base/utils.hpp"
 #include "base/utils.hpp"
+#include "base/profile.hpp"
+#include "base/tuning.hpp"
 #include "base/types.hpp"
+#include "base/parallel.hpp"
+#include "base/workspace.hpp"
 #include "lapack/lahr2.hpp"
 
 #include <memory>
@@ -25,13 +29,22 @@ namespace tlapack
     template <typename idx_t, typename T>
     struct gehrd_opts_t {
         // Blocksize used in the blocked reduction
-        idx_t nb = 32;
+        tunable<idx_t> nb = {tuning_default, 32};
         // If only nx_switch columns are left, the algorithm will use unblocked code
-        idx_t nx_switch = 128;
+        tunable<idx_t> nx_switch = {tuning_default, 128};
+        // If true, the two-sided updates of each block are split across OpenMP
+        // threads, the trailing gemv of the panel is row-parallel, and the part
+        // of the left update outside the active block A(i+1:ihi,ihi:n) is
+        // overlapped with the next panel (lookahead).
+        // Has no effect if <T>LAPACK is not compiled with OpenMP.
+        bool parallel = false;
         // Workspace pointer, if no workspace is provided, one will be allocated internally
         T* _work=nullptr;
         // Workspace size
-        idx_t lwork;
+        idx_t lwork = 0;
+        // Arena used if no workspace is provided. If nullptr, the default
+        // arena of the calling thread is used.
+        workspace_arena* arena = nullptr;
     };
 
     /**
@@ -44,9 +57,30 @@ namespace tlapack
     idx_t get_work_gehrd(size_type<matrix_t> ilo, size_type<matrix_t> ihi, matrix_t &A, vector_t &tau, const gehrd_opts_t<idx_t, TA> &opts = {})
     {
         const idx_t n = ncols(A);
-        idx_t nb = opts.nb;
+        idx_t nb = tuned<TA>(opts.nb, "gehrd", "nb", n);
 
-        return (n+nb)*nb;
+        // The lookahead needs a copy of T and a workspace for the deferred
+        // left update
+        return (opts.parallel) ? 2*(n+nb)*nb : (n+nb)*nb;
+    }
+
+    /**
+     * Returns the number of bytes gehrd borrows from the workspace arena.
+     * The arguments are the same as for gehrd itself.
+     *
+     * @return 0 if opts provides a workspace of at least get_work_gehrd()
+     *      elements, the size of the borrowed workspace otherwise.
+     */
+    template <class matrix_t, class vector_t, typename idx_t = size_type<matrix_t>, typename TA = type_t<matrix_t>>
+    std::size_t get_worksize_gehrd(size_type<matrix_t> ilo, size_type<matrix_t> ihi, matrix_t &A, vector_t &tau, const gehrd_opts_t<idx_t, TA> &opts = {})
+    {
+        if (ncols(A) <= 0)
+            return 0;
+
+        const idx_t required_workspace = get_work_gehrd(ilo, ihi, A, tau, opts);
+        return (opts._work && required_workspace <= opts.lwork)
+            ? 0
+            : workspace_arena::push_size<TA>(required_workspace);
     }
 
     /** Reduces a general square matrix to upper Hessenberg form
@@ -98,10 +132,12 @@ namespace tlapack
         const TA one(1);
         const idx_t n = ncols(A);
 
+        TLAPACK_PROFILE_SCOPE( "gehrd", TA, (10.0/3.0)*(ihi-ilo)*(ihi-ilo)*(ihi-ilo), double(n)*n );
+
         // Blocksize
-        idx_t nb = opts.nb;
+        idx_t nb = tuned<TA>(opts.nb, "gehrd", "nb", n);
         // Size of the last block which be handled with unblocked code
-        idx_t nx_switch = opts.nx_switch;
+        idx_t nx_switch = tuned<TA>(opts.nx_switch, "gehrd", "nx_switch", n);
         idx_t nx = std::max( nb, nx_switch );
 
         // check arguments
@@ -116,36 +152,35 @@ namespace tlapack
             return 0;
 
         // Get the workspace
-        TA* _work;
-        idx_t lwork;
         idx_t required_workspace = get_work_gehrd(ilo, ihi, A, tau, opts);
-        // Store whether or not a workspace was locally allocated
-        bool locally_allocated = false;
-        if( opts._work and required_workspace <= opts.lwork ){
-            // Provided workspace is large enough, use it
-            _work = opts._work;
-            lwork = opts.lwork;
-        } else {
-            // No workspace provided or not large enough, allocate it
-            locally_allocated = true;
-            lwork = required_workspace;
-            _work = new TA[lwork];
-        }
+        // Use the provided workspace if it is large enough, otherwise borrow
+        // it from the arena
+        local_workspace<TA> workspace( opts._work, opts.lwork, required_workspace, opts.arena );
+        TA* _work = workspace.data();
 
         auto Y = legacyMatrix<TA, layout<matrix_t>>( n, nb, &_work[0], layout<matrix_t> == Layout::ColMajor ? n : nb );
         auto T = legacyMatrix<TA, layout<matrix_t>>( nb, nb, &_work[n*nb], nb );
 
+        // Workspace used by the lookahead. T_la holds a copy of T while the
+        // deferred update of A(i+1:ihi,ihi:n) is running.
+        const bool parallel = opts.parallel;
+        TA* _work_la = (parallel) ? &_work[(n+nb)*nb] : nullptr;
+
         idx_t i = ilo;
+        TLAPACK_OMP(parallel if(parallel))
+        TLAPACK_OMP(single)
+        {
         for (; i+nx < ihi-1; i = i + nb)
         {
             auto nb2 = std::min(nb, ihi - i - 1);
+            TLAPACK_TRACE_SCOPE( "gehrd.panel", trace_arg("i", i), trace_arg("nb", nb2), trace_arg("m", ihi - i) );
 
             auto V = slice(A, pair{i + 1, ihi}, pair{i, i + nb2});
             auto A2 = slice(A, pair{0, ihi}, pair{i, ihi});
             auto tau2 = slice(tau, pair{i, ihi});
             auto T_s = slice(T, pair{0, nb2}, pair{0, nb2});
             auto Y_s = slice(Y, pair{0, n}, pair{0, nb2});
-            lahr2(i, nb2, A2, tau2, T_s, Y_s);
+            lahr2(i, nb2, A2, tau2, T_s, Y_s, parallel);
             if( i + nb2 < ihi ){
                 // Note, this V2 contains the last row of the triangular part
                 auto V2 = slice(V, pair{nb2-1, ihi-i-1}, pair{0, nb2});
@@ -156,7 +191,24 @@ namespace tlapack
                 V(nb2-1, nb2-1) = one;
                 auto A3 = slice(A, pair{0, ihi}, pair{i + nb2, ihi});
                 auto Y_2 = slice(Y, pair{0, ihi}, pair{0, nb2});
-                gemm(Op::NoTrans, Op::ConjTrans, -one, Y_2, V2, one, A3);
+                if( parallel ) {
+                    // Rows of A3 are independent
+                    const idx_t nblocks = std::max<idx_t>(1, std::min<idx_t>(get_num_threads(), ihi / nb));
+                    const idx_t rb = (ihi + nblocks - 1) / nblocks;
+                    TLAPACK_OMP(taskloop grainsize(1) if(nblocks > 1))
+                    for (idx_t ib = 0; ib < nblocks; ++ib)
+                    {
+                        const idx_t r0 = std::min(ib * rb, ihi);
+                        const idx_t r1 = std::min(r0 + rb, ihi);
+                        if( r0 < r1 ) {
+                            auto A3_r = slice(A3, pair{r0, r1}, pair{0, ncols(A3)});
+                            auto Y_r = slice(Y_2, pair{r0, r1}, pair{0, nb2});
+                            gemm(Op::NoTrans, Op::ConjTrans, -one, Y_r, V2, one, A3_r);
+                        }
+                    }
+                }
+                else
+                    gemm(Op::NoTrans, Op::ConjTrans, -one, Y_2, V2, one, A3);
                 V(nb2-1, nb2-1) = ei;
             }
             // Apply the block reflector H to A(0:i+1,i+1:i+ib) from the right
@@ -169,16 +221,55 @@ namespace tlapack
             }
 
             // Apply the block reflector H to A(i+1:ihi,i+nb:n) from the left
-            auto A5 = slice(A, pair{i + 1, ihi}, pair{i + nb2, n});
-            auto Y_left = legacyMatrix<TA, layout<matrix_t>>( nb2, n - i - nb2, &_work[0], layout<matrix_t> == Layout::ColMajor ? nb2 : n - i - nb2 );
-            larfb(Side::Left, Op::ConjTrans, Direction::Forward, StoreV::Columnwise, V, T_s, A5, Y_left);
+            if( parallel ) {
+
+                // The next panel only reads the columns of the active block.
+                // The update of A(i+1:ihi,ihi:n) can be deferred and run
+                // concurrently with the next panel. We wait for the previous
+                // deferred update because it uses the same workspace and
+                // the same columns of A.
+                TLAPACK_OMP(taskwait)
+
+                // Columns A(i+1:ihi,i+nb:ihi) are independent
+                const idx_t nc = ihi - i - nb2;
+                const idx_t nblocks = std::max<idx_t>(1, std::min<idx_t>(get_num_threads(), nc / nb));
+                const idx_t cb = (nc + nblocks - 1) / nblocks;
+                TLAPACK_OMP(taskloop grainsize(1) if(nblocks > 1))
+                for (idx_t ib = 0; ib < nblocks; ++ib)
+                {
+                    const idx_t c0 = std::min(ib * cb, nc);
+                    const idx_t c1 = std::min(c0 + cb, nc);
+                    if( c0 < c1 ) {
+                        auto A5 = slice(A, pair{i + 1, ihi}, pair{i + nb2 + c0, i + nb2 + c1});
+                        auto Y_left = legacyMatrix<TA, layout<matrix_t>>( nb2, c1 - c0, &_work[nb2 * c0], layout<matrix_t> == Layout::ColMajor ? nb2 : c1 - c0 );
+                        larfb(Side::Left, Op::ConjTrans, Direction::Forward, StoreV::Columnwise, V, T_s, A5, Y_left);
+                    }
+                }
+
+                if( ihi < n ) {
+                    auto T_la = legacyMatrix<TA, layout<matrix_t>>( nb2, nb2, &_work_la[0], nb2 );
+                    lacpy(Uplo::Upper, T_s, T_la);
+                    TLAPACK_OMP(task firstprivate(i, nb2, V, T_la))
+                    {
+                        auto A5 = slice(A, pair{i + 1, ihi}, pair{ihi, n});
+                        auto Y_left = legacyMatrix<TA, layout<matrix_t>>( nb2, n - ihi, &_work_la[nb*nb], layout<matrix_t> == Layout::ColMajor ? nb2 : n - ihi );
+                        larfb(Side::Left, Op::ConjTrans, Direction::Forward, StoreV::Columnwise, V, T_la, A5, Y_left);
+                    }
+                }
+            }
+            else {
+                auto A5 = slice(A, pair{i + 1, ihi}, pair{i + nb2, n});
+                auto Y_left = legacyMatrix<TA, layout<matrix_t>>( nb2, n - i - nb2, &_work[0], layout<matrix_t> == Layout::ColMajor ? nb2 : n - i - nb2 );
+                larfb(Side::Left, Op::ConjTrans, Direction::Forward, StoreV::Columnwise, V, T_s, A5, Y_left);
+            }
+        }
+        // Wait for the last deferred update
+        TLAPACK_OMP(taskwait)
         }
 
         auto workspace_vector = col( Y, 0 );
         gehd2( i, ihi, A, tau, workspace_vector );
 
-        if(locally_allocated)
-            delete [] _work;
         return 0;
     }
 
@@ -0,0 +1,100 @@
+/// @file gelq2.hpp
+/// Adapted from @see https://github.com/Reference-LAPACK/lapack/tree/master/SRC/zgelq2.f
+//
+// Copyright (c) 2022, University of Colorado Denver. All rights reserved.
+//
+// This file is part of <T>LAPACK.
+// <T>LAPACK is free software: you can redistribute it and/or modify it under
+// the terms of the BSD 3-Clause license. See the accompanying LICENSE file.
+
+#ifndef __TLAPACK_GELQ2_HH__
+#define __TLAPACK_GELQ2_HH__
+
+#include "base/utils.hpp"
+#include "base/profile.hpp"
+#include "base/types.hpp"
+#include "lapack/larfg.hpp"
+#include "lapack/larf.hpp"
+
+namespace tlapack {
+
+/** Computes an LQ factorization of a matrix A.
+ *
+ * The matrix Q is represented as a product of elementary reflectors
+ * \[
+ *          Q = H_{k-1}^H ... H_1^H H_0^H,
+ * \]
+ * where k = min(m,n). Each H_i has the form
+ * \[
+ *          H_i = I - tau * v * v',
+ * \]
+ * where tau is a scalar, and v is a vector with
+ * \[
+ *          v[0] = v[1] = ... = v[i-1] = 0; v[i] = 1,
+ * \]
+ * with conj(v[i+1]) through conj(v[n-1]) stored on exit to the right of
+ * the diagonal in the ith row of A, and tau in tau[i].
+ *
+ * @return  0 if success
+ *
+ * @param[in,out] A m-by-n matrix.
+ *      On exit, the elements on and below the diagonal of the array
+ *      contain the m-by-min(m,n) lower trapezoidal matrix L
+ *      (L is lower triangular if m <= n); the elements to the right of the
+ *      diagonal, with the array tau, represent the unitary matrix Q as a
+ *      product of elementary reflectors.
+ * @param[out] tau Vector of length min(m,n).
+ *      The scalar factors of the elementary reflectors.
+ *
+ * @param work Vector of size m-1.
+ *
+ * @ingroup gelqf
+ */
+template< class matrix_t, class vector_t, class work_t >
+int gelq2( matrix_t& A, vector_t &tau, work_t &work )
+{
+    using idx_t = size_type< matrix_t >;
+    using pair  = pair<idx_t,idx_t>;
+
+    // constants
+    const idx_t m = nrows(A);
+    const idx_t n = ncols(A);
+    const idx_t k = std::min<idx_t>( m, n );
+
+    TLAPACK_PROFILE_SCOPE( "gelq2", type_t<matrix_t>, (n >= m) ? 2.0*m*m*(n - m/3.0) : 2.0*n*n*(m - n/3.0), double(m)*n );
+
+    // check arguments
+    tlapack_check_false( access_denied( dense, write_policy(A) ), -1 );
+    tlapack_check_false( (idx_t) size(tau)  < k, -2 );
+    tlapack_check_false( (idx_t) size(work) < m-1, -3 );
+
+    // quick return
+    if (m <= 0) return 0;
+
+    for(idx_t i = 0; i < k; ++i) {
+
+        // Define w := conj(A[i,i:n])
+        auto w = slice( A, i, pair{i,n} );
+        for( idx_t j = 0; j < n-i; ++j )
+            w[j] = conj( w[j] );
+
+        // Generate the (i+1)-th elementary Householder reflection on w
+        larfg( w, tau[i] );
+
+        // C := C (I - tau_i w w^H), where C := A[i+1:m,i:n]
+        if( i+1 < m ) {
+            auto C = slice( A, pair{i+1,m}, pair{i,n} );
+            auto wk = slice( work, pair{0,m-i-1} );
+            larf( right_side, w, tau[i], C, wk );
+        }
+
+        for( idx_t j = 0; j < n-i; ++j )
+            w[j] = conj( w[j] );
+    }
+
+    return 0;
+}
+
+} // lapack
+
+#endif // __TLAPACK_GELQ2_HH__
@@ -12,12 +12,38 @@
 #define __TLAPACK_GEQR2_HH__
 
 #include "base/utils.hpp"
+#include "base/profile.hpp"
 #include "base/types.hpp"
 #include "lapack/larfg.hpp"
 #include "lapack/larf.hpp"
 
 namespace tlapack {
 
+/**
+ * Returns the size of the workspace vector of geqr2.
+ * The arguments are the same as for geqr2 itself.
+ * 
+ * @return idx_t The size of the required workspace
+ */
+template< class matrix_t, class vector_t >
+inline size_type< matrix_t >
+get_work_geqr2( const matrix_t& A, const vector_t &tau )
+{
+    using idx_t = size_type< matrix_t >;
+    return std::max<idx_t>( 0, ncols(A)-1 );
+}
+
+/**
+ * Returns the size in bytes of the workspace vector of geqr2.
+ * The arguments are the same as for geqr2 itself.
+ */
+template< class matrix_t, class vector_t >
+inline std::size_t
+get_worksize_geqr2( const matrix_t& A, const vector_t &tau )
+{
+    return get_work_geqr2( A, tau ) * sizeof( type_t< matrix_t > );
+}
+
 /** Computes a QR factorization of a matrix A.
  * 
  * The matrix Q is represented as a product of elementary reflectors
@@ -65,6 +91,8 @@ int geqr2( matrix_t& A, vector_t &tau, work_t &work )
     const idx_t n = ncols(A);
     const idx_t k = std::min<idx_t>( m, n-1 );
 
+    TLAPACK_PROFILE_SCOPE( "geqr2", type_t<matrix_t>, (m >= n) ? 2.0*n*n*(m - n/3.0) : 2.0*m*m*(n - m/3.0), double(m)*n );
+
     // check arguments
     tlapack_check_false( access_denied( dense, write_policy(A) ), -1 );
     tlapack_check_false( (idx_t) size(tau)  < std::min<idx_t>( m, n ), -2 );
@@ -0,0 +1,58 @@
+/// @file gesdd.hpp
+/// Adapted from @see https://github.com/Reference-LAPACK/lapack/tree/master/SRC/zgesdd.f
+//
+// Copyright (c) 2022, University of Colorado Denver. All rights reserved.
+//
+// This file is part of <T>LAPACK.
+// <T>LAPACK is free software: you can redistribute it and/or modify it under
+// the terms of the BSD 3-Clause license. See the accompanying LICENSE file.
+
+#ifndef __TLAPACK_GESDD_HH__
+#define __TLAPACK_GESDD_HH__
+
+#include "lapack/gesvd.hpp"
+
+namespace tlapack
+{
+
+    /**
+     * Returns the required workspaces for gesdd.
+     * The arguments are the same as for gesdd itself.
+     *
+     * @return std::pair<idx_t,idx_t> The sizes of the required workspace
+     *      and of the required real workspace
+     */
+    template <class matrix_t, class vector_t, class matrixU_t, class matrixVT_t, typename idx_t = size_type<matrix_t>, typename TA = type_t<matrix_t>>
+    std::pair<idx_t,idx_t> get_work_gesdd(bool want_u, bool want_vt, matrix_t &A, vector_t &s, matrixU_t &U, matrixVT_t &VT, const gesvd_opts_t<idx_t, TA> &opts = {})
+    {
+        gesvd_opts_t<idx_t, TA> opts2 = opts;
+        opts2.divide_and_conquer = true;
+        return get_work_gesvd(want_u, want_vt, A, s, U, VT, opts2);
+    }
+
+    /** Computes the singular value decomposition of a general m-by-n matrix
+     * A using the divide and conquer method: $A = U S V^H$.
+     *
+     * Same as gesvd with opts.divide_and_conquer = true. See gesvd for the
+     * description of the arguments.
+     *
+     * If want_u and want_vt are false, only the singular values are computed,
+     * and neither the singular vectors of the bidiagonal matrix nor the
+     * unitary matrices of the reduction are ever formed.
+     *
+     * @return  0 if success
+     * @return  > 0 if the bidiagonal SVD failed to converge.
+     *
+     * @ingroup gesvd
+     */
+    template <class matrix_t, class vector_t, class matrixU_t, class matrixVT_t, typename idx_t = size_type<matrix_t>, typename TA = type_t<matrix_t>>
+    int gesdd(bool want_u, bool want_vt, matrix_t &A, vector_t &s, matrixU_t &U, matrixVT_t &VT, const gesvd_opts_t<idx_t, TA> &opts = {})
+    {
+        gesvd_opts_t<idx_t, TA> opts2 = opts;
+        opts2.divide_and_conquer = true;
+        return gesvd(want_u, want_vt, A, s, U, VT, opts2);
+    }
+
+} // lapack
+
+#endif // __TLAPACK_GESDD_HH__
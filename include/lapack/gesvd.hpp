@@ -0,0 +1,386 @@
+/// @file gesvd.hpp
+/// Adapted from @see https://github.com/Reference-LAPACK/lapack/tree/master/SRC/zgesvd.f
+//
+// Copyright (c) 2022, University of Colorado Denver. All rights reserved.
+//
+// This file is part of <T>LAPACK.
+// <T>LAPACK is free software: you can redistribute it and/or modify it under
+// the terms of the BSD 3-Clause license. See the accompanying LICENSE file.
+
+#ifndef __TLAPACK_GESVD_HH__
+#define __TLAPACK_GESVD_HH__
+
+#include "legacy_api/base/utils.hpp"
+#include "base/utils.hpp"
+#include "base/profile.hpp"
+#include "base/types.hpp"
+#include "base/workspace.hpp"
+#include "lapack/laset.hpp"
+#include "lapack/gebrd.hpp"
+#include "lapack/ge2gb.hpp"
+#include "lapack/gbbrd.hpp"
+#include "lapack/bdsqr.hpp"
+#include "lapack/bdsdc.hpp"
+#include "lapack/unmqr.hpp"
+#include "lapack/unmlq.hpp"
+#include "blas/gemm.hpp"
+
+namespace tlapack
+{
+
+    /**
+     * Options struct for gesvd and gesdd
+     */
+    template <typename idx_t, typename T>
+    struct gesvd_opts_t {
+        // Blocksize used in gebrd and in the back-transformations, and
+        // bandwidth of the intermediate band matrix in the two-stage reduction
+        idx_t nb = 32;
+        // If only nx_switch columns are left, gebrd will use unblocked code
+        idx_t nx_switch = 128;
+        // If true, A is reduced to upper band form by ge2gb and then to
+        // bidiagonal form by gbbrd, instead of being reduced directly by gebrd
+        bool two_stage = false;
+        // If true, the singular vectors of the bidiagonal matrix are computed
+        // by bdsdc instead of bdsqr
+        bool divide_and_conquer = false;
+        // Subproblems of size at most smlsiz are solved by steqr in bdsdc
+        idx_t smlsiz = 25;
+        // If true, bdsdc solves independent subproblems in parallel.
+        // Has no effect if <T>LAPACK is not compiled with OpenMP.
+        bool parallel = false;
+        // Workspace pointer, if no workspace is provided, one will be allocated internally
+        T* _work=nullptr;
+        // Workspace size
+        idx_t lwork = 0;
+        // Real workspace pointer, if no workspace is provided, one will be allocated internally
+        real_type<T>* _rwork=nullptr;
+        // Real workspace size
+        idx_t lrwork = 0;
+        // Arena used if no workspace is provided. If nullptr, the default
+        // arena of the calling thread is used.
+        workspace_arena* arena = nullptr;
+    };
+
+    /**
+     * Returns the required workspaces for gesvd.
+     * The arguments are the same as for gesvd itself.
+     *
+     * @return std::pair<idx_t,idx_t> The sizes of the required workspace
+     *      and of the required real workspace
+     */
+    template <class matrix_t, class vector_t, class matrixU_t, class matrixVT_t, typename idx_t = size_type<matrix_t>, typename TA = type_t<matrix_t>>
+    std::pair<idx_t,idx_t> get_work_gesvd(bool want_u, bool want_vt, matrix_t &A, vector_t &s, matrixU_t &U, matrixVT_t &VT, const gesvd_opts_t<idx_t, TA> &opts = {})
+    {
+        // The SVD of A^H is computed if A has more columns than rows
+        const bool transposed = nrows(A) < ncols(A);
+        const idx_t m = (transposed) ? ncols(A) : nrows(A);
+        const idx_t n = (transposed) ? nrows(A) : ncols(A);
+        const idx_t nb = opts.nb;
+        const bool want_vectors = want_u || want_vt;
+        const bool two_stage = opts.two_stage && nb > 1 && n > nb + 1;
+
+        // tauq and taup
+        idx_t lwork = 2*n;
+        // The band matrix and the left and right transformations of gbbrd
+        if (two_stage)
+            lwork += (nb + 3)*n + ((want_u) ? n*n : 0) + ((want_vt) ? n*n : 0);
+        // Complex copy of the singular vectors of the bidiagonal matrix
+        if (want_vectors)
+            lwork += n*n;
+        // Workspace of the reduction or of the back-transformations
+        lwork += std::max<idx_t>(
+            (two_stage) ? nb*nb + m*nb : std::max<idx_t>( (m + n)*nb + 2*nb, m ),
+            (want_vectors) ? (n + nb)*nb : 0 );
+        // A^H and its singular vectors
+        if (transposed)
+            lwork += m*n + ((want_vt) ? m*n : 0) + ((want_u) ? n*n : 0);
+
+        // The bidiagonal matrix, its singular vectors and the workspace of
+        // bdsdc
+        idx_t lrwork = 2*n;
+        if (want_vectors)
+        {
+            lrwork += 2*n*n;
+            if (opts.divide_and_conquer && n > 1)
+                lrwork += 4*n + 4*n*n + (8*n*n + 10*n) + 2*n;
+        }
+
+        return std::pair<idx_t,idx_t>( lwork, lrwork );
+    }
+
+    /** Computes the singular value decomposition of a general m-by-n matrix
+     * A: $A = U S V^H$.
+     *
+     * A is reduced to real upper bidiagonal form B, either directly by gebrd
+     * or, if opts.two_stage is true, first to band form by ge2gb and then to
+     * bidiagonal form by gbbrd. The SVD of B is computed by the implicit QR
+     * method in bdsqr, or by the divide and conquer method in bdsdc if
+     * opts.divide_and_conquer is true, and the singular vectors are
+     * transformed back by unmqr and unmlq. If m < n, the SVD of $A^H$ is
+     * computed instead.
+     *
+     * If want_u and want_vt are false, only the singular values are computed.
+     * In this case, neither the singular vectors of B nor the unitary
+     * matrices of the reduction are ever formed.
+     *
+     * @return  0 if success
+     * @return  > 0 if the bidiagonal SVD failed to converge.
+     *
+     * @param[in] want_u bool.
+     *      If true, the first min(m,n) left singular vectors are computed.
+     * @param[in] want_vt bool.
+     *      If true, the first min(m,n) right singular vectors are computed.
+     * @param[in,out] A m-by-n matrix.
+     *      On exit, A is destroyed.
+     * @param[out] s Real vector of length min(m,n).
+     *      The singular values of A in decreasing order.
+     * @param[out] U m-by-min(m,n) matrix.
+     *      If want_u is true, the left singular vectors of A.
+     *      Otherwise, U is not referenced.
+     * @param[out] VT min(m,n)-by-n matrix.
+     *      If want_vt is true, the conjugate transposed right singular
+     *      vectors of A. Otherwise, VT is not referenced.
+     *
+     * @param[in,out] opts Struct containing the options
+     *      See gesvd_opts_t for more details
+     *
+     * @ingroup gesvd
+     */
+    template <class matrix_t, class vector_t, class matrixU_t, class matrixVT_t, typename idx_t = size_type<matrix_t>, typename TA = type_t<matrix_t>>
+    int gesvd(bool want_u, bool want_vt, matrix_t &A, vector_t &s, matrixU_t &U, matrixVT_t &VT, const gesvd_opts_t<idx_t, TA> &opts = {})
+    {
+        using real_t = real_type<TA>;
+        using pair = pair<idx_t, idx_t>;
+
+        // constants
+        const TA one(1);
+        const TA zero(0);
+        const real_t rzero(0);
+        const real_t rone(1);
+        const idx_t m = nrows(A);
+        const idx_t n = ncols(A);
+        const idx_t k = std::min(m, n);
+        const idx_t nb = opts.nb;
+        const bool want_vectors = want_u || want_vt;
+        constexpr Layout L = layout<matrix_t>;
+
+        TLAPACK_PROFILE_SCOPE( "gesvd", TA, 0, double(m)*n + ((want_u) ? double(m)*k : 0) + ((want_vt) ? double(k)*n : 0) );
+
+        // check arguments
+        tlapack_check_false(access_denied(dense, write_policy(A)), -3);
+        tlapack_check_false((idx_t)size(s) < k, -4);
+        tlapack_check_false(want_u && (nrows(U) != m || ncols(U) != k), -5);
+        tlapack_check_false(want_vt && (nrows(VT) != k || ncols(VT) != n), -6);
+
+        // quick return
+        if (k <= 0)
+            return 0;
+
+        // Get the workspaces
+        const auto required_workspace = get_work_gesvd(want_u, want_vt, A, s, U, VT, opts);
+        // Use the provided workspaces if they are large enough, otherwise
+        // borrow them from the arena
+        local_workspace<TA> workspace( opts._work, opts.lwork, required_workspace.first, opts.arena );
+        local_workspace<real_t> rworkspace( opts._rwork, opts.lrwork, required_workspace.second, opts.arena );
+        TA* _work = workspace.data();
+        real_t* _rwork = rworkspace.data();
+        const idx_t lwork = workspace.size();
+        const idx_t lrwork = rworkspace.size();
+
+        int info = 0;
+        if (m < n)
+        {
+            // Compute the SVD of A^H = V S U^H
+            auto AH = legacyMatrix<TA, L>( n, m, &_work[0], L == Layout::ColMajor ? n : m );
+            for (idx_t j = 0; j < n; ++j)
+                for (idx_t i = 0; i < m; ++i)
+                    AH(j, i) = conj(A(i, j));
+            idx_t off = n*m;
+            auto V = legacyMatrix<TA, L>( (want_vt) ? n : 0, (want_vt) ? m : 0, &_work[off], L == Layout::ColMajor ? n : m );
+            if (want_vt)
+                off += n*m;
+            auto UH = legacyMatrix<TA, L>( (want_u) ? m : 0, (want_u) ? m : 0, &_work[off], m );
+            if (want_u)
+                off += m*m;
+
+            gesvd_opts_t<idx_t, TA> opts2 = opts;
+            opts2._work = &_work[off];
+            opts2.lwork = lwork - off;
+            opts2._rwork = _rwork;
+            opts2.lrwork = lrwork;
+            info = gesvd(want_vt, want_u, AH, s, V, UH, opts2);
+
+            if (want_u)
+                for (idx_t j = 0; j < m; ++j)
+                    for (idx_t i = 0; i < m; ++i)
+                        U(i, j) = conj(UH(j, i));
+            if (want_vt)
+                for (idx_t j = 0; j < n; ++j)
+                    for (idx_t i = 0; i < m; ++i)
+                        VT(i, j) = conj(V(j, i));
+        }
+        else
+        {
+            const bool two_stage = opts.two_stage && nb > 1 && n > nb + 1;
+            const idx_t kd = (two_stage) ? nb : 1;
+
+            // Distribute the workspaces
+            auto tauq = legacyVector<TA>( n, &_work[0] );
+            auto taup = legacyVector<TA>( n, &_work[n] );
+            idx_t off = 2*n;
+            TA* _band = &_work[off];
+            if (two_stage)
+                off += (nb + 3)*n;
+            auto U2 = legacyMatrix<TA, L>( n, n, &_work[off], n );
+            if (two_stage && want_u)
+                off += n*n;
+            auto V2 = legacyMatrix<TA, L>( n, n, &_work[off], n );
+            if (two_stage && want_vt)
+                off += n*n;
+            auto W = legacyMatrix<TA, L>( n, n, &_work[off], n );
+            if (want_vectors)
+                off += n*n;
+            TA* _work2 = &_work[off];
+            const idx_t lwork2 = lwork - off;
+
+            auto d = legacyVector<real_t>( n, &_rwork[0] );
+            auto e = legacyVector<real_t>( n - 1, &_rwork[n] );
+            auto UB = legacyMatrix<real_t, L>( (want_vectors) ? n : 0, (want_vectors) ? n : 0, &_rwork[2*n], n );
+            auto VTB = legacyMatrix<real_t, L>( (want_vectors) ? n : 0, (want_vectors) ? n : 0, &_rwork[2*n + ((want_vectors) ? n*n : 0)], n );
+            real_t* _rwork2 = &_rwork[2*n + ((want_vectors) ? 2*n*n : 0)];
+            const idx_t lrwork2 = lrwork - 2*n - ((want_vectors) ? 2*n*n : 0);
+
+            // Reduce A to bidiagonal form
+            if (two_stage)
+            {
+                ge2gb_opts_t<idx_t, TA> ge2gb_opts;
+                ge2gb_opts.nb = nb;
+                ge2gb_opts._work = _work2;
+                ge2gb_opts.lwork = lwork2;
+                ge2gb_opts.arena = opts.arena;
+                ge2gb(A, tauq, taup, ge2gb_opts);
+
+                // Copy the band to a band matrix with room for the bulges
+                auto B = legacyBandedMatrix<TA>( n, n, 1, kd + 1, _band );
+                for (idx_t i = 0; i < (kd + 3)*n; ++i)
+                    _band[i] = zero;
+                for (idx_t j = 0; j < n; ++j)
+                    for (idx_t i = (j > kd) ? j - kd : 0; i <= j; ++i)
+                        B(i, j) = A(i, j);
+
+                if (want_u)
+                    laset(dense, zero, one, U2);
+                if (want_vt)
+                    laset(dense, zero, one, V2);
+                gbbrd(want_u, want_vt, kd, B, d, e, U2, V2);
+            }
+            else
+            {
+                gebrd_opts_t<idx_t, TA> gebrd_opts;
+                gebrd_opts.nb = nb;
+                gebrd_opts.nx_switch = opts.nx_switch;
+                gebrd_opts._work = _work2;
+                gebrd_opts.lwork = lwork2;
+                gebrd_opts.arena = opts.arena;
+                gebrd(A, tauq, taup, gebrd_opts);
+
+                for (idx_t i = 0; i < n; ++i)
+                    d[i] = real(A(i, i));
+                for (idx_t i = 0; i + 1 < n; ++i)
+                    e[i] = real(A(i, i + 1));
+            }
+
+            // SVD of the bidiagonal matrix
+            if (opts.divide_and_conquer)
+            {
+                bdsdc_opts_t<idx_t, real_t> bdsdc_opts;
+                bdsdc_opts.smlsiz = opts.smlsiz;
+                bdsdc_opts.parallel = opts.parallel;
+                bdsdc_opts._work = _rwork2;
+                bdsdc_opts.lwork = lrwork2;
+                bdsdc_opts.arena = opts.arena;
+                info = bdsdc(want_vectors, d, e, UB, VTB, bdsdc_opts);
+            }
+            else
+            {
+                if (want_vectors)
+                {
+                    laset(dense, rzero, rone, UB);
+                    laset(dense, rzero, rone, VTB);
+                }
+                info = bdsqr(want_u, want_vt, d, e, UB, VTB);
+            }
+            for (idx_t i = 0; i < n; ++i)
+                s[i] = d[i];
+
+            // Back-transform the left singular vectors: U := Q [ U2 UB; 0 ]
+            if (want_u)
+            {
+                auto U1 = slice(U, pair{0, n}, pair{0, n});
+                if (two_stage)
+                {
+                    for (idx_t j = 0; j < n; ++j)
+                        for (idx_t i = 0; i < n; ++i)
+                            W(i, j) = UB(i, j);
+                    gemm(Op::NoTrans, Op::NoTrans, one, U2, W, zero, U1);
+                }
+                else
+                {
+                    for (idx_t j = 0; j < n; ++j)
+                        for (idx_t i = 0; i < n; ++i)
+                            U1(i, j) = UB(i, j);
+                }
+                if (m > n)
+                {
+                    auto U0 = slice(U, pair{n, m}, pair{0, n});
+                    laset(dense, zero, zero, U0);
+                }
+
+                auto Wq = legacyMatrix<TA, L>( nb, n + nb, _work2, L == Layout::ColMajor ? nb : n + nb );
+                struct {
+                    idx_t nb;
+                    decltype(Wq)* workPtr;
+                } unmqr_opts = { nb, &Wq };
+                unmqr(Side::Left, Op::NoTrans, A, tauq, U, std::move(unmqr_opts));
+            }
+
+            // Back-transform the right singular vectors: VT := VTB V2^H P^H
+            if (want_vt)
+            {
+                if (two_stage)
+                {
+                    for (idx_t j = 0; j < n; ++j)
+                        for (idx_t i = 0; i < n; ++i)
+                            W(i, j) = VTB(i, j);
+                    gemm(Op::NoTrans, Op::ConjTrans, one, W, V2, zero, VT);
+                }
+                else
+                {
+                    for (idx_t j = 0; j < n; ++j)
+                        for (idx_t i = 0; i < n; ++i)
+                            VT(i, j) = VTB(i, j);
+                }
+
+                // P^H is the matrix Q of the LQ factorization of A(0:n-kd,kd:n)
+                if (n > kd)
+                {
+                    auto Ap = slice(A, pair{0, n - kd}, pair{kd, n});
+                    auto taup1 = slice(taup, pair{0, n - kd});
+                    auto VT1 = slice(VT, pair{0, n}, pair{kd, n});
+                    unmlq_opts_t<idx_t, TA> unmlq_opts;
+                    unmlq_opts.nb = nb;
+                    unmlq_opts._work = _work2;
+                    unmlq_opts.lwork = lwork2;
+                    unmlq_opts.arena = opts.arena;
+                    unmlq(Side::Right, Op::NoTrans, Ap, taup1, VT1, unmlq_opts);
+                }
+            }
+        }
+
+        return info;
+    }
+
+} // lapack
+
+#endif // __TLAPACK_GESVD_HH__
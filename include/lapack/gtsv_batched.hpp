@@ -0,0 +1,112 @@
+/// @file gtsv_batched.hpp Solves many independent tridiagonal systems stored interleaved.
+//
+// Copyright (c) 2022, University of Colorado Denver. All rights reserved.
+//
+// This file is part of <T>LAPACK.
+// <T>LAPACK is free software: you can redistribute it and/or modify it under
+// the terms of the BSD 3-Clause license. See the accompanying LICENSE file.
+
+#ifndef __TLAPACK_GTSV_BATCHED_HH__
+#define __TLAPACK_GTSV_BATCHED_HH__
+
+#include "base/utils.hpp"
+#include "base/profile.hpp"
+#include "base/parallel.hpp"
+
+namespace tlapack {
+
+/** Solves nbatch independent systems of linear equations
+ * \[
+ *      A_s x_s = b_s, \quad s = 0, ..., nbatch-1,
+ * \]
+ * where each $A_s$ is a n-by-n tridiagonal matrix, using the Thomas
+ * algorithm.
+ *
+ * The systems are interleaved: the row s of D holds the diagonal of $A_s$,
+ * and similarly for DL, DU and B. With column-major matrices, the entry i
+ * of all systems is contiguous in memory, so the loops over the systems
+ * have unit stride and are vectorized. Different threads may solve
+ * disjoint sets of rows of the matrices.
+ *
+ * There is no pivoting, so the matrices $A_s$ are meant to be diagonally
+ * dominant or Hermitian positive definite.
+ *
+ * @param[in] DL nbatch-by-(n-1) matrix. DL(s,i) = $A_s$(i+1,i).
+ *
+ * @param[in,out] D nbatch-by-n matrix.
+ *      On entry, D(s,i) = $A_s$(i,i).
+ *      On exit, the pivots of the elimination.
+ *
+ * @param[in] DU nbatch-by-(n-1) matrix. DU(s,i) = $A_s$(i,i+1).
+ *
+ * @param[in,out] B nbatch-by-n matrix.
+ *      On entry, B(s,i) = $b_s$[i].
+ *      On exit, B(s,i) = $x_s$[i].
+ *
+ * @param[in] ec Exception handling configuration at runtime.
+ *
+ * @return = 0: successful exit.
+ * @return i, 0 < i <= n, if the pivot i-1 of some system is exactly zero.
+ *      The solution was not computed. D and B hold the elimination up to
+ *      the column i-1, with no infs or NaNs introduced by the zero pivot.
+ *
+ * @ingroup gtsv
+ */
+template< class matrixDL_t, class matrixD_t, class matrixDU_t, class matrixB_t >
+int gtsv_batched( const matrixDL_t& DL, matrixD_t& D, const matrixDU_t& DU, matrixB_t& B,
+                  const ErrorCheck& ec = {} )
+{
+    using T     = type_t< matrixD_t >;
+    using idx_t = size_type< matrixD_t >;
+
+    // constants
+    const idx_t nbatch = nrows(D);
+    const idx_t n      = ncols(D);
+
+    // check arguments
+    tlapack_check_false( n > 0 && (nrows(DL) != nbatch || ncols(DL) != n-1), -1 );
+    tlapack_check_false( n > 0 && (nrows(DU) != nbatch || ncols(DU) != n-1), -3 );
+    tlapack_check_false( nrows(B) != nbatch || ncols(B) != n, -4 );
+
+    TLAPACK_PROFILE_SCOPE( "gtsv_batched", T, 8.0*n*nbatch, 5.0*n*nbatch );
+
+    // quick return
+    if( n == 0 || nbatch == 0 )
+        return 0;
+
+    // Forward elimination. Each pivot is checked before it is used, so that
+    // no division by zero takes place
+    for( idx_t i = 0; i < n; ++i ) {
+        for( idx_t s = 0; s < nbatch; ++s ) {
+            if( D(s,i) == T(0) ) {
+                tlapack_error_internal( ec, i+1,
+                    "A zero pivot was found. The solution was not computed." );
+                return i+1;
+            }
+        }
+        if( i+1 < n ) {
+            TLAPACK_OMP(simd)
+            for( idx_t s = 0; s < nbatch; ++s ) {
+                const T w = DL(s,i) / D(s,i);
+                D(s,i+1) -= w * DU(s,i);
+                B(s,i+1) -= w * B(s,i);
+            }
+        }
+    }
+
+    // Back substitution
+    TLAPACK_OMP(simd)
+    for( idx_t s = 0; s < nbatch; ++s )
+        B(s,n-1) /= D(s,n-1);
+    for( idx_t i = n-1; i-- > 0; ) {
+        TLAPACK_OMP(simd)
+        for( idx_t s = 0; s < nbatch; ++s )
+            B(s,i) = ( B(s,i) - DU(s,i) * B(s,i+1) ) / D(s,i);
+    }
+
+    return 0;
+}
+
+} // namespace tlapack
+
+#endif // __TLAPACK_GTSV_BATCHED_HH__
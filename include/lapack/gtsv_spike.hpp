@@ -0,0 +1,307 @@
+/// @file gtsv_spike.hpp Solves a general tridiagonal system of linear equations by a partitioned (SPIKE) algorithm.
+//
+// Copyright (c) 2022, University of Colorado Denver. All rights reserved.
+//
+// This file is part of <T>LAPACK.
+// <T>LAPACK is free software: you can redistribute it and/or modify it under
+// the terms of the BSD 3-Clause license. See the accompanying LICENSE file.
+
+#ifndef __TLAPACK_GTSV_SPIKE_HH__
+#define __TLAPACK_GTSV_SPIKE_HH__
+
+#include "legacy_api/base/utils.hpp"
+#include "base/utils.hpp"
+#include "base/profile.hpp"
+#include "base/tuning.hpp"
+#include "base/parallel.hpp"
+#include "base/workspace.hpp"
+
+#include "lapack/gttrf.hpp"
+#include "lapack/gttrs.hpp"
+
+namespace tlapack {
+
+/**
+ * Options struct for gtsv_spike
+ */
+template< typename idx_t, typename T >
+struct gtsv_spike_opts_t
+{
+    // Size of the partitions, at least 2. The last partition also takes the
+    // remaining n % nb rows
+    tunable<idx_t> nb = {tuning_default, 1024};
+    // If true, the partitions are eliminated and back substituted by
+    // different OpenMP threads.
+    // Has no effect if <T>LAPACK is not compiled with OpenMP.
+    bool parallel = false;
+    // Workspace pointer, if no workspace is provided, one will be allocated internally
+    T* _work = nullptr;
+    // Workspace size
+    idx_t lwork = 0;
+    // Integer workspace pointer, if no workspace is provided, one will be allocated internally
+    idx_t* _iwork = nullptr;
+    // Integer workspace size
+    idx_t liwork = 0;
+    // Arena used if no workspace is provided. If nullptr, the default
+    // arena of the calling thread is used.
+    workspace_arena* arena = nullptr;
+};
+
+/**
+ * Returns the required workspace for gtsv_spike.
+ * The arguments are the same as for gtsv_spike itself.
+ *
+ * @return idx_t The size of the required workspace
+ */
+template< class vectorDL_t, class vectorD_t, class vectorDU_t, class matrixB_t,
+          typename idx_t = size_type<vectorD_t>, typename T = type_t<vectorD_t> >
+idx_t get_work_gtsv_spike( const vectorDL_t& dl, const vectorD_t& d, const vectorDU_t& du, const matrixB_t& B,
+                           const gtsv_spike_opts_t<idx_t,T>& opts = {} )
+{
+    const idx_t n  = size(d);
+    const idx_t nb = std::max<idx_t>( tuned<T>( opts.nb, "gtsv_spike", "nb", n ), 2 );
+    const idx_t p  = n / nb;
+
+    // du2 of the factorizations, the spikes of each partition and the
+    // tridiagonal reduced system of size 2p with its right hand sides
+    return ( p < 2 ) ? n : 3*n + 2*p*(4 + ncols(B));
+}
+
+/**
+ * Returns the required integer workspace for gtsv_spike.
+ * The arguments are the same as for gtsv_spike itself.
+ *
+ * @return idx_t The size of the required integer workspace
+ */
+template< class vectorDL_t, class vectorD_t, class vectorDU_t, class matrixB_t,
+          typename idx_t = size_type<vectorD_t>, typename T = type_t<vectorD_t> >
+idx_t get_iwork_gtsv_spike( const vectorDL_t& dl, const vectorD_t& d, const vectorDU_t& du, const matrixB_t& B,
+                            const gtsv_spike_opts_t<idx_t,T>& opts = {} )
+{
+    const idx_t n  = size(d);
+    const idx_t nb = std::max<idx_t>( tuned<T>( opts.nb, "gtsv_spike", "nb", n ), 2 );
+    const idx_t p  = n / nb;
+
+    return ( p < 2 ) ? n : n + 2*p;
+}
+
+/** Solves a system of linear equations
+ * \[
+ *      A X = B,
+ * \]
+ * with a n-by-n tridiagonal matrix A using a partitioned (SPIKE)
+ * algorithm suited for a single large system.
+ *
+ * The rows of A are split in p = n/nb partitions. The interior of each
+ * partition, i.e., all its rows but the first and the last, is factored
+ * with gttrf() independently of the others, which gives the solution of
+ * the interior in terms of the first and last unknowns of the partition
+ * (the spikes). The first and last rows of the partitions then form a
+ * tridiagonal reduced system of size 2p, which is solved with gttrf() and
+ * gttrs(). Finally, the interior unknowns of each partition are recovered
+ * independently of the others. The elimination and the recovery of the
+ * partitions run in parallel if opts.parallel is true.
+ *
+ * Pivoting is restricted to each interior and to the reduced system, so
+ * the algorithm is meant for matrices that are diagonally dominant or
+ * Hermitian positive definite, for which no pivoting is needed. If p < 2,
+ * the whole system is solved with gttrf() and gttrs().
+ *
+ * @param[in,out] dl Vector of size n-1.
+ *      On entry, the subdiagonal of A, i.e., dl[i] = A(i+1,i).
+ *      On exit, dl is overwritten.
+ *
+ * @param[in,out] d Vector of size n.
+ *      On entry, the diagonal of A.
+ *      On exit, d is overwritten.
+ *
+ * @param[in,out] du Vector of size n-1.
+ *      On entry, the superdiagonal of A, i.e., du[i] = A(i,i+1).
+ *      On exit, du is overwritten.
+ *
+ * @param[in,out] B
+ *      On entry, the n-by-nrhs matrix B.
+ *      On exit,  the solution matrix X.
+ *
+ * @param[in] opts Options.
+ *      - @c opts.nb: Size of the partitions.
+ *      - @c opts.parallel: Eliminate the partitions in parallel.
+ *      - @c opts._work, @c opts.lwork: Workspace, see get_work_gtsv_spike().
+ *      - @c opts._iwork, @c opts.liwork: Integer workspace, see get_iwork_gtsv_spike().
+ *      - @c opts.arena: Arena used if no workspace is provided.
+ *
+ * @param[in] ec Exception handling configuration at runtime.
+ *
+ * @return = 0: successful exit.
+ * @return i > 0 if a zero pivot was found in the row i-1 of the interior
+ *      of a partition or of the reduced system. The solution was not
+ *      computed.
+ *
+ * @ingroup gtsv
+ */
+template< class vectorDL_t, class vectorD_t, class vectorDU_t, class matrixB_t,
+          typename idx_t = size_type<vectorD_t>, typename T = type_t<vectorD_t> >
+int gtsv_spike( vectorDL_t& dl, vectorD_t& d, vectorDU_t& du, matrixB_t& B,
+                const gtsv_spike_opts_t<idx_t,T>& opts = {}, const ErrorCheck& ec = {} )
+{
+    using pair = std::pair<idx_t,idx_t>;
+
+    // constants
+    const idx_t n    = size(d);
+    const idx_t nrhs = ncols(B);
+    const idx_t nb   = std::max<idx_t>( tuned<T>( opts.nb, "gtsv_spike", "nb", n ), 2 );
+    const idx_t p    = n / nb;
+
+    // check arguments
+    tlapack_check_false( n > 0 && (idx_t) size(dl) < n-1, -1 );
+    tlapack_check_false( n > 0 && (idx_t) size(du) < n-1, -3 );
+    tlapack_check_false( nrows(B) != n, -4 );
+
+    TLAPACK_PROFILE_SCOPE( "gtsv_spike", T, 20.0*n*(nrhs+2), 6.0*n + 4.0*n*nrhs );
+
+    // quick return
+    if( n == 0 )
+        return 0;
+
+    // Get the workspaces
+    const idx_t required_workspace = get_work_gtsv_spike( dl, d, du, B, opts );
+    const idx_t required_iworkspace = get_iwork_gtsv_spike( dl, d, du, B, opts );
+    local_workspace<T> workspace( opts._work, opts.lwork, required_workspace, opts.arena );
+    local_workspace<idx_t> iworkspace( opts._iwork, opts.liwork, required_iworkspace, opts.arena );
+    T* _work = workspace.data();
+    idx_t* _iwork = iworkspace.data();
+
+    auto du2 = legacyVector<T>( n, &_work[0] );
+    auto piv = legacyVector<idx_t>( n, &_iwork[0] );
+
+    // A single partition
+    if( p < 2 ) {
+        int info = gttrf( dl, d, du, du2, piv, noErrorCheck );
+        if( info != 0 ) {
+            tlapack_error_internal( ec, info,
+                "A zero pivot was found. The solution was not computed." );
+            return info;
+        }
+        gttrs( Op::NoTrans, dl, d, du, du2, piv, B );
+        return 0;
+    }
+
+    // Spikes of the partitions and reduced system
+    const idx_t r = 2*p;
+    auto VW  = legacyMatrix<T>( n, 2, &_work[n], n );
+    auto dlr = legacyVector<T>( r-1, &_work[3*n] );
+    auto dr  = legacyVector<T>( r,   &_work[3*n + r] );
+    auto dur = legacyVector<T>( r-1, &_work[3*n + 2*r] );
+    auto du2r = legacyVector<T>( r-2, &_work[3*n + 3*r] );
+    auto Br  = legacyMatrix<T>( r, nrhs, &_work[3*n + 4*r], r );
+    auto pivr = legacyVector<idx_t>( r, &_iwork[n] );
+
+    // Rows s to e-1 of the partition k
+    const auto first = [&]( idx_t k ) { return k*nb; };
+    const auto last  = [&]( idx_t k ) { return (k+1 < p) ? (k+1)*nb : n; };
+
+    // Eliminate the interior of the partitions and build the reduced system
+    int info = 0;
+    TLAPACK_OMP(parallel for if(opts.parallel))
+    for( idx_t k = 0; k < p; ++k ) {
+
+        const idx_t s  = first(k);
+        const idx_t e  = last(k);
+        const idx_t mi = e - s - 2;
+
+        if( mi > 0 ) {
+            auto dlk  = slice( dl,  pair{s+1, e-2} );
+            auto dk   = slice( d,   pair{s+1, e-1} );
+            auto duk  = slice( du,  pair{s+1, e-2} );
+            auto du2k = slice( du2, pair{s+1, (mi > 2) ? e-3 : s+1} );
+            auto pivk = slice( piv, pair{s+1, e-1} );
+
+            int infok = gttrf( dlk, dk, duk, du2k, pivk, noErrorCheck );
+            if( infok != 0 ) {
+                TLAPACK_OMP(atomic write)
+                info = int( s + 1 + infok );
+                continue;
+            }
+
+            // The interior is x = G - x[s] V - x[e-1] W, where G solves
+            // the interior system and V, W are the spikes
+            auto VWk = slice( VW, pair{s+1, e-1}, pair{0,2} );
+            for( idx_t i = 0; i < mi; ++i ) {
+                VWk(i,0) = T(0);
+                VWk(i,1) = T(0);
+            }
+            VWk(0,0)    = dl[s];
+            VWk(mi-1,1) = du[e-2];
+            gttrs( Op::NoTrans, dlk, dk, duk, du2k, pivk, VWk );
+
+            auto Bk = slice( B, pair{s+1, e-1}, pair{0,nrhs} );
+            gttrs( Op::NoTrans, dlk, dk, duk, du2k, pivk, Bk );
+
+            // First and last rows of the partition
+            dr[2*k]    = d[s] - du[s] * VW(s+1,0);
+            dur[2*k]   = -du[s] * VW(s+1,1);
+            dlr[2*k]   = -dl[e-2] * VW(e-2,0);
+            dr[2*k+1]  = d[e-1] - dl[e-2] * VW(e-2,1);
+            for( idx_t j = 0; j < nrhs; ++j ) {
+                Br(2*k,j)   = B(s,j) - du[s] * B(s+1,j);
+                Br(2*k+1,j) = B(e-1,j) - dl[e-2] * B(e-2,j);
+            }
+        }
+        else {
+            dr[2*k]   = d[s];
+            dur[2*k]  = du[s];
+            dlr[2*k]  = dl[s];
+            dr[2*k+1] = d[s+1];
+            for( idx_t j = 0; j < nrhs; ++j ) {
+                Br(2*k,j)   = B(s,j);
+                Br(2*k+1,j) = B(s+1,j);
+            }
+        }
+
+        // Coupling with the neighbor partitions
+        if( k > 0 )
+            dlr[2*k-1] = dl[s-1];
+        if( k+1 < p )
+            dur[2*k+1] = du[e-1];
+    }
+
+    if( info != 0 ) {
+        tlapack_error_internal( ec, info,
+            "A zero pivot was found. The solution was not computed." );
+        return info;
+    }
+
+    // Solve the reduced system
+    info = gttrf( dlr, dr, dur, du2r, pivr, noErrorCheck );
+    if( info != 0 ) {
+        const idx_t k = (info-1) / 2;
+        info = int( ( (info-1) % 2 == 0 ) ? first(k) + 1 : last(k) );
+        tlapack_error_internal( ec, info,
+            "A zero pivot was found. The solution was not computed." );
+        return info;
+    }
+    gttrs( Op::NoTrans, dlr, dr, dur, du2r, pivr, Br );
+
+    // Recover the interior of the partitions
+    TLAPACK_OMP(parallel for if(opts.parallel))
+    for( idx_t k = 0; k < p; ++k ) {
+
+        const idx_t s = first(k);
+        const idx_t e = last(k);
+
+        for( idx_t j = 0; j < nrhs; ++j ) {
+            const T xs = Br(2*k,j);
+            const T xe = Br(2*k+1,j);
+            B(s,j)   = xs;
+            B(e-1,j) = xe;
+            for( idx_t i = s+1; i+1 < e; ++i )
+                B(i,j) -= xs * VW(i,0) + xe * VW(i,1);
+        }
+    }
+
+    return 0;
+}
+
+} // namespace tlapack
+
+#endif // __TLAPACK_GTSV_SPIKE_HH__
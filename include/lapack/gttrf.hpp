@@ -0,0 +1,125 @@
+/// @file gttrf.hpp Computes the LU factorization of a general tridiagonal matrix.
+/// Adapted from @see https://github.com/Reference-LAPACK/lapack/tree/master/SRC/zgttrf.f
+//
+// Copyright (c) 2022, University of Colorado Denver. All rights reserved.
+//
+// This file is part of <T>LAPACK.
+// <T>LAPACK is free software: you can redistribute it and/or modify it under
+// the terms of the BSD 3-Clause license. See the accompanying LICENSE file.
+
+#ifndef __TLAPACK_GTTRF_HH__
+#define __TLAPACK_GTTRF_HH__
+
+#include "base/utils.hpp"
+#include "base/profile.hpp"
+
+namespace tlapack {
+
+/** Computes an LU factorization of a n-by-n tridiagonal matrix A using
+ * elimination with partial pivoting and row interchanges.
+ *
+ * The factorization has the form
+ * \[
+ *     A = L U
+ * \]
+ * where L is a product of permutation and unit lower bidiagonal matrices
+ * and U is upper triangular with nonzeros in only the main diagonal and
+ * the first two superdiagonals.
+ *
+ * @param[in,out] dl Vector of size n-1.
+ *      On entry, the subdiagonal of A, i.e., dl[i] = A(i+1,i).
+ *      On exit, the multipliers that define the matrix L.
+ *
+ * @param[in,out] d Vector of size n.
+ *      On entry, the diagonal of A.
+ *      On exit, the diagonal of U.
+ *
+ * @param[in,out] du Vector of size n-1.
+ *      On entry, the superdiagonal of A, i.e., du[i] = A(i,i+1).
+ *      On exit, the first superdiagonal of U.
+ *
+ * @param[out] du2 Vector of size n-2.
+ *      The second superdiagonal of U.
+ *
+ * @param[out] piv Vector of size n.
+ *      The pivot indices: for 0 <= i < n, the row i of the matrix was
+ *      interchanged with the row piv[i], which is either i or i+1.
+ *
+ * @param[in] ec Exception handling configuration at runtime.
+ *
+ * @return = 0: successful exit.
+ * @return i, 0 < i <= n, if U(i-1,i-1) is exactly zero. The factorization
+ *      has been completed, but U is singular.
+ *
+ * @ingroup gtsv_computational
+ */
+template< class vectorDL_t, class vectorD_t, class vectorDU_t, class vectorDU2_t, class vectorPiv_t >
+int gttrf( vectorDL_t& dl, vectorD_t& d, vectorDU_t& du, vectorDU2_t& du2, vectorPiv_t& piv,
+           const ErrorCheck& ec = {} )
+{
+    using T     = type_t< vectorD_t >;
+    using idx_t = size_type< vectorD_t >;
+
+    // constants
+    const idx_t n = size(d);
+
+    // check arguments
+    tlapack_check_false( n > 0 && (idx_t) size(dl) < n-1, -1 );
+    tlapack_check_false( n > 0 && (idx_t) size(du) < n-1, -3 );
+    tlapack_check_false( n > 1 && (idx_t) size(du2) < n-2, -4 );
+    tlapack_check_false( (idx_t) size(piv) < n, -5 );
+
+    TLAPACK_PROFILE_SCOPE( "gttrf", T, 4.0*n, 4.0*n );
+
+    // quick return
+    if( n == 0 )
+        return 0;
+
+    for( idx_t i = 0; i < n; ++i )
+        piv[i] = i;
+
+    for( idx_t i = 0; i+1 < n; ++i ) {
+        if( abs1( d[i] ) >= abs1( dl[i] ) ) {
+
+            // No row interchange required, eliminate dl[i]
+            if( d[i] != T(0) ) {
+                const T fact = dl[i] / d[i];
+                dl[i] = fact;
+                d[i+1] -= fact * du[i];
+            }
+            if( i+2 < n )
+                du2[i] = T(0);
+        }
+        else {
+
+            // Interchange rows i and i+1, eliminate d[i]
+            const T fact = d[i] / dl[i];
+            d[i] = dl[i];
+            dl[i] = fact;
+            const T temp = du[i];
+            du[i] = d[i+1];
+            d[i+1] = temp - fact * d[i+1];
+            if( i+2 < n ) {
+                du2[i] = du[i+1];
+                du[i+1] = -fact * du[i+1];
+            }
+            piv[i] = i+1;
+        }
+    }
+
+    // Check for a zero on the diagonal of U
+    for( idx_t i = 0; i < n; ++i ) {
+        if( d[i] == T(0) ) {
+            tlapack_error_internal( ec, i+1,
+                "U(info-1,info-1) is exactly zero."
+                " The factorization has been completed, but U is singular." );
+            return i+1;
+        }
+    }
+
+    return 0;
+}
+
+} // namespace tlapack
+
+#endif // __TLAPACK_GTTRF_HH__
@@ -0,0 +1,131 @@
+/// @file gttrs.hpp Solves a general tridiagonal system of linear equations using the LU factorization computed by gttrf.
+/// Adapted from @see https://github.com/Reference-LAPACK/lapack/tree/master/SRC/zgtts2.f
+//
+// Copyright (c) 2022, University of Colorado Denver. All rights reserved.
+//
+// This file is part of <T>LAPACK.
+// <T>LAPACK is free software: you can redistribute it and/or modify it under
+// the terms of the BSD 3-Clause license. See the accompanying LICENSE file.
+
+#ifndef __TLAPACK_GTTRS_HH__
+#define __TLAPACK_GTTRS_HH__
+
+#include "base/utils.hpp"
+#include "base/profile.hpp"
+
+namespace tlapack {
+
+/** Solves a system of linear equations
+ * \[
+ *      op(A) X = B,
+ * \]
+ * with a n-by-n tridiagonal matrix A using the LU factorization computed
+ * by gttrf().
+ *
+ * @param[in] trans
+ *      The system to be solved:
+ *      - Op::NoTrans:   $A   X = B$,
+ *      - Op::Trans:     $A^T X = B$,
+ *      - Op::ConjTrans: $A^H X = B$.
+ *
+ * @param[in] dl Vector of size n-1. The multipliers returned by gttrf().
+ * @param[in] d Vector of size n. The diagonal of U returned by gttrf().
+ * @param[in] du Vector of size n-1. The first superdiagonal of U returned by gttrf().
+ * @param[in] du2 Vector of size n-2. The second superdiagonal of U returned by gttrf().
+ * @param[in] piv Vector of size n. The pivot indices returned by gttrf().
+ *
+ * @param[in,out] B
+ *      On entry, the n-by-nrhs matrix B.
+ *      On exit,  the solution matrix X.
+ *
+ * @return = 0: successful exit.
+ *
+ * @ingroup gtsv_computational
+ */
+template< class vectorDL_t, class vectorD_t, class vectorDU_t, class vectorDU2_t, class vectorPiv_t,
+          class matrixB_t >
+int gttrs( Op trans,
+           const vectorDL_t& dl, const vectorD_t& d, const vectorDU_t& du, const vectorDU2_t& du2,
+           const vectorPiv_t& piv, matrixB_t& B )
+{
+    using T     = type_t< matrixB_t >;
+    using idx_t = size_type< matrixB_t >;
+
+    // constants
+    const idx_t n    = size(d);
+    const idx_t nrhs = ncols(B);
+
+    // check arguments
+    tlapack_check_false( trans != Op::NoTrans &&
+                         trans != Op::Trans &&
+                         trans != Op::ConjTrans, -1 );
+    tlapack_check_false( n > 0 && (idx_t) size(dl) < n-1, -2 );
+    tlapack_check_false( n > 0 && (idx_t) size(du) < n-1, -4 );
+    tlapack_check_false( n > 1 && (idx_t) size(du2) < n-2, -5 );
+    tlapack_check_false( (idx_t) size(piv) < n, -6 );
+    tlapack_check_false( nrows(B) != n, -7 );
+
+    TLAPACK_PROFILE_SCOPE( "gttrs", T, 10.0*n*nrhs, 5.0*n + 2.0*n*nrhs );
+
+    // quick return
+    if( n == 0 || nrhs == 0 )
+        return 0;
+
+    // Entries of the factors, conjugated if needed
+    const bool conjA = ( trans == Op::ConjTrans );
+    const auto L  = [&]( idx_t i ) { return conjA ? conj( dl[i] ) : dl[i]; };
+    const auto D  = [&]( idx_t i ) { return conjA ? conj( d[i] ) : d[i]; };
+    const auto U1 = [&]( idx_t i ) { return conjA ? conj( du[i] ) : du[i]; };
+    const auto U2 = [&]( idx_t i ) { return conjA ? conj( du2[i] ) : du2[i]; };
+
+    for( idx_t j = 0; j < nrhs; ++j ) {
+        if( trans == Op::NoTrans ) {
+
+            // Solve L x = b
+            for( idx_t i = 0; i+1 < n; ++i ) {
+                if( piv[i] == i ) {
+                    B(i+1,j) -= dl[i] * B(i,j);
+                }
+                else {
+                    const T temp = B(i,j);
+                    B(i,j) = B(i+1,j);
+                    B(i+1,j) = temp - dl[i] * B(i,j);
+                }
+            }
+
+            // Solve U x = b
+            B(n-1,j) /= d[n-1];
+            if( n > 1 )
+                B(n-2,j) = ( B(n-2,j) - du[n-2] * B(n-1,j) ) / d[n-2];
+            for( idx_t i = (n > 2) ? n-2 : 0; i-- > 0; )
+                B(i,j) = ( B(i,j) - du[i] * B(i+1,j) - du2[i] * B(i+2,j) ) / d[i];
+        }
+        else {
+
+            // Solve U^T x = b or U^H x = b
+            B(0,j) /= D(0);
+            if( n > 1 )
+                B(1,j) = ( B(1,j) - U1(0) * B(0,j) ) / D(1);
+            for( idx_t i = 2; i < n; ++i )
+                B(i,j) = ( B(i,j) - U1(i-1) * B(i-1,j) - U2(i-2) * B(i-2,j) ) / D(i);
+
+            // Solve L^T x = b or L^H x = b
+            for( idx_t i = n-1; i-- > 0; ) {
+                if( piv[i] == i ) {
+                    B(i,j) -= L(i) * B(i+1,j);
+                }
+                else {
+                    const T temp = B(i+1,j);
+                    B(i+1,j) = B(i,j) - L(i) * temp;
+                    B(i,j) = temp;
+                }
+            }
+        }
+    }
+
+    return 0;
+}
+
+} // namespace tlapack
+
+#endif // __TLAPACK_GTTRS_HH__
@@ -0,0 +1,198 @@
+/// @file heevd.hpp
+/// Adapted from @see https://github.com/Reference-LAPACK/lapack/tree/master/SRC/zheevd.f
+//
+// Copyright (c) 2022, University of Colorado Denver. All rights reserved.
+//
+// This file is part of <T>LAPACK.
+// <T>LAPACK is free software: you can redistribute it and/or modify it under
+// the terms of the BSD 3-Clause license. See the accompanying LICENSE file.
+
+#ifndef __TLAPACK_HEEVD_HH__
+#define __TLAPACK_HEEVD_HH__
+
+#include "legacy_api/base/utils.hpp"
+#include "base/utils.hpp"
+#include "base/profile.hpp"
+#include "base/types.hpp"
+#include "base/workspace.hpp"
+#include "lapack/hetrd.hpp"
+#include "lapack/stedc.hpp"
+#include "lapack/unmtr.hpp"
+#include "lapack/lacpy.hpp"
+
+namespace tlapack
+{
+
+    /**
+     * Options struct for heevd
+     */
+    template <typename idx_t, typename T>
+    struct heevd_opts_t {
+        // Blocksize used in hetrd and unmtr
+        idx_t nb = 32;
+        // If only nx_switch columns are left, hetrd will use unblocked code
+        idx_t nx_switch = 128;
+        // Subproblems of size at most smlsiz are solved by steqr in stedc
+        idx_t smlsiz = 25;
+        // If true, stedc solves independent subproblems in parallel.
+        // Has no effect if <T>LAPACK is not compiled with OpenMP.
+        bool parallel = false;
+        // Workspace pointer, if no workspace is provided, one will be allocated internally
+        T* _work=nullptr;
+        // Workspace size
+        idx_t lwork = 0;
+        // Real workspace pointer, if no workspace is provided, one will be allocated internally
+        real_type<T>* _rwork=nullptr;
+        // Real workspace size
+        idx_t lrwork = 0;
+        // Arena used if no workspace is provided. If nullptr, the default
+        // arena of the calling thread is used.
+        workspace_arena* arena = nullptr;
+    };
+
+    /**
+     * Returns the required workspaces for heevd.
+     * The arguments are the same as for heevd itself.
+     *
+     * @return std::pair<idx_t,idx_t> The sizes of the required workspace
+     *      and of the required real workspace
+     */
+    template <class matrix_t, class vector_t, typename idx_t = size_type<matrix_t>, typename TA = type_t<matrix_t>>
+    std::pair<idx_t,idx_t> get_work_heevd(bool want_z, Uplo uplo, matrix_t &A, vector_t &w, const heevd_opts_t<idx_t, TA> &opts = {})
+    {
+        const idx_t n = ncols(A);
+        const idx_t nb = opts.nb;
+
+        // tau, the workspace of hetrd and unmtr, and the eigenvectors
+        const idx_t lwork = n + std::max( n*nb + n, (n+nb)*nb ) + ((want_z) ? n*n : 0);
+        // e, the eigenvectors of T and the workspace of stedc
+        const idx_t lrwork = n + ((want_z) ? n*n + 2*n*n + 5*n : 0);
+
+        return std::pair<idx_t,idx_t>( lwork, lrwork );
+    }
+
+    /** Computes all eigenvalues and, optionally, eigenvectors of a Hermitian
+     * matrix A.
+     *
+     * The matrix is reduced to real tridiagonal form T by hetrd, the
+     * eigensystem of T is computed by the divide and conquer method in
+     * stedc, and the eigenvectors are transformed back by unmtr.
+     *
+     * If want_z is false, stedc only computes the eigenvalues of T, and
+     * neither the eigenvectors of T nor Q are ever formed.
+     *
+     * @return  0 if success
+     * @return  > 0 if stedc failed to converge.
+     *
+     * @param[in] want_z bool.
+     *      If true, the eigenvectors of A are computed.
+     * @param[in] uplo
+     *      - Uplo::Upper: Upper triangle of A is referenced;
+     *      - Uplo::Lower: Lower triangle of A is referenced.
+     * @param[in,out] A n-by-n Hermitian matrix.
+     *      On exit, if want_z is true, the orthonormal eigenvectors of A.
+     *      If want_z is false, the referenced triangle of A is destroyed.
+     * @param[out] w Real vector of length n.
+     *      The eigenvalues in ascending order.
+     *
+     * @param[in,out] opts Struct containing the options
+     *      See heevd_opts_t for more details
+     *
+     * @ingroup heev
+     */
+    template <class matrix_t, class vector_t, typename idx_t = size_type<matrix_t>, typename TA = type_t<matrix_t>>
+    int heevd(bool want_z, Uplo uplo, matrix_t &A, vector_t &w, const heevd_opts_t<idx_t, TA> &opts = {})
+    {
+        using real_t = real_type<TA>;
+
+        // constants
+        const idx_t n = ncols(A);
+        const idx_t nb = opts.nb;
+
+        TLAPACK_PROFILE_SCOPE( "heevd", TA, 0, double(n)*n );
+
+        // check arguments
+        tlapack_check_false(uplo != Uplo::Lower && uplo != Uplo::Upper, -2);
+        tlapack_check_false(access_denied(uplo, write_policy(A)), -3);
+        tlapack_check_false(ncols(A) != nrows(A), -3);
+        tlapack_check_false((idx_t)size(w) < n, -4);
+
+        // quick return
+        if (n <= 0)
+            return 0;
+        if (n == 1)
+        {
+            w[0] = real(A(0, 0));
+            if (want_z)
+                A(0, 0) = TA(1);
+            return 0;
+        }
+
+        // Get the workspaces
+        const auto required_workspace = get_work_heevd(want_z, uplo, A, w, opts);
+        // Use the provided workspaces if they are large enough, otherwise
+        // borrow them from the arena
+        local_workspace<TA> workspace( opts._work, opts.lwork, required_workspace.first, opts.arena );
+        local_workspace<real_t> rworkspace( opts._rwork, opts.lrwork, required_workspace.second, opts.arena );
+        TA* _work = workspace.data();
+        real_t* _rwork = rworkspace.data();
+
+        auto tau = legacyVector<TA>( n-1, &_work[0] );
+        TA* _work2 = &_work[n];
+        const idx_t lwork2 = std::max( n*nb + n, (n+nb)*nb );
+        auto e = legacyVector<real_t>( n-1, &_rwork[0] );
+
+        // Reduce A to tridiagonal form
+        hetrd_opts_t<idx_t, TA> hetrd_opts;
+        hetrd_opts.nb = nb;
+        hetrd_opts.nx_switch = opts.nx_switch;
+        hetrd_opts._work = _work2;
+        hetrd_opts.lwork = lwork2;
+        hetrd_opts.arena = opts.arena;
+        hetrd(uplo, A, tau, hetrd_opts);
+
+        for (idx_t i = 0; i < n; ++i)
+            w[i] = real(A(i, i));
+        for (idx_t i = 0; i < n - 1; ++i)
+            e[i] = real( (uplo == Uplo::Upper) ? A(i, i + 1) : A(i + 1, i) );
+
+        int info = 0;
+        if (!want_z)
+        {
+            // The eigenvectors are never referenced
+            auto Z = legacyMatrix<real_t, layout<matrix_t>>( 0, 0, &_rwork[0], 1 );
+            info = stedc(false, w, e, Z);
+        }
+        else
+        {
+            auto Z = legacyMatrix<real_t, layout<matrix_t>>( n, n, &_rwork[n], n );
+            auto C = legacyMatrix<TA, layout<matrix_t>>( n, n, &_work[n + lwork2], n );
+
+            // Eigenvectors of T
+            stedc_opts_t<idx_t, real_t> stedc_opts;
+            stedc_opts.smlsiz = opts.smlsiz;
+            stedc_opts.parallel = opts.parallel;
+            stedc_opts._work = &_rwork[n + n*n];
+            stedc_opts.lwork = 2*n*n + 5*n;
+            stedc_opts.arena = opts.arena;
+            info = stedc(true, w, e, Z, stedc_opts);
+
+            // Back-transform: A := Q Z
+            for (idx_t j = 0; j < n; ++j)
+                for (idx_t i = 0; i < n; ++i)
+                    C(i, j) = Z(i, j);
+            unmtr_opts_t<idx_t, TA> unmtr_opts;
+            unmtr_opts.nb = nb;
+            unmtr_opts._work = _work2;
+            unmtr_opts.lwork = lwork2;
+            unmtr_opts.arena = opts.arena;
+            unmtr(Side::Left, uplo, Op::NoTrans, A, tau, C, unmtr_opts);
+            lacpy(dense, C, A);
+        }
+
+        return info;
+    }
+
+} // lapack
+
+#endif // __TLAPACK_HEEVD_HH__
@@ -0,0 +1,175 @@
+/// @file hetd2.hpp
+/// Adapted from @see https://github.com/Reference-LAPACK/lapack/tree/master/SRC/zhetd2.f
+//
+// Copyright (c) 2022, University of Colorado Denver. All rights reserved.
+//
+// This file is part of <T>LAPACK.
+// <T>LAPACK is free software: you can redistribute it and/or modify it under
+// the terms of the BSD 3-Clause license. See the accompanying LICENSE file.
+
+#ifndef __TLAPACK_HETD2_HH__
+#define __TLAPACK_HETD2_HH__
+
+#include "base/utils.hpp"
+#include "base/profile.hpp"
+#include "base/types.hpp"
+#include "lapack/larfg.hpp"
+#include "blas/hemv.hpp"
+#include "blas/her2.hpp"
+#include "blas/dot.hpp"
+#include "blas/axpy.hpp"
+
+namespace tlapack {
+
+/** Reduces a Hermitian matrix to real symmetric tridiagonal form by a
+ * unitary similarity transformation: $Q^H A Q = T$.
+ *
+ * If uplo = Uplo::Upper, the matrix Q is represented as a product of
+ * elementary reflectors
+ * \[
+ *          Q = H_{n-2} ... H_1 H_0.
+ * \]
+ * Each H_i has the form
+ * \[
+ *          H_i = I - tau * v * v',
+ * \]
+ * where tau is a scalar, and v is a vector with
+ * \[
+ *          v[i+1] = ... = v[n-1] = 0; v[i] = 1,
+ * \]
+ * with v[0] through v[i-1] stored on exit in A(0:i,i+1), and tau in tau[i].
+ *
+ * If uplo = Uplo::Lower, the matrix Q is represented as a product of
+ * elementary reflectors
+ * \[
+ *          Q = H_0 H_1 ... H_{n-2}.
+ * \]
+ * Each H_i has the form
+ * \[
+ *          H_i = I - tau * v * v',
+ * \]
+ * where tau is a scalar, and v is a vector with
+ * \[
+ *          v[0] = v[1] = ... = v[i] = 0; v[i+1] = 1,
+ * \]
+ * with v[i+2] through v[n-1] stored on exit in A(i+2:n,i), and tau in tau[i].
+ *
+ * @return  0 if success
+ *
+ * @param[in] uplo
+ *      - Uplo::Upper: Upper triangle of A is referenced;
+ *      - Uplo::Lower: Lower triangle of A is referenced.
+ * @param[in,out] A n-by-n Hermitian matrix.
+ *      On exit, the diagonal and the first superdiagonal (Uplo::Upper) or
+ *      the first subdiagonal (Uplo::Lower) of A are overwritten by the real
+ *      tridiagonal matrix T. The remaining elements of the referenced
+ *      triangle, with the array tau, represent the unitary matrix Q as a
+ *      product of elementary reflectors.
+ * @param[out] tau Vector of length n-1.
+ *      The scalar factors of the elementary reflectors.
+ *      Also used as workspace.
+ *
+ * @ingroup heev_computational
+ */
+template< class matrix_t, class vector_t >
+int hetd2( Uplo uplo, matrix_t& A, vector_t &tau )
+{
+    using TA    = type_t< matrix_t >;
+    using real_t = real_type< TA >;
+    using idx_t = size_type< matrix_t >;
+    using pair  = pair<idx_t,idx_t>;
+
+    // constants
+    const TA one(1);
+    const TA zero(0);
+    const real_t half(0.5);
+    const idx_t n = ncols(A);
+
+    TLAPACK_PROFILE_SCOPE( "hetd2", type_t<matrix_t>, (4.0/3.0)*n*n*n, 0.5*n*(n+1) );
+
+    // check arguments
+    tlapack_check_false( uplo != Uplo::Lower &&
+                         uplo != Uplo::Upper, -1 );
+    tlapack_check_false( access_denied( uplo, write_policy(A) ), -2 );
+    tlapack_check_false( ncols(A) != nrows(A), -2 );
+    tlapack_check_false( (idx_t) size(tau) < n-1, -3 );
+
+    // quick return
+    if (n <= 0) return 0;
+
+    if( uplo == Uplo::Upper ) {
+
+        A(n-1,n-1) = real( A(n-1,n-1) );
+        for( idx_t i = n-1; i-- > 0; ) {
+
+            // Generate elementary reflector H_i to annihilate A(0:i,i+1)
+            TA alpha = A(i,i+1);
+            TA taui;
+            auto x = slice( A, (i > 0) ? pair{0,i} : pair{0,0}, i+1 );
+            larfg( alpha, x, taui );
+
+            if( taui != zero ) {
+
+                A(i,i+1) = one;
+                auto v  = slice( A, pair{0,i+1}, i+1 );
+                auto A1 = slice( A, pair{0,i+1}, pair{0,i+1} );
+                auto w  = slice( tau, pair{0,i+1} );
+
+                // w := taui * A1 * v
+                hemv( Uplo::Upper, taui, A1, v, zero, w );
+
+                // w := w - 1/2 * taui * (w' * v) * v
+                const TA beta = -half * taui * dot( w, v );
+                axpy( beta, v, w );
+
+                // A1 := A1 - v * w' - w * v'
+                her2( Uplo::Upper, -one, v, w, A1 );
+            }
+            else
+                A(i,i) = real( A(i,i) );
+
+            A(i,i+1) = alpha;
+            tau[i] = taui;
+        }
+    }
+    else {
+
+        A(0,0) = real( A(0,0) );
+        for( idx_t i = 0; i < n-1; ++i ) {
+
+            // Generate elementary reflector H_i to annihilate A(i+2:n,i)
+            auto v = slice( A, pair{i+1,n}, i );
+            TA taui;
+            larfg( v, taui );
+            const TA alpha = v[0];
+
+            if( taui != zero ) {
+
+                v[0] = one;
+                auto A1 = slice( A, pair{i+1,n}, pair{i+1,n} );
+                auto w  = slice( tau, pair{i,n-1} );
+
+                // w := taui * A1 * v
+                hemv( Uplo::Lower, taui, A1, v, zero, w );
+
+                // w := w - 1/2 * taui * (w' * v) * v
+                const TA beta = -half * taui * dot( w, v );
+                axpy( beta, v, w );
+
+                // A1 := A1 - v * w' - w * v'
+                her2( Uplo::Lower, -one, v, w, A1 );
+            }
+            else
+                A(i+1,i+1) = real( A(i+1,i+1) );
+
+            v[0] = alpha;
+            tau[i] = taui;
+        }
+    }
+
+    return 0;
+}
+
+} // lapack
+
+#endif // __TLAPACK_HETD2_HH__
@@ -0,0 +1,202 @@
+/// @file hetrd.hpp
+/// Adapted from @see https://github.com/Reference-LAPACK/lapack/tree/master/SRC/zhetrd.f
+//
+// Copyright (c) 2022, University of Colorado Denver. All rights reserved.
+//
+// This file is part of <T>LAPACK.
+// <T>LAPACK is free software: you can redistribute it and/or modify it under
+// the terms of the BSD 3-Clause license. See the accompanying LICENSE file.
+
+#ifndef __TLAPACK_HETRD_HH__
+#define __TLAPACK_HETRD_HH__
+
+#include "legacy_api/base/utils.hpp"
+#include "base/utils.hpp"
+#include "base/profile.hpp"
+#include "base/types.hpp"
+#include "base/workspace.hpp"
+#include "lapack/hetd2.hpp"
+#include "lapack/latrd.hpp"
+#include "blas/her2k.hpp"
+
+namespace tlapack
+{
+
+    /**
+     * Options struct for hetrd
+     */
+    template <typename idx_t, typename T>
+    struct hetrd_opts_t {
+        // Blocksize used in the blocked reduction
+        idx_t nb = 32;
+        // If only nx_switch columns are left, the algorithm will use unblocked code
+        idx_t nx_switch = 128;
+        // Workspace pointer, if no workspace is provided, one will be allocated internally
+        T* _work=nullptr;
+        // Workspace size
+        idx_t lwork = 0;
+        // Arena used if no workspace is provided. If nullptr, the default
+        // arena of the calling thread is used.
+        workspace_arena* arena = nullptr;
+    };
+
+    /**
+     * Returns the required workspace for hetrd.
+     * The arguments are the same as for hetrd itself.
+     *
+     * @return idx_t The size of the required workspace
+     */
+    template <class matrix_t, class vector_t, typename idx_t = size_type<matrix_t>, typename TA = type_t<matrix_t>>
+    idx_t get_work_hetrd(Uplo uplo, matrix_t &A, vector_t &tau, const hetrd_opts_t<idx_t, TA> &opts = {})
+    {
+        const idx_t n = ncols(A);
+        idx_t nb = opts.nb;
+
+        // W and the off-diagonal elements of each panel
+        return n*nb + n;
+    }
+
+    /** Reduces a Hermitian matrix to real symmetric tridiagonal form by a
+     * unitary similarity transformation: $Q^H A Q = T$.
+     *
+     * The panels of nb columns are reduced by latrd, and the trailing matrix
+     * is updated with the rank-2nb operation
+     * \[
+     *      A := A - V W^H - W V^H
+     * \]
+     * using her2k. See hetd2 for the representation of Q.
+     *
+     * @return  0 if success
+     *
+     * @param[in] uplo
+     *      - Uplo::Upper: Upper triangle of A is referenced;
+     *      - Uplo::Lower: Lower triangle of A is referenced.
+     * @param[in,out] A n-by-n Hermitian matrix.
+     *      On exit, the diagonal and the first superdiagonal (Uplo::Upper) or
+     *      the first subdiagonal (Uplo::Lower) of A are overwritten by the
+     *      real tridiagonal matrix T. The remaining elements of the
+     *      referenced triangle, with the array tau, represent the unitary
+     *      matrix Q as a product of elementary reflectors.
+     * @param[out] tau Vector of length n-1.
+     *      The scalar factors of the elementary reflectors.
+     *
+     * @param[in,out] opts Struct containing the options
+     *      See hetrd_opts_t for more details
+     *
+     * @ingroup heev_computational
+     */
+    template <class matrix_t, class vector_t, typename idx_t = size_type<matrix_t>, typename TA = type_t<matrix_t>>
+    int hetrd(Uplo uplo, matrix_t &A, vector_t &tau, const hetrd_opts_t<idx_t, TA> &opts = {})
+    {
+        using real_t = real_type<TA>;
+        using pair = pair<idx_t, idx_t>;
+
+        // constants
+        const TA one(1);
+        const real_t rone(1);
+        const idx_t n = ncols(A);
+
+        TLAPACK_PROFILE_SCOPE( "hetrd", TA, (4.0/3.0)*n*n*n, 0.5*n*(n+1) );
+
+        // Blocksize
+        idx_t nb = opts.nb;
+        // Size of the last block which be handled with unblocked code
+        idx_t nx_switch = opts.nx_switch;
+        idx_t nx = std::max( nb, nx_switch );
+
+        // check arguments
+        tlapack_check_false(uplo != Uplo::Lower && uplo != Uplo::Upper, -1);
+        tlapack_check_false(access_denied(uplo, write_policy(A)), -2);
+        tlapack_check_false(ncols(A) != nrows(A), -2);
+        tlapack_check_false((idx_t)size(tau) < n - 1, -3);
+
+        // quick return
+        if (n <= 0)
+            return 0;
+
+        // Use unblocked code for small matrices
+        if (n <= nx)
+            return hetd2(uplo, A, tau);
+
+        // Get the workspace
+        idx_t required_workspace = get_work_hetrd(uplo, A, tau, opts);
+        // Use the provided workspace if it is large enough, otherwise borrow
+        // it from the arena
+        local_workspace<TA> workspace( opts._work, opts.lwork, required_workspace, opts.arena );
+        TA* _work = workspace.data();
+
+        auto W = legacyMatrix<TA, layout<matrix_t>>( n, nb, &_work[0], layout<matrix_t> == Layout::ColMajor ? n : nb );
+        auto e = legacyVector<TA>( n, &_work[n*nb] );
+
+        if (uplo == Uplo::Upper)
+        {
+            // Columns kk:n are reduced in blocks of nb columns
+            const idx_t nblocks = (n - nx + nb - 1) / nb;
+            const idx_t kk = n - nblocks * nb;
+
+            for (idx_t b = 0; b < nblocks; ++b)
+            {
+                const idx_t i = n - (b + 1) * nb;
+
+                // Reduce columns i:i+nb to tridiagonal form and form the
+                // matrix W which is needed to update the unreduced part of
+                // the matrix
+                auto A1 = slice(A, pair{0, i + nb}, pair{0, i + nb});
+                auto W1 = slice(W, pair{0, i + nb}, pair{0, nb});
+                latrd(uplo, A1, e, tau, W1);
+
+                // Update the unreduced submatrix A(0:i,0:i), using an update
+                // of the form:  A := A - V*W**H - W*V**H
+                auto V = slice(A, pair{0, i}, pair{i, i + nb});
+                auto W2 = slice(W, pair{0, i}, pair{0, nb});
+                auto A2 = slice(A, pair{0, i}, pair{0, i});
+                her2k(Uplo::Upper, Op::NoTrans, -one, V, W2, rone, A2);
+
+                // Copy superdiagonal elements back into A
+                for (idx_t j = i; j < i + nb; ++j)
+                    A(j - 1, j) = e[j - 1];
+            }
+
+            // Use unblocked code to reduce the last or only block
+            auto A0 = slice(A, pair{0, kk}, pair{0, kk});
+            hetd2(uplo, A0, tau);
+        }
+        else
+        {
+            // Reduce columns 0:n-nx in blocks of nb columns
+            idx_t i = 0;
+            for (; i + nx < n; i += nb)
+            {
+                // Reduce columns i:i+nb to tridiagonal form and form the
+                // matrix W which is needed to update the unreduced part of
+                // the matrix
+                auto A1 = slice(A, pair{i, n}, pair{i, n});
+                auto W1 = slice(W, pair{0, n - i}, pair{0, nb});
+                auto e1 = slice(e, pair{i, n});
+                auto tau1 = slice(tau, pair{i, n - 1});
+                latrd(uplo, A1, e1, tau1, W1);
+
+                // Update the unreduced submatrix A(i+nb:n,i+nb:n), using an
+                // update of the form:  A := A - V*W**H - W*V**H
+                auto V = slice(A, pair{i + nb, n}, pair{i, i + nb});
+                auto W2 = slice(W, pair{nb, n - i}, pair{0, nb});
+                auto A2 = slice(A, pair{i + nb, n}, pair{i + nb, n});
+                her2k(Uplo::Lower, Op::NoTrans, -one, V, W2, rone, A2);
+
+                // Copy subdiagonal elements back into A
+                for (idx_t j = i; j < i + nb; ++j)
+                    A(j + 1, j) = e[j];
+            }
+
+            // Use unblocked code to reduce the last or only block
+            auto A0 = slice(A, pair{i, n}, pair{i, n});
+            auto tau0 = slice(tau, (i < n - 1) ? pair{i, n - 1} : pair{0, 0});
+            hetd2(uplo, A0, tau0);
+        }
+
+        return 0;
+    }
+
+} // lapack
+
+#endif // __TLAPACK_HETRD_HH__
@@ -0,0 +1,160 @@
+/// @file labrd.hpp
+/// Adapted from @see https://github.com/Reference-LAPACK/lapack/tree/master/SRC/zlabrd.f
+//
+// Copyright (c) 2022, University of Colorado Denver. All rights reserved.
+//
+// This file is part of <T>LAPACK.
+// <T>LAPACK is free software: you can redistribute it and/or modify it under
+// the terms of the BSD 3-Clause license. See the accompanying LICENSE file.
+
+#ifndef __TLAPACK_LABRD_HH__
+#define __TLAPACK_LABRD_HH__
+
+#include "base/utils.hpp"
+#include "base/profile.hpp"
+#include "base/types.hpp"
+#include "lapack/larfg.hpp"
+#include "blas/gemv.hpp"
+#include "blas/scal.hpp"
+
+namespace tlapack {
+
+/** Reduces the first nb rows and columns of a general m-by-n matrix A,
+ * m >= n, to real upper bidiagonal form by a unitary transformation
+ * $Q^H A P$, and returns the matrices X and Y which are needed to apply the
+ * transformation to the unreduced part of A.
+ *
+ * The update of the unreduced part of A has the form
+ * \[
+ *      A := A - V Y^H - X U^H,
+ * \]
+ * where V and U hold the elementary reflectors that define Q and P. See
+ * gebd2 for the representation of the reflectors.
+ *
+ * @return  0 if success
+ *
+ * @param[in,out] A m-by-n matrix, m >= n.
+ *      On exit, the first nb rows and columns of A contain the elementary
+ *      reflectors, as in gebd2, with the exception that the diagonal and
+ *      superdiagonal elements of B are stored in d and e and replaced by 1
+ *      in A.
+ * @param[out] d Vector of length nb.
+ *      The diagonal elements of the reduced part of B.
+ * @param[out] e Vector of length nb.
+ *      The superdiagonal elements of the reduced part of B.
+ * @param[out] tauq Vector of length nb.
+ *      The scalar factors of the elementary reflectors which represent Q.
+ * @param[out] taup Vector of length nb.
+ *      The scalar factors of the elementary reflectors which represent P.
+ * @param[out] X m-by-nb matrix.
+ * @param[out] Y n-by-nb matrix.
+ *
+ * @ingroup gesvd_computational
+ */
+template< class matrix_t, class vectorD_t, class vectorE_t,
+          class vectorQ_t, class vectorP_t, class matrixX_t, class matrixY_t >
+int labrd( matrix_t& A, vectorD_t& d, vectorE_t& e,
+           vectorQ_t& tauq, vectorP_t& taup, matrixX_t& X, matrixY_t& Y )
+{
+    using TA    = type_t< matrix_t >;
+    using idx_t = size_type< matrix_t >;
+    using pair  = pair<idx_t,idx_t>;
+
+    // constants
+    const TA one(1);
+    const TA zero(0);
+    const idx_t m = nrows(A);
+    const idx_t n = ncols(A);
+    const idx_t nb = ncols(X);
+
+    TLAPACK_PROFILE_SCOPE( "labrd", type_t<matrix_t>, 4.0*nb*(m*n - 0.5*(m+n)*nb), double(m)*n + double(m+n)*nb );
+
+    // quick return
+    if (n <= 0) return 0;
+
+    for( idx_t i = 0; i < nb; ++i ) {
+
+        // Update A(i:m,i)
+        auto a = slice( A, pair{i,m}, i );
+        if( i > 0 ) {
+            auto A1 = slice( A, pair{i,m}, pair{0,i} );
+            auto X1 = slice( X, pair{i,m}, pair{0,i} );
+            auto yi = slice( Y, i, pair{0,i} );
+            auto ai = slice( A, pair{0,i}, i );
+
+            for( idx_t j = 0; j < i; ++j )
+                yi[j] = conj( yi[j] );
+            gemv( Op::NoTrans, -one, A1, yi, one, a );
+            for( idx_t j = 0; j < i; ++j )
+                yi[j] = conj( yi[j] );
+            gemv( Op::NoTrans, -one, X1, ai, one, a );
+        }
+
+        // Generate H_i to annihilate A(i+1:m,i)
+        larfg( a, tauq[i] );
+        d[i] = real( a[0] );
+
+        if( i < n-1 ) {
+
+            a[0] = one;
+
+            // Compute Y(i+1:n,i)
+            auto y = slice( Y, pair{i+1,n}, i );
+            gemv( Op::ConjTrans, one, slice( A, pair{i,m}, pair{i+1,n} ), a, zero, y );
+            if( i > 0 ) {
+                auto y0 = slice( Y, pair{0,i}, i );
+                gemv( Op::ConjTrans, one, slice( A, pair{i,m}, pair{0,i} ), a, zero, y0 );
+                gemv( Op::NoTrans, -one, slice( Y, pair{i+1,n}, pair{0,i} ), y0, one, y );
+                gemv( Op::ConjTrans, one, slice( X, pair{i,m}, pair{0,i} ), a, zero, y0 );
+                gemv( Op::ConjTrans, -one, slice( A, pair{0,i}, pair{i+1,n} ), y0, one, y );
+            }
+            scal( tauq[i], y );
+
+            // Update A(i,i+1:n)
+            auto u = slice( A, i, pair{i+1,n} );
+            auto ar = slice( A, i, pair{0,i+1} );
+            for( idx_t j = 0; j < n-i-1; ++j )
+                u[j] = conj( u[j] );
+            for( idx_t j = 0; j <= i; ++j )
+                ar[j] = conj( ar[j] );
+            gemv( Op::NoTrans, -one, slice( Y, pair{i+1,n}, pair{0,i+1} ), ar, one, u );
+            for( idx_t j = 0; j <= i; ++j )
+                ar[j] = conj( ar[j] );
+            if( i > 0 ) {
+                auto xi = slice( X, i, pair{0,i} );
+                for( idx_t j = 0; j < i; ++j )
+                    xi[j] = conj( xi[j] );
+                gemv( Op::ConjTrans, -one, slice( A, pair{0,i}, pair{i+1,n} ), xi, one, u );
+                for( idx_t j = 0; j < i; ++j )
+                    xi[j] = conj( xi[j] );
+            }
+
+            // Generate G_i to annihilate A(i,i+2:n)
+            larfg( u, taup[i] );
+            e[i] = real( u[0] );
+            u[0] = one;
+
+            // Compute X(i+1:m,i)
+            auto x = slice( X, pair{i+1,m}, i );
+            auto x0 = slice( X, pair{0,i+1}, i );
+            gemv( Op::NoTrans, one, slice( A, pair{i+1,m}, pair{i+1,n} ), u, zero, x );
+            gemv( Op::ConjTrans, one, slice( Y, pair{i+1,n}, pair{0,i+1} ), u, zero, x0 );
+            gemv( Op::NoTrans, -one, slice( A, pair{i+1,m}, pair{0,i+1} ), x0, one, x );
+            if( i > 0 ) {
+                auto x1 = slice( X, pair{0,i}, i );
+                gemv( Op::NoTrans, one, slice( A, pair{0,i}, pair{i+1,n} ), u, zero, x1 );
+                gemv( Op::NoTrans, -one, slice( X, pair{i+1,m}, pair{0,i} ), x1, one, x );
+            }
+            scal( taup[i], x );
+
+            for( idx_t j = 0; j < n-i-1; ++j )
+                u[j] = conj( u[j] );
+        }
+    }
+
+    return 0;
+}
+
+} // lapack
+
+#endif // __TLAPACK_LABRD_HH__
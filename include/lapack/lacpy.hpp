@@ -12,6 +12,7 @@
 #define __TLAPACK_LACPY_HH__
 
 #include "base/types.hpp"
+#include "base/profile.hpp"
 
 namespace tlapack {
 
@@ -41,6 +42,8 @@ void lacpy( uplo_t uplo, const matrixA_t& A, matrixB_t& B )
     const idx_t m = nrows(A);
     const idx_t n = ncols(A);
 
+    TLAPACK_PROFILE_SCOPE( "lacpy", type_t<matrixB_t>, 0, 2.0*m*n );
+
     // check arguments
     tlapack_check_false(  uplo != Uplo::Lower &&
                     uplo != Uplo::Upper &&
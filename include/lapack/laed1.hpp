@@ -0,0 +1,269 @@
+/// @file laed1.hpp
+/// Adapted from @see https://github.com/Reference-LAPACK/lapack/tree/master/SRC/dlaed1.f
+//
+// Copyright (c) 2022, University of Colorado Denver. All rights reserved.
+//
+// This file is part of <T>LAPACK.
+// <T>LAPACK is free software: you can redistribute it and/or modify it under
+// the terms of the BSD 3-Clause license. See the accompanying LICENSE file.
+
+#ifndef __TLAPACK_LAED1_HH__
+#define __TLAPACK_LAED1_HH__
+
+#include <algorithm>
+
+#include "legacy_api/base/utils.hpp"
+#include "base/utils.hpp"
+#include "base/profile.hpp"
+#include "base/types.hpp"
+#include "base/parallel.hpp"
+#include "lapack/lapy2.hpp"
+#include "lapack/laed4.hpp"
+#include "blas/rot.hpp"
+#include "blas/gemm.hpp"
+
+namespace tlapack {
+
+/** Merges the eigensystems of two halves of a symmetric tridiagonal matrix
+ * which was split by a rank-one tear (the merge step of the divide and
+ * conquer method).
+ *
+ * On entry,
+ * \[
+ *      T = Q ( D + rho v v^T ) Q^T,
+ * \]
+ * where Q = diag(Q1, Q2) is orthogonal, D = diag(D1, D2) and
+ * v = [ e_{n1-1} ; e_0 ] selects the last row of Q1 and the first row of
+ * Q2. On exit, d and Q hold the eigendecomposition of T.
+ *
+ * The eigenvalues of the rank-one modification which are sufficiently close
+ * to an eigenvalue of D, or whose component of z = Q^T v is negligible, are
+ * deflated. The remaining ones are computed by laed4, and the vector z is
+ * recomputed from them (Gu and Eisenstat) so that the eigenvectors are
+ * numerically orthogonal.
+ *
+ * @return  0 if success
+ * @return  1 if laed4 failed to converge.
+ *
+ * @param[in,out] d Real vector of length n.
+ *      On entry, the eigenvalues of the two halves, each half in ascending
+ *      order. On exit, the eigenvalues of T in ascending order.
+ * @param[in,out] Q n-by-n real matrix.
+ *      On entry, diag(Q1, Q2), the eigenvectors of the two halves.
+ *      On exit, the eigenvectors of T.
+ * @param[in] rho Real scalar.
+ *      The off-diagonal element of T where the matrix was torn.
+ * @param[in] n1 integer. 0 < n1 < n.
+ *      The size of the first half.
+ * @param work Real array of length 2*n*n + 5*n.
+ * @param iwork Integer array of length 3*n.
+ * @param[in] parallel bool.
+ *      If true, the roots of the secular equation and the update of the
+ *      eigenvectors are computed by OpenMP tasks. Has no effect if
+ *      <T>LAPACK is not compiled with OpenMP.
+ *
+ * @ingroup heev_computational
+ */
+template< class vector_t, class matrix_t, class real_t = type_t< matrix_t > >
+int laed1(
+    vector_t& d, matrix_t& Q, real_t rho,
+    size_type< matrix_t > n1, real_t* work, size_type< matrix_t >* iwork,
+    bool parallel = false )
+{
+    using idx_t = size_type< matrix_t >;
+    using pair  = pair<idx_t,idx_t>;
+
+    // constants
+    const real_t zero(0);
+    const real_t one(1);
+    const real_t two(2);
+    const real_t eight(8);
+    const idx_t n = size(d);
+    const real_t eps = ulp<real_t>();
+
+    TLAPACK_PROFILE_SCOPE( "laed1", real_t, 0, double(n)*n + 2.0*n );
+
+    // Workspace
+    auto Qp = legacyMatrix<real_t, layout<matrix_t>>( n, n, &work[0], n );
+    real_t* U_ptr = &work[n*n];
+    auto ds = legacyVector<real_t>( n, &work[2*n*n] );
+    auto zs = legacyVector<real_t>( n, &work[2*n*n+n] );
+
+    // Form z = Q^T v / sqrt(2) and the modification 2 |rho|
+    const real_t sgn = ( rho >= zero ) ? one : -one;
+    const real_t s2 = one / sqrt( two );
+    rho = two * abs( rho );
+
+    // Sort the eigenvalues of the two halves
+    idx_t* perm = &iwork[0];
+    for( idx_t j = 0; j < n; ++j )
+        perm[j] = j;
+    std::merge( perm, perm + n1, perm + n1, perm + n, &iwork[n],
+        [&d]( idx_t a, idx_t b ) { return d[a] < d[b]; } );
+    std::copy( &iwork[n], &iwork[2*n], perm );
+    for( idx_t k = 0; k < n; ++k ) {
+        const idx_t j = perm[k];
+        ds[k] = d[j];
+        zs[k] = ( j < n1 ) ? s2 * Q(n1-1,j) : sgn * s2 * Q(n1,j);
+        for( idx_t i = 0; i < n; ++i )
+            Qp(i,k) = Q(i,j);
+    }
+
+    // Deflation tolerance
+    real_t dmax = zero, zmax = zero;
+    for( idx_t k = 0; k < n; ++k ) {
+        dmax = std::max( dmax, abs(ds[k]) );
+        zmax = std::max( zmax, abs(zs[k]) );
+    }
+    const real_t tol = eight * eps * std::max( dmax, zmax );
+
+    // Deflate eigenvalues whose z component is negligible, and pairs of
+    // eigenvalues which are close to each other
+    idx_t* nondefl = &iwork[n];
+    idx_t* defl = &iwork[2*n];
+    idx_t k = 0, kd = 0;
+    if( rho * zmax > tol ) {
+        idx_t pj = n;
+        for( idx_t j = 0; j < n; ++j ) {
+            if( rho * abs( zs[j] ) <= tol ) {
+                defl[kd++] = j;
+                continue;
+            }
+            if( pj == n ) {
+                pj = j;
+                continue;
+            }
+            real_t s = zs[pj];
+            real_t c = zs[j];
+            const real_t tau = lapy2( c, s );
+            const real_t t = ds[j] - ds[pj];
+            c /= tau;
+            s = -s / tau;
+            if( abs( t * c * s ) <= tol ) {
+                // Rotate z[pj] into z[j] and deflate pj
+                zs[j] = tau;
+                zs[pj] = zero;
+                auto qpj = slice( Qp, pair{0,n}, pj );
+                auto qj  = slice( Qp, pair{0,n}, j );
+                rot( qpj, qj, c, s );
+                const real_t dpj = ds[pj] * c * c + ds[j] * s * s;
+                ds[j] = ds[pj] * s * s + ds[j] * c * c;
+                ds[pj] = dpj;
+                defl[kd++] = pj;
+            }
+            else
+                nondefl[k++] = pj;
+            pj = j;
+        }
+        if( pj < n )
+            nondefl[k++] = pj;
+    }
+    else {
+        for( idx_t j = 0; j < n; ++j )
+            defl[kd++] = j;
+    }
+
+    // Q := [ Qp(:,nondefl), Qp(:,defl) ]
+    for( idx_t j = 0; j < n; ++j ) {
+        const idx_t jj = ( j < k ) ? nondefl[j] : defl[j-k];
+        for( idx_t i = 0; i < n; ++i )
+            Q(i,j) = Qp(i,jj);
+    }
+
+    // Compute the eigenvalues and eigenvectors of D + rho z z^T restricted
+    // to the non-deflated part
+    auto lambda = legacyVector<real_t>( n, &work[2*n*n+2*n] );
+    int info = 0;
+    if( k > 0 ) {
+
+        auto dl = legacyVector<real_t>( k, &work[2*n*n+3*n] );
+        auto zl = legacyVector<real_t>( k, &work[2*n*n+4*n] );
+        auto U  = legacyMatrix<real_t, layout<matrix_t>>( k, k, U_ptr, k );
+        for( idx_t j = 0; j < k; ++j ) {
+            dl[j] = ds[ nondefl[j] ];
+            zl[j] = zs[ nondefl[j] ];
+        }
+
+        if( k == 1 ) {
+            lambda[0] = dl[0] + rho * zl[0] * zl[0];
+            U(0,0) = one;
+        }
+        else {
+            // U(j,i) = dl[j] - lambda[i]
+            TLAPACK_OMP(taskloop if(parallel) shared(info))
+            for( idx_t i = 0; i < k; ++i ) {
+                auto delta = slice( U, pair{0,k}, i );
+                if( laed4( i, dl, zl, rho, delta, lambda[i] ) != 0 ) {
+                    TLAPACK_OMP(atomic write)
+                    info = 1;
+                }
+            }
+
+            // Recompute z from the computed eigenvalues
+            TLAPACK_OMP(taskloop if(parallel))
+            for( idx_t j = 0; j < k; ++j ) {
+                real_t w = U(j,j);
+                for( idx_t i = 0; i < k; ++i )
+                    if( i != j )
+                        w *= U(j,i) / ( dl[j] - dl[i] );
+                const real_t zj = sqrt( abs( w ) );
+                zl[j] = ( zl[j] >= zero ) ? zj : -zj;
+            }
+
+            // Eigenvectors of D + rho z z^T
+            TLAPACK_OMP(taskloop if(parallel))
+            for( idx_t i = 0; i < k; ++i ) {
+                real_t nrm = zero;
+                for( idx_t j = 0; j < k; ++j ) {
+                    U(j,i) = zl[j] / U(j,i);
+                    nrm += U(j,i) * U(j,i);
+                }
+                nrm = one / sqrt( nrm );
+                for( idx_t j = 0; j < k; ++j )
+                    U(j,i) *= nrm;
+            }
+        }
+
+        // Qp(:,0:k) := Q(:,0:k) U
+        const auto Q1 = slice( Q, pair{0,n}, pair{0,k} );
+        const idx_t nblocks = ( parallel )
+            ? std::max<idx_t>( 1, std::min<idx_t>( get_num_threads(), k / 32 ) )
+            : 1;
+        const idx_t cb = ( k + nblocks - 1 ) / nblocks;
+        TLAPACK_OMP(taskloop grainsize(1) if(nblocks > 1))
+        for( idx_t ib = 0; ib < nblocks; ++ib ) {
+            const idx_t c0 = std::min( ib * cb, k );
+            const idx_t c1 = std::min( c0 + cb, k );
+            if( c0 < c1 ) {
+                const auto Ub = slice( U, pair{0,k}, pair{c0,c1} );
+                auto Qb = slice( Qp, pair{0,n}, pair{c0,c1} );
+                gemm( Op::NoTrans, Op::NoTrans, one, Q1, Ub, zero, Qb );
+            }
+        }
+    }
+
+    // Deflated eigenpairs
+    for( idx_t j = k; j < n; ++j ) {
+        lambda[j] = ds[ defl[j-k] ];
+        for( idx_t i = 0; i < n; ++i )
+            Qp(i,j) = Q(i,j);
+    }
+
+    // Sort the eigenvalues and copy the eigenvectors back to Q
+    for( idx_t j = 0; j < n; ++j )
+        perm[j] = j;
+    std::sort( perm, perm + n,
+        [&lambda]( idx_t a, idx_t b ) { return lambda[a] < lambda[b]; } );
+    for( idx_t j = 0; j < n; ++j ) {
+        const idx_t jj = perm[j];
+        d[j] = lambda[jj];
+        for( idx_t i = 0; i < n; ++i )
+            Q(i,j) = Qp(i,jj);
+    }
+
+    return info;
+}
+
+} // lapack
+
+#endif // __TLAPACK_LAED1_HH__
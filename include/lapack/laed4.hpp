@@ -0,0 +1,157 @@
+/// @file laed4.hpp
+/// Adapted from @see https://github.com/Reference-LAPACK/lapack/tree/master/SRC/dlaed4.f
+//
+// Copyright (c) 2022, University of Colorado Denver. All rights reserved.
+//
+// This file is part of <T>LAPACK.
+// <T>LAPACK is free software: you can redistribute it and/or modify it under
+// the terms of the BSD 3-Clause license. See the accompanying LICENSE file.
+
+#ifndef __TLAPACK_LAED4_HH__
+#define __TLAPACK_LAED4_HH__
+
+#include "base/utils.hpp"
+#include "base/profile.hpp"
+#include "base/types.hpp"
+
+namespace tlapack {
+
+/** Computes the i-th eigenvalue of the rank-one modification of a diagonal
+ * matrix
+ * \[
+ *      D + rho z z^T,
+ * \]
+ * i.e., the i-th root of the secular equation
+ * \[
+ *      f(lambda) = 1 + rho sum_j z_j^2 / (d_j - lambda) = 0.
+ * \]
+ *
+ * The root is computed relative to the closest pole d_org, which is either
+ * d_i or d_{i+1}, so that the differences d_j - lambda are obtained to high
+ * relative accuracy. Each iteration uses the rational model
+ * \[
+ *      f(d_org + tau) ~ a + b / (-tau),
+ * \]
+ * which interpolates f and its derivative at the current iterate, and falls
+ * back to bisection when the new iterate leaves the bracket of the root.
+ *
+ * @return  0 if success
+ * @return  1 if the iteration did not converge.
+ *
+ * @param[in] i integer.
+ *      The index of the eigenvalue to be computed. 0 <= i < k.
+ * @param[in] d Real vector of length k.
+ *      The original eigenvalues. It is assumed that they are in order,
+ *      d[j] < d[j+1].
+ * @param[in] z Real vector of length k.
+ *      The components of the updating vector.
+ * @param[in] rho Real scalar. rho > 0.
+ * @param[out] delta Real vector of length k.
+ *      delta[j] = d[j] - lambda.
+ * @param[out] lambda Real scalar.
+ *      The computed eigenvalue.
+ *
+ * @ingroup heev_computational
+ */
+template< class vectorD_t, class vectorZ_t, class vectorDelta_t, class real_t >
+int laed4(
+    size_type< vectorD_t > i,
+    const vectorD_t& d, const vectorZ_t& z, const real_t& rho,
+    vectorDelta_t& delta, real_t& lambda )
+{
+    using idx_t = size_type< vectorD_t >;
+
+    // constants
+    const real_t zero(0);
+    const real_t one(1);
+    const real_t half(0.5);
+    const idx_t k = size(d);
+    const real_t eps = ulp<real_t>();
+    const idx_t maxit = 256;
+
+    TLAPACK_PROFILE_SCOPE( "laed4", real_t, 0, 3.0*k );
+
+    // The case of a single pole
+    if( k == 1 ) {
+        lambda = d[0] + rho * z[0] * z[0];
+        delta[0] = - rho * z[0] * z[0];
+        return 0;
+    }
+
+    // Choose the origin and the initial bracket for tau = lambda - d[org]
+    idx_t org;
+    real_t lo, hi;
+    if( i < k-1 ) {
+        const real_t mid = half * ( d[i+1] - d[i] );
+        real_t f = one;
+        for( idx_t j = 0; j < k; ++j )
+            f += rho * z[j] * ( z[j] / ( ( d[j] - d[i] ) - mid ) );
+        if( f >= zero ) {
+            org = i;
+            lo = zero;
+            hi = mid;
+        }
+        else {
+            org = i+1;
+            lo = -mid;
+            hi = zero;
+        }
+    }
+    else {
+        real_t znorm2 = zero;
+        for( idx_t j = 0; j < k; ++j )
+            znorm2 += z[j] * z[j];
+        org = k-1;
+        lo = zero;
+        hi = rho * znorm2;
+    }
+
+    // delta[j] holds d[j] - d[org] during the iteration
+    const real_t dorg = d[org];
+    for( idx_t j = 0; j < k; ++j )
+        delta[j] = d[j] - dorg;
+
+    int info = 1;
+    real_t tau = half * ( lo + hi );
+    for( idx_t iter = 0; iter < maxit; ++iter ) {
+
+        // Evaluate f and f' at tau
+        real_t f = one;
+        real_t df = zero;
+        for( idx_t j = 0; j < k; ++j ) {
+            const real_t t = z[j] / ( delta[j] - tau );
+            f  += rho * z[j] * t;
+            df += rho * t * t;
+        }
+
+        if( f == zero ) { info = 0; break; }
+        if( f < zero ) lo = tau;
+        else           hi = tau;
+
+        if( hi - lo <= eps * std::max( abs(lo), abs(hi) ) ) { info = 0; break; }
+
+        // Root of the rational model a + b / (-tau) with b = f' tau^2
+        // and a = f + f' tau
+        const real_t a = f + df * tau;
+        real_t tnew = ( a != zero ) ? ( df * tau ) * ( tau / a ) : lo;
+        if( !( tnew > lo && tnew < hi ) )
+            tnew = half * ( lo + hi );
+
+        if( abs( tnew - tau ) <= eps * abs( tnew ) ) {
+            tau = tnew;
+            info = 0;
+            break;
+        }
+        tau = tnew;
+    }
+
+    for( idx_t j = 0; j < k; ++j )
+        delta[j] -= tau;
+    lambda = dorg + tau;
+
+    return info;
+}
+
+} // lapack
+
+#endif // __TLAPACK_LAED4_HH__
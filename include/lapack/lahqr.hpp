@@ -13,9 +13,10 @@
 
 #include <complex>
 #include <iostream>
-#include <vector>
 
+#include "legacy_api/base/utils.hpp"
 #include "base/utils.hpp"
+#include "base/profile.hpp"
 #include "base/types.hpp"
 #include "lapack/larfg.hpp"
 #include "lapack/larf.hpp"
@@ -95,6 +96,8 @@ namespace tlapack
         const idx_t n = ncols(A);
         const idx_t nh = ihi - ilo;
 
+        TLAPACK_PROFILE_SCOPE( "lahqr", TA, 0, double(n)*n*((want_z) ? 2 : 1) );
+
         // check arguments
         tlapack_check_false(n != nrows(A), -5);
         tlapack_check_false((idx_t)size(w) != n, -6);
@@ -180,7 +183,7 @@ namespace tlapack
                     {
                         tst = tst + abs(A(i - 1, i - 2));
                     }
-                    if (i < ihi)
+                    if (i + 1 < ihi)
                     {
                         tst = tst + abs(A(i + 1, i));
                     }
@@ -296,7 +299,8 @@ namespace tlapack
             // If it has split, we can introduce any shift at the top of the new subblock.
             // Now that we know the specific shift, we can also check whether we can introduce that shift
             // somewhere else in the subblock.
-            std::vector<TA> v(3);
+            TA v_[3];
+            auto v = legacyVector<TA>(3, &v_[0]);
             TA t1;
             auto istart2 = istart;
             if (istart + 3 < istop)
@@ -489,6 +493,8 @@ namespace tlapack
         const idx_t n = ncols(A);
         const idx_t nh = ihi - ilo;
 
+        TLAPACK_PROFILE_SCOPE( "lahqr", TA, 0, double(n)*n*((want_z) ? 2 : 1) );
+
         // check arguments
         tlapack_check_false(n != nrows(A), -5);
         tlapack_check_false((idx_t)size(w) != n, -6);
@@ -569,7 +575,7 @@ namespace tlapack
                     {
                         tst = tst + abs(A(i - 1, i - 2));
                     }
-                    if (i < ihi)
+                    if (i + 1 < ihi)
                     {
                         tst = tst + abs(A(i + 1, i));
                     }
@@ -10,7 +10,9 @@
 #define __TLAPACK_LAHR2_HH__
 
 #include "base/utils.hpp"
+#include "base/profile.hpp"
 #include "base/types.hpp"
+#include "base/parallel.hpp"
 #include "lapack/larfg.hpp"
 #include "lapack/larf.hpp"
 #include "blas/gemv.hpp"
@@ -44,11 +46,15 @@ namespace tlapack
      *      The scalar factors of the elementary reflectors.
      * @param[in,out] T nb-by-nb matrix.
      * @param[in,out] Y n-by-nb matrix.
+     * @param[in] parallel bool.
+     *      If true, the products with the trailing matrix A(k+1:n,i+1:n-k)
+     *      are split by blocks of rows into OpenMP tasks. Has no effect if
+     *      <T>LAPACK is not compiled with OpenMP.
      *
      * @ingroup gehrd
      */
     template <class matrix_t, class vector_t, class T_t, class Y_t>
-    int lahr2(size_type<matrix_t> k, size_type<matrix_t> nb, matrix_t &A, vector_t &tau, T_t &T, Y_t &Y)
+    int lahr2(size_type<matrix_t> k, size_type<matrix_t> nb, matrix_t &A, vector_t &tau, T_t &T, Y_t &Y, bool parallel = false)
     {
         using TA = type_t<matrix_t>;
         using idx_t = size_type<matrix_t>;
@@ -60,6 +66,8 @@ namespace tlapack
         const TA zero(0);
         const idx_t n = nrows(A);
 
+        TLAPACK_PROFILE_SCOPE( "lahr2", type_t<matrix_t>, 2.0*n*nb*(n-k) + 2.0*n*nb*nb, double(n)*(n-k) + 2.0*n*nb );
+
         // quick return if possible
         if (n <= 1)
             return 0;
@@ -140,7 +148,27 @@ namespace tlapack
             //
             auto A2 = slice(A, pair{k + 1, n}, pair{i + 1, n - k});
             auto y = slice(Y, pair{k + 1, n}, i);
-            gemv(Op::NoTrans, one, A2, v, zero, y);
+            if (parallel)
+            {
+                // Row-parallel gemv. Each task owns a block of rows of A2 and y
+                const idx_t m2 = nrows(A2);
+                const idx_t nblocks = std::max<idx_t>(1, std::min<idx_t>(get_num_threads(), m2 / 32));
+                const idx_t rb = (m2 + nblocks - 1) / nblocks;
+                TLAPACK_OMP(taskloop grainsize(1) if(nblocks > 1))
+                for (idx_t ib = 0; ib < nblocks; ++ib)
+                {
+                    const idx_t r0 = std::min(ib * rb, m2);
+                    const idx_t r1 = std::min(r0 + rb, m2);
+                    if (r0 < r1)
+                    {
+                        auto A2_r = slice(A2, pair{r0, r1}, pair{0, ncols(A2)});
+                        auto y_r = slice(y, pair{r0, r1});
+                        gemv(Op::NoTrans, one, A2_r, v, zero, y_r);
+                    }
+                }
+            }
+            else
+                gemv(Op::NoTrans, one, A2, v, zero, y);
             auto t = slice(T, pair{0, i}, i);
             auto A3 = slice(A, pair{k + i + 1, n}, pair{0, i});
             gemv(Op::ConjTrans, one, A3, v, zero, t);
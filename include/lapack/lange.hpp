@@ -12,6 +12,7 @@
 #define __TLAPACK_LANGE_HH__
 
 #include "base/types.hpp"
+#include "base/profile.hpp"
 #include "lapack/lassq.hpp"
 
 namespace tlapack {
@@ -44,6 +45,8 @@ lange( norm_t normType, const matrix_t& A )
     const idx_t m = nrows(A);
     const idx_t n = ncols(A);
 
+    TLAPACK_PROFILE_SCOPE( "lange", type_t<matrix_t>, double(m)*n, double(m)*n );
+
     // check arguments
     tlapack_check_false(  normType != Norm::Fro &&
                     normType != Norm::Inf &&
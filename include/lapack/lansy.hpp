@@ -12,6 +12,7 @@
 #define __TLAPACK_LANSY_HH__
 
 #include "base/types.hpp"
+#include "base/profile.hpp"
 #include "lapack/lassq.hpp"
 
 namespace tlapack {
@@ -48,6 +49,8 @@ lansy( norm_t normType, uplo_t uplo, const matrix_t& A )
     // constants
     const idx_t n = nrows(A);
 
+    TLAPACK_PROFILE_SCOPE( "lansy", type_t<matrix_t>, 0.5*n*(n+1), 0.5*n*(n+1) );
+
     // check arguments
     tlapack_check_false(  normType != Norm::Fro &&
                     normType != Norm::Inf &&
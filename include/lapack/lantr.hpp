@@ -12,6 +12,7 @@
 #define __TLAPACK_LANTR_HH__
 
 #include "base/types.hpp"
+#include "base/profile.hpp"
 #include "lapack/lassq.hpp"
 
 namespace tlapack {
@@ -54,6 +55,8 @@ lantr( norm_t normType, uplo_t uplo, diag_t diag, const matrix_t& A )
     const idx_t m = nrows(A);
     const idx_t n = ncols(A);
 
+    TLAPACK_PROFILE_SCOPE( "lantr", type_t<matrix_t>, 0.5*m*n, 0.5*m*n );
+
     // check arguments
     tlapack_check_false(  normType != Norm::Fro &&
                     normType != Norm::Inf &&
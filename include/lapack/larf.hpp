@@ -12,6 +12,7 @@
 #define __TLAPACK_LARF_HH__
 
 #include "base/utils.hpp"
+#include "base/profile.hpp"
 
 #include "tblas.hpp"
 
@@ -63,6 +64,8 @@ inline void larf(
     const idx_t m = nrows(C);
     const idx_t n = ncols(C);
 
+    TLAPACK_PROFILE_SCOPE( "larf", T, 4.0*m*n, 2.0*m*n + m + n );
+
     // check arguments
     tlapack_check_false( side != Side::Left &&
                    side != Side::Right );
@@ -12,12 +12,52 @@
 #define __TLAPACK_LARFB_HH__
 
 #include "base/utils.hpp"
+#include "base/profile.hpp"
 #include "base/types.hpp"
 #include "lapack/lacpy.hpp"
 #include "tblas.hpp"
 
 namespace tlapack {
 
+/**
+ * Returns the size of the workspace matrix of larfb,
+ * which is k-by-n if side = Side::Left, and m-by-k if side = Side::Right.
+ * The arguments are the same as for larfb itself.
+ * 
+ * @return idx_t The number of elements of the required workspace
+ */
+template<
+    class matrixV_t, class matrixT_t, class matrixC_t,
+    class side_t, class trans_t, class direction_t, class storage_t >
+inline size_type< matrixC_t >
+get_work_larfb(
+    side_t side, trans_t trans,
+    direction_t direction, storage_t storeMode,
+    const matrixV_t& V, const matrixT_t& T,
+    const matrixC_t& C )
+{
+    const size_type< matrixC_t > k = nrows(T);
+    return ( side == Side::Left ) ? k * ncols(C) : nrows(C) * k;
+}
+
+/**
+ * Returns the size in bytes of the workspace matrix of larfb.
+ * The arguments are the same as for larfb itself.
+ */
+template<
+    class matrixV_t, class matrixT_t, class matrixC_t,
+    class side_t, class trans_t, class direction_t, class storage_t >
+inline std::size_t
+get_worksize_larfb(
+    side_t side, trans_t trans,
+    direction_t direction, storage_t storeMode,
+    const matrixV_t& V, const matrixT_t& T,
+    const matrixC_t& C )
+{
+    return get_work_larfb( side, trans, direction, storeMode, V, T, C )
+        * sizeof( type_t< matrixC_t > );
+}
+
 /** Applies a block reflector $H$ or its conjugate transpose $H^H$ to a
  * m-by-n matrix C, from either the left or the right.
  * 
@@ -113,6 +153,8 @@ int larfb(
     const idx_t n = ncols(C);
     const idx_t k = nrows(T);
 
+    TLAPACK_PROFILE_SCOPE( "larfb", type_t<matrixC_t>, 4.0*m*n*k, 2.0*m*n + double((side == Side::Left) ? m : n)*k + double(k)*k );
+
     // check arguments
     tlapack_check_false(    side != Side::Left &&
                         side != Side::Right, -1 );
@@ -15,6 +15,7 @@
 #include "lapack/lapy2.hpp"
 #include "lapack/lapy3.hpp"
 #include "base/utils.hpp"
+#include "base/profile.hpp"
 
 #include "tblas.hpp"
 
@@ -70,6 +71,8 @@ void larfg( alpha_t& alpha, vector_t& x, tau_t& tau )
     const real_t safemin  = safe_min<real_t>() / uroundoff<real_t>();
     const real_t rsafemin = one / safemin;
 
+    TLAPACK_PROFILE_SCOPE( "larfg", TX, 3.0*n, 2.0*n );
+
     tau = tau_t( 0 );
     if (n > 0)
     {
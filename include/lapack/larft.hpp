@@ -12,6 +12,7 @@
 #define __TLAPACK_LARFT_HH__
 
 #include "base/utils.hpp"
+#include "base/profile.hpp"
 #include "base/types.hpp"
 #include "tblas.hpp"
 
@@ -100,6 +101,8 @@ int larft(
     const idx_t n = (storeMode == StoreV::Columnwise) ? nrows( V ) : ncols( V );
     const idx_t k = size( tau );
 
+    TLAPACK_PROFILE_SCOPE( "larft", scalar_t, double(n)*k*k, double(n)*k + double(k)*k );
+
     // check arguments
     tlapack_check_false(    direction != Direction::Backward &&
                         direction != Direction::Forward, -1 );
@@ -13,6 +13,7 @@
 
 #include <random>
 #include "base/types.hpp"
+#include "base/profile.hpp"
 
 namespace tlapack {
 
@@ -52,10 +53,12 @@ void larnv( Sseq& iseed, vector_t& x )
     const real_t eight = 8.0;
     const real_t twopi = eight * atan(one);
 
-    // Initialize the Mersenne Twister generator
-    std::random_device device;
-    std::mt19937 generator(device());
-    generator.seed(iseed);
+    TLAPACK_PROFILE_SCOPE( "larnv", T, 0, n );
+
+    // Initialize the Mersenne Twister generator. The state is a local
+    // object seeded from iseed, so no entropy source is opened and no memory
+    // is allocated.
+    std::mt19937 generator(iseed);
 
     if (idist == 1) {
         std::uniform_real_distribution<real_t> d1(0, 1);
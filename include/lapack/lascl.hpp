@@ -12,6 +12,7 @@
 #define __TLAPACK_LASCL_HH__
 
 #include "base/utils.hpp"
+#include "base/profile.hpp"
 
 namespace tlapack {
 
@@ -69,6 +70,8 @@ int lascl(
     const idx_t m = nrows(A);
     const idx_t n = ncols(A);
 
+    TLAPACK_PROFILE_SCOPE( "lascl", type_t<matrix_t>, double(m)*n, 2.0*m*n );
+
     // constants
     const real_t small = safe_min<real_t>();
     const real_t big   = safe_max<real_t>();
@@ -12,6 +12,7 @@
 #define __TLAPACK_LASET_HH__
 
 #include "base/types.hpp"
+#include "base/profile.hpp"
 
 namespace tlapack {
 
@@ -49,6 +50,8 @@ void laset(
     const idx_t m = nrows(A);
     const idx_t n = ncols(A);
 
+    TLAPACK_PROFILE_SCOPE( "laset", type_t<matrix_t>, 0, double(m)*n );
+
     // check arguments
     tlapack_check_false(  uplo != Uplo::Lower &&
                     uplo != Uplo::Upper &&
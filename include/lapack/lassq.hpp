@@ -16,6 +16,7 @@
 #define __TLAPACK_LASSQ_HH__
 
 #include "base/utils.hpp"
+#include "base/profile.hpp"
 
 namespace tlapack {
 
@@ -70,6 +71,8 @@ void lassq(
     // constants
     const idx_t n = size(x);
 
+    TLAPACK_PROFILE_SCOPE( "lassq", T, 3.0*n, n );
+
     // constants
     const real_t zero( 0 );
     const real_t one( 1 );
@@ -12,7 +12,6 @@
 #define __TLAPACK_LASY2_HH__
 
 #include <complex>
-#include <memory>
 
 #include "base/utils.hpp"
 #include "base/types.hpp"
@@ -86,13 +85,13 @@ namespace tlapack
         if (n1 == 2 and n2 == 2)
         {
             // 2x2 blocks, build a 4x4 matrix
-            std::unique_ptr<T[]> _btmp(new T[4]);
+            T _btmp[4];
             auto btmp = legacyVector<T>(4, &_btmp[0]);
-            std::unique_ptr<T[]> _tmp(new T[4]);
+            T _tmp[4];
             auto tmp = legacyVector<T>(4, &_tmp[0]);
-            std::unique_ptr<T[]> T16_(new T[16]);
+            T T16_[16];
             auto T16 = colmajor_matrix<T>(&T16_[0], 4, 4);
-            std::unique_ptr<idx_t[]> _jpiv(new idx_t[4]);
+            idx_t _jpiv[4];
             auto jpiv = legacyVector<idx_t>(4, &_jpiv[0]);
 
             auto smin = max( max(abs(TR(0, 0)), abs(TR(0, 1))), max(abs(TR(1, 0)), abs(TR(1, 1))));
@@ -0,0 +1,201 @@
+/// @file latrd.hpp
+/// Adapted from @see https://github.com/Reference-LAPACK/lapack/tree/master/SRC/zlatrd.f
+//
+// Copyright (c) 2022, University of Colorado Denver. All rights reserved.
+//
+// This file is part of <T>LAPACK.
+// <T>LAPACK is free software: you can redistribute it and/or modify it under
+// the terms of the BSD 3-Clause license. See the accompanying LICENSE file.
+
+#ifndef __TLAPACK_LATRD_HH__
+#define __TLAPACK_LATRD_HH__
+
+#include "base/utils.hpp"
+#include "base/profile.hpp"
+#include "base/types.hpp"
+#include "lapack/larfg.hpp"
+#include "blas/hemv.hpp"
+#include "blas/gemv.hpp"
+#include "blas/dot.hpp"
+#include "blas/axpy.hpp"
+#include "blas/scal.hpp"
+
+namespace tlapack {
+
+/** Reduces nb rows and columns of a Hermitian matrix A to real tridiagonal
+ * form by a unitary similarity transformation $Q^H A Q$, and returns the
+ * matrix W which is needed to apply the transformation to the unreduced
+ * part of A.
+ *
+ * If uplo = Uplo::Upper, latrd reduces the last nb rows and columns of a
+ * matrix, of which the upper triangle is supplied;
+ * if uplo = Uplo::Lower, latrd reduces the first nb rows and columns of a
+ * matrix, of which the lower triangle is supplied.
+ *
+ * The update of the unreduced part of A has the form
+ * \[
+ *      A := A - V W^H - W V^H,
+ * \]
+ * where V holds the elementary reflectors. See hetd2 for the
+ * representation of the reflectors.
+ *
+ * @return  0 if success
+ *
+ * @param[in] uplo
+ *      - Uplo::Upper: Upper triangle of A is referenced;
+ *      - Uplo::Lower: Lower triangle of A is referenced.
+ * @param[in,out] A n-by-n Hermitian matrix.
+ *      On exit, the reduced rows and columns contain the tridiagonal
+ *      elements and the elementary reflectors, as in hetd2, with the
+ *      exception that the off-diagonal elements of T are stored in e
+ *      and replaced by 1 in A.
+ * @param[out] e Vector of length n-1.
+ *      The off-diagonal elements of the reduced part of T.
+ * @param[out] tau Vector of length n-1.
+ *      The scalar factors of the elementary reflectors.
+ * @param[out] W n-by-nb matrix.
+ *
+ * @ingroup heev_computational
+ */
+template< class matrix_t, class vector_t, class vectorE_t, class matrixW_t >
+int latrd( Uplo uplo, matrix_t& A, vectorE_t& e, vector_t& tau, matrixW_t& W )
+{
+    using TA    = type_t< matrix_t >;
+    using real_t = real_type< TA >;
+    using idx_t = size_type< matrix_t >;
+    using pair  = pair<idx_t,idx_t>;
+
+    // constants
+    const TA one(1);
+    const TA zero(0);
+    const real_t half(0.5);
+    const idx_t n = nrows(A);
+    const idx_t nb = ncols(W);
+
+    TLAPACK_PROFILE_SCOPE( "latrd", TA, 4.0*n*n*nb, double(n)*n + 2.0*n*nb );
+
+    // quick return
+    if (n <= 0) return 0;
+
+    if( uplo == Uplo::Upper ) {
+
+        // Reduce last nb columns of upper triangle
+        for( idx_t i = n-1; i+1 > n-nb; --i ) {
+
+            const idx_t iw = i - (n-nb);
+
+            if( i < n-1 ) {
+
+                // Update A(0:i+1,i)
+                A(i,i) = real( A(i,i) );
+                auto a = slice( A, pair{0,i+1}, i );
+                auto A2 = slice( A, pair{0,i+1}, pair{i+1,n} );
+                auto W2 = slice( W, pair{0,i+1}, pair{iw+1,nb} );
+                auto wi = slice( W, i, pair{iw+1,nb} );
+                auto ai = slice( A, i, pair{i+1,n} );
+
+                for( idx_t j = 0; j < size(wi); ++j )
+                    wi[j] = conj( wi[j] );
+                gemv( Op::NoTrans, -one, A2, wi, one, a );
+                for( idx_t j = 0; j < size(wi); ++j )
+                    wi[j] = conj( wi[j] );
+
+                for( idx_t j = 0; j < size(ai); ++j )
+                    ai[j] = conj( ai[j] );
+                gemv( Op::NoTrans, -one, W2, ai, one, a );
+                for( idx_t j = 0; j < size(ai); ++j )
+                    ai[j] = conj( ai[j] );
+
+                A(i,i) = real( A(i,i) );
+            }
+
+            if( i > 0 ) {
+
+                // Generate elementary reflector H_{i-1} to annihilate
+                // A(0:i-1,i)
+                TA alpha = A(i-1,i);
+                auto x = slice( A, (i > 1) ? pair{0,i-1} : pair{0,0}, i );
+                larfg( alpha, x, tau[i-1] );
+                e[i-1] = real( alpha );
+                A(i-1,i) = one;
+
+                // Compute W(0:i,iw)
+                auto v = slice( A, pair{0,i}, i );
+                auto w = slice( W, pair{0,i}, iw );
+                hemv( Uplo::Upper, one, slice( A, pair{0,i}, pair{0,i} ), v, zero, w );
+                if( i < n-1 ) {
+                    auto w2 = slice( W, pair{i+1,n}, iw );
+                    auto W1 = slice( W, pair{0,i}, pair{iw+1,nb} );
+                    auto A1 = slice( A, pair{0,i}, pair{i+1,n} );
+                    gemv( Op::ConjTrans, one, W1, v, zero, w2 );
+                    gemv( Op::NoTrans, -one, A1, w2, one, w );
+                    gemv( Op::ConjTrans, one, A1, v, zero, w2 );
+                    gemv( Op::NoTrans, -one, W1, w2, one, w );
+                }
+                scal( tau[i-1], w );
+                const TA beta = -half * tau[i-1] * dot( w, v );
+                axpy( beta, v, w );
+            }
+        }
+    }
+    else {
+
+        // Reduce first nb columns of lower triangle
+        for( idx_t i = 0; i < nb; ++i ) {
+
+            // Update A(i:n,i)
+            A(i,i) = real( A(i,i) );
+            if( i > 0 ) {
+                auto a = slice( A, pair{i,n}, i );
+                auto A2 = slice( A, pair{i,n}, pair{0,i} );
+                auto W2 = slice( W, pair{i,n}, pair{0,i} );
+                auto wi = slice( W, i, pair{0,i} );
+                auto ai = slice( A, i, pair{0,i} );
+
+                for( idx_t j = 0; j < i; ++j )
+                    wi[j] = conj( wi[j] );
+                gemv( Op::NoTrans, -one, A2, wi, one, a );
+                for( idx_t j = 0; j < i; ++j )
+                    wi[j] = conj( wi[j] );
+
+                for( idx_t j = 0; j < i; ++j )
+                    ai[j] = conj( ai[j] );
+                gemv( Op::NoTrans, -one, W2, ai, one, a );
+                for( idx_t j = 0; j < i; ++j )
+                    ai[j] = conj( ai[j] );
+            }
+            A(i,i) = real( A(i,i) );
+
+            if( i < n-1 ) {
+
+                // Generate elementary reflector H_i to annihilate A(i+2:n,i)
+                auto v = slice( A, pair{i+1,n}, i );
+                larfg( v, tau[i] );
+                e[i] = real( v[0] );
+                v[0] = one;
+
+                // Compute W(i+1:n,i)
+                auto w = slice( W, pair{i+1,n}, i );
+                hemv( Uplo::Lower, one, slice( A, pair{i+1,n}, pair{i+1,n} ), v, zero, w );
+                if( i > 0 ) {
+                    auto w2 = slice( W, pair{0,i}, i );
+                    auto W1 = slice( W, pair{i+1,n}, pair{0,i} );
+                    auto A1 = slice( A, pair{i+1,n}, pair{0,i} );
+                    gemv( Op::ConjTrans, one, W1, v, zero, w2 );
+                    gemv( Op::NoTrans, -one, A1, w2, one, w );
+                    gemv( Op::ConjTrans, one, A1, v, zero, w2 );
+                    gemv( Op::NoTrans, -one, W1, w2, one, w );
+                }
+                scal( tau[i], w );
+                const TA beta = -half * tau[i] * dot( w, v );
+                axpy( beta, v, w );
+            }
+        }
+    }
+
+    return 0;
+}
+
+} // lapack
+
+#endif // __TLAPACK_LATRD_HH__
@@ -0,0 +1,128 @@
+/// @file lauu2.hpp
+/// @brief Unblocked LAUUM
+//
+// Copyright (c) 2022, University of Colorado Denver. All rights reserved.
+//
+// This file is part of <T>LAPACK.
+// <T>LAPACK is free software: you can redistribute it and/or modify it under
+// the terms of the BSD 3-Clause license. See the accompanying LICENSE file.
+
+#ifndef __TLAPACK_LAUU2_HH__
+#define __TLAPACK_LAUU2_HH__
+
+#include "base/utils.hpp"
+#include "base/types.hpp"
+
+namespace tlapack
+{
+
+    /** Computes the product `U * U^H` or `L^H * L` of the triangular factor
+     * of `A` and stores it in place of `A`, one row or column at a time.
+     *
+     * This is the unblocked variant of lauum_recursive(), used by it on the
+     * blocks that are smaller than nx. The loops are unrolled by two rows
+     * or columns of the result.
+     *
+     * @param[in] uplo
+     *      - Uplo::Upper: Upper triangle of `A` is referenced; the strictly lower
+     *      triangular part of `A` is not referenced.
+     *      - Uplo::Lower: Lower triangle of `A` is referenced; the strictly upper
+     *      triangular part of `A` is not referenced.
+     *
+     * @param[in,out] A n-by-n (upper of lower) (triangular or symmetric) matrix.
+     *      On entry, the (upper of lower) part of the n-by-n triangular matrix.
+     *      On exit, the (upper of lower) part of the n-by-n symmetric matrix `A^H * A` or `A * A^H`.
+     *
+     * @return = 0: successful exit
+     */
+    template <typename matrix_t>
+    int lauu2(const Uplo &uplo, matrix_t &A)
+    {
+        using T = type_t<matrix_t>;
+        using idx_t = size_type<matrix_t>;
+        using real_t = real_type<T>;
+
+        const idx_t n = nrows(A);
+
+        // check arguments
+        tlapack_check_false(uplo != Uplo::Lower &&
+                                uplo != Uplo::Upper,
+                            -1);
+        tlapack_check_false(access_denied(uplo, write_policy(A)), -1);
+        tlapack_check_false(nrows(A) != ncols(A), -2);
+
+        if (uplo == Uplo::Upper)
+        {
+            // Column i of U * U^H only needs the columns i to n-1 of U. The
+            // rows r and r+1 are computed together to reuse conj(A(i,k))
+            for (idx_t i = 0; i < n; ++i)
+            {
+                const T aii = conj(A(i, i));
+                idx_t r = 0;
+                for (; r + 1 < i; r += 2)
+                {
+                    T s0 = A(r, i) * aii;
+                    T s1 = A(r + 1, i) * aii;
+                    for (idx_t k = i + 1; k < n; ++k)
+                    {
+                        const T aik = conj(A(i, k));
+                        s0 += A(r, k) * aik;
+                        s1 += A(r + 1, k) * aik;
+                    }
+                    A(r, i) = s0;
+                    A(r + 1, i) = s1;
+                }
+                if (r < i)
+                {
+                    T sum = A(r, i) * aii;
+                    for (idx_t k = i + 1; k < n; ++k)
+                        sum += A(r, k) * conj(A(i, k));
+                    A(r, i) = sum;
+                }
+                real_t d(0);
+                for (idx_t k = i; k < n; ++k)
+                    d += real(A(i, k)) * real(A(i, k)) + imag(A(i, k)) * imag(A(i, k));
+                A(i, i) = T(d);
+            }
+        }
+        else
+        {
+            // Row i of L^H * L only needs the rows i to n-1 of L. The
+            // columns j and j+1 are computed together to reuse conj(A(k,i))
+            for (idx_t i = 0; i < n; ++i)
+            {
+                const T aii = conj(A(i, i));
+                idx_t j = 0;
+                for (; j + 1 < i; j += 2)
+                {
+                    T s0 = aii * A(i, j);
+                    T s1 = aii * A(i, j + 1);
+                    for (idx_t k = i + 1; k < n; ++k)
+                    {
+                        const T aki = conj(A(k, i));
+                        s0 += aki * A(k, j);
+                        s1 += aki * A(k, j + 1);
+                    }
+                    A(i, j) = s0;
+                    A(i, j + 1) = s1;
+                }
+                if (j < i)
+                {
+                    T sum = aii * A(i, j);
+                    for (idx_t k = i + 1; k < n; ++k)
+                        sum += conj(A(k, i)) * A(k, j);
+                    A(i, j) = sum;
+                }
+                real_t d(0);
+                for (idx_t k = i; k < n; ++k)
+                    d += real(A(k, i)) * real(A(k, i)) + imag(A(k, i)) * imag(A(k, i));
+                A(i, i) = T(d);
+            }
+        }
+
+        return 0;
+    }
+
+} // namespace tlapack
+
+#endif // __TLAPACK_LAUU2_HH__
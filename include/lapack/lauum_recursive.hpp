@@ -9,11 +9,22 @@
 #define __TLAPACK_LAUUM_RECURSIVE__TLAPACK_
 
 #include "base/utils.hpp"
+#include "base/profile.hpp"
 #include "base/types.hpp"
+#include "base/tuning.hpp"
+
+#include "lapack/lauu2.hpp"
 
 namespace tlapack
 {
 
+    template <typename idx_t>
+    struct lauum_opts_t {
+        // Optimization parameter. Matrices of size up to nx are computed
+        // by lauu2 instead of the recursion. Must be at least 1.
+        tunable<idx_t> nx = {tuning_default, 16};
+    };
+
     /** LAUUM is a specific type of inplace HERK. Given `A` a triangular 
      * matrix (lower or upper), LAUUM computes the Hermitian matrix 
      * `upper times lower`. 
@@ -34,13 +45,14 @@ namespace tlapack
      *      On entry, the (upper of lower) part of the n-by-n triangular matrix.
      *      On exit, the (upper of lower) part of the n-by-n symmetric matrix `A^H * A` or `A * A^H`.
      * 
-     * @return = 0: successful exit
+     * @param[in] opts Options.
+     *      - @c opts.nx: Size of the blocks computed by lauu2().
      *
-     * @todo: implement nx to bail out of recursion before 1-by-1 case
+     * @return = 0: successful exit
      *
      */
     template <typename matrix_t>
-    int lauum_recursive(const Uplo &uplo, matrix_t &C)
+    int lauum_recursive(const Uplo &uplo, matrix_t &C, const lauum_opts_t<size_type<matrix_t>> &opts = {})
 
     {
         tlapack_check(nrows(C) == ncols(C));
@@ -51,6 +63,9 @@ namespace tlapack
         using real_t = real_type<T>;
 
         const idx_t n = nrows(C);
+        const idx_t nx = tuned<T>(opts.nx, "lauum", "nx", n);
+
+        TLAPACK_PROFILE_SCOPE( "lauum_recursive", T, (1.0/3.0)*n*n*n, 0.5*n*(n+1) );
 
         // check arguments
         tlapack_check_false(uplo != Uplo::Lower &&
@@ -58,6 +73,7 @@ namespace tlapack
                             -1);
         tlapack_check_false(access_denied(uplo, write_policy(C)), -1);
         tlapack_check_false(nrows(C) != ncols(C), -2);
+        tlapack_check(nx >= 1);
 
         // Quick return
         if (n <= 0)
@@ -65,17 +81,17 @@ namespace tlapack
 
         idx_t n0 = n / 2;
 
-        // 1-by-1 case for recursion
-        if (n == 1)
+        // The matrix is small, use the unblocked method and end recursion
+        if (n <= nx)
         {
-
-            real_t rC00 = real(C(0, 0));
-            real_t iC00 = imag(C(0, 0));
-            C(0, 0) = make_scalar<T>( rC00*rC00 + iC00*iC00, 0 );
-
+            lauu2(uplo, C);
         }
         else
         {
+            // The blocks use the same nx as the whole matrix
+            lauum_opts_t<idx_t> block_opts;
+            block_opts.nx = nx;
+
             if (uplo == Uplo::Lower)
             {
                 // Upper computes U * U_hermitian
@@ -83,10 +99,10 @@ namespace tlapack
                 auto C10 = slice(C, range(n0, n), range(0, n0));
                 auto C11 = slice(C, range(n0, n), range(n0, n));
 
-                lauum_recursive(uplo, C00);
+                lauum_recursive(uplo, C00, block_opts);
                 herk(Uplo::Lower, Op::ConjTrans, real_t(1.0), C10, real_t(1.0), C00);
                 trmm(Side::Left, uplo, Op::ConjTrans, Diag::NonUnit, real_t(1.0), C11, C10);
-                lauum_recursive(uplo, C11);
+                lauum_recursive(uplo, C11, block_opts);
 
             }
             else
@@ -96,10 +112,10 @@ namespace tlapack
                 auto C01 = slice(C, range(0, n0), range(n0, n));
                 auto C11 = slice(C, range(n0, n), range(n0, n));
 
-                lauum_recursive(uplo, C00);
+                lauum_recursive(uplo, C00, block_opts);
                 herk(Uplo::Upper, Op::NoTrans, real_t(1.0), C01, real_t(1.0), C00);
                 trmm(Side::Right, uplo, Op::ConjTrans, Diag::NonUnit, real_t(1.0), C11, C01);
-                lauum_recursive(Uplo::Upper, C11);
+                lauum_recursive(Uplo::Upper, C11, block_opts);
 
             }
         }
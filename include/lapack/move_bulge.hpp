@@ -11,7 +11,6 @@
 #define __MOVE_BULGE_HH__
 
 
-#include <memory>
 #include <complex>
 
 #include "legacy_api/base/utils.hpp"
@@ -80,7 +79,7 @@ namespace tlapack
         {
             // The bulge has collapsed, attempt to reintroduce using
             // 2-small-subdiagonals trick
-            std::unique_ptr<T[]> _vt(new T[3]);
+            T _vt[3];
             auto vt = legacyVector<T>(3, &_vt[0]);
             auto H2 = slice(H, pair{1, 4}, pair{1, 4});
             lahqr_shiftcolumn(H2, vt, s1, s2);
@@ -17,7 +17,10 @@
 
 #include "legacy_api/base/utils.hpp"
 #include "base/utils.hpp"
+#include "base/profile.hpp"
+#include "base/tuning.hpp"
 #include "base/types.hpp"
+#include "base/workspace.hpp"
 #include "lapack/multishift_qr_sweep.hpp"
 #include "lapack/agressive_early_deflation.hpp"
 
@@ -32,9 +35,13 @@ namespace tlapack
     {
 
         // Function that returns the number of shifts to use
-        // for a given matrix size
+        // for a given matrix size. By default, the value in the tuning
+        // table, or the built-in table below.
         std::function<idx_t(idx_t, idx_t)> nshift_recommender = [](idx_t n, idx_t nh) -> idx_t
         {
+            std::size_t ns;
+            if (tuning().lookup("multishift_qr", "nshift", tuning_type<T>(), n, ns))
+                return idx_t(ns);
             if (n < 30)
                 return 2;
             if (n < 60)
@@ -50,10 +57,14 @@ namespace tlapack
             return 256;
         };
 
-        // Function that returns the number of shifts to use
-        // for a given matrix size
+        // Function that returns the size of the deflation window
+        // for a given matrix size. By default, the value in the tuning
+        // table, or the built-in table below.
         std::function<idx_t(idx_t, idx_t)> deflation_window_recommender = [](idx_t n, idx_t nh) -> idx_t
         {
+            std::size_t nw;
+            if (tuning().lookup("multishift_qr", "nw", tuning_type<T>(), n, nw))
+                return idx_t(nw);
             if (n < 30)
                 return 2;
             if (n < 60)
@@ -75,15 +86,92 @@ namespace tlapack
         int n_sweep = 0;
         int n_shifts_total = 0;
         // Threshold to switch between blocked and unblocked code
-        idx_t nmin = 75;
+        tunable<idx_t> nmin = {tuning_default, 75};
         // Threshold of percent of AED window that must converge to skip a sweep
-        idx_t nibble = 14;
+        tunable<idx_t> nibble = {tuning_default, 14};
         // Workspace pointer, if no workspace is provided, one will be allocated internally
         T *_work = nullptr;
         // Workspace size
-        idx_t lwork;
+        idx_t lwork = 0;
+        // Arena used if no workspace is provided, also by the nested calls
+        // to multishift_qr and gehrd. If nullptr, the default arena of the
+        // calling thread is used.
+        workspace_arena* arena = nullptr;
     };
 
+    /**
+     * Returns the size of the workspace opts._work such that neither
+     * multishift_qr nor its nested calls to multishift_qr and gehrd, made by
+     * the aggressive early deflation, borrow workspace from the arena.
+     * The nested calls reuse the same workspace.
+     * The arguments are the same as for multishift_qr itself.
+     *
+     * @return idx_t The size of the required workspace
+     */
+    template <
+        class matrix_t,
+        class vector_t,
+        enable_if_t<is_complex<type_t<vector_t>>::value, bool> = true>
+    size_type<matrix_t> get_work_multishift_qr(bool want_t, bool want_z, size_type<matrix_t> ilo, size_type<matrix_t> ihi, matrix_t &A, vector_t &w, matrix_t &Z, const francis_opts_t<size_type<matrix_t>, type_t<matrix_t>> &opts)
+    {
+        using idx_t = size_type<matrix_t>;
+
+        const idx_t n = ncols(A);
+        const idx_t nh = ihi - ilo;
+
+        // Tiny matrices use lahqr, which needs no workspace
+        if (nh <= 0 or n < tuned<type_t<matrix_t>>(opts.nmin, "multishift_qr", "nmin", n))
+            return 0;
+
+        // Matrix V of the sweep, and the nested calls in AED with the
+        // largest possible deflation window
+        const idx_t nsr = opts.nshift_recommender(n, nh);
+        const idx_t nw_max = (n - 3) / 3;
+        return std::max<idx_t>(
+            3 * (nsr / 2),
+            get_work_agressive_early_deflation(want_t, want_z, ilo, ihi, nw_max, A, w, Z, opts));
+    }
+
+    /**
+     * Returns the number of bytes multishift_qr borrows from the workspace
+     * arena, including the nested calls to multishift_qr and gehrd made by
+     * the aggressive early deflation.
+     * The arguments are the same as for multishift_qr itself.
+     *
+     * The deflation window varies during the iteration. The returned size
+     * corresponds to the largest window, and is attained if the window
+     * reaches its maximum size. It is exact as long as opts.nshift_recommender
+     * is nondecreasing in n, as the default recommender is.
+     *
+     * @return 0 if opts provides a workspace of at least
+     *      get_work_multishift_qr() elements.
+     */
+    template <
+        class matrix_t,
+        class vector_t,
+        enable_if_t<is_complex<type_t<vector_t>>::value, bool> = true>
+    std::size_t get_worksize_multishift_qr(bool want_t, bool want_z, size_type<matrix_t> ilo, size_type<matrix_t> ihi, matrix_t &A, vector_t &w, matrix_t &Z, const francis_opts_t<size_type<matrix_t>, type_t<matrix_t>> &opts)
+    {
+        using TA = type_t<matrix_t>;
+        using idx_t = size_type<matrix_t>;
+
+        const idx_t n = ncols(A);
+        const idx_t nh = ihi - ilo;
+
+        // Tiny matrices use lahqr, which needs no workspace
+        if (nh <= 0 or n < tuned<type_t<matrix_t>>(opts.nmin, "multishift_qr", "nmin", n))
+            return 0;
+
+        // Matrix V of the sweep, alive during the calls to AED
+        const idx_t required_workspace = 3 * (opts.nshift_recommender(n, nh) / 2);
+        const std::size_t own = (opts._work && required_workspace <= opts.lwork)
+            ? 0
+            : workspace_arena::push_size<TA>(required_workspace);
+
+        const idx_t nw_max = (n - 3) / 3;
+        return own + get_worksize_agressive_early_deflation(want_t, want_z, ilo, ihi, nw_max, A, w, Z, opts);
+    }
+
     /** multishift_qr computes the eigenvalues and optionally the Schur
      *  factorization of an upper Hessenberg matrix, using the multishift
      *  implicit QR algorithm with AED.
@@ -149,10 +237,12 @@ namespace tlapack
         const idx_t n = ncols(A);
         const idx_t nh = ihi - ilo;
 
+        TLAPACK_PROFILE_SCOPE( "multishift_qr", TA, 0, double(n)*n*((want_z) ? 2 : 1) );
+
         // This routine uses the space below the subdiagonal as workspace
         // For small matrices, this is not enough
         // if n < nmin, the matrix will be passed to lahqr
-        const idx_t nmin = opts.nmin;
+        const idx_t nmin = tuned<TA>(opts.nmin, "multishift_qr", "nmin", n);
 
         // Recommended number of shifts
         const idx_t nsr = opts.nshift_recommender(n, nh);
@@ -161,7 +251,7 @@ namespace tlapack
         const idx_t nwr = opts.deflation_window_recommender(n, nh);
         const idx_t nw_max = (n - 3) / 3;
 
-        const idx_t nibble = opts.nibble;
+        const idx_t nibble = tuned<TA>(opts.nibble, "multishift_qr", "nibble", n);
 
         int n_aed = 0;
         int n_sweep = 0;
@@ -188,25 +278,13 @@ namespace tlapack
         }
 
         // Get the workspace
-        TA *_work;
-        idx_t lwork;
-        // idx_t required_workspace = get_work_multishift_qr(want_t, want_z, ilo, ihi, A, w, Z, opts);
+        // Only the matrix V is needed here. The nested calls in AED get their
+        // own workspace, see get_work_multishift_qr()
         idx_t required_workspace = 3 * (nsr / 2);
-        // Store whether or not a workspace was locally allocated
-        bool locally_allocated = false;
-        if (opts._work and required_workspace <= opts.lwork)
-        {
-            // Provided workspace is large enough, use it
-            _work = opts._work;
-            lwork = opts.lwork;
-        }
-        else
-        {
-            // No workspace provided or not large enough, allocate it
-            locally_allocated = true;
-            lwork = required_workspace;
-            _work = new TA[lwork];
-        }
+        // Use the provided workspace if it is large enough, otherwise borrow
+        // it from the arena
+        local_workspace<TA> workspace(opts._work, opts.lwork, required_workspace, opts.arena);
+        TA *_work = workspace.data();
         auto V = legacyMatrix<TA, layout<matrix_t>>(3, nsr / 2, &_work[0], layout<matrix_t> == Layout ::ColMajor ? 3 : nsr / 2);
 
         // itmax is the total number of QR iterations allowed.
@@ -259,6 +337,8 @@ namespace tlapack
                     break;
                 }
             }
+            TLAPACK_TRACE_SCOPE( "multishift_qr.iteration", trace_arg("iter", iter), trace_arg("istart", istart), trace_arg("istop", istop) );
+
             //
             // Agressive early deflation
             //
@@ -291,7 +371,10 @@ namespace tlapack
 
             idx_t ls, ld;
             n_aed = n_aed + 1;
-            agressive_early_deflation(want_t, want_z, istart, istop, nw, A, w, Z, ls, ld, opts);
+            {
+                TLAPACK_TRACE_SCOPE( "multishift_qr.aed", trace_arg("kwtop", istop - nw), trace_arg("nw", nw) );
+                agressive_early_deflation(want_t, want_z, istart, istop, nw, A, w, Z, ls, ld, opts);
+            }
 
             istop = istop - ld;
 
@@ -413,15 +496,16 @@ namespace tlapack
 
             n_sweep = n_sweep + 1;
             n_shifts_total = n_shifts_total + ns;
-            multishift_QR_sweep(want_t, want_z, istart, istop, A, shifts, Z, V);
+            {
+                TLAPACK_TRACE_SCOPE( "multishift_qr.sweep", trace_arg("istart", istart), trace_arg("istop", istop), trace_arg("ns", ns) );
+                multishift_QR_sweep(want_t, want_z, istart, istop, A, shifts, Z, V);
+            }
         }
 
         opts.n_aed = n_aed;
         opts.n_shifts_total = n_shifts_total;
         opts.n_sweep = n_sweep;
 
-        if (locally_allocated)
-            delete[] _work;
         return info;
     }
 
@@ -16,6 +16,7 @@
 #include "legacy_api/base/utils.hpp"
 #include "base/utils.hpp"
 #include "base/types.hpp"
+#include "base/profile.hpp"
 #include "lapack/larfg.hpp"
 #include "lapack/lahqr_shiftcolumn.hpp"
 #include "lapack/move_bulge.hpp"
@@ -70,6 +71,8 @@ namespace tlapack
         const real_t eps = ulp<real_t>();
         const real_t small_num = safe_min<real_t>() * ((real_t)n / eps);
 
+        TLAPACK_PROFILE_SCOPE( "multishift_QR_sweep", T, 0, double(n)*n*((want_z) ? 2 : 1) );
+
         // Assertions
         assert(n >= 12);
         assert(nrows(A) == n);
@@ -111,6 +114,7 @@ namespace tlapack
             // The calculations are initially limited to the window: A(ilo:ilo+n_block,ilo:ilo+n_block)
             // The rest is updated later via level 3 BLAS
             idx_t n_block = std::min(n_block_desired, ihi - ilo);
+            TLAPACK_TRACE_SCOPE( "multishift_QR_sweep.introduce", trace_arg("pos", ilo), trace_arg("n_block", n_block) );
             idx_t istart_m = ilo;
             idx_t istop_m = ilo + n_block;
             auto U2 = slice(U, pair{0, n_block}, pair{0, n_block});
@@ -307,6 +311,7 @@ namespace tlapack
             idx_t n_pos = std::min<idx_t>(n_block_desired - n_shifts, ihi - n_shifts - 1 - i_pos_block);
             // Actual blocksize
             idx_t n_block = n_shifts + n_pos;
+            TLAPACK_TRACE_SCOPE( "multishift_QR_sweep.chase", trace_arg("pos", i_pos_block), trace_arg("n_block", n_block) );
 
             auto U2 = slice(U, pair{0, n_block}, pair{0, n_block});
             laset(Uplo::General, zero, one, U2);
@@ -489,6 +494,7 @@ namespace tlapack
         //
         {
             idx_t n_block = ihi - i_pos_block;
+            TLAPACK_TRACE_SCOPE( "multishift_QR_sweep.remove", trace_arg("pos", i_pos_block), trace_arg("n_block", n_block) );
 
             auto U2 = slice(U, pair{0, n_block}, pair{0, n_block});
             laset(Uplo::General, zero, one, U2);
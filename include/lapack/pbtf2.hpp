@@ -0,0 +1,120 @@
+/// @file pbtf2.hpp Computes the Cholesky factorization of a Hermitian positive definite band matrix using the unblocked algorithm.
+//
+// Copyright (c) 2022, University of Colorado Denver. All rights reserved.
+//
+// This file is part of <T>LAPACK.
+// <T>LAPACK is free software: you can redistribute it and/or modify it under
+// the terms of the BSD 3-Clause license. See the accompanying LICENSE file.
+
+#ifndef __TLAPACK_PBTF2_HH__
+#define __TLAPACK_PBTF2_HH__
+
+#include "base/utils.hpp"
+#include "base/profile.hpp"
+
+namespace tlapack {
+
+/** Computes the Cholesky factorization of a Hermitian
+ * positive definite band matrix A with kd diagonals besides the main
+ * diagonal.
+ *
+ * The factorization has the form
+ *     $A = U^H U,$ if uplo = Upper, or
+ *     $A = L L^H,$ if uplo = Lower,
+ * where U is an upper triangular band matrix with kd superdiagonals and L
+ * is a lower triangular band matrix with kd subdiagonals.
+ *
+ * This is the unblocked version of the algorithm, which only accesses the
+ * elements of the band.
+ *
+ * @tparam uplo_t
+ *      Access type: Upper or Lower.
+ *      Either Uplo or any class that implements `operator Uplo()`.
+ *
+ * @param[in] uplo
+ *      - Uplo::Upper: kd = upperband(A) and the upper triangle of A is referenced;
+ *      - Uplo::Lower: kd = lowerband(A) and the lower triangle of A is referenced.
+ *
+ * @param[in,out] A
+ *      n-by-n Hermitian band matrix, e.g., a legacyBandedMatrix.
+ *      On exit, if return value = 0, the factor U or L from the Cholesky
+ *      factorization $A = U^H U$ or $A = L L^H.$
+ *
+ * @param[in] ec Exception handling configuration at runtime.
+ *
+ * @return = 0: successful exit
+ * @return > 0: if return value = i, the leading minor of order i is not
+ *     positive definite, and the factorization could not be completed.
+ *
+ * @ingroup pbsv_computational
+ */
+template< class uplo_t, class matrix_t >
+int pbtf2( uplo_t uplo, matrix_t& A, const ErrorCheck& ec = {} )
+{
+    using T      = type_t< matrix_t >;
+    using real_t = real_type< T >;
+    using idx_t  = size_type< matrix_t >;
+
+    using std::min;
+
+    // constants
+    const real_t rzero( 0.0 );
+    const idx_t n  = nrows(A);
+    const idx_t kd = (uplo == Uplo::Upper) ? upperband(A) : lowerband(A);
+
+    // check arguments
+    tlapack_check_false( uplo != Uplo::Lower &&
+                         uplo != Uplo::Upper, -1 );
+    tlapack_check_false( access_denied( (uplo == Uplo::Upper) ? band_t( 0, kd ) : band_t( kd, 0 ),
+                                        write_policy(A) ), -2 );
+    tlapack_check_false( nrows(A) != ncols(A), -2 );
+
+    TLAPACK_PROFILE_SCOPE( "pbtf2", T, double(n)*kd*(kd+1), double(n)*(kd+1) );
+
+    for( idx_t j = 0; j < n; ++j ) {
+
+        // Compute the diagonal element and test for non-positive-definiteness
+        real_t ajj = real( A(j,j) );
+        if( ajj <= rzero || isnan(ajj) ) {
+            tlapack_error_internal( ec, j+1,
+                "The leading minor of the reported order is not positive definite,"
+                " and the factorization could not be completed." );
+            return j+1;
+        }
+        ajj = sqrt( ajj );
+        A(j,j) = ajj;
+
+        const idx_t kn = min( kd, n-1-j );
+
+        if( uplo == Uplo::Upper ) {
+
+            // Scale the row j and update the trailing submatrix within the band
+            for( idx_t c = j+1; c <= j+kn; ++c )
+                A(j,c) /= ajj;
+            for( idx_t c = j+1; c <= j+kn; ++c ) {
+                const T ajc = A(j,c);
+                for( idx_t i = j+1; i < c; ++i )
+                    A(i,c) -= conj( A(j,i) ) * ajc;
+                A(c,c) = real( A(c,c) ) - real( conj( ajc ) * ajc );
+            }
+        }
+        else {
+
+            // Scale the column j and update the trailing submatrix within the band
+            for( idx_t i = j+1; i <= j+kn; ++i )
+                A(i,j) /= ajj;
+            for( idx_t c = j+1; c <= j+kn; ++c ) {
+                const T acj = conj( A(c,j) );
+                A(c,c) = real( A(c,c) ) - real( A(c,j) * acj );
+                for( idx_t i = c+1; i <= j+kn; ++i )
+                    A(i,c) -= A(i,j) * acj;
+            }
+        }
+    }
+
+    return 0;
+}
+
+} // namespace tlapack
+
+#endif // __TLAPACK_PBTF2_HH__
@@ -0,0 +1,206 @@
+/// @file pbtrf.hpp Computes the Cholesky factorization of a Hermitian positive definite band matrix using a blocked algorithm.
+//
+// Copyright (c) 2022, University of Colorado Denver. All rights reserved.
+//
+// This file is part of <T>LAPACK.
+// <T>LAPACK is free software: you can redistribute it and/or modify it under
+// the terms of the BSD 3-Clause license. See the accompanying LICENSE file.
+
+#ifndef __TLAPACK_PBTRF_HH__
+#define __TLAPACK_PBTRF_HH__
+
+#include "base/utils.hpp"
+#include "base/profile.hpp"
+#include "base/tuning.hpp"
+#include "base/workspace.hpp"
+#include "legacy_api/base/utils.hpp"
+
+#include "lapack/pbtf2.hpp"
+#include "lapack/potrf2.hpp"
+#include "tblas.hpp"
+
+namespace tlapack {
+
+/// Options struct for pbtrf
+template< typename idx_t, typename T >
+struct pbtrf_opts_t
+{
+    // Block size. pbtrf uses the unblocked pbtf2 if nb <= 1 or nb > kd
+    tunable<idx_t> nb = {tuning_default, 32};
+    // Workspace pointer, if no workspace is provided, one will be allocated internally
+    T* _work = nullptr;
+    // Workspace size
+    idx_t lwork = 0;
+    // Arena used if no workspace is provided. If nullptr, the default
+    // arena of the calling thread is used.
+    workspace_arena* arena = nullptr;
+};
+
+/**
+ * Returns the required workspace for pbtrf, i.e., the size of the dense
+ * (nb+kd)-by-(nb+kd) window copied out of the band of A at each step.
+ * The arguments are the same as for pbtrf itself.
+ *
+ * @return idx_t The size of the required workspace
+ */
+template< class uplo_t, class matrix_t, typename idx_t = size_type<matrix_t>, typename T = type_t<matrix_t> >
+idx_t get_work_pbtrf( uplo_t uplo, const matrix_t& A, const pbtrf_opts_t<idx_t,T>& opts = {} )
+{
+    const idx_t n  = ncols(A);
+    const idx_t kd = (uplo == Uplo::Upper) ? upperband(A) : lowerband(A);
+    const idx_t nb = tuned<T>( opts.nb, "pbtrf", "nb", n );
+
+    return ( nb <= 1 || nb > kd ) ? 0 : (nb+kd) * (nb+kd);
+}
+
+/**
+ * Returns the number of bytes pbtrf borrows from the workspace arena.
+ * The arguments are the same as for pbtrf itself.
+ *
+ * @return 0 if opts provides a workspace of at least get_work_pbtrf()
+ *      elements, the size of the borrowed workspace otherwise.
+ */
+template< class uplo_t, class matrix_t, typename idx_t = size_type<matrix_t>, typename T = type_t<matrix_t> >
+std::size_t get_worksize_pbtrf( uplo_t uplo, const matrix_t& A, const pbtrf_opts_t<idx_t,T>& opts = {} )
+{
+    const idx_t required_workspace = get_work_pbtrf( uplo, A, opts );
+    return ( required_workspace <= 0 || (opts._work && required_workspace <= opts.lwork) )
+        ? 0
+        : workspace_arena::push_size<T>( required_workspace );
+}
+
+/** Computes the Cholesky factorization of a Hermitian
+ * positive definite band matrix A with kd diagonals besides the main
+ * diagonal.
+ *
+ * The factorization has the form
+ *     $A = U^H U,$ if uplo = Upper, or
+ *     $A = L L^H,$ if uplo = Lower,
+ * where U is an upper triangular band matrix with kd superdiagonals and L
+ * is a lower triangular band matrix with kd subdiagonals.
+ *
+ * This is the blocked version of the algorithm. At each step, the
+ * (nb+kd)-by-(nb+kd) window of A that is touched by a block of nb columns
+ * is copied to a dense workspace, factored with potrf2, trsm and herk, and
+ * copied back to the band. The memory used is O(n kd) for A plus
+ * O((nb+kd)^2) for the workspace. pbtf2() is used if nb <= 1 or nb > kd.
+ *
+ * @tparam uplo_t
+ *      Access type: Upper or Lower.
+ *      Either Uplo or any class that implements `operator Uplo()`.
+ *
+ * @param[in] uplo
+ *      - Uplo::Upper: kd = upperband(A) and the upper triangle of A is referenced;
+ *      - Uplo::Lower: kd = lowerband(A) and the lower triangle of A is referenced.
+ *
+ * @param[in,out] A
+ *      n-by-n Hermitian band matrix, e.g., a legacyBandedMatrix.
+ *      On exit, if return value = 0, the factor U or L from the Cholesky
+ *      factorization $A = U^H U$ or $A = L L^H.$
+ *
+ * @param[in] opts Options.
+ *      - @c opts.nb: Block size.
+ *      - @c opts._work, @c opts.lwork: Workspace, see get_work_pbtrf().
+ *      - @c opts.arena: Arena used if no workspace is provided.
+ *
+ * @param[in] ec Exception handling configuration at runtime.
+ *
+ * @return = 0: successful exit
+ * @return > 0: if return value = i, the leading minor of order i is not
+ *     positive definite, and the factorization could not be completed.
+ *
+ * @ingroup pbsv_computational
+ */
+template< class uplo_t, class matrix_t, typename idx_t = size_type<matrix_t>, typename T = type_t<matrix_t> >
+int pbtrf( uplo_t uplo, matrix_t& A, const pbtrf_opts_t<idx_t,T>& opts = {}, const ErrorCheck& ec = {} )
+{
+    using real_t = real_type< T >;
+    using pair   = std::pair<idx_t,idx_t>;
+
+    using std::min;
+
+    // constants
+    const real_t one( 1.0 );
+    const idx_t n  = nrows(A);
+    const idx_t kd = (uplo == Uplo::Upper) ? upperband(A) : lowerband(A);
+    const idx_t nb = tuned<T>( opts.nb, "pbtrf", "nb", n );
+
+    // check arguments
+    tlapack_check_false( uplo != Uplo::Lower &&
+                         uplo != Uplo::Upper, -1 );
+    tlapack_check_false( access_denied( (uplo == Uplo::Upper) ? band_t( 0, kd ) : band_t( kd, 0 ),
+                                        write_policy(A) ), -2 );
+    tlapack_check_false( nrows(A) != ncols(A), -2 );
+
+    // quick return
+    if( n == 0 )
+        return 0;
+
+    // Use the unblocked code if the block is too small or larger than the
+    // number of off-diagonals
+    if( nb <= 1 || nb > kd )
+        return pbtf2( uplo, A, ec );
+
+    TLAPACK_PROFILE_SCOPE( "pbtrf", T, double(n)*kd*(kd+1), double(n)*(kd+1) );
+
+    // Get the workspace
+    const idx_t required_workspace = get_work_pbtrf( uplo, A, opts );
+    local_workspace<T> workspace( opts._work, opts.lwork, required_workspace, opts.arena );
+    T* _work = workspace.data();
+
+    // Position (r,c) of the window is in the referenced part of the band
+    const auto in_band = [&]( idx_t r, idx_t c ) {
+        return (uplo == Uplo::Upper) ? ( r <= c && c <= r + kd )
+                                     : ( c <= r && r <= c + kd );
+    };
+
+    for( idx_t j = 0; j < n; j += nb ) {
+
+        const idx_t jb = min( nb, n-j );
+
+        // The window A(j:j+w,j:j+w) contains all the entries of the band
+        // touched by the columns j to j+jb-1
+        const idx_t w = min( n, j+jb+kd ) - j;
+        auto W = legacyMatrix<T>( w, w, _work, w );
+
+        // Copy the window to the workspace, with zeros out of the band
+        for( idx_t c = 0; c < w; ++c )
+            for( idx_t r = 0; r < w; ++r )
+                W(r,c) = in_band( r, c ) ? A(j+r,j+c) : T(0);
+
+        auto W11 = slice( W, pair{0,jb}, pair{0,jb} );
+        int info = potrf2( uplo, W11, noErrorCheck );
+        if( info != 0 ) {
+            tlapack_error_internal( ec, info + j,
+                "The leading minor of the reported order is not positive definite,"
+                " and the factorization could not be completed." );
+            return info + j;
+        }
+
+        if( jb < w ) {
+            auto W22 = slice( W, pair{jb,w}, pair{jb,w} );
+            if( uplo == Uplo::Upper ) {
+                auto W12 = slice( W, pair{0,jb}, pair{jb,w} );
+                trsm( Side::Left, Uplo::Upper, Op::ConjTrans, Diag::NonUnit, T(1), W11, W12 );
+                herk( Uplo::Upper, Op::ConjTrans, -one, W12, one, W22 );
+            }
+            else {
+                auto W21 = slice( W, pair{jb,w}, pair{0,jb} );
+                trsm( Side::Right, Uplo::Lower, Op::ConjTrans, Diag::NonUnit, T(1), W11, W21 );
+                herk( Uplo::Lower, Op::NoTrans, -one, W21, one, W22 );
+            }
+        }
+
+        // Copy the window back to the band
+        for( idx_t c = 0; c < w; ++c )
+            for( idx_t r = 0; r < w; ++r )
+                if( in_band( r, c ) )
+                    A(j+r,j+c) = W(r,c);
+    }
+
+    return 0;
+}
+
+} // namespace tlapack
+
+#endif // __TLAPACK_PBTRF_HH__
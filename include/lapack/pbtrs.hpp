@@ -0,0 +1,86 @@
+/// @file pbtrs.hpp Solves a Hermitian positive definite band system of linear equations using the Cholesky factorization computed by pbtrf.
+//
+// Copyright (c) 2022, University of Colorado Denver. All rights reserved.
+//
+// This file is part of <T>LAPACK.
+// <T>LAPACK is free software: you can redistribute it and/or modify it under
+// the terms of the BSD 3-Clause license. See the accompanying LICENSE file.
+
+#ifndef __TLAPACK_PBTRS_HH__
+#define __TLAPACK_PBTRS_HH__
+
+#include "base/utils.hpp"
+#include "base/profile.hpp"
+
+#include "tblas.hpp"
+
+namespace tlapack {
+
+/** Apply the Cholesky factorization of a band matrix to solve a linear system.
+ * \[
+ *      A X = B,
+ * \]
+ * where
+ *      $A = U^H U,$ if uplo = Upper, or
+ *      $A = L L^H,$ if uplo = Lower,
+ * and U or L is the band factor computed by pbtrf() or pbtf2().
+ *
+ * @tparam uplo_t
+ *      Access type: Upper or Lower.
+ *      Either Uplo or any class that implements `operator Uplo()`.
+ *
+ * @param[in] uplo
+ *      - Uplo::Upper: kd = upperband(A) and A contains the matrix U;
+ *      - Uplo::Lower: kd = lowerband(A) and A contains the matrix L.
+ *
+ * @param[in] A
+ *      The factor U or L from the Cholesky factorization of A.
+ *
+ * @param[in,out] B
+ *      On entry, the matrix B.
+ *      On exit,  the matrix X.
+ *
+ * @return = 0: successful exit.
+ *
+ * @ingroup pbsv_computational
+ */
+template< class uplo_t, class matrixA_t, class matrixB_t >
+int pbtrs( uplo_t uplo, const matrixA_t& A, matrixB_t& B )
+{
+    using idx_t = size_type< matrixA_t >;
+
+    // constants
+    const idx_t n    = ncols(A);
+    const idx_t nrhs = ncols(B);
+    const idx_t kd   = (uplo == Uplo::Upper) ? upperband(A) : lowerband(A);
+
+    // check arguments
+    tlapack_check_false( uplo != Uplo::Lower &&
+                         uplo != Uplo::Upper, -1 );
+    tlapack_check_false( access_denied( (uplo == Uplo::Upper) ? band_t( 0, kd ) : band_t( kd, 0 ),
+                                        read_policy(A) ), -2 );
+    tlapack_check_false( nrows(A) != n, -2 );
+    tlapack_check_false( nrows(B) != n, -3 );
+
+    TLAPACK_PROFILE_SCOPE( "pbtrs", type_t< matrixB_t >, 4.0*n*kd*nrhs, double(n)*(kd+1) + 2.0*n*nrhs );
+
+    for( idx_t c = 0; c < nrhs; ++c ) {
+        auto b = col( B, c );
+        if( uplo == Uplo::Upper ) {
+            // Solve A*X = B where A = U**H *U.
+            tbsv( Uplo::Upper, Op::ConjTrans, Diag::NonUnit, A, b );
+            tbsv( Uplo::Upper, Op::NoTrans,   Diag::NonUnit, A, b );
+        }
+        else {
+            // Solve A*X = B where A = L*L**H.
+            tbsv( Uplo::Lower, Op::NoTrans,   Diag::NonUnit, A, b );
+            tbsv( Uplo::Lower, Op::ConjTrans, Diag::NonUnit, A, b );
+        }
+    }
+
+    return 0;
+}
+
+} // namespace tlapack
+
+#endif // __TLAPACK_PBTRS_HH__
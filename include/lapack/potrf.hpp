@@ -11,6 +11,8 @@
 #define __TLAPACK_POTRF_HH__
 
 #include "base/utils.hpp"
+#include "base/profile.hpp"
+#include "base/tuning.hpp"
 
 #include "lapack/potrf2.hpp"
 #include "tblas.hpp"
@@ -21,53 +23,38 @@ namespace tlapack {
 template< typename idx_t >
 struct potrf_opts_t
 {
-    idx_t nb = 32; ///< Block size
+    tunable<idx_t> nb = {tuning_default, 32}; ///< Block size
 };
 
-/** Computes the Cholesky factorization of a Hermitian
- * positive definite matrix A using a blocked algorithm.
- *
- * The factorization has the form
- *      $A = U^H U,$ if uplo = Upper, or
- *      $A = L L^H,$ if uplo = Lower,
- * where U is an upper triangular matrix and L is lower triangular.
- * 
- * @tparam uplo_t
- *      Access type: Upper or Lower.
- *      Either Uplo or any class that implements `operator Uplo()`.
- * 
- * @tparam opts_t Struct with the members:
- *      opts_t::nb.
- *
- * @param[in] uplo
- *      - Uplo::Upper: Upper triangle of A is referenced;
- *      - Uplo::Lower: Lower triangle of A is referenced.
- *
- * @param[in,out] A
- *      On entry, the Hermitian matrix A of size n-by-n.
- *      
- *      - If uplo = Uplo::Upper, the strictly lower
- *      triangular part of A is not referenced.
- *
- *      - If uplo = Uplo::Lower, the strictly upper
- *      triangular part of A is not referenced.
- *
- *      - On successful exit, the factor U or L from the Cholesky
- *      factorization $A = U^H U$ or $A = L L^H.$
- *
- * @param[in] opts Options. Default options are defined in @see potrf_opts_t.
- *
- * @param[in] ec Exception handling configuration at runtime.
- *      Default options are defined in ErrorCheck.
- *
- * @return 0: successful exit.
- * @return i, 0 < i <= n, if the leading minor of order i is not
- *      positive definite, and the factorization could not be completed.
- *
- * @ingroup posv_computational
+/**
+ * Returns the size of the workspace of potrf, which is zero since potrf
+ * works in place.
+ * The arguments are the same as for potrf itself.
  */
 template< class uplo_t, class matrix_t, class opts_t >
-int potrf( uplo_t uplo, matrix_t& A, opts_t&& opts, const ErrorCheck& ec = {} )
+inline constexpr size_type< matrix_t >
+get_work_potrf( uplo_t uplo, const matrix_t& A, opts_t&& opts )
+{
+    return 0;
+}
+
+/**
+ * Returns the size in bytes of the workspace of potrf, which is zero.
+ * The arguments are the same as for potrf itself.
+ */
+template< class uplo_t, class matrix_t, class opts_t >
+inline constexpr std::size_t
+get_worksize_potrf( uplo_t uplo, const matrix_t& A, opts_t&& opts )
+{
+    return 0;
+}
+
+namespace internal {
+
+/// Blocked algorithm of potrf, also used by the overloads of potrf for
+/// other matrix types, e.g., tiledMatrix, when they cannot do better
+template< class uplo_t, class matrix_t, class opts_t >
+int potrf_blocked( uplo_t uplo, matrix_t& A, opts_t&& opts, const ErrorCheck& ec )
 {
     using T      = type_t< matrix_t >;
     using real_t = real_type< T >;
@@ -79,7 +66,9 @@ int potrf( uplo_t uplo, matrix_t& A, opts_t&& opts, const ErrorCheck& ec = {} )
     // Constants
     const real_t one( 1.0 );
     const idx_t n  = nrows(A);
-    const idx_t nb = opts.nb;
+    const idx_t nb = tuned<T>( opts.nb, "potrf", "nb", n );
+
+    TLAPACK_PROFILE_SCOPE( "potrf", T, (1.0/3.0)*n*n*n, 0.5*n*(n+1) );
 
     // check arguments
     tlapack_check( uplo == Uplo::Lower || uplo == Uplo::Upper );
@@ -92,7 +81,7 @@ int potrf( uplo_t uplo, matrix_t& A, opts_t&& opts, const ErrorCheck& ec = {} )
 
     // Unblocked code
     else if ( nb <= 1 || nb >= n )
-        return potrf2( uplo, A );
+        return potrf2( uplo, A, ec );
     
     // Blocked code
     else {
@@ -100,6 +89,7 @@ int potrf( uplo_t uplo, matrix_t& A, opts_t&& opts, const ErrorCheck& ec = {} )
             for (idx_t j = 0; j < n; j+=nb)
             {
                 idx_t jb = min( nb, n-j );
+                TLAPACK_TRACE_SCOPE( "potrf.block", trace_arg("j", j), trace_arg("nb", jb), trace_arg("n", n) );
 
                 // Define AJJ and A1J
                 auto AJJ = slice( A, pair{j,j+jb}, pair{j,j+jb} );
@@ -109,7 +99,7 @@ int potrf( uplo_t uplo, matrix_t& A, opts_t&& opts, const ErrorCheck& ec = {} )
                 
                 int info = potrf2( uplo, AJJ, noErrorCheck );
                 if( info != 0 ) {
-                    tlapack_error( info + j,
+                    tlapack_error_internal( ec, info + j,
                         "The leading minor of the reported order is not positive definite,"
                         " and the factorization could not be completed." );
                     return info + j;
@@ -131,6 +121,7 @@ int potrf( uplo_t uplo, matrix_t& A, opts_t&& opts, const ErrorCheck& ec = {} )
             for (idx_t j = 0; j < n; j+=nb)
             {
                 idx_t jb = min( nb, n-j );
+                TLAPACK_TRACE_SCOPE( "potrf.block", trace_arg("j", j), trace_arg("nb", jb), trace_arg("n", n) );
 
                 // Define AJJ and AJ1
                 auto AJJ = slice( A, pair{j,j+jb}, pair{j,j+jb} );
@@ -140,7 +131,7 @@ int potrf( uplo_t uplo, matrix_t& A, opts_t&& opts, const ErrorCheck& ec = {} )
                 
                 int info = potrf2( uplo, AJJ, noErrorCheck );
                 if( info != 0 ) {
-                    tlapack_error( info + j,
+                    tlapack_error_internal( ec, info + j,
                         "The leading minor of the reported order is not positive definite,"
                         " and the factorization could not be completed." );
                     return info + j;
@@ -169,6 +160,56 @@ int potrf( uplo_t uplo, matrix_t& A, opts_t&& opts, const ErrorCheck& ec = {} )
     }
 }
 
+} // namespace internal
+
+/** Computes the Cholesky factorization of a Hermitian
+ * positive definite matrix A using a blocked algorithm.
+ *
+ * The factorization has the form
+ *      $A = U^H U,$ if uplo = Upper, or
+ *      $A = L L^H,$ if uplo = Lower,
+ * where U is an upper triangular matrix and L is lower triangular.
+ * 
+ * @tparam uplo_t
+ *      Access type: Upper or Lower.
+ *      Either Uplo or any class that implements `operator Uplo()`.
+ * 
+ * @tparam opts_t Struct with the members:
+ *      opts_t::nb.
+ *
+ * @param[in] uplo
+ *      - Uplo::Upper: Upper triangle of A is referenced;
+ *      - Uplo::Lower: Lower triangle of A is referenced.
+ *
+ * @param[in,out] A
+ *      On entry, the Hermitian matrix A of size n-by-n.
+ *      
+ *      - If uplo = Uplo::Upper, the strictly lower
+ *      triangular part of A is not referenced.
+ *
+ *      - If uplo = Uplo::Lower, the strictly upper
+ *      triangular part of A is not referenced.
+ *
+ *      - On successful exit, the factor U or L from the Cholesky
+ *      factorization $A = U^H U$ or $A = L L^H.$
+ *
+ * @param[in] opts Options. Default options are defined in @see potrf_opts_t.
+ *
+ * @param[in] ec Exception handling configuration at runtime.
+ *      Default options are defined in ErrorCheck.
+ *
+ * @return 0: successful exit.
+ * @return i, 0 < i <= n, if the leading minor of order i is not
+ *      positive definite, and the factorization could not be completed.
+ *
+ * @ingroup posv_computational
+ */
+template< class uplo_t, class matrix_t, class opts_t >
+int potrf( uplo_t uplo, matrix_t& A, opts_t&& opts, const ErrorCheck& ec = {} )
+{
+    return internal::potrf_blocked( uplo, A, opts, ec );
+}
+
 /** Computes the Cholesky factorization of a Hermitian
  * positive definite matrix A using a blocked algorithm.
  * 
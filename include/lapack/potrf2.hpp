@@ -11,6 +11,7 @@
 #define __TLAPACK_POTRF2_HH__
 
 #include "base/utils.hpp"
+#include "base/profile.hpp"
 #include "tblas.hpp"
 
 namespace tlapack {
@@ -79,6 +80,8 @@ int potrf2( uplo_t uplo, matrix_t& A, const ErrorCheck& ec = {} )
     const real_t rzero( 0.0 );
     const idx_t n = nrows(A);
 
+    TLAPACK_PROFILE_SCOPE( "potrf2", T, (1.0/3.0)*n*n*n, 0.5*n*(n+1) );
+
     // check arguments
     tlapack_check_false(    uplo != Uplo::Lower &&
                             uplo != Uplo::Upper, -1 );
@@ -0,0 +1,109 @@
+/// @file potri.hpp Computes the inverse of a Hermitian positive definite matrix using its Cholesky factorization.
+//
+// Copyright (c) 2022, University of Colorado Denver. All rights reserved.
+//
+// This file is part of <T>LAPACK.
+// <T>LAPACK is free software: you can redistribute it and/or modify it under
+// the terms of the BSD 3-Clause license. See the accompanying LICENSE file.
+
+#ifndef __TLAPACK_POTRI_HH__
+#define __TLAPACK_POTRI_HH__
+
+#include "base/utils.hpp"
+#include "base/profile.hpp"
+#include "base/tuning.hpp"
+
+#include "lapack/trtri_recursive.hpp"
+#include "lapack/lauum_recursive.hpp"
+
+namespace tlapack {
+
+template< typename idx_t >
+struct potri_opts_t {
+    // Optimization parameter. Blocks of size up to nx are handled by the
+    // unblocked kernels trti2 and lauu2. Must be at least 1.
+    tunable<idx_t> nx = {tuning_default, 16};
+    // If true, the inverse of the triangular factor is computed with
+    // OpenMP tasks. See trtri_opts_t::parallel.
+    bool parallel = false;
+};
+
+/** Computes the inverse of a Hermitian positive definite matrix A using its
+ * Cholesky factorization
+ * \[
+ *      A = U^H U \quad \text{or} \quad A = L L^H
+ * \]
+ * computed by potrf().
+ *
+ * The triangular factor is inverted by trtri_recursive(), and then
+ * \[
+ *      A^{-1} = U^{-1} U^{-H} \quad \text{or} \quad A^{-1} = L^{-H} L^{-1}
+ * \]
+ * is formed by lauum_recursive().
+ *
+ * @param[in] uplo
+ *      - Uplo::Upper: Upper triangle of A contains the matrix U;
+ *      - Uplo::Lower: Lower triangle of A contains the matrix L.
+ *      The other triangular part of A is not referenced.
+ *
+ * @param[in,out] A n-by-n matrix.
+ *      On entry, the factor U or L from the Cholesky factorization of A.
+ *      On exit, the upper or lower triangle of the inverse of A.
+ *
+ * @param[in] opts Options.
+ *      - @c opts.nx: Size of the blocks handled by trti2() and lauu2().
+ *      - @c opts.parallel: Invert the triangular factor with OpenMP tasks.
+ *
+ * @param[in] ec Exception handling configuration at runtime.
+ *      Default options are defined in ErrorCheck.
+ *
+ * @return = 0: successful exit.
+ * @return i, 0 < i <= n, if the (i-1,i-1) element of the factor U or L is
+ *      exactly zero. The matrix A is singular, its inverse could not be
+ *      computed, and A is not modified.
+ *
+ * @ingroup posv_computational
+ */
+template< class matrix_t >
+int potri( Uplo uplo, matrix_t& A, const potri_opts_t< size_type<matrix_t> >& opts = {}, const ErrorCheck& ec = {} )
+{
+    using idx_t = size_type< matrix_t >;
+
+    // constants
+    const idx_t n = nrows(A);
+
+    // check arguments
+    tlapack_check_false( uplo != Uplo::Lower &&
+                         uplo != Uplo::Upper, -1 );
+    tlapack_check_false( access_denied( uplo, write_policy(A) ), -1 );
+    tlapack_check_false( nrows(A) != ncols(A), -2 );
+
+    TLAPACK_PROFILE_SCOPE( "potri", type_t< matrix_t >, (2.0/3.0)*n*n*n, 0.5*n*(n+1) );
+
+    // quick return
+    if( n == 0 )
+        return 0;
+
+    // Invert the triangular factor
+    trtri_opts_t<idx_t> trtriOpts;
+    trtriOpts.nx       = opts.nx;
+    trtriOpts.parallel = opts.parallel;
+    const int info = trtri_recursive( uplo, Diag::NonUnit, A, trtriOpts, noErrorCheck );
+    if( info != 0 ) {
+        tlapack_error_internal( ec, info,
+            "The factor has a zero diagonal element."
+            " The matrix is singular and its inverse could not be computed." );
+        return info;
+    }
+
+    // Form inv(U) * inv(U)^H or inv(L)^H * inv(L)
+    lauum_opts_t<idx_t> lauumOpts;
+    lauumOpts.nx = opts.nx;
+    lauum_recursive( uplo, A, lauumOpts );
+
+    return 0;
+}
+
+} // namespace tlapack
+
+#endif // __TLAPACK_POTRI_HH__
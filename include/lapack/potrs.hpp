@@ -11,6 +11,7 @@
 #define __TLAPACK_POTRS_HH__
 
 #include "base/utils.hpp"
+#include "base/profile.hpp"
 
 #include "tblas.hpp"
 
@@ -59,6 +60,8 @@ int potrs( uplo_t uplo, const matrixA_t& A, matrixB_t& B )
     // Constants
     const T one( 1.0 );
 
+    TLAPACK_PROFILE_SCOPE( "potrs", T, 2.0*ncols(A)*ncols(A)*ncols(B), double(ncols(A))*ncols(A) + 2.0*nrows(B)*ncols(B) );
+
     // Check arguments
     tlapack_check_false(    uplo != Uplo::Lower &&
                         uplo != Uplo::Upper, -1 );
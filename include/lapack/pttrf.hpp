@@ -0,0 +1,78 @@
+/// @file pttrf.hpp Computes the L D L^H factorization of a Hermitian positive definite tridiagonal matrix.
+/// Adapted from @see https://github.com/Reference-LAPACK/lapack/tree/master/SRC/zpttrf.f
+//
+// Copyright (c) 2022, University of Colorado Denver. All rights reserved.
+//
+// This file is part of <T>LAPACK.
+// <T>LAPACK is free software: you can redistribute it and/or modify it under
+// the terms of the BSD 3-Clause license. See the accompanying LICENSE file.
+
+#ifndef __TLAPACK_PTTRF_HH__
+#define __TLAPACK_PTTRF_HH__
+
+#include "base/utils.hpp"
+#include "base/profile.hpp"
+
+namespace tlapack {
+
+/** Computes the factorization
+ * \[
+ *     A = L D L^H
+ * \]
+ * of a n-by-n Hermitian positive definite tridiagonal matrix A, where L
+ * is a unit lower bidiagonal matrix and D is diagonal. This is the Thomas
+ * algorithm, which needs no pivoting for positive definite matrices.
+ *
+ * @param[in,out] d Real vector of size n.
+ *      On entry, the diagonal of A.
+ *      On exit, the diagonal of D.
+ *
+ * @param[in,out] e Vector of size n-1.
+ *      On entry, the subdiagonal of A, i.e., e[i] = A(i+1,i).
+ *      On exit, the subdiagonal of L.
+ *
+ * @param[in] ec Exception handling configuration at runtime.
+ *
+ * @return = 0: successful exit.
+ * @return i, 0 < i <= n, if the leading minor of order i is not positive
+ *      definite. If i < n, the factorization could not be completed. If
+ *      i = n, the factorization was completed, but D(n-1) <= 0.
+ *
+ * @ingroup ptsv_computational
+ */
+template< class vectorD_t, class vectorE_t >
+int pttrf( vectorD_t& d, vectorE_t& e, const ErrorCheck& ec = {} )
+{
+    using real_t = type_t< vectorD_t >;
+    using idx_t  = size_type< vectorD_t >;
+
+    // constants
+    const real_t zero( 0 );
+    const idx_t n = size(d);
+
+    // check arguments
+    tlapack_check_false( n > 0 && (idx_t) size(e) < n-1, -2 );
+
+    TLAPACK_PROFILE_SCOPE( "pttrf", type_t< vectorE_t >, 3.0*n, 2.0*n );
+
+    for( idx_t i = 0; i < n; ++i ) {
+
+        if( d[i] <= zero || isnan( d[i] ) ) {
+            tlapack_error_internal( ec, i+1,
+                "The leading minor of the reported order is not positive definite." );
+            return i+1;
+        }
+
+        if( i+1 < n ) {
+            const auto ei = e[i];
+            e[i] = ei / d[i];
+            d[i+1] -= real( conj( ei ) * e[i] );
+        }
+    }
+
+    return 0;
+}
+
+} // namespace tlapack
+
+#endif // __TLAPACK_PTTRF_HH__
@@ -0,0 +1,72 @@
+/// @file pttrs.hpp Solves a Hermitian positive definite tridiagonal system of linear equations using the factorization computed by pttrf.
+/// Adapted from @see https://github.com/Reference-LAPACK/lapack/tree/master/SRC/zptts2.f
+//
+// Copyright (c) 2022, University of Colorado Denver. All rights reserved.
+//
+// This file is part of <T>LAPACK.
+// <T>LAPACK is free software: you can redistribute it and/or modify it under
+// the terms of the BSD 3-Clause license. See the accompanying LICENSE file.
+
+#ifndef __TLAPACK_PTTRS_HH__
+#define __TLAPACK_PTTRS_HH__
+
+#include "base/utils.hpp"
+#include "base/profile.hpp"
+
+namespace tlapack {
+
+/** Solves a system of linear equations
+ * \[
+ *      A X = B,
+ * \]
+ * with a n-by-n Hermitian positive definite tridiagonal matrix A using the
+ * factorization $A = L D L^H$ computed by pttrf().
+ *
+ * @param[in] d Real vector of size n. The diagonal of D returned by pttrf().
+ * @param[in] e Vector of size n-1. The subdiagonal of L returned by pttrf().
+ *
+ * @param[in,out] B
+ *      On entry, the n-by-nrhs matrix B.
+ *      On exit,  the solution matrix X.
+ *
+ * @return = 0: successful exit.
+ *
+ * @ingroup ptsv_computational
+ */
+template< class vectorD_t, class vectorE_t, class matrixB_t >
+int pttrs( const vectorD_t& d, const vectorE_t& e, matrixB_t& B )
+{
+    using idx_t = size_type< matrixB_t >;
+
+    // constants
+    const idx_t n    = size(d);
+    const idx_t nrhs = ncols(B);
+
+    // check arguments
+    tlapack_check_false( n > 0 && (idx_t) size(e) < n-1, -2 );
+    tlapack_check_false( nrows(B) != n, -3 );
+
+    TLAPACK_PROFILE_SCOPE( "pttrs", type_t< matrixB_t >, 6.0*n*nrhs, 2.0*n + 2.0*n*nrhs );
+
+    // quick return
+    if( n == 0 || nrhs == 0 )
+        return 0;
+
+    for( idx_t j = 0; j < nrhs; ++j ) {
+
+        // Solve L x = b
+        for( idx_t i = 1; i < n; ++i )
+            B(i,j) -= e[i-1] * B(i-1,j);
+
+        // Solve D L^H x = b
+        B(n-1,j) /= d[n-1];
+        for( idx_t i = n-1; i-- > 0; )
+            B(i,j) = B(i,j) / d[i] - conj( e[i] ) * B(i+1,j);
+    }
+
+    return 0;
+}
+
+} // namespace tlapack
+
+#endif // __TLAPACK_PTTRS_HH__
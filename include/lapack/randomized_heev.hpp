@@ -0,0 +1,198 @@
+/// @file randomized_heev.hpp
+//
+// Copyright (c) 2022, University of Colorado Denver. All rights reserved.
+//
+// This file is part of <T>LAPACK.
+// <T>LAPACK is free software: you can redistribute it and/or modify it under
+// the terms of the BSD 3-Clause license. See the accompanying LICENSE file.
+
+#ifndef __TLAPACK_RANDOMIZED_HEEV_HH__
+#define __TLAPACK_RANDOMIZED_HEEV_HH__
+
+#include "legacy_api/base/utils.hpp"
+#include "base/utils.hpp"
+#include "base/profile.hpp"
+#include "base/types.hpp"
+#include "base/workspace.hpp"
+#include "lapack/rangefinder.hpp"
+#include "lapack/heevd.hpp"
+
+namespace tlapack
+{
+
+    /**
+     * Options struct for randomized_heev
+     */
+    template <typename idx_t, typename T>
+    struct randomized_heev_opts_t {
+        // Number of columns of the sketch in addition to the target rank
+        idx_t oversampling = 10;
+        // Number of power iterations in the range finder
+        idx_t n_power_iter = 2;
+        // Blocksize used in the eigendecomposition of the small matrix
+        idx_t nb = 32;
+        // If true, the sketch and the products with A are computed in
+        // parallel. Has no effect if <T>LAPACK is not compiled with OpenMP.
+        bool parallel = false;
+        // Workspace pointer, if no workspace is provided, one will be allocated internally
+        T* _work=nullptr;
+        // Workspace size
+        idx_t lwork = 0;
+        // Real workspace pointer, if no workspace is provided, one will be allocated internally
+        real_type<T>* _rwork=nullptr;
+        // Real workspace size
+        idx_t lrwork = 0;
+        // Arena used if no workspace is provided. If nullptr, the default
+        // arena of the calling thread is used.
+        workspace_arena* arena = nullptr;
+    };
+
+    /**
+     * Returns the required workspaces for randomized_heev.
+     * The arguments are the same as for randomized_heev itself.
+     *
+     * @return std::pair<idx_t,idx_t> The sizes of the required workspace
+     *      and of the required real workspace
+     */
+    template <class matrix_t, class vector_t, class matrixZ_t, class Sseq, typename idx_t = size_type<matrix_t>, typename TA = type_t<matrix_t>>
+    std::pair<idx_t,idx_t> get_work_randomized_heev(bool want_z, const matrix_t &A, vector_t &w, matrixZ_t &Z, Sseq &iseed, const randomized_heev_opts_t<idx_t, TA> &opts = {})
+    {
+        const idx_t n = ncols(A);
+        const idx_t k = size(w);
+        const idx_t l = std::min(k + opts.oversampling, n);
+
+        // Q, A Q, C = Q^H A Q and the workspace of range_finder
+        const idx_t lwork = 2 * n * l + l * l + (n * l + l + n);
+        // The eigenvalues of C
+        const idx_t lrwork = l;
+
+        return std::pair<idx_t,idx_t>( lwork, lrwork );
+    }
+
+    /** Computes a rank-k approximation of the eigendecomposition of a
+     * Hermitian n-by-n matrix A: $A \approx Z \Lambda Z^H$.
+     *
+     * An orthonormal basis Q of l = k + oversampling columns for the range
+     * of A is computed by range_finder. Then, the eigendecomposition of the
+     * small l-by-l matrix $C = Q^H A Q = \tilde Z \Lambda \tilde Z^H$ is
+     * computed by heevd, and $Z = Q \tilde Z$. The k eigenvalues of C of
+     * largest magnitude are returned, since they approximate the dominant
+     * eigenvalues of A.
+     *
+     * @return  0 if success
+     * @return  > 0 if heevd failed to converge.
+     *
+     * @param[in] want_z bool.
+     *      If true, the eigenvectors are computed.
+     * @param[in] A n-by-n Hermitian matrix.
+     *      Both the upper and the lower triangle of A must be stored.
+     * @param[out] w Real vector of length k, k <= n.
+     *      The approximate k eigenvalues of A of largest magnitude, in
+     *      ascending order.
+     * @param[out] Z n-by-k matrix.
+     *      If want_z is true, the approximate orthonormal eigenvectors
+     *      associated with w.
+     * @param[in,out] iseed Seed for the random number generator.
+     *      See range_finder.
+     *
+     * @param[in] opts Struct containing the options
+     *      See randomized_heev_opts_t for more details
+     *
+     * @ingroup heev
+     */
+    template <class matrix_t, class vector_t, class matrixZ_t, class Sseq, typename idx_t = size_type<matrix_t>, typename TA = type_t<matrix_t>>
+    int randomized_heev(bool want_z, const matrix_t &A, vector_t &w, matrixZ_t &Z, Sseq &iseed, const randomized_heev_opts_t<idx_t, TA> &opts = {})
+    {
+        using real_t = real_type<TA>;
+        using pair = pair<idx_t, idx_t>;
+        constexpr Layout L = layout<matrix_t>;
+
+        // constants
+        const TA zero(0);
+        const TA one(1);
+        const idx_t n = ncols(A);
+        const idx_t k = size(w);
+        const idx_t l = std::min(k + opts.oversampling, n);
+
+        TLAPACK_PROFILE_SCOPE( "randomized_heev", TA, 4.0*n*n*l, double(n)*n + double(n)*k );
+
+        // check arguments
+        tlapack_check_false(nrows(A) != n, -2);
+        tlapack_check_false(k > n, -3);
+        tlapack_check_false(want_z && (nrows(Z) != n || ncols(Z) != k), -4);
+
+        // quick return
+        if (k <= 0)
+            return 0;
+
+        // Get the workspaces
+        const auto required_workspace = get_work_randomized_heev(want_z, A, w, Z, iseed, opts);
+        // Use the provided workspaces if they are large enough, otherwise
+        // borrow them from the arena
+        local_workspace<TA> workspace( opts._work, opts.lwork, required_workspace.first, opts.arena );
+        local_workspace<real_t> rworkspace( opts._rwork, opts.lrwork, required_workspace.second, opts.arena );
+        TA* _work = workspace.data();
+        real_t* _rwork = rworkspace.data();
+
+        auto Q = legacyMatrix<TA, L>( n, l, &_work[0], L == Layout::ColMajor ? n : l );
+        auto AQ = legacyMatrix<TA, L>( n, l, &_work[n * l], L == Layout::ColMajor ? n : l );
+        auto C = legacyMatrix<TA, L>( l, l, &_work[2 * n * l], l );
+        auto wC = legacyVector<real_t>( l, &_rwork[0] );
+
+        // Orthonormal basis for the range of A
+        range_finder_opts_t<idx_t, TA> rf_opts;
+        rf_opts.n_power_iter = opts.n_power_iter;
+        rf_opts.parallel = opts.parallel;
+        rf_opts._work = &_work[2 * n * l + l * l];
+        rf_opts.lwork = n * l + l + n;
+        rf_opts.arena = opts.arena;
+        range_finder(A, Q, iseed, rf_opts);
+
+        // C := Q^H A Q
+        internal::parallel_gemm(Op::NoTrans, Op::NoTrans, one, A, Q, zero, AQ, opts.parallel);
+        gemm(Op::ConjTrans, Op::NoTrans, one, Q, AQ, zero, C);
+
+        // Eigendecomposition of C
+        heevd_opts_t<idx_t, TA> heevd_opts;
+        heevd_opts.nb = opts.nb;
+        heevd_opts.arena = opts.arena;
+        int info = heevd(want_z, Uplo::Lower, C, wC, heevd_opts);
+
+        // The eigenvalues of largest magnitude are at both ends of wC.
+        // Select wC[0:lo] and wC[hi:l]
+        idx_t lo = 0, hi = l;
+        for (idx_t i = 0; i < k; ++i)
+        {
+            if (abs(wC[lo]) >= abs(wC[hi - 1]))
+                ++lo;
+            else
+                --hi;
+        }
+        for (idx_t i = 0; i < lo; ++i)
+            w[i] = wC[i];
+        for (idx_t i = hi; i < l; ++i)
+            w[lo + i - hi] = wC[i];
+
+        // Z := Q C(:,selected)
+        if (want_z)
+        {
+            if (lo > 0)
+            {
+                auto C1 = slice(C, pair{0, l}, pair{0, lo});
+                auto Z1 = slice(Z, pair{0, n}, pair{0, lo});
+                internal::parallel_gemm(Op::NoTrans, Op::NoTrans, one, Q, C1, zero, Z1, opts.parallel);
+            }
+            if (hi < l)
+            {
+                auto C2 = slice(C, pair{0, l}, pair{hi, l});
+                auto Z2 = slice(Z, pair{0, n}, pair{lo, k});
+                internal::parallel_gemm(Op::NoTrans, Op::NoTrans, one, Q, C2, zero, Z2, opts.parallel);
+            }
+        }
+
+        return info;
+    }
+
+} // lapack
+
+#endif // __TLAPACK_RANDOMIZED_HEEV_HH__
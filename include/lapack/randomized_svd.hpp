@@ -0,0 +1,191 @@
+/// @file randomized_svd.hpp
+//
+// Copyright (c) 2022, University of Colorado Denver. All rights reserved.
+//
+// This file is part of <T>LAPACK.
+// <T>LAPACK is free software: you can redistribute it and/or modify it under
+// the terms of the BSD 3-Clause license. See the accompanying LICENSE file.
+
+#ifndef __TLAPACK_RANDOMIZED_SVD_HH__
+#define __TLAPACK_RANDOMIZED_SVD_HH__
+
+#include "legacy_api/base/utils.hpp"
+#include "base/utils.hpp"
+#include "base/profile.hpp"
+#include "base/types.hpp"
+#include "base/workspace.hpp"
+#include "lapack/rangefinder.hpp"
+#include "lapack/gesvd.hpp"
+#include "lapack/lacpy.hpp"
+
+namespace tlapack
+{
+
+    /**
+     * Options struct for randomized_svd
+     */
+    template <typename idx_t, typename T>
+    struct randomized_svd_opts_t {
+        // Number of columns of the sketch in addition to the target rank
+        idx_t oversampling = 10;
+        // Number of power iterations in the range finder
+        idx_t n_power_iter = 2;
+        // Blocksize used in the SVD of the small matrix
+        idx_t nb = 32;
+        // If true, the sketch and the products with A are computed in
+        // parallel. Has no effect if <T>LAPACK is not compiled with OpenMP.
+        bool parallel = false;
+        // Workspace pointer, if no workspace is provided, one will be allocated internally
+        T* _work=nullptr;
+        // Workspace size
+        idx_t lwork = 0;
+        // Real workspace pointer, if no workspace is provided, one will be allocated internally
+        real_type<T>* _rwork=nullptr;
+        // Real workspace size
+        idx_t lrwork = 0;
+        // Arena used if no workspace is provided. If nullptr, the default
+        // arena of the calling thread is used.
+        workspace_arena* arena = nullptr;
+    };
+
+    /**
+     * Returns the required workspaces for randomized_svd.
+     * The arguments are the same as for randomized_svd itself.
+     *
+     * @return std::pair<idx_t,idx_t> The sizes of the required workspace
+     *      and of the required real workspace
+     */
+    template <class matrix_t, class vector_t, class matrixU_t, class matrixVT_t, class Sseq, typename idx_t = size_type<matrix_t>, typename TA = type_t<matrix_t>>
+    std::pair<idx_t,idx_t> get_work_randomized_svd(bool want_u, bool want_vt, const matrix_t &A, vector_t &s, matrixU_t &U, matrixVT_t &VT, Sseq &iseed, const randomized_svd_opts_t<idx_t, TA> &opts = {})
+    {
+        const idx_t m = nrows(A);
+        const idx_t n = ncols(A);
+        const idx_t k = size(s);
+        const idx_t l = std::min(k + opts.oversampling, std::min(m, n));
+
+        // Q, B = Q^H A, the singular vectors of B and the workspace of
+        // range_finder
+        const idx_t lwork = m * l + l * n + l * l + l * n + (n * l + l + std::max(m, n));
+        // The singular values of B
+        const idx_t lrwork = l;
+
+        return std::pair<idx_t,idx_t>( lwork, lrwork );
+    }
+
+    /** Computes a rank-k approximation of the singular value decomposition
+     * of a general m-by-n matrix A: $A \approx U S V^H$.
+     *
+     * An orthonormal basis Q of l = k + oversampling columns for the range
+     * of A is computed by range_finder. Then, the SVD of the small l-by-n
+     * matrix $B = Q^H A = \tilde U S V^H$ is computed by gesvd, and
+     * $U = Q \tilde U$. Only the leading k singular triplets are returned.
+     *
+     * The cost is O(mnl) flops per pass over A, instead of the O(mn min(m,n))
+     * flops of gesvd, and is dominated by matrix-matrix products, which are
+     * computed in parallel if opts.parallel is true.
+     *
+     * @return  0 if success
+     * @return  > 0 if gesvd failed to converge.
+     *
+     * @param[in] want_u bool.
+     *      If true, the left singular vectors are computed.
+     * @param[in] want_vt bool.
+     *      If true, the right singular vectors are computed.
+     * @param[in] A m-by-n matrix.
+     * @param[out] s Real vector of length k, k <= min(m,n).
+     *      The approximate leading singular values of A, in decreasing order.
+     * @param[out] U m-by-k matrix.
+     *      If want_u is true, the approximate leading left singular vectors.
+     * @param[out] VT k-by-n matrix.
+     *      If want_vt is true, the approximate leading right singular
+     *      vectors, stored rowwise.
+     * @param[in,out] iseed Seed for the random number generator.
+     *      See range_finder.
+     *
+     * @param[in] opts Struct containing the options
+     *      See randomized_svd_opts_t for more details
+     *
+     * @ingroup gesvd
+     */
+    template <class matrix_t, class vector_t, class matrixU_t, class matrixVT_t, class Sseq, typename idx_t = size_type<matrix_t>, typename TA = type_t<matrix_t>>
+    int randomized_svd(bool want_u, bool want_vt, const matrix_t &A, vector_t &s, matrixU_t &U, matrixVT_t &VT, Sseq &iseed, const randomized_svd_opts_t<idx_t, TA> &opts = {})
+    {
+        using real_t = real_type<TA>;
+        using pair = pair<idx_t, idx_t>;
+        constexpr Layout L = layout<matrix_t>;
+
+        // constants
+        const TA zero(0);
+        const TA one(1);
+        const idx_t m = nrows(A);
+        const idx_t n = ncols(A);
+        const idx_t k = size(s);
+        const idx_t l = std::min(k + opts.oversampling, std::min(m, n));
+
+        TLAPACK_PROFILE_SCOPE( "randomized_svd", TA, 4.0*m*n*l, double(m)*n + double(m+n)*k );
+
+        // check arguments
+        tlapack_check_false(k > std::min(m, n), -4);
+        tlapack_check_false(want_u && (nrows(U) != m || ncols(U) != k), -5);
+        tlapack_check_false(want_vt && (nrows(VT) != k || ncols(VT) != n), -6);
+
+        // quick return
+        if (k <= 0)
+            return 0;
+
+        // Get the workspaces
+        const auto required_workspace = get_work_randomized_svd(want_u, want_vt, A, s, U, VT, iseed, opts);
+        // Use the provided workspaces if they are large enough, otherwise
+        // borrow them from the arena
+        local_workspace<TA> workspace( opts._work, opts.lwork, required_workspace.first, opts.arena );
+        local_workspace<real_t> rworkspace( opts._rwork, opts.lrwork, required_workspace.second, opts.arena );
+        TA* _work = workspace.data();
+        real_t* _rwork = rworkspace.data();
+
+        auto Q = legacyMatrix<TA, L>( m, l, &_work[0], L == Layout::ColMajor ? m : l );
+        auto B = legacyMatrix<TA, L>( l, n, &_work[m * l], L == Layout::ColMajor ? l : n );
+        auto UB = legacyMatrix<TA, L>( l, l, &_work[m * l + l * n], l );
+        auto VTB = legacyMatrix<TA, L>( l, n, &_work[m * l + l * n + l * l], L == Layout::ColMajor ? l : n );
+        auto sB = legacyVector<real_t>( l, &_rwork[0] );
+
+        // Orthonormal basis for the range of A
+        range_finder_opts_t<idx_t, TA> rf_opts;
+        rf_opts.n_power_iter = opts.n_power_iter;
+        rf_opts.parallel = opts.parallel;
+        rf_opts._work = &_work[m * l + 2 * l * n + l * l];
+        rf_opts.lwork = n * l + l + std::max(m, n);
+        rf_opts.arena = opts.arena;
+        range_finder(A, Q, iseed, rf_opts);
+
+        // B := Q^H A
+        internal::parallel_gemm(Op::ConjTrans, Op::NoTrans, one, Q, A, zero, B, opts.parallel);
+
+        // SVD of B
+        gesvd_opts_t<idx_t, TA> gesvd_opts;
+        gesvd_opts.nb = opts.nb;
+        gesvd_opts.arena = opts.arena;
+        int info = gesvd(want_u, want_vt, B, sB, UB, VTB, gesvd_opts);
+
+        for (idx_t i = 0; i < k; ++i)
+            s[i] = sB[i];
+
+        // U := Q UB(:,0:k)
+        if (want_u)
+        {
+            auto UBk = slice(UB, pair{0, l}, pair{0, k});
+            internal::parallel_gemm(Op::NoTrans, Op::NoTrans, one, Q, UBk, zero, U, opts.parallel);
+        }
+
+        // VT := VTB(0:k,:)
+        if (want_vt)
+        {
+            auto VTBk = slice(VTB, pair{0, k}, pair{0, n});
+            lacpy(dense, VTBk, VT);
+        }
+
+        return info;
+    }
+
+} // lapack
+
+#endif // __TLAPACK_RANDOMIZED_SVD_HH__
@@ -0,0 +1,220 @@
+/// @file rangefinder.hpp
+//
+// Copyright (c) 2022, University of Colorado Denver. All rights reserved.
+//
+// This file is part of <T>LAPACK.
+// <T>LAPACK is free software: you can redistribute it and/or modify it under
+// the terms of the BSD 3-Clause license. See the accompanying LICENSE file.
+
+#ifndef __TLAPACK_RANGEFINDER_HH__
+#define __TLAPACK_RANGEFINDER_HH__
+
+#include "legacy_api/base/utils.hpp"
+#include "base/utils.hpp"
+#include "base/profile.hpp"
+#include "base/types.hpp"
+#include "base/workspace.hpp"
+#include "base/parallel.hpp"
+#include "blas/gemm.hpp"
+#include "lapack/larnv.hpp"
+#include "lapack/geqr2.hpp"
+#include "lapack/ung2r.hpp"
+
+namespace tlapack
+{
+
+    namespace internal
+    {
+        /** Computes C := alpha op(A) op(B) + beta C, splitting the largest
+         * dimension of C in blocks that are updated by different OpenMP
+         * threads if parallel is true.
+         *
+         * Has no effect on the result if <T>LAPACK is not compiled with
+         * OpenMP.
+         */
+        template <class matrixA_t, class matrixB_t, class matrixC_t, class alpha_t, class beta_t>
+        void parallel_gemm(Op transA, Op transB, const alpha_t &alpha, const matrixA_t &A, const matrixB_t &B, const beta_t &beta, matrixC_t &C, bool parallel)
+        {
+            using idx_t = size_type<matrixC_t>;
+            using pair = pair<idx_t, idx_t>;
+
+            const idx_t m = nrows(C);
+            const idx_t n = ncols(C);
+            const idx_t k = (transA == Op::NoTrans) ? ncols(A) : nrows(A);
+            const bool split_rows = (m >= n);
+            const idx_t nc = (split_rows) ? m : n;
+
+            // Blocks of at least 32 rows or columns
+            const idx_t nblocks = (parallel)
+                ? std::max<idx_t>(1, std::min<idx_t>(get_max_threads(), nc / 32))
+                : 1;
+            const idx_t bs = (nc + nblocks - 1) / nblocks;
+
+            TLAPACK_OMP(parallel for if(nblocks > 1))
+            for (idx_t ib = 0; ib < nblocks; ++ib)
+            {
+                const idx_t i0 = std::min(ib * bs, nc);
+                const idx_t i1 = std::min(i0 + bs, nc);
+                if (i0 >= i1)
+                    continue;
+                if (split_rows)
+                {
+                    auto A_r = (transA == Op::NoTrans)
+                        ? slice(A, pair{i0, i1}, pair{0, k})
+                        : slice(A, pair{0, k}, pair{i0, i1});
+                    auto C_r = slice(C, pair{i0, i1}, pair{0, n});
+                    gemm(transA, transB, alpha, A_r, B, beta, C_r);
+                }
+                else
+                {
+                    auto B_c = (transB == Op::NoTrans)
+                        ? slice(B, pair{0, k}, pair{i0, i1})
+                        : slice(B, pair{i0, i1}, pair{0, k});
+                    auto C_c = slice(C, pair{0, m}, pair{i0, i1});
+                    gemm(transA, transB, alpha, A, B_c, beta, C_c);
+                }
+            }
+        }
+    } // namespace internal
+
+    /**
+     * Options struct for range_finder
+     */
+    template <typename idx_t, typename T>
+    struct range_finder_opts_t {
+        // Number of power iterations. Each iteration costs two products with
+        // A and improves the approximation when the singular values of A
+        // decay slowly.
+        idx_t n_power_iter = 2;
+        // If true, the columns of the Gaussian sketch are generated and the
+        // products with A are computed by different OpenMP threads.
+        // Has no effect if <T>LAPACK is not compiled with OpenMP.
+        bool parallel = false;
+        // Workspace pointer, if no workspace is provided, one will be allocated internally
+        T* _work=nullptr;
+        // Workspace size
+        idx_t lwork = 0;
+        // Arena used if no workspace is provided. If nullptr, the default
+        // arena of the calling thread is used.
+        workspace_arena* arena = nullptr;
+    };
+
+    /**
+     * Returns the required workspace for range_finder.
+     * The arguments are the same as for range_finder itself.
+     *
+     * @return idx_t The size of the required workspace
+     */
+    template <class matrixA_t, class matrixQ_t, class Sseq, typename idx_t = size_type<matrixA_t>, typename TA = type_t<matrixA_t>>
+    idx_t get_work_range_finder(const matrixA_t &A, matrixQ_t &Q, Sseq &iseed, const range_finder_opts_t<idx_t, TA> &opts = {})
+    {
+        const idx_t m = nrows(A);
+        const idx_t n = ncols(A);
+        const idx_t l = ncols(Q);
+
+        // The sketch, tau and the workspace of geqr2 and ung2r
+        return n * l + l + std::max(m, n);
+    }
+
+    /** Computes an m-by-l matrix Q with orthonormal columns whose range
+     * approximates the range of the m-by-n matrix A.
+     *
+     * This is the randomized range finder of Halko, Martinsson and Tropp.
+     * A Gaussian sketch $\Omega$ of size n-by-l is generated by larnv, and
+     * Q is an orthonormal basis of
+     * \[
+     *      Y = (A A^H)^q A \Omega,
+     * \]
+     * where q is the number of power iterations. Each product with A or
+     * $A^H$ is followed by a QR factorization to keep the basis
+     * orthonormal in finite precision.
+     *
+     * Each column j of $\Omega$ is generated with the seed iseed + j, so the
+     * result does not depend on the number of threads.
+     *
+     * @return  0 if success
+     *
+     * @param[in] A m-by-n matrix.
+     * @param[out] Q m-by-l matrix, l <= min(m,n).
+     *      Orthonormal basis of the approximate range of A.
+     * @param[in,out] iseed Seed for the random number generator.
+     *      On exit, iseed := iseed + l.
+     *
+     * @param[in] opts Struct containing the options
+     *      See range_finder_opts_t for more details
+     *
+     * @ingroup gesvd_computational
+     */
+    template <class matrixA_t, class matrixQ_t, class Sseq, typename idx_t = size_type<matrixA_t>, typename TA = type_t<matrixA_t>>
+    int range_finder(const matrixA_t &A, matrixQ_t &Q, Sseq &iseed, const range_finder_opts_t<idx_t, TA> &opts = {})
+    {
+        using TQ = type_t<matrixQ_t>;
+        using pair = pair<idx_t, idx_t>;
+
+        // constants
+        const TQ zero(0);
+        const TQ one(1);
+        const idx_t m = nrows(A);
+        const idx_t n = ncols(A);
+        const idx_t l = ncols(Q);
+        const bool parallel = opts.parallel;
+
+        TLAPACK_PROFILE_SCOPE( "range_finder", TQ, 2.0*m*n*l*(2*opts.n_power_iter + 1), double(m)*n + double(m)*l );
+
+        // check arguments
+        tlapack_check_false(nrows(Q) != m, -2);
+        tlapack_check_false(l > std::min(m, n), -2);
+        tlapack_check_false(access_denied(dense, write_policy(Q)), -2);
+
+        // quick return
+        if (l <= 0)
+            return 0;
+
+        // Get the workspace
+        idx_t required_workspace = get_work_range_finder(A, Q, iseed, opts);
+        // Use the provided workspace if it is large enough, otherwise borrow
+        // it from the arena
+        local_workspace<TQ> workspace( opts._work, opts.lwork, required_workspace, opts.arena );
+        TQ* _work = workspace.data();
+
+        constexpr Layout L = layout<matrixQ_t>;
+        auto Omega = legacyMatrix<TQ, L>( n, l, &_work[0], L == Layout::ColMajor ? n : l );
+        auto tau = legacyVector<TQ>( l, &_work[n * l] );
+        auto work = legacyVector<TQ>( std::max(m, n), &_work[n * l + l] );
+
+        // Gaussian sketch
+        const Sseq seed0 = iseed;
+        TLAPACK_OMP(parallel for if(parallel))
+        for (idx_t j = 0; j < l; ++j)
+        {
+            Sseq seed = seed0 + j;
+            auto omega_j = slice(Omega, pair{0, n}, j);
+            larnv<3>(seed, omega_j);
+        }
+        iseed = seed0 + l;
+
+        // Q := orth( A Omega )
+        internal::parallel_gemm(Op::NoTrans, Op::NoTrans, one, A, Omega, zero, Q, parallel);
+        geqr2(Q, tau, work);
+        ung2r(l, Q, tau, work);
+
+        // Power iterations
+        for (idx_t iter = 0; iter < opts.n_power_iter; ++iter)
+        {
+            // Omega := orth( A^H Q )
+            internal::parallel_gemm(Op::ConjTrans, Op::NoTrans, one, A, Q, zero, Omega, parallel);
+            geqr2(Omega, tau, work);
+            ung2r(l, Omega, tau, work);
+
+            // Q := orth( A Omega )
+            internal::parallel_gemm(Op::NoTrans, Op::NoTrans, one, A, Omega, zero, Q, parallel);
+            geqr2(Q, tau, work);
+            ung2r(l, Q, tau, work);
+        }
+
+        return 0;
+    }
+
+} // lapack
+
+#endif // __TLAPACK_RANGEFINDER_HH__
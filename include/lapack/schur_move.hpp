@@ -18,6 +18,7 @@
 #include <iomanip>
 
 #include "base/utils.hpp"
+#include "base/profile.hpp"
 #include "base/types.hpp"
 #include "lapack/schur_move.hpp"
 
@@ -60,6 +61,8 @@ namespace tlapack
         const idx_t n = ncols(A);
         const T zero(0);
 
+        TLAPACK_PROFILE_SCOPE( "schur_move", T, 0, double(n)*n*((want_q) ? 2 : 1) );
+
         // Quick return
         if (n == 0)
             return 0;
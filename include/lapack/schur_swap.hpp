@@ -134,7 +134,7 @@ namespace tlapack
             // Swap 1-by-1 block with 2-by-2 block
             //
 
-            std::unique_ptr<T[]> B_(new T[6]);
+            T B_[6];
             auto B = internal::colmajor_matrix<T>(&B_[0], 3, 2);
             B(0, 0) = A(j0, j1);
             B(1, 0) = A(j1, j1) - A(j0, j0);
@@ -208,7 +208,7 @@ namespace tlapack
             // Swap 2-by-2 block with 1-by-1 block
             //
 
-            std::unique_ptr<T[]> B_(new T[6]);
+            T B_[6];
             auto B = internal::colmajor_matrix<T>(&B_[0], 3, 2);
             B(0, 0) = A(j1, j2);
             B(1, 0) = A(j1, j1) - A(j2, j2);
@@ -277,7 +277,7 @@ namespace tlapack
         }
         if (n1 == 2 and n2 == 2)
         {
-            std::unique_ptr<T[]> _D(new T[4 * 4]);
+            T _D[4 * 4];
             auto D = internal::colmajor_matrix<T>(&_D[0], 4, 4);
 
             auto AD_slice = slice(A, pair{j0, j0 + 4}, pair{j0, j0 + 4});
@@ -288,7 +288,7 @@ namespace tlapack
             const T small_num = safe_min<T>() / eps;
             T thresh = max(ten * eps * dnorm, small_num);
 
-            std::unique_ptr<T[]> _V(new T[4 * 2]);
+            T _V[4 * 2];
             auto V = internal::colmajor_matrix<T>(&_V[0], 4, 2);
             auto X = slice(V, pair{0, 2}, pair{0, 2});
             auto TL = slice(D, pair{0, 2}, pair{0, 2});
@@ -0,0 +1,263 @@
+/// @file stedc.hpp
+/// Adapted from @see https://github.com/Reference-LAPACK/lapack/tree/master/SRC/dstedc.f
+//
+// Copyright (c) 2022, University of Colorado Denver. All rights reserved.
+//
+// This file is part of <T>LAPACK.
+// <T>LAPACK is free software: you can redistribute it and/or modify it under
+// the terms of the BSD 3-Clause license. See the accompanying LICENSE file.
+
+#ifndef __TLAPACK_STEDC_HH__
+#define __TLAPACK_STEDC_HH__
+
+#include "legacy_api/base/utils.hpp"
+#include "base/utils.hpp"
+#include "base/profile.hpp"
+#include "base/types.hpp"
+#include "base/workspace.hpp"
+#include "base/parallel.hpp"
+#include "lapack/laset.hpp"
+#include "lapack/steqr.hpp"
+#include "lapack/laed1.hpp"
+
+namespace tlapack
+{
+
+    /**
+     * Options struct for stedc
+     */
+    template <typename idx_t, typename T>
+    struct stedc_opts_t {
+        // Subproblems of size at most smlsiz are solved by steqr
+        idx_t smlsiz = 25;
+        // If true, the two halves of each subproblem are solved by different
+        // OpenMP tasks, and so are the roots of the secular equations and the
+        // update of the eigenvectors in the merge step.
+        // Has no effect if <T>LAPACK is not compiled with OpenMP.
+        bool parallel = false;
+        // Workspace pointer, if no workspace is provided, one will be allocated internally
+        T* _work=nullptr;
+        // Workspace size
+        idx_t lwork = 0;
+        // Integer workspace pointer, if no workspace is provided, one will be allocated internally
+        idx_t* _iwork=nullptr;
+        // Integer workspace size
+        idx_t liwork = 0;
+        // Arena used if no workspace is provided. If nullptr, the default
+        // arena of the calling thread is used.
+        workspace_arena* arena = nullptr;
+    };
+
+    /**
+     * Returns the required workspace for stedc.
+     * The arguments are the same as for stedc itself.
+     *
+     * @return idx_t The size of the required workspace
+     */
+    template <class vectorD_t, class vectorE_t, class matrix_t, typename idx_t = size_type<matrix_t>, typename real_t = type_t<matrix_t>>
+    idx_t get_work_stedc(bool want_z, vectorD_t &d, vectorE_t &e, matrix_t &Z, const stedc_opts_t<idx_t, real_t> &opts = {})
+    {
+        const idx_t n = size(d);
+
+        // The steqr path needs no workspace. Otherwise, each merge of
+        // size m needs 2*m*m+5*m, and the two halves of a subproblem use
+        // disjoint parts of the workspace of their parent.
+        return (!want_z || n <= opts.smlsiz) ? 0 : 2*n*n + 5*n;
+    }
+
+    /**
+     * Returns the required integer workspace for stedc.
+     * The arguments are the same as for stedc itself.
+     *
+     * @return idx_t The size of the required integer workspace
+     */
+    template <class vectorD_t, class vectorE_t, class matrix_t, typename idx_t = size_type<matrix_t>, typename real_t = type_t<matrix_t>>
+    idx_t get_iwork_stedc(bool want_z, vectorD_t &d, vectorE_t &e, matrix_t &Z, const stedc_opts_t<idx_t, real_t> &opts = {})
+    {
+        const idx_t n = size(d);
+
+        // Each merge of size m needs 3*m indices, and the two halves of a
+        // subproblem use disjoint parts of the workspace of their parent.
+        return (!want_z || n <= opts.smlsiz) ? 0 : 3*n;
+    }
+
+    /** Recursive step of the divide and conquer method used by stedc.
+     *
+     * Computes the eigenvalues and eigenvectors of the real symmetric
+     * tridiagonal matrix with diagonal d and off-diagonal e. Q is set to
+     * the matrix of eigenvectors.
+     *
+     * @return  0 if success
+     * @return  > 0 if steqr or laed1 failed.
+     *
+     * @param[in,out] d Real vector of length n.
+     * @param[in,out] e Real vector of length n-1.
+     * @param[out] Q n-by-n real matrix.
+     * @param work Real array of length 2*n*n + 5*n.
+     * @param iwork Integer array of length 3*n.
+     * @param[in] smlsiz integer.
+     * @param[in] parallel bool.
+     *
+     * @ingroup htev
+     */
+    template <class vectorD_t, class vectorE_t, class matrix_t, typename idx_t = size_type<matrix_t>, typename real_t = type_t<matrix_t>>
+    int laed0(vectorD_t &d, vectorE_t &e, matrix_t &Q, real_t* work, idx_t* iwork, idx_t smlsiz, bool parallel)
+    {
+        using pair = pair<idx_t, idx_t>;
+
+        // constants
+        const real_t zero(0);
+        const real_t one(1);
+        const idx_t n = size(d);
+
+        // Small subproblems are solved by the QL method
+        if (n <= smlsiz)
+        {
+            laset(dense, zero, one, Q);
+            return steqr(true, d, e, Q);
+        }
+
+        // Tear the matrix at e[n1-1]:
+        // T = diag(T1, T2) + |rho| v v^T, with v = [ e_{n1-1} ; sign(rho) e_0 ]
+        const idx_t n1 = n / 2;
+        const idx_t n2 = n - n1;
+        const real_t rho = e[n1 - 1];
+        d[n1 - 1] -= abs(rho);
+        d[n1] -= abs(rho);
+
+        auto d1 = slice(d, pair{0, n1});
+        auto e1 = slice(e, (n1 > 1) ? pair{0, n1 - 1} : pair{0, 0});
+        auto Q1 = slice(Q, pair{0, n1}, pair{0, n1});
+        auto d2 = slice(d, pair{n1, n});
+        auto e2 = slice(e, (n2 > 1) ? pair{n1, n - 1} : pair{0, 0});
+        auto Q2 = slice(Q, pair{n1, n}, pair{n1, n});
+
+        // The off-diagonal blocks of Q are zero
+        auto Q12 = slice(Q, pair{0, n1}, pair{n1, n});
+        auto Q21 = slice(Q, pair{n1, n}, pair{0, n1});
+        laset(dense, zero, zero, Q12);
+        laset(dense, zero, zero, Q21);
+
+        // Solve the two halves using disjoint parts of the workspace
+        real_t* work1 = work;
+        real_t* work2 = &work[2 * n1 * n1 + 5 * n1];
+        idx_t* iwork1 = iwork;
+        idx_t* iwork2 = &iwork[3 * n1];
+        int info1 = 0, info2 = 0;
+        TLAPACK_OMP(task shared(info1) if(parallel))
+        info1 = laed0(d1, e1, Q1, work1, iwork1, smlsiz, parallel);
+        TLAPACK_OMP(task shared(info2) if(parallel))
+        info2 = laed0(d2, e2, Q2, work2, iwork2, smlsiz, parallel);
+        TLAPACK_OMP(taskwait)
+        if (info1 != 0)
+            return info1;
+        if (info2 != 0)
+            return info2;
+
+        // Merge the two halves
+        return laed1(d, Q, rho, n1, work, iwork, parallel);
+    }
+
+    /** Computes all eigenvalues and, optionally, eigenvectors of a real
+     * symmetric tridiagonal matrix T using the divide and conquer method.
+     *
+     * The matrix is recursively torn into two halves by rank-one
+     * modifications until the subproblems have at most opts.smlsiz rows,
+     * which are then solved by steqr. The eigensystems of the halves are
+     * merged by laed1.
+     *
+     * If want_z is false, only the eigenvalues are computed by steqr and no
+     * eigenvector is ever formed or updated.
+     *
+     * @return  0 if success
+     * @return  > 0 if the algorithm failed to converge.
+     *
+     * @param[in] want_z bool.
+     *      If true, the eigenvectors of T are computed.
+     * @param[in,out] d Real vector of length n.
+     *      On entry, the diagonal elements of T.
+     *      On exit, if successful, the eigenvalues in ascending order.
+     * @param[in,out] e Real vector of length n-1.
+     *      On entry, the off-diagonal elements of T.
+     *      On exit, e has been destroyed.
+     * @param[out] Z n-by-n real matrix.
+     *      If want_z is true, the orthonormal eigenvectors of T, the i-th
+     *      column corresponding to d[i].
+     *      If want_z is false, Z is not referenced.
+     *
+     * @param[in,out] opts Struct containing the options
+     *      See stedc_opts_t for more details
+     *
+     * @ingroup htev
+     */
+    template <class vectorD_t, class vectorE_t, class matrix_t, typename idx_t = size_type<matrix_t>, typename real_t = type_t<matrix_t>>
+    int stedc(bool want_z, vectorD_t &d, vectorE_t &e, matrix_t &Z, const stedc_opts_t<idx_t, real_t> &opts = {})
+    {
+        // constants
+        const real_t zero(0);
+        const real_t one(1);
+        const idx_t n = size(d);
+        const idx_t smlsiz = std::max<idx_t>(opts.smlsiz, 1);
+
+        TLAPACK_PROFILE_SCOPE( "stedc", real_t, 0, double(n)*n*((want_z) ? 1 : 0) + 2.0*n );
+
+        // check arguments
+        tlapack_check_false(n > 0 && (idx_t)size(e) < n - 1, -3);
+        tlapack_check_false(want_z && (nrows(Z) != n || ncols(Z) != n), -4);
+
+        // quick return
+        if (n <= 0)
+            return 0;
+
+        // Eigenvalues only
+        if (!want_z)
+            return steqr(false, d, e, Z);
+
+        if (n <= smlsiz)
+        {
+            laset(dense, zero, one, Z);
+            return steqr(true, d, e, Z);
+        }
+
+        // Scale the matrix to avoid overflow in the secular equations
+        real_t orgnrm = zero;
+        for (idx_t i = 0; i < n; ++i)
+            orgnrm = std::max(orgnrm, abs(d[i]));
+        for (idx_t i = 0; i + 1 < n; ++i)
+            orgnrm = std::max(orgnrm, abs(e[i]));
+        if (orgnrm == zero)
+        {
+            laset(dense, zero, one, Z);
+            return 0;
+        }
+        for (idx_t i = 0; i < n; ++i)
+            d[i] /= orgnrm;
+        for (idx_t i = 0; i + 1 < n; ++i)
+            e[i] /= orgnrm;
+
+        // Get the workspaces
+        idx_t required_workspace = get_work_stedc(want_z, d, e, Z, opts);
+        idx_t required_iworkspace = get_iwork_stedc(want_z, d, e, Z, opts);
+        // Use the provided workspaces if they are large enough, otherwise
+        // borrow them from the arena
+        local_workspace<real_t> workspace( opts._work, opts.lwork, required_workspace, opts.arena );
+        local_workspace<idx_t> iworkspace( opts._iwork, opts.liwork, required_iworkspace, opts.arena );
+        real_t* _work = workspace.data();
+        idx_t* _iwork = iworkspace.data();
+
+        const bool parallel = opts.parallel;
+        int info = 0;
+        TLAPACK_OMP(parallel if(parallel))
+        TLAPACK_OMP(single)
+        info = laed0(d, e, Z, _work, _iwork, smlsiz, parallel);
+
+        // Scale back
+        for (idx_t i = 0; i < n; ++i)
+            d[i] *= orgnrm;
+
+        return info;
+    }
+
+} // lapack
+
+#endif // __TLAPACK_STEDC_HH__
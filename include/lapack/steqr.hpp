@@ -0,0 +1,177 @@
+/// @file steqr.hpp
+/// Adapted from @see https://github.com/Reference-LAPACK/lapack/tree/master/SRC/dsteqr.f
+//
+// Copyright (c) 2022, University of Colorado Denver. All rights reserved.
+//
+// This file is part of <T>LAPACK.
+// <T>LAPACK is free software: you can redistribute it and/or modify it under
+// the terms of the BSD 3-Clause license. See the accompanying LICENSE file.
+
+#ifndef __TLAPACK_STEQR_HH__
+#define __TLAPACK_STEQR_HH__
+
+#include "base/utils.hpp"
+#include "base/profile.hpp"
+#include "base/types.hpp"
+#include "lapack/lapy2.hpp"
+#include "blas/rot.hpp"
+#include "blas/swap.hpp"
+
+namespace tlapack {
+
+/** Computes all eigenvalues and, optionally, eigenvectors of a real symmetric
+ * tridiagonal matrix T using the implicit QL method with Wilkinson shifts.
+ *
+ * If want_z is true, the plane rotations are accumulated in Z, so that Z is
+ * multiplied from the right by the orthogonal matrix which diagonalizes T.
+ * If want_z is false, Z is not referenced and only the eigenvalues are
+ * computed, with O(n^2) work.
+ *
+ * @return  0 if success
+ * @return  i if the algorithm failed to find all the eigenvalues in a total
+ *            of 30*n iterations. In this case, d and e contain the elements
+ *            of a symmetric tridiagonal matrix which is orthogonally similar
+ *            to the original matrix, and i is the number of off-diagonal
+ *            elements of e that have not converged to zero.
+ *
+ * @param[in] want_z bool.
+ *      If true, the eigenvectors are accumulated in Z.
+ * @param[in,out] d Real vector of length n.
+ *      On entry, the diagonal elements of T.
+ *      On exit, if successful, the eigenvalues in ascending order.
+ * @param[in,out] e Real vector of length n-1.
+ *      On entry, the off-diagonal elements of T.
+ *      On exit, e has been destroyed.
+ * @param[in,out] Z nz-by-n matrix.
+ *      On entry, a matrix Q, e.g., the unitary matrix used to reduce a
+ *      Hermitian matrix to tridiagonal form. Use the identity to obtain
+ *      the eigenvectors of T.
+ *      On exit, if want_z is true, Q times the eigenvectors of T.
+ *
+ * @ingroup htev
+ */
+template< class vectorD_t, class vectorE_t, class matrix_t >
+int steqr( bool want_z, vectorD_t& d, vectorE_t& e, matrix_t& Z )
+{
+    using real_t = type_t< vectorD_t >;
+    using idx_t  = size_type< vectorD_t >;
+    using pair   = pair<idx_t,idx_t>;
+
+    // constants
+    const real_t zero(0);
+    const real_t one(1);
+    const real_t two(2);
+    const idx_t n = size(d);
+    const real_t eps = ulp<real_t>();
+    const real_t small_num = safe_min<real_t>();
+    const idx_t itmax = 30 * n;
+
+    TLAPACK_PROFILE_SCOPE( "steqr", real_t, 0, double(nrows(Z))*n*((want_z) ? 1 : 0) + 2.0*n );
+
+    // check arguments
+    tlapack_check_false( n > 0 && (idx_t) size(e) < n-1, -3 );
+    tlapack_check_false( want_z && ncols(Z) != n, -4 );
+
+    // quick return
+    if (n <= 1) return 0;
+
+    const idx_t nz = (want_z) ? nrows(Z) : 0;
+
+    idx_t iter = 0;
+    for( idx_t l = 0; l < n; ++l ) {
+
+        while( true ) {
+
+            // Look for a small off-diagonal element to split the matrix
+            idx_t m = l;
+            for( ; m < n-1; ++m ) {
+                const real_t dd = abs( d[m] ) + abs( d[m+1] );
+                if( abs( e[m] ) <= eps * dd || abs( e[m] ) <= small_num ) {
+                    e[m] = zero;
+                    break;
+                }
+            }
+            if( m == l )
+                break;
+
+            if( iter == itmax ) {
+                idx_t info = 0;
+                for( idx_t i = 0; i < n-1; ++i )
+                    if( e[i] != zero ) ++info;
+                return info;
+            }
+            ++iter;
+
+            // Form the Wilkinson shift
+            real_t g = ( d[l+1] - d[l] ) / ( two * e[l] );
+            real_t r = lapy2( g, one );
+            g = d[m] - d[l] + e[l] / ( g + ( (g >= zero) ? r : -r ) );
+
+            // Chase the bulge from the bottom to the top of the block
+            real_t s = one;
+            real_t c = one;
+            real_t p = zero;
+            bool underflow = false;
+            for( idx_t i = m; i-- > l; ) {
+                const real_t f = s * e[i];
+                const real_t b = c * e[i];
+                r = lapy2( f, g );
+                if( i+1 < m ) e[i+1] = r;
+                if( r == zero ) {
+                    // Recover from underflow
+                    d[i+1] -= p;
+                    underflow = true;
+                    break;
+                }
+                s = f / r;
+                c = g / r;
+                g = d[i+1] - p;
+                r = ( d[i] - g ) * s + two * c * b;
+                p = s * r;
+                d[i+1] = g + p;
+                g = c * r - b;
+
+                if( want_z ) {
+                    auto z1 = slice( Z, pair{0,nz}, i+1 );
+                    auto z0 = slice( Z, pair{0,nz}, i );
+                    rot( z1, z0, c, s );
+                }
+            }
+            if( underflow ) {
+                if( m < n-1 ) e[m] = zero;
+                continue;
+            }
+
+            d[l] -= p;
+            e[l] = g;
+            if( m < n-1 ) e[m] = zero;
+        }
+    }
+
+    // Sort the eigenvalues in increasing order
+    for( idx_t i = 0; i < n-1; ++i ) {
+        idx_t k = i;
+        real_t p = d[i];
+        for( idx_t j = i+1; j < n; ++j ) {
+            if( d[j] < p ) {
+                k = j;
+                p = d[j];
+            }
+        }
+        if( k != i ) {
+            d[k] = d[i];
+            d[i] = p;
+            if( want_z ) {
+                auto zi = slice( Z, pair{0,nz}, i );
+                auto zk = slice( Z, pair{0,nz}, k );
+                tlapack::swap( zi, zk );
+            }
+        }
+    }
+
+    return 0;
+}
+
+} // lapack
+
+#endif // __TLAPACK_STEQR_HH__
@@ -11,6 +11,7 @@
 #define __TLAPACK_TRANSPOSE_HH__
 
 #include "base/utils.hpp"
+#include "base/tuning.hpp"
 
 #include "tblas.hpp"
 
@@ -23,7 +24,7 @@ namespace tlapack
     struct transpose_opts_t {
         // Optimization parameter. Matrices smaller than nx will not
         // be transposed using recursion. Must be at least 2.s
-        idx_t nx = 16;
+        tunable<idx_t> nx = {tuning_default, 16};
     };
 
 
@@ -48,11 +49,13 @@ namespace tlapack
         const idx_t m = nrows(A);
         const idx_t n = ncols(A);
 
+        const idx_t nx = tuned<type_t<matrixA_t>>(opts.nx, "transpose", "nx", std::max(m, n));
+
         tlapack_check(m == ncols(B));
         tlapack_check(n == nrows(B));
-        tlapack_check( opts.nx >= 2 );
+        tlapack_check( nx >= 2 );
 
-        if (min(m, n) <= opts.nx)
+        if (min(m, n) <= nx)
         {
             // The matrix is small, use direct method and end recursion
             for (idx_t i = 0; i < m; ++i)
@@ -75,10 +78,14 @@ namespace tlapack
             auto B10 = slice(B, pair(n1, n), pair(0, m1));
             auto B11 = slice(B, pair(n1, n), pair(m1, m));
 
-            conjtranspose(A00, B00, opts);
-            conjtranspose(A01, B10, opts);
-            conjtranspose(A10, B01, opts);
-            conjtranspose(A11, B11, opts);
+            // The blocks use the same nx as the whole matrix
+            transpose_opts_t<idx_t> block_opts;
+            block_opts.nx = nx;
+
+            conjtranspose(A00, B00, block_opts);
+            conjtranspose(A01, B10, block_opts);
+            conjtranspose(A10, B01, block_opts);
+            conjtranspose(A11, B11, block_opts);
         }
     }
 
@@ -103,11 +110,13 @@ namespace tlapack
         const idx_t m = nrows(A);
         const idx_t n = ncols(A);
 
+        const idx_t nx = tuned<type_t<matrixA_t>>(opts.nx, "transpose", "nx", std::max(m, n));
+
         tlapack_check(m == ncols(B));
         tlapack_check(n == nrows(B));
-        tlapack_check( opts.nx >= 2 );
+        tlapack_check( nx >= 2 );
 
-        if (min(m, n) <= opts.nx)
+        if (min(m, n) <= nx)
         {
             // The matrix is small, use direct method and end recursion
             for (idx_t i = 0; i < m; ++i)
@@ -130,10 +139,14 @@ namespace tlapack
             auto B10 = slice(B, pair(n1, n), pair(0, m1));
             auto B11 = slice(B, pair(n1, n), pair(m1, m));
 
-            transpose(A00, B00, opts);
-            transpose(A01, B10, opts);
-            transpose(A10, B01, opts);
-            transpose(A11, B11, opts);
+            // The blocks use the same nx as the whole matrix
+            transpose_opts_t<idx_t> block_opts;
+            block_opts.nx = nx;
+
+            transpose(A00, B00, block_opts);
+            transpose(A01, B10, block_opts);
+            transpose(A10, B01, block_opts);
+            transpose(A11, B11, block_opts);
         }
     }
 
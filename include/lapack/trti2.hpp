@@ -0,0 +1,135 @@
+/// @file trti2.hpp
+/// @brief Unblocked inverse of a triangular matrix
+//
+// Copyright (c) 2022, University of Colorado Denver. All rights reserved.
+//
+// This file is part of <T>LAPACK.
+// <T>LAPACK is free software: you can redistribute it and/or modify it under
+// the terms of the BSD 3-Clause license. See the accompanying LICENSE file.
+
+#ifndef __TLAPACK_TRTI2_HH__
+#define __TLAPACK_TRTI2_HH__
+
+#include "base/utils.hpp"
+#include "base/types.hpp"
+
+namespace tlapack
+{
+
+    /** Computes the inverse of a triangular matrix in place, one column at
+     * a time.
+     *
+     * This is the unblocked variant of trtri_recursive(), used by it on the
+     * blocks that are smaller than nx. The product of each column by the
+     * part of the inverse already computed is written with the loops
+     * unrolled by two rows, instead of calling trmv, so that the leaves of
+     * the recursion are not dominated by the calls. A must be nonsingular.
+     *
+     * @param[in] uplo
+     *      - Uplo::Upper: A is upper triangular.
+     *      - Uplo::Lower: A is lower triangular.
+     *
+     * @param[in] diag
+     *      - Diag::NonUnit: A is non-unit triangular.
+     *      - Diag::Unit: A is unit triangular. The diagonal is not referenced.
+     *
+     * @param[in,out] A n-by-n triangular matrix.
+     *      On exit, the (upper or lower) triangle of the inverse of A.
+     *
+     * @return = 0: successful exit
+     */
+    template <typename matrix_t>
+    int trti2(const Uplo &uplo, const Diag &diag, matrix_t &A)
+    {
+        using T = type_t<matrix_t>;
+        using idx_t = size_type<matrix_t>;
+
+        const idx_t n = nrows(A);
+        const bool nonunit = (diag == Diag::NonUnit);
+
+        // check arguments
+        tlapack_check_false(uplo != Uplo::Lower &&
+                                uplo != Uplo::Upper,
+                            -1);
+        tlapack_check_false(diag != Diag::NonUnit &&
+                                diag != Diag::Unit,
+                            -2);
+        tlapack_check_false(access_denied(uplo, write_policy(A)), -1);
+        tlapack_check_false(nrows(A) != ncols(A), -3);
+
+        // Diagonal of the part of the inverse already computed
+        const auto d = [&](idx_t i) { return nonunit ? A(i, i) : T(1); };
+
+        if (uplo == Uplo::Upper)
+        {
+            // Column j of the inverse only needs the columns 0 to j-1 of it:
+            // A(0:j,j) = -A(j,j)^{-1} * inv(A)(0:j,0:j) * A(0:j,j)
+            for (idx_t j = 0; j < n; ++j)
+            {
+                T ajj(-1);
+                if (nonunit)
+                {
+                    A(j, j) = T(1) / A(j, j);
+                    ajj = -A(j, j);
+                }
+
+                // The rows r and r+1 only need A(k,j) for k >= r, which are
+                // not overwritten yet
+                idx_t r = 0;
+                for (; r + 1 < j; r += 2)
+                {
+                    T s0 = d(r) * A(r, j) + A(r, r + 1) * A(r + 1, j);
+                    T s1 = d(r + 1) * A(r + 1, j);
+                    for (idx_t k = r + 2; k < j; ++k)
+                    {
+                        const T akj = A(k, j);
+                        s0 += A(r, k) * akj;
+                        s1 += A(r + 1, k) * akj;
+                    }
+                    A(r, j) = ajj * s0;
+                    A(r + 1, j) = ajj * s1;
+                }
+                if (r < j)
+                    A(r, j) = ajj * d(r) * A(r, j);
+            }
+        }
+        else
+        {
+            // Column j of the inverse only needs the columns j+1 to n-1 of it:
+            // A(j+1:n,j) = -A(j,j)^{-1} * inv(A)(j+1:n,j+1:n) * A(j+1:n,j)
+            for (idx_t j = n; j-- > 0;)
+            {
+                T ajj(-1);
+                if (nonunit)
+                {
+                    A(j, j) = T(1) / A(j, j);
+                    ajj = -A(j, j);
+                }
+
+                // The rows r and r-1 only need A(k,j) for k <= r, which are
+                // not overwritten yet
+                idx_t r = n - 1;
+                for (; r > j + 1; r -= 2)
+                {
+                    T s0 = d(r) * A(r, j) + A(r, r - 1) * A(r - 1, j);
+                    T s1 = d(r - 1) * A(r - 1, j);
+                    for (idx_t k = j + 1; k + 1 < r; ++k)
+                    {
+                        const T akj = A(k, j);
+                        s0 += A(r, k) * akj;
+                        s1 += A(r - 1, k) * akj;
+                    }
+                    A(r, j) = ajj * s0;
+                    A(r - 1, j) = ajj * s1;
+                }
+                if (r == j + 1)
+                    A(r, j) = ajj * d(r) * A(r, j);
+            }
+        }
+
+        return 0;
+    }
+
+} // namespace tlapack
+
+#endif // __TLAPACK_TRTI2_HH__
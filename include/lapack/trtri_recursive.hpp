@@ -0,0 +1,182 @@
+/// @file trtri_recursive.hpp
+/// @brief Recursive inverse of a triangular matrix
+//
+// Copyright (c) 2022, University of Colorado Denver. All rights reserved.
+//
+// This file is part of <T>LAPACK.
+// <T>LAPACK is free software: you can redistribute it and/or modify it under
+// the terms of the BSD 3-Clause license. See the accompanying LICENSE file.
+
+#ifndef __TLAPACK_TRTRI_RECURSIVE_HH__
+#define __TLAPACK_TRTRI_RECURSIVE_HH__
+
+#include "base/utils.hpp"
+#include "base/profile.hpp"
+#include "base/types.hpp"
+#include "base/tuning.hpp"
+#include "base/parallel.hpp"
+
+#include "lapack/trti2.hpp"
+#include "tblas.hpp"
+
+namespace tlapack
+{
+
+    template <typename idx_t>
+    struct trtri_opts_t {
+        // Optimization parameter. Matrices of size up to nx are inverted
+        // by trti2 instead of the recursion. Must be at least 1.
+        tunable<idx_t> nx = {tuning_default, 16};
+        // If true, the inverses of the two diagonal blocks at each level of
+        // the recursion are computed by different OpenMP tasks.
+        // Has no effect if <T>LAPACK is not compiled with OpenMP.
+        bool parallel = false;
+    };
+
+    namespace internal
+    {
+        /// Recursion of trtri_recursive() on a nonsingular matrix A, with
+        /// the options already resolved. Does not check the arguments.
+        template <typename matrix_t>
+        void trtri_recursive(const Uplo &uplo, const Diag &diag, matrix_t &A,
+                             size_type<matrix_t> nx, bool parallel)
+        {
+            using T = type_t<matrix_t>;
+            using idx_t = size_type<matrix_t>;
+            using range = std::pair<idx_t, idx_t>;
+
+            const idx_t n = nrows(A);
+
+            // The matrix is small, use the unblocked method and end recursion
+            if (n <= nx)
+            {
+                trti2(uplo, diag, A);
+                return;
+            }
+
+            const idx_t n0 = n / 2;
+
+            auto A00 = slice(A, range(0, n0), range(0, n0));
+            auto A11 = slice(A, range(n0, n), range(n0, n));
+
+            if (uplo == Uplo::Lower)
+            {
+                // A10 = - A11^{-1} * A10 * A00^{-1}
+                auto A10 = slice(A, range(n0, n), range(0, n0));
+                trsm(Side::Left, Uplo::Lower, Op::NoTrans, diag, T(-1), A11, A10);
+                trsm(Side::Right, Uplo::Lower, Op::NoTrans, diag, T(1), A00, A10);
+            }
+            else
+            {
+                // A01 = - A00^{-1} * A01 * A11^{-1}
+                auto A01 = slice(A, range(0, n0), range(n0, n));
+                trsm(Side::Left, Uplo::Upper, Op::NoTrans, diag, T(-1), A00, A01);
+                trsm(Side::Right, Uplo::Upper, Op::NoTrans, diag, T(1), A11, A01);
+            }
+
+            if (parallel)
+            {
+                internal::run_tasks([&]() {
+                    TLAPACK_OMP(task if(n0 > nx))
+                    trtri_recursive(uplo, diag, A00, nx, parallel);
+                    trtri_recursive(uplo, diag, A11, nx, parallel);
+                });
+            }
+            else
+            {
+                trtri_recursive(uplo, diag, A00, nx, parallel);
+                trtri_recursive(uplo, diag, A11, nx, parallel);
+            }
+        }
+
+    } // namespace internal
+
+    /** Computes the inverse of a triangular matrix in place.
+     *
+     * The matrix is split in halves,
+     * \[
+     *      A = \begin{bmatrix} A_{00} & 0 \\ A_{10} & A_{11} \end{bmatrix},
+     *      \quad
+     *      A^{-1} = \begin{bmatrix} A_{00}^{-1} & 0 \\
+     *          -A_{11}^{-1} A_{10} A_{00}^{-1} & A_{11}^{-1} \end{bmatrix},
+     * \]
+     * if A is lower triangular, so that the off-diagonal block is computed
+     * by two calls of trsm and the diagonal blocks recursively. The
+     * inverses of the diagonal blocks are independent and run in parallel
+     * if opts.parallel is true.
+     *
+     * This is the recursive variant.
+     *
+     * @param[in] uplo
+     *      - Uplo::Upper: A is upper triangular. The strictly lower
+     *      triangular part of A is not referenced.
+     *      - Uplo::Lower: A is lower triangular. The strictly upper
+     *      triangular part of A is not referenced.
+     *
+     * @param[in] diag
+     *      - Diag::NonUnit: A is non-unit triangular.
+     *      - Diag::Unit: A is unit triangular. The diagonal is not referenced.
+     *
+     * @param[in,out] A n-by-n triangular matrix.
+     *      On exit, the (upper or lower) triangle of the inverse of A.
+     *
+     * @param[in] opts Options.
+     *      - @c opts.nx: Size of the blocks inverted by trti2().
+     *      - @c opts.parallel: Invert the diagonal blocks in parallel.
+     *
+     * @param[in] ec Exception handling configuration at runtime.
+     *      Default options are defined in ErrorCheck.
+     *
+     * @return = 0: successful exit
+     * @return i, 0 < i <= n, if A(i-1,i-1) is exactly zero. The matrix is
+     *      singular and its inverse could not be computed.
+     *
+     * @ingroup auxiliary
+     */
+    template <typename matrix_t>
+    int trtri_recursive(const Uplo &uplo, const Diag &diag, matrix_t &A, const trtri_opts_t<size_type<matrix_t>> &opts = {}, const ErrorCheck &ec = {})
+    {
+        using T = type_t<matrix_t>;
+        using idx_t = size_type<matrix_t>;
+
+        const idx_t n = nrows(A);
+        const idx_t nx = tuned<T>(opts.nx, "trtri", "nx", n);
+
+        TLAPACK_PROFILE_SCOPE( "trtri_recursive", T, (1.0/3.0)*n*n*n, 0.5*n*(n+1) );
+
+        // check arguments
+        tlapack_check_false(uplo != Uplo::Lower &&
+                                uplo != Uplo::Upper,
+                            -1);
+        tlapack_check_false(diag != Diag::NonUnit &&
+                                diag != Diag::Unit,
+                            -2);
+        tlapack_check_false(access_denied(uplo, write_policy(A)), -1);
+        tlapack_check_false(nrows(A) != ncols(A), -3);
+        tlapack_check(nx >= 1);
+
+        // Quick return
+        if (n <= 0)
+            return 0;
+
+        // Check for singularity once, the recursion does not check again
+        if (diag == Diag::NonUnit)
+        {
+            for (idx_t i = 0; i < n; ++i)
+                if (A(i, i) == T(0))
+                {
+                    tlapack_error_internal(ec, i + 1,
+                        "A(info,info) is exactly zero."
+                        " The triangular matrix is singular and its inverse can not be computed.");
+                    return i + 1;
+                }
+        }
+
+        internal::trtri_recursive(uplo, diag, A, nx, opts.parallel);
+
+        return 0;
+    }
+
+} // namespace tlapack
+
+#endif // __TLAPACK_TRTRI_RECURSIVE_HH__
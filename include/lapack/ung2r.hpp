@@ -12,6 +12,7 @@
 #define __TLAPACK_UNG2R_HH__
 
 #include "base/utils.hpp"
+#include "base/profile.hpp"
 #include "base/types.hpp"
 #include "lapack/larf.hpp"
 
@@ -19,6 +20,31 @@
 
 namespace tlapack {
 
+/**
+ * Returns the size of the workspace vector of ung2r.
+ * The arguments are the same as for ung2r itself.
+ * 
+ * @return idx_t The size of the required workspace
+ */
+template< class matrix_t, class vector_t >
+inline size_type< matrix_t >
+get_work_ung2r( size_type< matrix_t > k, const matrix_t& A, const vector_t &tau )
+{
+    using idx_t = size_type< matrix_t >;
+    return std::max<idx_t>( 0, ncols(A)-1 );
+}
+
+/**
+ * Returns the size in bytes of the workspace vector of ung2r.
+ * The arguments are the same as for ung2r itself.
+ */
+template< class matrix_t, class vector_t >
+inline std::size_t
+get_worksize_ung2r( size_type< matrix_t > k, const matrix_t& A, const vector_t &tau )
+{
+    return get_work_ung2r( k, A, tau ) * sizeof( type_t< matrix_t > );
+}
+
 /**
  * @brief Generates a matrix Q with orthogonal columns.
  * \[
@@ -57,6 +83,8 @@ int ung2r(
     const idx_t m = nrows(A);
     const idx_t n = ncols(A);
 
+    TLAPACK_PROFILE_SCOPE( "ung2r", T, 4.0*m*n*k - 2.0*(m+n)*k*k + (4.0/3.0)*k*k*k, double(m)*n );
+
     // check arguments
     tlapack_check_false( k < 0 || k > n, -1 );
     tlapack_check_false( access_denied( dense, write_policy(A) ), -2 );
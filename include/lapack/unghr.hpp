@@ -10,12 +10,46 @@
 #define __TLAPACK_UNGHR_HH__
 
 #include "base/utils.hpp"
+#include "base/profile.hpp"
 #include "base/types.hpp"
 #include "lapack/larf.hpp"
 #include "lapack/ung2r.hpp"
 
 namespace tlapack {
 
+/**
+ * Returns the size of the workspace vector of unghr.
+ * The arguments are the same as for unghr itself.
+ * 
+ * @return idx_t The size of the required workspace
+ */
+template< class matrix_t, class vector_t >
+inline size_type< matrix_t >
+get_work_unghr(
+    size_type< matrix_t > ilo,
+    size_type< matrix_t > ihi,
+    const matrix_t& A,
+    const vector_t& tau )
+{
+    using idx_t = size_type< matrix_t >;
+    return std::max<idx_t>( 0, ncols(A)-1 );
+}
+
+/**
+ * Returns the size in bytes of the workspace vector of unghr.
+ * The arguments are the same as for unghr itself.
+ */
+template< class matrix_t, class vector_t >
+inline std::size_t
+get_worksize_unghr(
+    size_type< matrix_t > ilo,
+    size_type< matrix_t > ihi,
+    const matrix_t& A,
+    const vector_t& tau )
+{
+    return get_work_unghr( ilo, ihi, A, tau ) * sizeof( type_t< matrix_t > );
+}
+
 /** Generates a m-by-n matrix Q with orthogonal columns.
  * 
  * @param[in] ilo integer
@@ -48,6 +82,8 @@ int unghr(
     const idx_t n = ncols(A);
     const idx_t nh = ihi > ilo +1 ? ihi-1-ilo : 0;
 
+    TLAPACK_PROFILE_SCOPE( "unghr", T, (4.0/3.0)*nh*nh*nh, double(m)*n );
+
     // check arguments
     tlapack_check_false( (idx_t) size(tau)  < std::min<idx_t>( m, n ), -2 );
     tlapack_check_false( (idx_t) size(work) < n-1, -3 );
@@ -12,6 +12,7 @@
 #define __TLAPACK_UNM2R_HH__
 
 #include "base/utils.hpp"
+#include "base/profile.hpp"
 #include "base/types.hpp"
 #include "lapack/larf.hpp"
 
@@ -91,6 +92,8 @@ int unm2r(
     const idx_t k = size(tau);
     const idx_t nA = (side == Side::Left) ? m : n;
 
+    TLAPACK_PROFILE_SCOPE( "unm2r", type_t<matrixC_t>, (side == Side::Left) ? 4.0*n*m*k - 2.0*n*k*k : 4.0*m*n*k - 2.0*m*k*k, 2.0*m*n + double(nA)*k );
+
     // check arguments
     tlapack_check_false( side != Side::Left &&
                      side != Side::Right, -1 );
@@ -17,6 +17,42 @@
 namespace tlapack
 {
 
+    /**
+     * Returns the size of the workspace vector of unmhr.
+     * The arguments are the same as for unmhr itself.
+     *
+     * @return idx_t The size of the required workspace
+     */
+    template <class matrix_t, class vector_t>
+    inline size_type<matrix_t> get_work_unmhr(
+        Side side,
+        Op trans,
+        size_type<matrix_t> ilo,
+        size_type<matrix_t> ihi,
+        const matrix_t &A,
+        const vector_t &tau,
+        const matrix_t &C)
+    {
+        return (side == Side::Left) ? ncols(C) : nrows(C);
+    }
+
+    /**
+     * Returns the size in bytes of the workspace vector of unmhr.
+     * The arguments are the same as for unmhr itself.
+     */
+    template <class matrix_t, class vector_t>
+    inline std::size_t get_worksize_unmhr(
+        Side side,
+        Op trans,
+        size_type<matrix_t> ilo,
+        size_type<matrix_t> ihi,
+        const matrix_t &A,
+        const vector_t &tau,
+        const matrix_t &C)
+    {
+        return get_work_unmhr(side, trans, ilo, ihi, A, tau, C) * sizeof(type_t<matrix_t>);
+    }
+
     /** Applies unitary matrix Q to a matrix C.
      *
      * @param[in] ilo integer
@@ -11,12 +11,62 @@
 #define __TLAPACK_UNMQR_HH__
 
 #include "base/utils.hpp"
+#include "base/profile.hpp"
 #include "base/types.hpp"
 #include "lapack/larft.hpp"
 #include "lapack/larfb.hpp"
 
 namespace tlapack {
 
+/**
+ * Returns the size of the workspace matrix *(opts.workPtr) of unmqr,
+ * which is nb-by-(max(1,n)+nb) if side = Side::Left, and
+ * nb-by-(max(1,m)+nb) if side = Side::Right.
+ * The arguments are the same as for unmqr itself.
+ * 
+ * @return idx_t The number of elements of the required workspace
+ */
+template<
+    class matrixA_t, class matrixC_t,
+    class tau_t, class side_t, class trans_t,
+    class opts_t >
+inline size_type< matrixC_t >
+get_work_unmqr(
+    side_t side, trans_t trans,
+    const matrixA_t& A,
+    const tau_t& tau,
+    const matrixC_t& C,
+    opts_t&& opts )
+{
+    using idx_t = size_type< matrixC_t >;
+    using std::max;
+
+    const idx_t nb = get_nb(opts);
+    const idx_t nw = (side == Side::Left) ? max<idx_t>(1,ncols(C)) : max<idx_t>(1,nrows(C));
+
+    return nb * (nw + nb);
+}
+
+/**
+ * Returns the size in bytes of the workspace matrix of unmqr.
+ * The arguments are the same as for unmqr itself.
+ */
+template<
+    class matrixA_t, class matrixC_t,
+    class tau_t, class side_t, class trans_t,
+    class opts_t >
+inline std::size_t
+get_worksize_unmqr(
+    side_t side, trans_t trans,
+    const matrixA_t& A,
+    const tau_t& tau,
+    const matrixC_t& C,
+    opts_t&& opts )
+{
+    return get_work_unmqr( side, trans, A, tau, C, std::forward<opts_t>(opts) )
+        * sizeof( type_t< matrixC_t > );
+}
+
 /** Applies orthogonal matrix op(Q) to a matrix C using a blocked code.
  *
  * - side = Side::Left  & trans = Op::NoTrans:    $C := Q C$;
@@ -82,6 +132,7 @@ namespace tlapack {
  *      - opts.workPtr Workspace pointer.
  *          - Pointer to a matrix of size (nb)-by-(n+nb) if side = Side::Left.
  *          - Pointer to a matrix of size (nb)-by-(m+nb) if side = Side::Right.
+ *          See get_work_unmqr().
  * 
  * @ingroup geqrf
  */
@@ -116,6 +167,8 @@ int unmqr(
     const idx_t nb = get_nb(opts); // Block size
     auto W = get_work(opts); // (nb)-by-(nw+nb) matrix
 
+    TLAPACK_PROFILE_SCOPE( "unmqr", type_t<matrixC_t>, (side == Side::Left) ? 4.0*n*m*k - 2.0*n*k*k : 4.0*m*n*k - 2.0*m*k*k, 2.0*m*n + double(nA)*k );
+
     // check arguments
     tlapack_check_false( side != Side::Left &&
                      side != Side::Right, -1 );
@@ -146,7 +199,7 @@ int unmqr(
         idx_t ib = min<idx_t>( nb, k-i );
         const auto V = slice( A, pair{i,nA}, pair{i,i+ib} );
         const auto taui = slice( tau, pair{i,i+ib} );
-        auto T = slice( W, pair{nw,nw+ib}, pair{nw,nw+ib} );
+        auto T = slice( W, pair{0,ib}, pair{nw,nw+ib} );
 
         // Form the triangular factor of the block reflector
         // $H = H(i) H(i+1) ... H(i+ib-1)$
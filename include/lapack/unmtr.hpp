@@ -0,0 +1,190 @@
+/// @file unmtr.hpp
+/// Adapted from @see https://github.com/Reference-LAPACK/lapack/tree/master/SRC/zunmtr.f
+//
+// Copyright (c) 2022, University of Colorado Denver. All rights reserved.
+//
+// This file is part of <T>LAPACK.
+// <T>LAPACK is free software: you can redistribute it and/or modify it under
+// the terms of the BSD 3-Clause license. See the accompanying LICENSE file.
+
+#ifndef __TLAPACK_UNMTR_HH__
+#define __TLAPACK_UNMTR_HH__
+
+#include "legacy_api/base/utils.hpp"
+#include "base/utils.hpp"
+#include "base/profile.hpp"
+#include "base/types.hpp"
+#include "base/workspace.hpp"
+#include "lapack/larft.hpp"
+#include "lapack/larfb.hpp"
+
+namespace tlapack
+{
+
+    /**
+     * Options struct for unmtr
+     */
+    template <typename idx_t, typename T>
+    struct unmtr_opts_t {
+        // Blocksize used to apply the block reflectors
+        idx_t nb = 32;
+        // Workspace pointer, if no workspace is provided, one will be allocated internally
+        T* _work=nullptr;
+        // Workspace size
+        idx_t lwork = 0;
+        // Arena used if no workspace is provided. If nullptr, the default
+        // arena of the calling thread is used.
+        workspace_arena* arena = nullptr;
+    };
+
+    /**
+     * Returns the required workspace for unmtr.
+     * The arguments are the same as for unmtr itself.
+     *
+     * @return idx_t The size of the required workspace
+     */
+    template <class matrixA_t, class vector_t, class matrixC_t, typename idx_t = size_type<matrixC_t>, typename TA = type_t<matrixC_t>>
+    idx_t get_work_unmtr(Side side, Uplo uplo, Op trans, matrixA_t &A, vector_t &tau, matrixC_t &C, const unmtr_opts_t<idx_t, TA> &opts = {})
+    {
+        const idx_t nw = (side == Side::Left) ? ncols(C) : nrows(C);
+        idx_t nb = opts.nb;
+
+        // The triangular factor T and the workspace of larfb
+        return (nw + nb) * nb;
+    }
+
+    /** Applies the unitary matrix Q from hetrd to a matrix C using a blocked
+     * code.
+     *
+     * - side = Side::Left  & trans = Op::NoTrans:    $C := Q C$;
+     * - side = Side::Right & trans = Op::NoTrans:    $C := C Q$;
+     * - side = Side::Left  & trans = Op::ConjTrans:  $C := Q^H C$;
+     * - side = Side::Right & trans = Op::ConjTrans:  $C := C Q^H$.
+     *
+     * Q is the product of n-1 elementary reflectors, as returned by hetrd.
+     * Blocks of nb reflectors are aggregated by larft and applied by larfb.
+     *
+     * @return  0 if success
+     *
+     * @param[in] side Specifies which side Q is to be applied.
+     * @param[in] uplo Must have the same value as in the call to hetrd.
+     *      - Uplo::Upper: Q = H_{n-2} ... H_1 H_0;
+     *      - Uplo::Lower: Q = H_0 H_1 ... H_{n-2}.
+     * @param[in] trans The operation $op(Q)$ to be used:
+     *      - Op::NoTrans:      $op(Q) = Q$;
+     *      - Op::ConjTrans:    $op(Q) = Q^H$.
+     *      Op::Trans is a valid value if the data type of A is real.
+     * @param[in] A
+     *      - side = Side::Left:    m-by-m matrix;
+     *      - side = Side::Right:   n-by-n matrix.
+     *      The vectors which define the elementary reflectors, as returned
+     *      by hetrd.
+     * @param[in] tau Vector of length nrows(A)-1.
+     *      Contains the scalar factors of the elementary reflectors.
+     * @param[in,out] C m-by-n matrix.
+     *      On exit, C is replaced by $op(Q) C$ or $C op(Q)$.
+     *
+     * @param[in,out] opts Struct containing the options
+     *      See unmtr_opts_t for more details
+     *
+     * @ingroup heev_computational
+     */
+    template <class matrixA_t, class vector_t, class matrixC_t, typename idx_t = size_type<matrixC_t>, typename TA = type_t<matrixC_t>>
+    int unmtr(Side side, Uplo uplo, Op trans, matrixA_t &A, vector_t &tau, matrixC_t &C, const unmtr_opts_t<idx_t, TA> &opts = {})
+    {
+        using pair = pair<idx_t, idx_t>;
+        using std::min;
+
+        // constants
+        const idx_t m = nrows(C);
+        const idx_t n = ncols(C);
+        const idx_t nq = (side == Side::Left) ? m : n;
+        const idx_t nw = (side == Side::Left) ? n : m;
+        const idx_t k = nq - 1;
+        const idx_t nb = opts.nb;
+
+        TLAPACK_PROFILE_SCOPE( "unmtr", TA, 2.0*nw*nq*nq, 2.0*m*n + 0.5*nq*nq );
+
+        // check arguments
+        tlapack_check_false(side != Side::Left && side != Side::Right, -1);
+        tlapack_check_false(uplo != Uplo::Lower && uplo != Uplo::Upper, -2);
+        tlapack_check_false(trans != Op::NoTrans &&
+                            trans != Op::Trans &&
+                            trans != Op::ConjTrans, -3);
+        tlapack_check_false(trans == Op::Trans && is_complex<matrixA_t>::value, -3);
+        tlapack_check_false(nrows(A) != nq || ncols(A) != nq, -4);
+        tlapack_check_false((idx_t)size(tau) < k, -5);
+        tlapack_check_false(access_denied(dense, write_policy(C)), -6);
+
+        // quick return
+        if (m <= 0 || n <= 0 || nq <= 1)
+            return 0;
+
+        // Get the workspace
+        idx_t required_workspace = get_work_unmtr(side, uplo, trans, A, tau, C, opts);
+        // Use the provided workspace if it is large enough, otherwise borrow
+        // it from the arena
+        local_workspace<TA> workspace( opts._work, opts.lwork, required_workspace, opts.arena );
+        TA* _work = workspace.data();
+
+        // larfb needs a nb-by-nw workspace if side == Side::Left and a
+        // nw-by-nb workspace otherwise
+        auto W = (side == Side::Left)
+            ? legacyMatrix<TA, layout<matrixC_t>>( nb, nw, &_work[0], layout<matrixC_t> == Layout::ColMajor ? nb : nw )
+            : legacyMatrix<TA, layout<matrixC_t>>( nw, nb, &_work[0], layout<matrixC_t> == Layout::ColMajor ? nw : nb );
+        auto T = legacyMatrix<TA, layout<matrixC_t>>( nb, nb, &_work[nw*nb], nb );
+
+        // Loop direction
+        const bool notran = (trans == Op::NoTrans);
+        const bool positiveInc = (uplo == Uplo::Upper)
+            ? ( (side == Side::Left) == notran )
+            : ( (side == Side::Left) != notran );
+        const idx_t nblocks = (k + nb - 1) / nb;
+
+        for (idx_t b = 0; b < nblocks; ++b)
+        {
+            const idx_t i = ((positiveInc) ? b : nblocks - 1 - b) * nb;
+            const idx_t ib = min<idx_t>(nb, k - i);
+
+            const auto taui = slice(tau, pair{i, i + ib});
+            auto Ti = slice(T, pair{0, ib}, pair{0, ib});
+            auto Wi = (side == Side::Left)
+                ? slice(W, pair{0, ib}, pair{0, nw})
+                : slice(W, pair{0, nw}, pair{0, ib});
+
+            if (uplo == Uplo::Upper)
+            {
+                // Q was determined by a call to hetrd with uplo = Uplo::Upper.
+                // The block of reflectors is stored as in a QL factorization
+                // of A(0:nq-1,1:nq)
+                const auto V = slice(A, pair{0, i + ib}, pair{i + 1, i + ib + 1});
+                larft(backward, columnwise_storage, V, taui, Ti);
+
+                // H or H**H is applied to either C[0:i+ib,0:n] or C[0:m,0:i+ib]
+                auto Ci = (side == Side::Left)
+                    ? slice(C, pair{0, i + ib}, pair{0, n})
+                    : slice(C, pair{0, m}, pair{0, i + ib});
+                larfb(side, trans, backward, columnwise_storage, V, Ti, Ci, Wi);
+            }
+            else
+            {
+                // Q was determined by a call to hetrd with uplo = Uplo::Lower.
+                // The block of reflectors is stored as in a QR factorization
+                // of A(1:nq,0:nq-1)
+                const auto V = slice(A, pair{i + 1, nq}, pair{i, i + ib});
+                larft(forward, columnwise_storage, V, taui, Ti);
+
+                // H or H**H is applied to either C[i+1:m,0:n] or C[0:m,i+1:n]
+                auto Ci = (side == Side::Left)
+                    ? slice(C, pair{i + 1, m}, pair{0, n})
+                    : slice(C, pair{0, m}, pair{i + 1, n});
+                larfb(side, trans, forward, columnwise_storage, V, Ti, Ci, Wi);
+            }
+        }
+
+        return 0;
+    }
+
+} // lapack
+
+#endif // __TLAPACK_UNMTR_HH__
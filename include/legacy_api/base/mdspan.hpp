@@ -8,6 +8,7 @@
 #define __TLAPACK_LEGACY_MDSPAN_HH__
 
 #include <experimental/mdspan> // Use mdspan for multidimensional arrays
+#include "plugins/tlapack_legacyArray.hpp" // mdspan has no band storage
 
 namespace tlapack {
 
@@ -94,6 +95,17 @@ namespace internal {
         );
     }
 
+    template< typename T >
+    inline constexpr auto banded_matrix(
+        T* A, 
+        std::experimental::dextents<2>::size_type m, 
+        std::experimental::dextents<2>::size_type n, 
+        std::experimental::dextents<2>::size_type kl, 
+        std::experimental::dextents<2>::size_type ku ) noexcept
+    {
+        return legacyBandedMatrix<T>{ m, n, kl, ku, A };
+    }
+
     template< typename T, typename integral_type >
     inline constexpr auto vector(
         T* x,
@@ -11,6 +11,7 @@
 #ifndef __TLAPACK_LEGACY_GEQR2_HH__
 #define __TLAPACK_LEGACY_GEQR2_HH__
 
+#include "base/workspace.hpp"
 #include "lapack/geqr2.hpp"
 
 namespace tlapack {
@@ -54,12 +55,9 @@ inline int geqr2(
 
     // Local parameters
     int info = 0;
-    work_t* work;
-    if( !is_same_v< TA, Ttau > || n-1 >= m ) {
-        work = new work_t[ (n > 0) ? n-1 : 0 ];
-    } else {
-        work = tau + 1;
-    }
+    const bool use_tau = is_same_v< TA, Ttau > && n-1 < m;
+    local_workspace<work_t> workspace( (use_tau) ? 0 : n-1 );
+    work_t* work = (use_tau) ? (work_t*) tau + 1 : workspace.data();
 
     // Matrix views
     auto A_    = colmajor_matrix( A, m, n, lda );
@@ -68,9 +66,6 @@ inline int geqr2(
     
     info = geqr2( A_, _tau, _work );
 
-    if( !is_same_v< TA, Ttau > || n-1 >= m )
-        delete[] work;
-        
     return info;
 }
 
@@ -11,8 +11,8 @@
 #ifndef __TLAPACK_LEGACY_LARF_HH__
 #define __TLAPACK_LEGACY_LARF_HH__
 
+#include "base/workspace.hpp"
 #include "lapack/larf.hpp"
-#include <memory>
 
 namespace tlapack {
 
@@ -42,10 +42,7 @@ inline void larf(
     tlapack_check_false( incv == 0 );
     tlapack_check_false( ldC < m );
 
-    // scalar_t *work = new scalar_t[ ( side == Side::Left ) ? n : m ];
-    std::unique_ptr<scalar_t[]> work(new scalar_t[
-        ( side == Side::Left ) ? n : m
-    ]);
+    local_workspace<scalar_t> work( ( side == Side::Left ) ? n : m );
 
     // Initialize indexes
     idx_t lenv  = (( side == Side::Left ) ? m : n);
@@ -53,7 +50,7 @@ inline void larf(
     
     // Matrix views
     auto C_ = colmajor_matrix<TC>( C, m, n, ldC );
-    auto _work = vector( &work[0], lwork );
+    auto _work = vector( work.data(), lwork );
 
     tlapack_expr_with_vector(
         _v, TV, lenv, v, incv,
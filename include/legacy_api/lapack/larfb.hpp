@@ -11,6 +11,7 @@
 #ifndef __TLAPACK_LEGACY_LARFB_HH__
 #define __TLAPACK_LEGACY_LARFB_HH__
 
+#include "base/workspace.hpp"
 #include "lapack/larfb.hpp"
 
 namespace tlapack {
@@ -142,7 +143,8 @@ int larfb(
     if (m <= 0 || n <= 0) return 0;
 
     // local variables
-    scalar_t *W = new scalar_t[ (side == Side::Left) ? k*n : m*k ];
+    local_workspace<scalar_t> workspace( (side == Side::Left) ? k*n : m*k );
+    scalar_t *W = workspace.data();
 
     // Views
     const auto V_ = (storeV == StoreV::Columnwise)
@@ -154,10 +156,7 @@ int larfb(
                ? colmajor_matrix<scalar_t>( W, k, n )
                : colmajor_matrix<scalar_t>( W, m, k );
 
-    int info = larfb( side, trans, direct, storeV, V_, T_, C_, W_ );
-
-    delete[] W;
-    return info;
+    return larfb( side, trans, direct, storeV, V_, T_, C_, W_ );
 }
 
 }
@@ -11,6 +11,7 @@
 #ifndef __TLAPACK_LEGACY_UNG2R_HH__
 #define __TLAPACK_LEGACY_UNG2R_HH__
 
+#include "base/workspace.hpp"
 #include "lapack/ung2r.hpp"
 
 #include "tblas.hpp"
@@ -59,7 +60,8 @@ inline int ung2r(
 
     // Local parameters
     int info = 0;
-    TA* work = new TA[ (n > 0) ? n-1 : 0 ];
+    local_workspace<TA> workspace( n-1 );
+    TA* work = workspace.data();
 
     // Matrix views
     auto A_    = colmajor_matrix<TA>( A, m, n, lda );
@@ -68,7 +70,6 @@ inline int ung2r(
     
     info = ung2r( k, A_, _tau, _work );
 
-    delete[] work;
     return info;
 }
 
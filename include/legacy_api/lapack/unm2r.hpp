@@ -11,6 +11,7 @@
 #ifndef __TLAPACK_LEGACY_UNM2R_HH__
 #define __TLAPACK_LEGACY_UNM2R_HH__
 
+#include "base/workspace.hpp"
 #include "lapack/unm2r.hpp"
 
 namespace tlapack {
@@ -76,7 +77,8 @@ inline int unm2r(
     if ((m == 0) || (n == 0) || (k == 0))
         return 0;
 
-    scalar_t* work = new scalar_t[ (q > 0) ? q : 0 ];
+    local_workspace<scalar_t> workspace( q );
+    scalar_t* work = workspace.data();
 
     // Matrix views
     const auto A_ = colmajor_matrix<TA>( (TA*)A, q, k, lda );
@@ -84,10 +86,7 @@ inline int unm2r(
     auto C_ = colmajor_matrix<TC>( C, m, n, ldc );
     auto _work = vector( work, q );
 
-    int info = unm2r( side, trans, A, _tau, C_, _work );
-
-    delete[] work;
-    return info;
+    return unm2r( side, trans, A_, _tau, C_, _work );
 }
 
 }
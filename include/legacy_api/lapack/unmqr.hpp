@@ -10,7 +10,7 @@
 #ifndef __TLAPACK_LEGACY_UNMQR_HH__
 #define __TLAPACK_LEGACY_UNMQR_HH__
 
-#include <memory>
+#include "base/workspace.hpp"
 #include "lapack/unmqr.hpp"
 
 namespace tlapack {
@@ -98,7 +98,7 @@ inline int unmqr(
                      trans != Op::ConjTrans, -2 );
     
     // Allocate work
-    std::unique_ptr<scalar_t[]> _work( new scalar_t[ nb * (nw + nb) ] );
+    local_workspace<scalar_t> _work( nb * (nw + nb) );
                 
     // Matrix views
     const auto A_ = (side == Side::Left)
@@ -106,7 +106,7 @@ inline int unmqr(
             : colmajor_matrix<TA>( (TA*)A, n, k, lda );
     const auto _tau = vector( (TA*)tau, k );
     auto C_ = colmajor_matrix<TC>( C, m, n, ldc );
-    auto W_ = colmajor_matrix<scalar_t>( &_work[0], nb, nw+nb );
+    auto W_ = colmajor_matrix<scalar_t>( _work.data(), nb, nw+nb );
 
     // Options
     struct {
@@ -8,6 +8,7 @@
 #define __TLAPACK_LEGACY_ARRAY_HH__
 
 #include <cassert>
+#include <cstddef>
 
 #include "legacy_api/base/types.hpp"
 #include "base/exceptionHandling.hpp"
@@ -55,6 +56,47 @@ namespace tlapack {
         }
     };
 
+    /** Legacy matrix whose layout is known at run time.
+     * 
+     * It describes the memory of a strided matrix, e.g., an mdspan with
+     * layout_stride, for the optimized BLAS. The layout is
+     * Layout::ColMajor if the rows have unit stride, Layout::RowMajor if
+     * the columns have unit stride, and Layout::Unspecified if the BLAS
+     * cannot represent the matrix.
+     * 
+     * @tparam T Floating-point type
+     */
+    template< typename T >
+    struct legacyStridedMatrix {
+        using idx_t = TLAPACK_SIZE_T;  ///< Index type
+        idx_t m, n;                 ///< Sizes
+        T* ptr;                     ///< Pointer to array in memory
+        idx_t ldim;                 ///< Leading dimension
+        Layout layout;              ///< Layout
+
+        /** Strides may be negative, in which case the layout is
+         * Layout::Unspecified.
+         * 
+         * @param rowStride Distance in memory between A(i,j) and A(i+1,j).
+         * @param colStride Distance in memory between A(i,j) and A(i,j+1).
+         */
+        inline constexpr legacyStridedMatrix(
+            idx_t m, idx_t n, T* ptr, std::ptrdiff_t rowStride, std::ptrdiff_t colStride )
+        : m(m), n(n), ptr(ptr), ldim(0), layout(Layout::Unspecified)
+        {
+            tlapack_check_false( m < 0 );
+            tlapack_check_false( n < 0 );
+            if( (rowStride == 1 || m <= 1) && colStride >= std::ptrdiff_t(m) && colStride >= 1 ) {
+                layout = Layout::ColMajor;
+                ldim = colStride;
+            }
+            else if( (colStride == 1 || n <= 1) && rowStride >= std::ptrdiff_t(n) && rowStride >= 1 ) {
+                layout = Layout::RowMajor;
+                ldim = rowStride;
+            }
+        }
+    };
+
     /** Legacy vector.
      * 
      * @tparam T Floating-point type
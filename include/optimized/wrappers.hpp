@@ -10,9 +10,51 @@
 
 #include "blas/wrappers.hh" // from BLAS++
 #include "base/utils.hpp"
+#include "base/dispatch.hpp"
+
+// Template implementations used for small sizes, see optblas_nmin(), and
+// for the calls that cannot be forwarded to the library
+#include "blas/gemm.hpp"
+#include "blas/gemv.hpp"
+#include "blas/ger.hpp"
+#include "blas/trmm.hpp"
+#include "blas/trsm.hpp"
+#include "blas/syrk.hpp"
 
 namespace tlapack {
 
+namespace internal {
+
+/**
+ * The optimized BLAS sees a matrix stored in the layout opposite to the one
+ * of the call as the transpose of the matrix. Sets top such that
+ * top(A^T) = op(A), and returns false if there is no such Op, i.e., for
+ * Op::ConjTrans in complex arithmetic.
+ */
+template< class T >
+inline bool transposed_op( Op op, Op& top )
+{
+    if( op == Op::NoTrans )
+        top = Op::Trans;
+    else if( op == Op::Trans || is_same_v< T, real_type<T> > )
+        top = Op::NoTrans;
+    else
+        return false;
+    return true;
+}
+
+/**
+ * True if the optimized BLAS can represent a matrix of the given layout.
+ * The layout of a strided matrix, e.g., legacyStridedMatrix, is known only
+ * at run time and is Layout::Unspecified if neither of its strides is 1.
+ */
+constexpr bool blas_layout( Layout L ) noexcept
+{
+    return ( L == Layout::ColMajor ) || ( L == Layout::RowMajor );
+}
+
+}  // namespace internal
+
 // =============================================================================
 // Level 1 BLAS wrappers
 
@@ -289,7 +331,7 @@ template<
     class vectorX_t, class vectorY_t, 
     class alpha_t, class beta_t,
     class T = type_t<vectorY_t>,
-    enable_if_allow_optblas_t<
+    enable_if_allow_optblas_mixed_t<
         pair< alpha_t, T >,
         pair< matrixA_t, T >,
         pair< vectorX_t, T >,
@@ -316,6 +358,10 @@ void gemv(
     const idx_t incx = (_x.direction == Direction::Forward) ? _x.inc : -_x.inc;
     const idx_t incy = (_y.direction == Direction::Forward) ? _y.inc : -_y.inc;
 
+    if( internal::use_template_blas<T>( optblas_routine::gemv, std::max(m, n),
+                                        internal::blas_layout( A_.layout ) ) )
+        return internal::gemv_template( trans, alpha, A, x, beta, y );
+
     return ::blas::gemv(
         (::blas::Layout) A_.layout,
         (::blas::Op) trans,
@@ -332,7 +378,7 @@ template<
     class vectorX_t, class vectorY_t,
     class alpha_t,
     class T = type_t<matrixA_t>,
-    enable_if_allow_optblas_t<
+    enable_if_allow_optblas_mixed_t<
         pair< alpha_t, T >,
         pair< matrixA_t, T >,
         pair< vectorX_t, T >,
@@ -358,6 +404,10 @@ void ger(
     const idx_t incx = (_x.direction == Direction::Forward) ? _x.inc : -_x.inc;
     const idx_t incy = (_y.direction == Direction::Forward) ? _y.inc : -_y.inc;
 
+    if( internal::use_template_blas<T>( optblas_routine::ger, std::max(m, n),
+                                        internal::blas_layout( A_.layout ) ) )
+        return internal::ger_template( alpha, x, y, A );
+
     return ::blas::ger(
         (::blas::Layout) A_.layout,
         m, n,
@@ -743,7 +793,7 @@ template<
     class alpha_t, 
     class beta_t,
     class T  = type_t<matrixC_t>,
-    enable_if_allow_optblas_t<
+    enable_if_allow_optblas_mixed_t<
         pair< matrixA_t, T >,
         pair< matrixB_t, T >,
         pair< matrixC_t, T >,
@@ -771,9 +821,21 @@ void gemm(
     const auto& n = C_.n;
     const auto& k = (transA == Op::NoTrans) ? A_.n : A_.m;
 
+    // A and B may be stored in the other layout than C
+    Op opA = transA, opB = transB;
+    const bool can_forward =
+        internal::blas_layout( A_.layout ) &&
+        internal::blas_layout( B_.layout ) &&
+        internal::blas_layout( C_.layout ) &&
+        ( A_.layout == C_.layout || internal::transposed_op<T>( transA, opA ) ) &&
+        ( B_.layout == C_.layout || internal::transposed_op<T>( transB, opB ) );
+
+    if( internal::use_template_blas<T>( optblas_routine::gemm, std::max({m, n, k}), can_forward ) )
+        return internal::gemm_template( transA, transB, alpha, A, B, beta, C );
+
     return ::blas::gemm(
-        (::blas::Layout) A_.layout,
-        (::blas::Op) transA, (::blas::Op) transB, 
+        (::blas::Layout) C_.layout,
+        (::blas::Op) opA, (::blas::Op) opB, 
         m, n, k,
         alpha,
         A_.ptr, A_.ldim,
@@ -1016,7 +1078,7 @@ template<
     class matrixA_t, class matrixC_t, 
     class alpha_t, class beta_t,
     class T  = type_t<matrixC_t>,
-    enable_if_allow_optblas_t<
+    enable_if_allow_optblas_mixed_t<
         pair< matrixA_t, T >,
         pair< matrixC_t, T >,
         pair< alpha_t,   T >,
@@ -1038,10 +1100,16 @@ void syrk(
     const auto& n = C_.n;
     const auto& k = (trans == Op::NoTrans) ? A_.n : A_.m;
 
+    // A may be stored in the other layout than C
+    Op opA = trans;
+    if( !internal::blas_layout( A_.layout ) || !internal::blas_layout( C_.layout ) ||
+        ( A_.layout != C_.layout && !internal::transposed_op<T>( trans, opA ) ) )
+        return internal::syrk_template( uplo, trans, alpha, A, beta, C );
+
     return ::blas::syrk(
-        (::blas::Layout) A_.layout,
+        (::blas::Layout) C_.layout,
         (::blas::Uplo) uplo,
-        (::blas::Op) trans, 
+        (::blas::Op) opA, 
         n, k,
         alpha,
         A_.ptr, A_.ldim,
@@ -1120,7 +1188,7 @@ void syr2k(
  */
 template< class matrixA_t, class matrixB_t, class alpha_t,
     class T  = type_t<matrixB_t>,
-    enable_if_allow_optblas_t<
+    enable_if_allow_optblas_mixed_t<
         pair< matrixA_t, T >,
         pair< matrixB_t, T >,
         pair< alpha_t,   T >
@@ -1144,11 +1212,25 @@ void trmm(
     const auto& m = B_.m;
     const auto& n = B_.n;
 
+    // A may be stored in the other layout than B. Its transpose has the
+    // other triangle.
+    Uplo uploA = uplo;
+    Op opA = trans;
+    bool can_forward =
+        internal::blas_layout( A_.layout ) && internal::blas_layout( B_.layout );
+    if( can_forward && A_.layout != B_.layout ) {
+        uploA = (uplo == Uplo::Upper) ? Uplo::Lower : Uplo::Upper;
+        can_forward = internal::transposed_op<T>( trans, opA );
+    }
+
+    if( internal::use_template_blas<T>( optblas_routine::trmm, std::max(m, n), can_forward ) )
+        return internal::trmm_template( side, uplo, trans, diag, alpha, A, B );
+
     return ::blas::trmm(
-        (::blas::Layout) A_.layout,
+        (::blas::Layout) B_.layout,
         (::blas::Side) side,
-        (::blas::Uplo) uplo,
-        (::blas::Op) trans,
+        (::blas::Uplo) uploA,
+        (::blas::Op) opA,
         (::blas::Diag) diag,
         m, n,
         alpha,
@@ -1158,7 +1240,7 @@ void trmm(
 
 template< class matrixA_t, class matrixB_t, class alpha_t,
     class T  = type_t<matrixB_t>,
-    enable_if_allow_optblas_t<
+    enable_if_allow_optblas_mixed_t<
         pair< matrixA_t, T >,
         pair< matrixB_t, T >,
         pair< alpha_t,   T >
@@ -1182,11 +1264,25 @@ void trsm(
     const auto& m = B_.m;
     const auto& n = B_.n;
 
+    // A may be stored in the other layout than B. Its transpose has the
+    // other triangle.
+    Uplo uploA = uplo;
+    Op opA = trans;
+    bool can_forward =
+        internal::blas_layout( A_.layout ) && internal::blas_layout( B_.layout );
+    if( can_forward && A_.layout != B_.layout ) {
+        uploA = (uplo == Uplo::Upper) ? Uplo::Lower : Uplo::Upper;
+        can_forward = internal::transposed_op<T>( trans, opA );
+    }
+
+    if( internal::use_template_blas<T>( optblas_routine::trsm, std::max(m, n), can_forward ) )
+        return internal::trsm_template( side, uplo, trans, diag, alpha, A, B );
+
     return ::blas::trsm(
-        (::blas::Layout) A_.layout,
+        (::blas::Layout) B_.layout,
         (::blas::Side) side,
-        (::blas::Uplo) uplo,
-        (::blas::Op) trans,
+        (::blas::Uplo) uploA,
+        (::blas::Op) opA,
         (::blas::Diag) diag,
         m, n,
         alpha,
@@ -8,8 +8,10 @@
 #ifndef __TLAPACK_EIGEN_HH__
 #define __TLAPACK_EIGEN_HH__
 
+#include <algorithm>
 #include <Eigen/Core>
 #include "base/arrayTraits.hpp"
+#include "legacy_api/legacyArray.hpp"
 
 namespace tlapack{
 
@@ -223,6 +225,109 @@ namespace tlapack{
         return A.diagonal( diagIdx );
     }
 
+    // -----------------------------------------------------------------------------
+    // Layout
+
+    namespace internal {
+
+        /// Layout of an Eigen expression with direct access to the memory,
+        /// Layout::Unspecified if it has no unit inner stride
+        template< class T >
+        constexpr Layout eigen_layout() noexcept
+        {
+            return ( (int(T::Flags) & Eigen::DirectAccessBit) == 0 ||
+                     int(T::InnerStrideAtCompileTime) != 1 )
+                ? Layout::Unspecified
+                : (int(T::Flags) & Eigen::RowMajorBit)
+                    ? Layout::RowMajor
+                    : Layout::ColMajor;
+        }
+
+        /// True if T has direct access to the memory
+        template< class T >
+        constexpr bool eigen_direct_access() noexcept
+        {
+            return (int(T::Flags) & Eigen::DirectAccessBit) != 0;
+        }
+
+    } // namespace internal
+
+    template< class S, int R, int C, int O, int MR, int MC >
+    constexpr Layout layout< Eigen::Matrix<S,R,C,O,MR,MC> > =
+        internal::eigen_layout< Eigen::Matrix<S,R,C,O,MR,MC> >();
+
+    template< class S, int R, int C, int O, int MR, int MC >
+    constexpr Layout layout< Eigen::Array<S,R,C,O,MR,MC> > =
+        internal::eigen_layout< Eigen::Array<S,R,C,O,MR,MC> >();
+
+    template< class XprType, int BlockRows, int BlockCols, bool InnerPanel >
+    constexpr Layout layout< Eigen::Block<XprType,BlockRows,BlockCols,InnerPanel> > =
+        internal::eigen_layout< Eigen::Block<XprType,BlockRows,BlockCols,InnerPanel> >();
+
+    template< class PlainObjectType, int MapOptions, class StrideType >
+    constexpr Layout layout< Eigen::Map<PlainObjectType,MapOptions,StrideType> > =
+        internal::eigen_layout< Eigen::Map<PlainObjectType,MapOptions,StrideType> >();
+
+    template< class PlainObjectType, int Options, class StrideType >
+    constexpr Layout layout< Eigen::Ref<PlainObjectType,Options,StrideType> > =
+        internal::eigen_layout< Eigen::Ref<PlainObjectType,Options,StrideType> >();
+
+    // -----------------------------------------------------------------------------
+    // Convert to legacy array
+
+    // Matrix with a compile-time layout
+    template< class T,
+        std::enable_if_t<
+            internal::eigen_layout<T>() != Layout::Unspecified
+        , int > = 0
+    >
+    inline constexpr auto
+    legacy_matrix( const Eigen::DenseBase<T>& A ) noexcept
+    {
+        using idx_t = typename legacyMatrix<typename T::Scalar>::idx_t;
+        const T& A_ = A.derived();
+        return legacyMatrix< typename T::Scalar, internal::eigen_layout<T>() >(
+            A_.rows(), A_.cols(),
+            const_cast< typename T::Scalar* >( A_.data() ),
+            std::max< idx_t >( 1, A_.outerStride() ) );
+    }
+
+    // Strided matrix, e.g., Map<MatrixXd, 0, Stride<Dynamic,Dynamic>>. The
+    // layout is known at run time.
+    template< class T,
+        std::enable_if_t<
+            internal::eigen_direct_access<T>() &&
+            internal::eigen_layout<T>() == Layout::Unspecified
+        , int > = 0
+    >
+    inline constexpr auto
+    legacy_matrix( const Eigen::DenseBase<T>& A ) noexcept
+    {
+        const T& A_ = A.derived();
+        return legacyStridedMatrix< typename T::Scalar >(
+            A_.rows(), A_.cols(),
+            const_cast< typename T::Scalar* >( A_.data() ),
+            A_.rowStride(), A_.colStride() );
+    }
+
+    // Vector, i.e., a matrix with one row or column at compile time
+    template< class T,
+        std::enable_if_t<
+            internal::eigen_direct_access<T>() &&
+            T::IsVectorAtCompileTime
+        , int > = 0
+    >
+    inline constexpr auto
+    legacy_vector( const Eigen::DenseBase<T>& v ) noexcept
+    {
+        using idx_t = typename legacyMatrix<typename T::Scalar>::idx_t;
+        const T& v_ = v.derived();
+        return legacyVector< typename T::Scalar, idx_t >(
+            v_.size(),
+            const_cast< typename T::Scalar* >( v_.data() ),
+            v_.innerStride() );
+    }
+
 } // namespace tlapack
 
 #endif // __TLAPACK_EIGEN_HH__
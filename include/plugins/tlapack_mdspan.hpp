@@ -7,6 +7,7 @@
 #ifndef __TLAPACK_MDSPAN_HH__
 #define __TLAPACK_MDSPAN_HH__
 
+#include <algorithm>
 #include <experimental/mdspan>
 
 #include "base/arrayTraits.hpp"
@@ -164,40 +165,72 @@ namespace tlapack {
 
     #undef isSlice
 
+    // -----------------------------------------------------------------------------
+    // Layout
+
+    template< class ET, class Exts, class AP >
+    constexpr Layout layout< mdspan<ET,Exts,std::experimental::layout_left,AP> > =
+        ( Exts::rank() == 2 ) ? Layout::ColMajor : Layout::Unspecified;
+
+    template< class ET, class Exts, class AP >
+    constexpr Layout layout< mdspan<ET,Exts,std::experimental::layout_right,AP> > =
+        ( Exts::rank() == 2 ) ? Layout::RowMajor : Layout::Unspecified;
+
     // -----------------------------------------------------------------------------
     // Convert to legacy array
+    //
+    // Only mdspans that access the memory directly, i.e., with the
+    // default_accessor, are converted. The layout of a layout_stride matrix is
+    // known at run time, see legacyStridedMatrix.
 
-    // /// alias has_blas_type for arrays
-    // template< class ET, class Exts, class LP, class AP,
-    //     std::enable_if_t<
-    //     /* Requires: */
-    //         has_blas_type_v<ET> &&
-    //         Exts::rank() <= 2 &&
-    //         LP::template mapping<Exts>::is_always_strided()
-    //     , bool > = true
-    // >
-    // struct has_blas_type< mdspan<ET,Exts,LP,AP> > {
-    //     using type = ET;
-    //     static constexpr bool value =
-    //         has_blas_type_v<type> && ;
-    // };
-
-    // template< class ET, class Exts, class LP, class AP,
-    //     std::enable_if_t<
-    //     /* Requires: */
-    //         LP::template mapping<Exts>::is_always_strided() &&
-    //         Exts::rank() == 2
-    //     , bool > = true
-    // >
-    // inline constexpr auto
-    // legacy_matrix( const mdspan<ET,Exts,LP,AP>& A ) {
-    //     if( A.stride(0) == 1 )
-    //         return legacyMatrix<ET,Layout::ColMajor>( A.extent(0), A.extent(1), A.data(), A.stride(1) );
-    //     else if( A.stride(1) == 1 )
-    //         return legacyMatrix<ET,Layout::RowMajor>( A.extent(0), A.extent(1), A.data(), A.stride(0) );
-    //     else
-    //         return legacyMatrix<ET>( 0, 0, nullptr, 0 );
-    // }
+    template< class ET, class Exts,
+        std::enable_if_t< (Exts::rank() == 2), int > = 0
+    >
+    inline constexpr auto
+    legacy_matrix( const mdspan<ET,Exts,std::experimental::layout_left,std::experimental::default_accessor<ET>>& A ) noexcept
+    {
+        using idx_t = typename legacyMatrix<ET>::idx_t;
+        return legacyMatrix<ET,Layout::ColMajor>(
+            A.extent(0), A.extent(1), A.data(),
+            std::max< idx_t >( 1, A.stride(1) ) );
+    }
+
+    template< class ET, class Exts,
+        std::enable_if_t< (Exts::rank() == 2), int > = 0
+    >
+    inline constexpr auto
+    legacy_matrix( const mdspan<ET,Exts,std::experimental::layout_right,std::experimental::default_accessor<ET>>& A ) noexcept
+    {
+        using idx_t = typename legacyMatrix<ET>::idx_t;
+        return legacyMatrix<ET,Layout::RowMajor>(
+            A.extent(0), A.extent(1), A.data(),
+            std::max< idx_t >( 1, A.stride(0) ) );
+    }
+
+    template< class ET, class Exts,
+        std::enable_if_t< (Exts::rank() == 2), int > = 0
+    >
+    inline constexpr auto
+    legacy_matrix( const mdspan<ET,Exts,std::experimental::layout_stride,std::experimental::default_accessor<ET>>& A ) noexcept
+    {
+        return legacyStridedMatrix<ET>(
+            A.extent(0), A.extent(1), A.data(),
+            A.stride(0), A.stride(1) );
+    }
+
+    template< class ET, class Exts, class LP,
+        std::enable_if_t<
+            (Exts::rank() == 1) &&
+            LP::template mapping<Exts>::is_always_strided()
+        , int > = 0
+    >
+    inline constexpr auto
+    legacy_vector( const mdspan<ET,Exts,LP,std::experimental::default_accessor<ET>>& v ) noexcept
+    {
+        using idx_t = typename legacyVector<ET>::idx_t;
+        return legacyVector<ET,idx_t>( v.extent(0), v.data(),
+            ( v.extent(0) <= 1 ) ? idx_t(1) : idx_t( v.stride(0) ) );
+    }
 
 } // namespace tlapack
 
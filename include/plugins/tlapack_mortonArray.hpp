@@ -0,0 +1,883 @@
+/// @file tlapack_mortonArray.hpp
+/// @brief Matrix stored in the recursive Z-order (Morton) block layout
+//
+// Copyright (c) 2022, University of Colorado Denver. All rights reserved.
+//
+// This file is part of <T>LAPACK.
+// <T>LAPACK is free software: you can redistribute it and/or modify it under
+// the terms of the BSD 3-Clause license. See the accompanying LICENSE file.
+
+#ifndef __TLAPACK_MORTONARRAY_HH__
+#define __TLAPACK_MORTONARRAY_HH__
+
+#include <algorithm>
+#include <cassert>
+#include <type_traits>
+#include <utility>
+
+#include "legacy_api/legacyArray.hpp"
+#include "plugins/tlapack_legacyArray.hpp"
+#include "base/arrayTraits.hpp"
+#include "base/parallel.hpp"
+#include "blas/gemm.hpp"
+#include "blas/herk.hpp"
+#include "blas/trmm.hpp"
+#include "blas/trsm.hpp"
+
+namespace tlapack {
+
+    namespace internal {
+
+        /**
+         * Moves from a node of the recursive layout to its child that
+         * contains the element (ii,jj) of the node.
+         *
+         * A node of M-by-N elements is a leaf if M <= mb and N <= nb. Other
+         * nodes are split at M/2 and N/2, as the recursive routines split
+         * the matrix, e.g., potrf2 and lauum_recursive. A side that is
+         * smaller than its leaf size is not split. The children are stored
+         * one after the other in Z-order: top-left, top-right, bottom-left
+         * and bottom-right.
+         */
+        template< typename T, class idx_t >
+        inline void morton_child(
+            T*& p, idx_t& M, idx_t& N, idx_t& ii, idx_t& jj,
+            idx_t mb, idx_t nb ) noexcept
+        {
+            const idx_t m1 = (M > mb) ? M/2 : M;
+            const idx_t n1 = (N > nb) ? N/2 : N;
+            if( ii < m1 )
+                M = m1;
+            else {
+                p += m1*N;
+                ii -= m1;
+                M -= m1;
+            }
+            if( jj < n1 )
+                N = n1;
+            else {
+                p += M*n1;
+                jj -= n1;
+                N -= n1;
+            }
+        }
+
+    } // namespace internal
+
+    /** Matrix in the recursive Z-order (Morton) block layout.
+     *
+     * The matrix is split recursively in four blocks, at half its number of
+     * rows and columns, until the blocks have at most mb rows and nb
+     * columns. The blocks of each level are stored one after the other in
+     * Z-order, and the leaves are stored contiguously in column-major order.
+     * The storage has exactly m*n elements.
+     *
+     * The recursive routines, e.g., potrf2, lauum_recursive and transpose,
+     * split the matrix at the same places. The blocks they work on are the
+     * blocks of the layout, so that each level of the recursion touches
+     * contiguous memory, and the leaves of the recursion are contiguous.
+     *
+     * A mortonMatrix does not own its memory. A slice is a window (i0,j0)
+     * in the smallest block of the layout, called node, that contains it.
+     *
+     * @tparam T Floating-point type
+     */
+    template< typename T >
+    struct mortonMatrix {
+        using idx_t = TLAPACK_SIZE_T;  ///< Index type
+        idx_t m, n;                 ///< Sizes
+        idx_t mb, nb;               ///< Maximum sizes of the leaves
+        T* ptr;                     ///< Pointer to the node
+        idx_t M, N;                 ///< Sizes of the node
+        idx_t i0, j0;               ///< Position of A(0,0) in the node
+
+        /// Number of elements of the storage of a m-by-n matrix
+        static constexpr idx_t
+        storage_size( idx_t m, idx_t n, idx_t mb, idx_t nb ) noexcept {
+            return m * n;
+        }
+
+        inline constexpr T&
+        operator()( idx_t i, idx_t j ) const noexcept {
+            assert( i >= 0);
+            assert( i < m);
+            assert( j >= 0);
+            assert( j < n);
+            T* p = ptr;
+            idx_t Mk = M, Nk = N;
+            idx_t ii = i + i0, jj = j + j0;
+            while( Mk > mb || Nk > nb )
+                internal::morton_child( p, Mk, Nk, ii, jj, mb, nb );
+            return p[ ii + jj*Mk ];
+        }
+
+        /// True if the node is a leaf, i.e., the matrix is column-major
+        inline constexpr bool is_leaf() const noexcept {
+            return M <= mb && N <= nb;
+        }
+
+        /// Matrix that uses all the storage of m-by-n matrix
+        inline constexpr mortonMatrix( idx_t m, idx_t n, idx_t mb, idx_t nb, T* ptr )
+        : m(m), n(n), mb(mb), nb(nb), ptr(ptr), M(m), N(n), i0(0), j0(0)
+        {
+            tlapack_check_false( m < 0 );
+            tlapack_check_false( n < 0 );
+            tlapack_check_false( mb <= 0 );
+            tlapack_check_false( nb <= 0 );
+        }
+
+        /// Submatrix of a matrix in the recursive layout
+        inline constexpr mortonMatrix( idx_t m, idx_t n, idx_t mb, idx_t nb, T* ptr, idx_t M, idx_t N, idx_t i0, idx_t j0 )
+        : m(m), n(n), mb(mb), nb(nb), ptr(ptr), M(M), N(N), i0(i0), j0(j0)
+        {
+            tlapack_check_false( m < 0 );
+            tlapack_check_false( n < 0 );
+            tlapack_check_false( i0 + m > M );
+            tlapack_check_false( j0 + n > N );
+        }
+    };
+
+    /** Vector in a matrix in the recursive layout, e.g., a row, a column or
+     * a diagonal.
+     *
+     * The element k is A(i+k*di, j+k*dj).
+     *
+     * @tparam T Floating-point type
+     */
+    template< typename T >
+    struct mortonVector {
+        using idx_t = TLAPACK_SIZE_T;  ///< Index type
+        mortonMatrix<T> A;          ///< Matrix that contains the vector
+        idx_t n;                    ///< Size
+        idx_t i, j;                 ///< Position of the first element in A
+        idx_t di, dj;               ///< Increments, either 0 or 1
+
+        inline constexpr T&
+        operator[]( idx_t k ) const noexcept {
+            assert( k >= 0);
+            assert( k < n);
+            return A( i + k*di, j + k*dj );
+        }
+
+        inline constexpr mortonVector( const mortonMatrix<T>& A, idx_t n, idx_t i, idx_t j, idx_t di, idx_t dj )
+        : A(A), n(n), i(i), j(j), di(di), dj(dj)
+        {
+            tlapack_check_false( n < 0 );
+        }
+    };
+
+    // -----------------------------------------------------------------------------
+    // Data description
+
+    // Number of rows
+    template< typename T >
+    inline constexpr auto
+    nrows( const mortonMatrix<T>& A ){ return A.m; }
+
+    // Number of columns
+    template< typename T >
+    inline constexpr auto
+    ncols( const mortonMatrix<T>& A ){ return A.n; }
+
+    // Read policy
+    template< typename T >
+    inline constexpr auto
+    read_policy( const mortonMatrix<T>& A ) {
+        return dense;
+    }
+
+    // Write policy
+    template< typename T >
+    inline constexpr auto
+    write_policy( const mortonMatrix<T>& A ) {
+        return dense;
+    }
+
+    // Size
+    template< typename T >
+    inline constexpr auto
+    size( const mortonVector<T>& x ){ return x.n; }
+
+    // -----------------------------------------------------------------------------
+    // Data blocks
+    //
+    // The slices of matrices descend to the smallest node that contains
+    // them, which costs O(log(n/nb)).
+
+    #define isSlice(SliceSpec) !std::is_convertible< SliceSpec, typename mortonMatrix<T>::idx_t >::value
+
+    // Slice
+    template< typename T, class SliceSpecRow, class SliceSpecCol,
+        typename std::enable_if< isSlice(SliceSpecRow) && isSlice(SliceSpecCol), int >::type = 0
+    >
+    inline constexpr auto
+    slice( const mortonMatrix<T>& A, SliceSpecRow&& rows, SliceSpecCol&& cols ) noexcept {
+        assert( rows.first >= 0 and rows.first <= nrows(A));
+        assert( rows.second >= 0 and rows.second <= nrows(A));
+        assert( rows.first <= rows.second );
+        assert( cols.first >= 0 and cols.first <= ncols(A));
+        assert( cols.second >= 0 and cols.second <= ncols(A));
+        assert( cols.first <= cols.second );
+        using idx_t = typename mortonMatrix<T>::idx_t;
+
+        const idx_t m = rows.second - rows.first;
+        const idx_t n = cols.second - cols.first;
+        T* p = A.ptr;
+        idx_t M = A.M, N = A.N;
+        idx_t ii = A.i0 + rows.first, jj = A.j0 + cols.first;
+
+        // Descend while the slice is in one child of the node
+        if( m > 0 && n > 0 ) {
+            while( M > A.mb || N > A.nb ) {
+                const idx_t m1 = (M > A.mb) ? M/2 : M;
+                const idx_t n1 = (N > A.nb) ? N/2 : N;
+                if( (ii < m1 && ii + m > m1) || (jj < n1 && jj + n > n1) )
+                    break;
+                internal::morton_child( p, M, N, ii, jj, A.mb, A.nb );
+            }
+        }
+
+        return mortonMatrix<T>( m, n, A.mb, A.nb, p, M, N, ii, jj );
+    }
+
+    #undef isSlice
+
+    // Slice
+    template< typename T, class SliceSpecCol >
+    inline constexpr auto
+    slice( const mortonMatrix<T>& A, typename mortonMatrix<T>::idx_t rowIdx, SliceSpecCol&& cols ) noexcept {
+        assert( cols.first >= 0 and cols.first <= ncols(A));
+        assert( cols.second >= 0 and cols.second <= ncols(A));
+        assert( cols.first <= cols.second );
+        assert( rowIdx >= 0 and rowIdx < nrows(A));
+        return mortonVector<T>( A, cols.second-cols.first, rowIdx, cols.first, 0, 1 );
+    }
+
+    // Slice
+    template< typename T, class SliceSpecRow >
+    inline constexpr auto
+    slice( const mortonMatrix<T>& A, SliceSpecRow&& rows, typename mortonMatrix<T>::idx_t colIdx = 0 ) noexcept {
+        assert( rows.first >= 0 and rows.first <= nrows(A));
+        assert( rows.second >= 0 and rows.second <= nrows(A));
+        assert( rows.first <= rows.second );
+        assert( colIdx >= 0 and colIdx < ncols(A));
+        return mortonVector<T>( A, rows.second-rows.first, rows.first, colIdx, 1, 0 );
+    }
+
+    // Rows
+    template< typename T, class SliceSpec >
+    inline constexpr auto
+    rows( const mortonMatrix<T>& A, SliceSpec&& rows ) noexcept {
+        using idx_t = typename mortonMatrix<T>::idx_t;
+        return slice( A, std::forward<SliceSpec>(rows), std::pair<idx_t,idx_t>{ 0, A.n } );
+    }
+
+    // Row
+    template< typename T >
+    inline constexpr auto
+    row( const mortonMatrix<T>& A, typename mortonMatrix<T>::idx_t rowIdx ) noexcept {
+        assert( rowIdx >= 0 and rowIdx < nrows(A));
+        return mortonVector<T>( A, A.n, rowIdx, 0, 0, 1 );
+    }
+
+    // Columns
+    template< typename T, class SliceSpec >
+    inline constexpr auto
+    cols( const mortonMatrix<T>& A, SliceSpec&& cols ) noexcept {
+        using idx_t = typename mortonMatrix<T>::idx_t;
+        return slice( A, std::pair<idx_t,idx_t>{ 0, A.m }, std::forward<SliceSpec>(cols) );
+    }
+
+    // Column
+    template< typename T >
+    inline constexpr auto
+    col( const mortonMatrix<T>& A, typename mortonMatrix<T>::idx_t colIdx ) noexcept {
+        assert( colIdx >= 0 and colIdx < ncols(A));
+        return mortonVector<T>( A, A.m, 0, colIdx, 1, 0 );
+    }
+
+    // Diagonal
+    template< typename T, class int_t >
+    inline constexpr auto
+    diag( const mortonMatrix<T>& A, int_t diagIdx = 0 ) noexcept {
+
+        using idx_t = typename mortonMatrix<T>::idx_t;
+
+        const idx_t i = (diagIdx >= 0) ? 0 : -diagIdx;
+        const idx_t j = (diagIdx >= 0) ? diagIdx : 0;
+        const idx_t n = (diagIdx >= 0)
+                    ? std::min( A.m+diagIdx, A.n ) - (idx_t) diagIdx
+                    : std::min( A.m, A.n-diagIdx ) + (idx_t) diagIdx;
+
+        return mortonVector<T>( A, n, i, j, 1, 1 );
+    }
+
+    // slice
+    template< typename T, class SliceSpec >
+    inline constexpr auto
+    slice( const mortonVector<T>& v, SliceSpec&& rows ) noexcept {
+        assert( rows.first >= 0 and rows.first <= size(v));
+        assert( rows.second >= 0 and rows.second <= size(v));
+        return mortonVector<T>( v.A, rows.second-rows.first,
+            v.i + rows.first*v.di, v.j + rows.first*v.dj, v.di, v.dj );
+    }
+
+    /** Matrix in a leaf of the recursive layout as a column-major legacy
+     * matrix.
+     *
+     * @param[in] A Matrix such that A.is_leaf(), or an empty matrix.
+     */
+    template< typename T >
+    inline constexpr auto
+    leaf( const mortonMatrix<T>& A ) noexcept {
+        assert( A.is_leaf() || A.m == 0 || A.n == 0 );
+        using idx_t = typename mortonMatrix<T>::idx_t;
+        if( A.m == 0 || A.n == 0 )
+            return legacyMatrix<T,Layout::ColMajor>( A.m, A.n, A.ptr, std::max<idx_t>( 1, A.m ) );
+        return legacyMatrix<T,Layout::ColMajor>( A.m, A.n, A.ptr + A.i0 + A.j0*A.M, A.M );
+    }
+
+    // -----------------------------------------------------------------------------
+    // Leaf traversal
+
+    namespace internal {
+
+        /// Blocks with fewer elements are not split in OpenMP tasks
+        constexpr std::size_t morton_task_size = 4096;
+
+        /**
+         * Calls f(Aleaf, i, j) for the parts of A in each leaf of the
+         * layout, where Aleaf is the column-major legacy matrix of the part
+         * and (i,j) is the position of Aleaf(0,0) in A. The leaves are
+         * visited in the order of the storage, and the blocks with more than
+         * morton_task_size elements are OpenMP tasks.
+         */
+        template< typename T, class idx_t, class f_t >
+        void for_each_leaf( const mortonMatrix<T>& A, idx_t i, idx_t j, const f_t& f )
+        {
+            using pair = std::pair<idx_t,idx_t>;
+
+            if( A.m <= 0 || A.n <= 0 )
+                return;
+            if( A.is_leaf() )
+                return f( leaf( A ), i, j );
+
+            // Split A where its node is split
+            const idx_t m1 = std::min( A.m, (A.i0 < A.M/2 && A.M > A.mb) ? A.M/2 - A.i0 : idx_t(0) );
+            const idx_t n1 = std::min( A.n, (A.j0 < A.N/2 && A.N > A.nb) ? A.N/2 - A.j0 : idx_t(0) );
+            const pair r[2] = { pair{ 0, m1 }, pair{ m1, A.m } };
+            const pair c[2] = { pair{ 0, n1 }, pair{ n1, A.n } };
+
+            const f_t* fp = &f;
+            for( int q = 0; q < 4; ++q ) {
+                const pair& rq = r[q/2];
+                const pair& cq = c[q%2];
+                if( rq.first == rq.second || cq.first == cq.second )
+                    continue;
+                const auto Aq = slice( A, rq, cq );
+                TLAPACK_OMP(task if(std::size_t(Aq.m)*std::size_t(Aq.n) > morton_task_size))
+                for_each_leaf( Aq, i + rq.first, j + cq.first, *fp );
+            }
+            TLAPACK_OMP(taskwait)
+        }
+
+    } // namespace internal
+
+    // -----------------------------------------------------------------------------
+    // Conversion
+
+    /** Copies a matrix into a matrix in the recursive layout.
+     *
+     * Each leaf is filled from a block of A, in the order of the storage,
+     * and the blocks are copied in parallel if <T>LAPACK is compiled with
+     * OpenMP.
+     *
+     * @param[in] A m-by-n matrix.
+     * @param[out] B m-by-n matrix in the recursive layout.
+     *
+     * @ingroup auxiliary
+     */
+    template< class matrix_t, typename T >
+    void copy_to_morton( const matrix_t& A, mortonMatrix<T>& B )
+    {
+        using idx_t = typename mortonMatrix<T>::idx_t;
+
+        tlapack_check( (idx_t) nrows(A) == B.m );
+        tlapack_check( (idx_t) ncols(A) == B.n );
+
+        internal::run_tasks( [&]() {
+            internal::for_each_leaf( B, idx_t(0), idx_t(0), [&]( auto Bl, idx_t i0, idx_t j0 ) {
+                for( idx_t j = 0; j < Bl.n; ++j )
+                    for( idx_t i = 0; i < Bl.m; ++i )
+                        Bl(i,j) = A( i0+i, j0+j );
+            } );
+        } );
+    }
+
+    /** Copies a matrix in the recursive layout into a matrix.
+     *
+     * Each leaf is copied to a block of B, in the order of the storage,
+     * and the blocks are copied in parallel if <T>LAPACK is compiled with
+     * OpenMP.
+     *
+     * @param[in] A m-by-n matrix in the recursive layout.
+     * @param[out] B m-by-n matrix.
+     *
+     * @ingroup auxiliary
+     */
+    template< typename T, class matrix_t >
+    void copy_from_morton( const mortonMatrix<T>& A, matrix_t& B )
+    {
+        using idx_t = typename mortonMatrix<T>::idx_t;
+
+        tlapack_check( A.m == (idx_t) nrows(B) );
+        tlapack_check( A.n == (idx_t) ncols(B) );
+
+        internal::run_tasks( [&]() {
+            internal::for_each_leaf( A, idx_t(0), idx_t(0), [&]( auto Al, idx_t i0, idx_t j0 ) {
+                for( idx_t j = 0; j < Al.n; ++j )
+                    for( idx_t i = 0; i < Al.m; ++i )
+                        B( i0+i, j0+j ) = Al(i,j);
+            } );
+        } );
+    }
+
+    // -----------------------------------------------------------------------------
+    // Level 3 BLAS
+    //
+    // The Level 3 BLAS routines on matrices in the recursive layout split
+    // their operands where the nodes of the layout are split, until all
+    // operands are leaves, and then call the routines on the column-major
+    // leaves. This way the kernels, e.g., the optimized BLAS with
+    // USE_BLASPP_WRAPPERS, work on contiguous memory and the element access
+    // does not descend the layout.
+
+    namespace internal {
+
+        /// Row of A where the node of A is split, or 0 if the split is not
+        /// inside A
+        template< typename T >
+        inline auto morton_row_split( const mortonMatrix<T>& A ) noexcept {
+            using idx_t = typename mortonMatrix<T>::idx_t;
+            if( A.m == 0 || A.n == 0 || A.M <= A.mb )
+                return idx_t(0);
+            const idx_t s = A.M/2;
+            return (A.i0 < s && A.i0 + A.m > s) ? s - A.i0 : idx_t(0);
+        }
+
+        /// Column of A where the node of A is split, or 0 if the split is not
+        /// inside A
+        template< typename T >
+        inline auto morton_col_split( const mortonMatrix<T>& A ) noexcept {
+            using idx_t = typename mortonMatrix<T>::idx_t;
+            if( A.m == 0 || A.n == 0 || A.N <= A.nb )
+                return idx_t(0);
+            const idx_t s = A.N/2;
+            return (A.j0 < s && A.j0 + A.n > s) ? s - A.j0 : idx_t(0);
+        }
+
+        /// Split of the rows of op(A), or 0 if there is none
+        template< typename T >
+        inline auto morton_op_row_split( Op trans, const mortonMatrix<T>& A ) noexcept {
+            return (trans == Op::NoTrans) ? morton_row_split( A ) : morton_col_split( A );
+        }
+
+        /// Split of the columns of op(A), or 0 if there is none
+        template< typename T >
+        inline auto morton_op_col_split( Op trans, const mortonMatrix<T>& A ) noexcept {
+            return (trans == Op::NoTrans) ? morton_col_split( A ) : morton_row_split( A );
+        }
+
+        /// Rows [r.first, r.second) of op(A)
+        template< typename T, class pair >
+        inline auto morton_op_rows( Op trans, const mortonMatrix<T>& A, const pair& r ) noexcept {
+            return (trans == Op::NoTrans) ? rows( A, r ) : cols( A, r );
+        }
+
+        /// Columns [c.first, c.second) of op(A)
+        template< typename T, class pair >
+        inline auto morton_op_cols( Op trans, const mortonMatrix<T>& A, const pair& c ) noexcept {
+            return (trans == Op::NoTrans) ? cols( A, c ) : rows( A, c );
+        }
+
+        /// First nonzero split
+        template< class idx_t >
+        inline idx_t morton_first_split( idx_t s1, idx_t s2 ) noexcept {
+            return (s1 != 0) ? s1 : s2;
+        }
+
+        /// gemm on matrices obtained with slice()
+        template< typename T, class alpha_t, class beta_t >
+        void morton_gemm(
+            Op transA, Op transB,
+            const alpha_t& alpha, const mortonMatrix<T>& A, const mortonMatrix<T>& B,
+            const beta_t& beta, const mortonMatrix<T>& C )
+        {
+            using idx_t = typename mortonMatrix<T>::idx_t;
+            using pair  = std::pair<idx_t,idx_t>;
+
+            const idx_t m = C.m;
+            const idx_t n = C.n;
+            const idx_t k = (transA == Op::NoTrans) ? A.n : A.m;
+
+            const idx_t sm = morton_first_split( morton_row_split( C ), morton_op_row_split( transA, A ) );
+            const idx_t sn = morton_first_split( morton_col_split( C ), morton_op_col_split( transB, B ) );
+            const idx_t sk = morton_first_split( morton_op_col_split( transA, A ), morton_op_row_split( transB, B ) );
+
+            // Split the largest dimension that can be split
+            const idx_t dm = (sm != 0) ? m : 0;
+            const idx_t dn = (sn != 0) ? n : 0;
+            const idx_t dk = (sk != 0) ? k : 0;
+
+            if( dm == 0 && dn == 0 && dk == 0 ) {
+                auto Cl = leaf( C );
+                gemm( transA, transB, alpha, leaf( A ), leaf( B ), beta, Cl );
+            }
+            else if( dm >= dn && dm >= dk ) {
+                const pair r1{ 0, sm }, r2{ sm, m };
+                morton_gemm( transA, transB, alpha, morton_op_rows( transA, A, r1 ), B, beta, rows( C, r1 ) );
+                morton_gemm( transA, transB, alpha, morton_op_rows( transA, A, r2 ), B, beta, rows( C, r2 ) );
+            }
+            else if( dn >= dk ) {
+                const pair c1{ 0, sn }, c2{ sn, n };
+                morton_gemm( transA, transB, alpha, A, morton_op_cols( transB, B, c1 ), beta, cols( C, c1 ) );
+                morton_gemm( transA, transB, alpha, A, morton_op_cols( transB, B, c2 ), beta, cols( C, c2 ) );
+            }
+            else {
+                const pair l1{ 0, sk }, l2{ sk, k };
+                morton_gemm( transA, transB, alpha,
+                    morton_op_cols( transA, A, l1 ), morton_op_rows( transB, B, l1 ), beta, C );
+                morton_gemm( transA, transB, alpha,
+                    morton_op_cols( transA, A, l2 ), morton_op_rows( transB, B, l2 ), beta_t(1), C );
+            }
+        }
+
+        /// herk on matrices obtained with slice()
+        template< typename T, class alpha_t, class beta_t >
+        void morton_herk(
+            Uplo uplo, Op trans,
+            const alpha_t& alpha, const mortonMatrix<T>& A,
+            const beta_t& beta, const mortonMatrix<T>& C )
+        {
+            using idx_t = typename mortonMatrix<T>::idx_t;
+            using pair  = std::pair<idx_t,idx_t>;
+
+            const idx_t n = C.n;
+            const idx_t k = (trans == Op::NoTrans) ? A.n : A.m;
+
+            const idx_t sn = morton_first_split( morton_first_split( morton_row_split( C ), morton_col_split( C ) ),
+                                                 morton_op_row_split( trans, A ) );
+            const idx_t sk = morton_op_col_split( trans, A );
+
+            if( sn == 0 && sk == 0 ) {
+                auto Cl = leaf( C );
+                herk( uplo, trans, alpha, leaf( A ), beta, Cl );
+            }
+            else if( sn != 0 && (sk == 0 || n >= k) ) {
+                const pair r1{ 0, sn }, r2{ sn, n };
+                const Op transH = (trans == Op::NoTrans) ? Op::ConjTrans : Op::NoTrans;
+                const auto A1 = morton_op_rows( trans, A, r1 );
+                const auto A2 = morton_op_rows( trans, A, r2 );
+
+                morton_herk( uplo, trans, alpha, A1, beta, slice( C, r1, r1 ) );
+                if( uplo != Uplo::Lower )
+                    morton_gemm( trans, transH, alpha, A1, A2, beta, slice( C, r1, r2 ) );
+                if( uplo != Uplo::Upper )
+                    morton_gemm( trans, transH, alpha, A2, A1, beta, slice( C, r2, r1 ) );
+                morton_herk( uplo, trans, alpha, A2, beta, slice( C, r2, r2 ) );
+            }
+            else {
+                const pair l1{ 0, sk }, l2{ sk, k };
+                morton_herk( uplo, trans, alpha, morton_op_cols( trans, A, l1 ), beta, C );
+                morton_herk( uplo, trans, alpha, morton_op_cols( trans, A, l2 ), beta_t(1), C );
+            }
+        }
+
+        /// trsm on matrices obtained with slice()
+        template< typename T, class alpha_t >
+        void morton_trsm(
+            Side side, Uplo uplo, Op trans, Diag diag,
+            const alpha_t& alpha, const mortonMatrix<T>& A, const mortonMatrix<T>& B )
+        {
+            using idx_t = typename mortonMatrix<T>::idx_t;
+            using pair  = std::pair<idx_t,idx_t>;
+
+            const idx_t m = B.m;
+            const idx_t n = B.n;
+
+            // Split of A, and of the dimension of B that is not multiplied by A
+            const idx_t sa = morton_first_split(
+                morton_first_split( morton_row_split( A ), morton_col_split( A ) ),
+                (side == Side::Left) ? morton_row_split( B ) : morton_col_split( B ) );
+            const idx_t sb = (side == Side::Left) ? morton_col_split( B ) : morton_row_split( B );
+            const idx_t na = (side == Side::Left) ? m : n;
+            const idx_t nb = (side == Side::Left) ? n : m;
+
+            // True if op(A) is lower triangular
+            const bool lower = (uplo == Uplo::Lower) == (trans == Op::NoTrans);
+
+            if( sa == 0 && sb == 0 ) {
+                auto Bl = leaf( B );
+                trsm( side, uplo, trans, diag, alpha, leaf( A ), Bl );
+            }
+            else if( sb != 0 && (sa == 0 || nb > na) ) {
+                // Independent problems
+                const pair p1{ 0, sb }, p2{ sb, nb };
+                if( side == Side::Left ) {
+                    morton_trsm( side, uplo, trans, diag, alpha, A, cols( B, p1 ) );
+                    morton_trsm( side, uplo, trans, diag, alpha, A, cols( B, p2 ) );
+                }
+                else {
+                    morton_trsm( side, uplo, trans, diag, alpha, A, rows( B, p1 ) );
+                    morton_trsm( side, uplo, trans, diag, alpha, A, rows( B, p2 ) );
+                }
+            }
+            else {
+                const pair p1{ 0, sa }, p2{ sa, na };
+                const auto A11 = slice( A, p1, p1 );
+                const auto A22 = slice( A, p2, p2 );
+                const auto Aoff = (uplo == Uplo::Lower) ? slice( A, p2, p1 ) : slice( A, p1, p2 );
+                const alpha_t one( 1 );
+
+                if( side == Side::Left ) {
+                    const auto B1 = rows( B, p1 );
+                    const auto B2 = rows( B, p2 );
+                    if( lower ) {
+                        morton_trsm( side, uplo, trans, diag, alpha, A11, B1 );
+                        morton_gemm( trans, Op::NoTrans, alpha_t(-1), Aoff, B1, alpha, B2 );
+                        morton_trsm( side, uplo, trans, diag, one, A22, B2 );
+                    }
+                    else {
+                        morton_trsm( side, uplo, trans, diag, alpha, A22, B2 );
+                        morton_gemm( trans, Op::NoTrans, alpha_t(-1), Aoff, B2, alpha, B1 );
+                        morton_trsm( side, uplo, trans, diag, one, A11, B1 );
+                    }
+                }
+                else {
+                    const auto B1 = cols( B, p1 );
+                    const auto B2 = cols( B, p2 );
+                    if( lower ) {
+                        morton_trsm( side, uplo, trans, diag, alpha, A22, B2 );
+                        morton_gemm( Op::NoTrans, trans, alpha_t(-1), B2, Aoff, alpha, B1 );
+                        morton_trsm( side, uplo, trans, diag, one, A11, B1 );
+                    }
+                    else {
+                        morton_trsm( side, uplo, trans, diag, alpha, A11, B1 );
+                        morton_gemm( Op::NoTrans, trans, alpha_t(-1), B1, Aoff, alpha, B2 );
+                        morton_trsm( side, uplo, trans, diag, one, A22, B2 );
+                    }
+                }
+            }
+        }
+
+        /// trmm on matrices obtained with slice()
+        template< typename T, class alpha_t >
+        void morton_trmm(
+            Side side, Uplo uplo, Op trans, Diag diag,
+            const alpha_t& alpha, const mortonMatrix<T>& A, const mortonMatrix<T>& B )
+        {
+            using idx_t = typename mortonMatrix<T>::idx_t;
+            using pair  = std::pair<idx_t,idx_t>;
+
+            const idx_t m = B.m;
+            const idx_t n = B.n;
+
+            // Split of A, and of the dimension of B that is not multiplied by A
+            const idx_t sa = morton_first_split(
+                morton_first_split( morton_row_split( A ), morton_col_split( A ) ),
+                (side == Side::Left) ? morton_row_split( B ) : morton_col_split( B ) );
+            const idx_t sb = (side == Side::Left) ? morton_col_split( B ) : morton_row_split( B );
+            const idx_t na = (side == Side::Left) ? m : n;
+            const idx_t nb = (side == Side::Left) ? n : m;
+
+            // True if op(A) is lower triangular
+            const bool lower = (uplo == Uplo::Lower) == (trans == Op::NoTrans);
+
+            if( sa == 0 && sb == 0 ) {
+                auto Bl = leaf( B );
+                trmm( side, uplo, trans, diag, alpha, leaf( A ), Bl );
+            }
+            else if( sb != 0 && (sa == 0 || nb > na) ) {
+                // Independent problems
+                const pair p1{ 0, sb }, p2{ sb, nb };
+                if( side == Side::Left ) {
+                    morton_trmm( side, uplo, trans, diag, alpha, A, cols( B, p1 ) );
+                    morton_trmm( side, uplo, trans, diag, alpha, A, cols( B, p2 ) );
+                }
+                else {
+                    morton_trmm( side, uplo, trans, diag, alpha, A, rows( B, p1 ) );
+                    morton_trmm( side, uplo, trans, diag, alpha, A, rows( B, p2 ) );
+                }
+            }
+            else {
+                const pair p1{ 0, sa }, p2{ sa, na };
+                const auto A11 = slice( A, p1, p1 );
+                const auto A22 = slice( A, p2, p2 );
+                const auto Aoff = (uplo == Uplo::Lower) ? slice( A, p2, p1 ) : slice( A, p1, p2 );
+                const alpha_t one( 1 );
+
+                if( side == Side::Left ) {
+                    const auto B1 = rows( B, p1 );
+                    const auto B2 = rows( B, p2 );
+                    if( lower ) {
+                        morton_trmm( side, uplo, trans, diag, alpha, A22, B2 );
+                        morton_gemm( trans, Op::NoTrans, alpha, Aoff, B1, one, B2 );
+                        morton_trmm( side, uplo, trans, diag, alpha, A11, B1 );
+                    }
+                    else {
+                        morton_trmm( side, uplo, trans, diag, alpha, A11, B1 );
+                        morton_gemm( trans, Op::NoTrans, alpha, Aoff, B2, one, B1 );
+                        morton_trmm( side, uplo, trans, diag, alpha, A22, B2 );
+                    }
+                }
+                else {
+                    const auto B1 = cols( B, p1 );
+                    const auto B2 = cols( B, p2 );
+                    if( lower ) {
+                        morton_trmm( side, uplo, trans, diag, alpha, A11, B1 );
+                        morton_gemm( Op::NoTrans, trans, alpha, B2, Aoff, one, B1 );
+                        morton_trmm( side, uplo, trans, diag, alpha, A22, B2 );
+                    }
+                    else {
+                        morton_trmm( side, uplo, trans, diag, alpha, A22, B2 );
+                        morton_gemm( Op::NoTrans, trans, alpha, B1, Aoff, one, B2 );
+                        morton_trmm( side, uplo, trans, diag, alpha, A11, B1 );
+                    }
+                }
+            }
+        }
+
+        /// A with the node that slice() would give
+        template< typename T >
+        inline auto morton_sliced( const mortonMatrix<T>& A ) noexcept {
+            using idx_t = typename mortonMatrix<T>::idx_t;
+            return slice( A, std::pair<idx_t,idx_t>{ 0, A.m }, std::pair<idx_t,idx_t>{ 0, A.n } );
+        }
+
+    } // namespace internal
+
+    /**
+     * General matrix-matrix multiply of matrices in the recursive layout,
+     * $C := \alpha op(A) \times op(B) + \beta C$.
+     *
+     * The largest dimension is split where the layout of one of the
+     * operands is split, until all operands are leaves.
+     *
+     * @see gemm( Op transA, Op transB, const alpha_t& alpha, const matrixA_t& A, const matrixB_t& B, const beta_t& beta, matrixC_t& C )
+     *
+     * @ingroup gemm
+     */
+    template< typename T, class alpha_t, class beta_t >
+    void gemm(
+        Op transA, Op transB,
+        const alpha_t& alpha,
+        const mortonMatrix<T>& A,
+        const mortonMatrix<T>& B,
+        const beta_t& beta,
+        mortonMatrix<T>& C )
+    {
+        const auto k = (transA == Op::NoTrans) ? A.n : A.m;
+
+        // check arguments
+        tlapack_check_false( transA != Op::NoTrans && transA != Op::Trans && transA != Op::ConjTrans );
+        tlapack_check_false( transB != Op::NoTrans && transB != Op::Trans && transB != Op::ConjTrans );
+        tlapack_check_false( C.m != ((transA == Op::NoTrans) ? A.m : A.n) );
+        tlapack_check_false( C.n != ((transB == Op::NoTrans) ? B.n : B.m) );
+        tlapack_check_false( k != ((transB == Op::NoTrans) ? B.m : B.n) );
+
+        internal::morton_gemm( transA, transB, alpha,
+            internal::morton_sliced( A ), internal::morton_sliced( B ),
+            beta, internal::morton_sliced( C ) );
+    }
+
+    /**
+     * Hermitian rank-k update of matrices in the recursive layout,
+     * $C := \alpha A A^H + \beta C$ or $C := \alpha A^H A + \beta C$.
+     *
+     * The diagonal blocks of C are updated recursively, and the
+     * off-diagonal blocks with gemm.
+     *
+     * @see herk( Uplo uplo, Op trans, const alpha_t& alpha, const matrixA_t& A, const beta_t& beta, matrixC_t& C )
+     *
+     * @ingroup herk
+     */
+    template< typename T, class alpha_t, class beta_t,
+        enable_if_t<(
+            !is_complex<alpha_t>::value &&
+            !is_complex<beta_t> ::value
+        ), int > = 0
+    >
+    void herk(
+        Uplo uplo, Op trans,
+        const alpha_t& alpha, const mortonMatrix<T>& A,
+        const beta_t& beta, mortonMatrix<T>& C )
+    {
+        // check arguments
+        tlapack_check_false( uplo != Uplo::Lower && uplo != Uplo::Upper && uplo != Uplo::General );
+        tlapack_check_false( trans != Op::NoTrans && trans != Op::ConjTrans );
+        tlapack_check_false( C.m != C.n );
+        tlapack_check_false( C.m != ((trans == Op::NoTrans) ? A.m : A.n) );
+
+        internal::morton_herk( uplo, trans, alpha,
+            internal::morton_sliced( A ), beta, internal::morton_sliced( C ) );
+    }
+
+    /**
+     * Solve the triangular matrix-vector equation with matrices in the
+     * recursive layout, $op(A) X = \alpha B$ or $X op(A) = \alpha B$.
+     *
+     * A is split in two diagonal blocks and one off-diagonal block, which
+     * gives two triangular solves and one gemm.
+     *
+     * @see trsm( Side side, Uplo uplo, Op trans, Diag diag, const alpha_t& alpha, const matrixA_t& A, matrixB_t& B )
+     *
+     * @ingroup trsm
+     */
+    template< typename T, class alpha_t >
+    void trsm(
+        Side side, Uplo uplo, Op trans, Diag diag,
+        const alpha_t& alpha, const mortonMatrix<T>& A, mortonMatrix<T>& B )
+    {
+        // check arguments
+        tlapack_check_false( side != Side::Left && side != Side::Right );
+        tlapack_check_false( uplo != Uplo::Lower && uplo != Uplo::Upper );
+        tlapack_check_false( trans != Op::NoTrans && trans != Op::Trans && trans != Op::ConjTrans );
+        tlapack_check_false( diag != Diag::NonUnit && diag != Diag::Unit );
+        tlapack_check_false( A.m != A.n );
+        tlapack_check_false( A.m != ((side == Side::Left) ? B.m : B.n) );
+
+        internal::morton_trsm( side, uplo, trans, diag, alpha,
+            internal::morton_sliced( A ), internal::morton_sliced( B ) );
+    }
+
+    /**
+     * Triangular matrix-matrix multiply of matrices in the recursive layout,
+     * $B := \alpha op(A) B$ or $B := \alpha B op(A)$.
+     *
+     * A is split in two diagonal blocks and one off-diagonal block, which
+     * gives two triangular products and one gemm.
+     *
+     * @see trmm( Side side, Uplo uplo, Op trans, Diag diag, const alpha_t& alpha, const matrixA_t& A, matrixB_t& B )
+     *
+     * @ingroup trmm
+     */
+    template< typename T, class alpha_t >
+    void trmm(
+        Side side, Uplo uplo, Op trans, Diag diag,
+        const alpha_t& alpha, const mortonMatrix<T>& A, mortonMatrix<T>& B )
+    {
+        // check arguments
+        tlapack_check_false( side != Side::Left && side != Side::Right );
+        tlapack_check_false( uplo != Uplo::Lower && uplo != Uplo::Upper );
+        tlapack_check_false( trans != Op::NoTrans && trans != Op::Trans && trans != Op::ConjTrans );
+        tlapack_check_false( diag != Diag::NonUnit && diag != Diag::Unit );
+        tlapack_check_false( A.m != A.n );
+        tlapack_check_false( A.m != ((side == Side::Left) ? B.m : B.n) );
+
+        internal::morton_trmm( side, uplo, trans, diag, alpha,
+            internal::morton_sliced( A ), internal::morton_sliced( B ) );
+    }
+
+} // namespace tlapack
+
+#endif // __TLAPACK_MORTONARRAY_HH__
@@ -0,0 +1,573 @@
+/// @file tlapack_rfpArray.hpp
+/// @brief Triangular or Hermitian matrix in the rectangular full packed format
+//
+// Copyright (c) 2022, University of Colorado Denver. All rights reserved.
+//
+// This file is part of <T>LAPACK.
+// <T>LAPACK is free software: you can redistribute it and/or modify it under
+// the terms of the BSD 3-Clause license. See the accompanying LICENSE file.
+
+#ifndef __TLAPACK_RFPARRAY_HH__
+#define __TLAPACK_RFPARRAY_HH__
+
+#include <cassert>
+#include <utility>
+
+#include "legacy_api/legacyArray.hpp"
+#include "plugins/tlapack_legacyArray.hpp"
+#include "base/arrayTraits.hpp"
+#include "blas/gemm.hpp"
+#include "blas/herk.hpp"
+#include "blas/trmm.hpp"
+#include "blas/trsm.hpp"
+#include "lapack/potrf.hpp"
+#include "lapack/lauum_recursive.hpp"
+#include "lapack/trtri_recursive.hpp"
+
+namespace tlapack {
+
+    /** Triangular or Hermitian n-by-n matrix in the rectangular full packed
+     * (RFP) format.
+     *
+     * Only the uplo triangle of the matrix is stored, in n(n+1)/2 elements
+     * that form a column-major array. The triangle is split in a triangle
+     * T1 of order n1, a triangle T2 of order n2 = n - n1 and a n2-by-n1 or
+     * n1-by-n2 block S:
+     *
+     *      Lower, n1 = n - n/2:        Upper, n1 = n/2:
+     *      A = [ T1      ]             A = [ T1^H  S  ]
+     *          [ S   T2^H ]                 [      T2 ]
+     *
+     * T1 is stored as a lower triangle and T2 as an upper triangle, which
+     * fit together in a (n+1)-by-(n/2) array if n is even, or in a
+     * n-by-((n+1)/2) array if n is odd. The three blocks are column-major
+     * legacy matrices, see rfp_triangle1(), rfp_triangle2() and
+     * rfp_square(), and the routines on RFP matrices call the Level 3 BLAS
+     * on them.
+     *
+     * The storage is the one of LAPACK with TRANSR = 'N'.
+     *
+     * The element access A(i,j) is valid for the pairs (i,j) in the pattern
+     * of the storage, see rfp_t. For a Lower matrix, A(i,j) is the element
+     * (i,j) of the matrix if j < n1, and its conjugate transpose otherwise.
+     * For an Upper matrix, A(i,j) is the element (i,j) of the matrix if
+     * j >= n1, and its conjugate transpose otherwise. Use copy_to_rfp()
+     * and copy_from_rfp() to convert from and to other layouts.
+     *
+     * An rfpMatrix does not own its memory.
+     *
+     * @tparam T Floating-point type
+     */
+    template< typename T >
+    struct rfpMatrix {
+        using idx_t = TLAPACK_SIZE_T;  ///< Index type
+        idx_t n;                    ///< Size
+        Uplo uplo;                  ///< Triangle that is stored
+        T* ptr;                     ///< Pointer to the storage
+
+        /// Number of elements of the storage of a n-by-n matrix
+        static constexpr idx_t
+        storage_size( idx_t n ) noexcept {
+            return (n * (n+1)) / 2;
+        }
+
+        /// Order of T1
+        inline constexpr idx_t n1() const noexcept {
+            return (uplo == Uplo::Lower) ? n - n/2 : n/2;
+        }
+
+        /// Order of T2
+        inline constexpr idx_t n2() const noexcept {
+            return n - n1();
+        }
+
+        /// Leading dimension of the storage
+        inline constexpr idx_t ld() const noexcept {
+            return (n % 2 == 0) ? n+1 : n;
+        }
+
+        /// Offset of T1(0,0) in the storage
+        inline constexpr idx_t offset1() const noexcept {
+            const idx_t even = (n % 2 == 0) ? 1 : 0;
+            return (uplo == Uplo::Lower) ? even : n2() + even;
+        }
+
+        /// Offset of T2(0,0) in the storage
+        inline constexpr idx_t offset2() const noexcept {
+            return (uplo == Uplo::Lower)
+                ? ((n % 2 == 0) ? 0 : ld())
+                : n1();
+        }
+
+        /// Offset of S(0,0) in the storage
+        inline constexpr idx_t offsetS() const noexcept {
+            return (uplo == Uplo::Lower) ? offset1() + n1() : 0;
+        }
+
+        inline constexpr T&
+        operator()( idx_t i, idx_t j ) const noexcept {
+            assert( i >= 0);
+            assert( i < n);
+            assert( j >= 0);
+            assert( j < n);
+            const idx_t k = n1();
+            if( uplo == Uplo::Lower ) {
+                if( j < k ) {
+                    assert( i >= j );
+                    return ptr[ offset1() + i + j*ld() ];
+                }
+                assert( i >= k && i <= j );
+                return ptr[ offset2() + (i-k) + (j-k)*ld() ];
+            }
+            else {
+                if( j >= k ) {
+                    assert( i <= j );
+                    return ptr[ i + (j-k)*ld() ];
+                }
+                assert( i >= j && i < k );
+                return ptr[ offset1() + i + j*ld() ];
+            }
+        }
+
+        inline constexpr rfpMatrix( idx_t n, Uplo uplo, T* ptr )
+        : n(n), uplo(uplo), ptr(ptr)
+        {
+            tlapack_check_false( n < 0 );
+            tlapack_check_false( uplo != Uplo::Lower && uplo != Uplo::Upper );
+        }
+    };
+
+    // -----------------------------------------------------------------------------
+    // Data description
+
+    // Number of rows
+    template< typename T >
+    inline constexpr auto
+    nrows( const rfpMatrix<T>& A ){ return A.n; }
+
+    // Number of columns
+    template< typename T >
+    inline constexpr auto
+    ncols( const rfpMatrix<T>& A ){ return A.n; }
+
+    // Read policy
+    template< typename T >
+    inline constexpr auto
+    read_policy( const rfpMatrix<T>& A ) {
+        return rfp_t( A.uplo, A.n1() );
+    }
+
+    // Write policy
+    template< typename T >
+    inline constexpr auto
+    write_policy( const rfpMatrix<T>& A ) {
+        return rfp_t( A.uplo, A.n1() );
+    }
+
+    // -----------------------------------------------------------------------------
+    // Data blocks
+    //
+    // An RFP matrix is not sliced like the other matrices. The three blocks
+    // of the storage are column-major legacy matrices.
+
+    /** Triangle T1 of an RFP matrix, which is lower triangular.
+     *
+     * The leading n1-by-n1 block of A if A.uplo is Lower, or its conjugate
+     * transpose if A.uplo is Upper.
+     */
+    template< typename T >
+    inline constexpr auto
+    rfp_triangle1( const rfpMatrix<T>& A ) noexcept {
+        return legacyMatrix<T,Layout::ColMajor>( A.n1(), A.n1(), A.ptr + A.offset1(), A.ld() );
+    }
+
+    /** Triangle T2 of an RFP matrix, which is upper triangular.
+     *
+     * The trailing n2-by-n2 block of A if A.uplo is Upper, or its conjugate
+     * transpose if A.uplo is Lower.
+     */
+    template< typename T >
+    inline constexpr auto
+    rfp_triangle2( const rfpMatrix<T>& A ) noexcept {
+        return legacyMatrix<T,Layout::ColMajor>( A.n2(), A.n2(), A.ptr + A.offset2(), A.ld() );
+    }
+
+    /** Off-diagonal block S of an RFP matrix.
+     *
+     * The n2-by-n1 block A(n1:n,0:n1) if A.uplo is Lower, or the n1-by-n2
+     * block A(0:n1,n1:n) if A.uplo is Upper.
+     */
+    template< typename T >
+    inline constexpr auto
+    rfp_square( const rfpMatrix<T>& A ) noexcept {
+        return (A.uplo == Uplo::Lower)
+            ? legacyMatrix<T,Layout::ColMajor>( A.n2(), A.n1(), A.ptr + A.offsetS(), A.ld() )
+            : legacyMatrix<T,Layout::ColMajor>( A.n1(), A.n2(), A.ptr + A.offsetS(), A.ld() );
+    }
+
+    // -----------------------------------------------------------------------------
+    // Conversion
+
+    namespace internal {
+
+        /// True if (i,j) is in the pattern of the RFP matrix A
+        template< typename T, class idx_t >
+        inline constexpr bool rfp_stored( const rfpMatrix<T>& A, idx_t i, idx_t j ) noexcept {
+            const idx_t n1 = A.n1();
+            return (A.uplo == Uplo::Lower)
+                ? ( (j < n1 && i >= j) || (i >= n1 && i <= j) )
+                : ( (j >= n1 && i <= j) || (j < n1 && i >= j && i < n1) );
+        }
+
+    } // namespace internal
+
+    /** Copies the B.uplo triangle of a matrix into an RFP matrix.
+     *
+     * @param[in] A n-by-n matrix. Only the B.uplo triangle is referenced.
+     * @param[out] B n-by-n matrix in the RFP format.
+     *
+     * @ingroup auxiliary
+     */
+    template< class matrix_t, typename T >
+    void copy_to_rfp( const matrix_t& A, rfpMatrix<T>& B )
+    {
+        using idx_t = typename rfpMatrix<T>::idx_t;
+
+        tlapack_check( (idx_t) nrows(A) == B.n );
+        tlapack_check( (idx_t) ncols(A) == B.n );
+
+        const idx_t n = B.n;
+        for( idx_t j = 0; j < n; ++j ) {
+            const idx_t i0 = (B.uplo == Uplo::Lower) ? j : 0;
+            const idx_t i1 = (B.uplo == Uplo::Lower) ? n : j+1;
+            for( idx_t i = i0; i < i1; ++i ) {
+                if( internal::rfp_stored( B, i, j ) )
+                    B(i,j) = A(i,j);
+                else
+                    B(j,i) = conj( A(i,j) );
+            }
+        }
+    }
+
+    /** Copies an RFP matrix into the A.uplo triangle of a matrix.
+     *
+     * @param[in] A n-by-n matrix in the RFP format.
+     * @param[out] B n-by-n matrix. Only the A.uplo triangle is written.
+     *
+     * @ingroup auxiliary
+     */
+    template< typename T, class matrix_t >
+    void copy_from_rfp( const rfpMatrix<T>& A, matrix_t& B )
+    {
+        using idx_t = typename rfpMatrix<T>::idx_t;
+
+        tlapack_check( A.n == (idx_t) nrows(B) );
+        tlapack_check( A.n == (idx_t) ncols(B) );
+
+        const idx_t n = A.n;
+        for( idx_t j = 0; j < n; ++j ) {
+            const idx_t i0 = (A.uplo == Uplo::Lower) ? j : 0;
+            const idx_t i1 = (A.uplo == Uplo::Lower) ? n : j+1;
+            for( idx_t i = i0; i < i1; ++i ) {
+                if( internal::rfp_stored( A, i, j ) )
+                    B(i,j) = A(i,j);
+                else
+                    B(i,j) = conj( A(j,i) );
+            }
+        }
+    }
+
+    // -----------------------------------------------------------------------------
+    // Cholesky factorization and related routines
+    //
+    // The routines on RFP matrices work on T1, T2 and S with the routines
+    // for column-major matrices, e.g., the optimized BLAS with
+    // USE_BLASPP_WRAPPERS, as LAPACK's pftrf, pftrs, tftri and lauum do.
+
+    /** Computes the Cholesky factorization of a Hermitian positive definite
+     * matrix A in the RFP format.
+     *
+     * T1 is factored with potrf, S is updated with trsm, T2 with herk, and
+     * T2 is factored with potrf.
+     *
+     * @param[in] uplo Must be A.uplo.
+     * @param[in,out] A n-by-n Hermitian matrix in the RFP format.
+     *      On exit, the factor U or L in the RFP format.
+     * @param[in] opts Options passed to potrf on T1 and T2.
+     * @param[in] ec Exception handling configuration at runtime.
+     *
+     * @return 0: successful exit.
+     * @return i, 0 < i <= n, if the leading minor of order i is not
+     *      positive definite, and the factorization could not be completed.
+     *
+     * @see potrf( uplo_t uplo, matrix_t& A, opts_t&& opts, const ErrorCheck& ec )
+     *
+     * @ingroup posv_computational
+     */
+    template< class uplo_t, typename T, class opts_t >
+    int potrf( uplo_t uplo, rfpMatrix<T>& A, opts_t&& opts, const ErrorCheck& ec = {} )
+    {
+        using idx_t  = typename rfpMatrix<T>::idx_t;
+        using real_t = real_type<T>;
+
+        const real_t one( 1 );
+        const idx_t n  = A.n;
+        const idx_t n1 = A.n1();
+
+        // check arguments
+        tlapack_check( uplo == A.uplo );
+
+        TLAPACK_PROFILE_SCOPE( "potrf", T, (1.0/3.0)*n*n*n, 0.5*n*(n+1) );
+
+        // Quick return
+        if( n <= 0 )
+            return 0;
+
+        auto T1 = rfp_triangle1( A );
+        auto T2 = rfp_triangle2( A );
+        auto S  = rfp_square( A );
+
+        int info = potrf( Uplo::Lower, T1, opts, noErrorCheck );
+        if( info != 0 ) {
+            tlapack_error_internal( ec, info,
+                "The leading minor of the reported order is not positive definite,"
+                " and the factorization could not be completed." );
+            return info;
+        }
+
+        if( A.uplo == Uplo::Lower ) {
+            // S = A21 L11^{-H} and T2 = A22 - S S^H
+            trsm( Side::Right, Uplo::Lower, Op::ConjTrans, Diag::NonUnit, one, T1, S );
+            herk( Uplo::Upper, Op::NoTrans, -one, S, one, T2 );
+        }
+        else {
+            // S = U11^{-H} A12 and T2 = A22 - S^H S
+            trsm( Side::Left, Uplo::Lower, Op::NoTrans, Diag::NonUnit, one, T1, S );
+            herk( Uplo::Upper, Op::ConjTrans, -one, S, one, T2 );
+        }
+
+        info = potrf( Uplo::Upper, T2, opts, noErrorCheck );
+        if( info != 0 ) {
+            tlapack_error_internal( ec, info + n1,
+                "The leading minor of the reported order is not positive definite,"
+                " and the factorization could not be completed." );
+            return info + n1;
+        }
+
+        return 0;
+    }
+
+    /** Computes the Cholesky factorization of a Hermitian positive definite
+     * matrix A in the RFP format.
+     *
+     * Version with default options defined in @see potrf_opts_t.
+     *
+     * @see potrf( uplo_t uplo, rfpMatrix<T>& A, opts_t&& opts, const ErrorCheck& ec )
+     */
+    template< class uplo_t, typename T >
+    inline
+    int potrf( uplo_t uplo, rfpMatrix<T>& A, const ErrorCheck& ec = {} )
+    {
+        using idx_t = typename rfpMatrix<T>::idx_t;
+        return potrf( uplo, A, potrf_opts_t<idx_t>{}, ec );
+    }
+
+    /** Apply the Cholesky factorization of a matrix in the RFP format to
+     * solve a linear system, $A X = B$.
+     *
+     * @param[in] uplo Must be A.uplo.
+     * @param[in] A The factor U or L in the RFP format, computed by potrf.
+     * @param[in,out] B
+     *      On entry, the matrix B.
+     *      On exit,  the matrix X.
+     *
+     * @return = 0: successful exit.
+     *
+     * @see potrs( uplo_t uplo, const matrixA_t& A, matrixB_t& B )
+     *
+     * @ingroup posv_computational
+     */
+    template< class uplo_t, typename T, class matrixB_t >
+    int potrs( uplo_t uplo, const rfpMatrix<T>& A, matrixB_t& B )
+    {
+        using idx_t = typename rfpMatrix<T>::idx_t;
+        using pair  = std::pair<idx_t,idx_t>;
+        using TB    = type_t< matrixB_t >;
+
+        const TB one( 1 );
+        const idx_t n  = A.n;
+        const idx_t n1 = A.n1();
+
+        TLAPACK_PROFILE_SCOPE( "potrs", TB, 2.0*n*n*ncols(B), double(n)*n + 2.0*nrows(B)*ncols(B) );
+
+        // check arguments
+        tlapack_check_false( uplo != A.uplo, -1 );
+        tlapack_check_false( (idx_t) nrows(B) != n, -3 );
+
+        // Quick return
+        if( n <= 0 )
+            return 0;
+
+        const auto T1 = rfp_triangle1( A );
+        const auto T2 = rfp_triangle2( A );
+        const auto S  = rfp_square( A );
+
+        // If n = 1, A is either T1 or T2
+        if( n == 1 ) {
+            if( n1 == 1 ) {
+                trsm( Side::Left, Uplo::Lower, Op::NoTrans,   Diag::NonUnit, one, T1, B );
+                trsm( Side::Left, Uplo::Lower, Op::ConjTrans, Diag::NonUnit, one, T1, B );
+            }
+            else {
+                trsm( Side::Left, Uplo::Upper, Op::ConjTrans, Diag::NonUnit, one, T2, B );
+                trsm( Side::Left, Uplo::Upper, Op::NoTrans,   Diag::NonUnit, one, T2, B );
+            }
+            return 0;
+        }
+
+        auto B1 = rows( B, pair{0,n1} );
+        auto B2 = rows( B, pair{n1,n} );
+
+        // The factor is [ T1 0 ; S T2^H ] if Lower, and its conjugate
+        // transpose is [ T1 S^H ; 0 T2 ]^H if Upper
+        const Op opS  = (A.uplo == Uplo::Lower) ? Op::NoTrans : Op::ConjTrans;
+        const Op opSH = (A.uplo == Uplo::Lower) ? Op::ConjTrans : Op::NoTrans;
+
+        // Solve with the lower triangular factor
+        trsm( Side::Left, Uplo::Lower, Op::NoTrans, Diag::NonUnit, one, T1, B1 );
+        gemm( opS, Op::NoTrans, -one, S, B1, one, B2 );
+        trsm( Side::Left, Uplo::Upper, Op::ConjTrans, Diag::NonUnit, one, T2, B2 );
+
+        // Solve with its conjugate transpose
+        trsm( Side::Left, Uplo::Upper, Op::NoTrans, Diag::NonUnit, one, T2, B2 );
+        gemm( opSH, Op::NoTrans, -one, S, B2, one, B1 );
+        trsm( Side::Left, Uplo::Lower, Op::ConjTrans, Diag::NonUnit, one, T1, B1 );
+
+        return 0;
+    }
+
+    /** Computes the product $U U^H$ or $L^H L$ of a triangular matrix in the
+     * RFP format.
+     *
+     * @param[in] uplo Must be A.uplo.
+     * @param[in,out] A n-by-n triangular matrix in the RFP format.
+     *      On exit, the A.uplo triangle of the product in the RFP format.
+     * @param[in] opts Options passed to lauum_recursive on T1 and T2.
+     *
+     * @return = 0: successful exit
+     *
+     * @see lauum_recursive( const Uplo& uplo, matrix_t& A, const lauum_opts_t<size_type<matrix_t>>& opts )
+     *
+     * @ingroup auxiliary
+     */
+    template< typename T >
+    int lauum_recursive( const Uplo& uplo, rfpMatrix<T>& A, const lauum_opts_t<typename rfpMatrix<T>::idx_t>& opts = {} )
+    {
+        using real_t = real_type<T>;
+
+        const real_t one( 1 );
+        const auto n = A.n;
+
+        // check arguments
+        tlapack_check_false( uplo != A.uplo, -1 );
+
+        TLAPACK_PROFILE_SCOPE( "lauum_recursive", T, (1.0/3.0)*n*n*n, 0.5*n*(n+1) );
+
+        // Quick return
+        if( n <= 0 )
+            return 0;
+
+        auto T1 = rfp_triangle1( A );
+        auto T2 = rfp_triangle2( A );
+        auto S  = rfp_square( A );
+
+        lauum_recursive( Uplo::Lower, T1, opts );
+        if( A.uplo == Uplo::Lower ) {
+            // A11 = L11^H L11 + L21^H L21 and A21 = L22^H L21
+            herk( Uplo::Lower, Op::ConjTrans, one, S, one, T1 );
+            trmm( Side::Left, Uplo::Upper, Op::NoTrans, Diag::NonUnit, one, T2, S );
+        }
+        else {
+            // A11 = U11 U11^H + U12 U12^H and A12 = U12 U22^H
+            herk( Uplo::Lower, Op::NoTrans, one, S, one, T1 );
+            trmm( Side::Right, Uplo::Upper, Op::ConjTrans, Diag::NonUnit, one, T2, S );
+        }
+        lauum_recursive( Uplo::Upper, T2, opts );
+
+        return 0;
+    }
+
+    /** Computes the inverse of a triangular matrix in the RFP format.
+     *
+     * @param[in] uplo Must be A.uplo.
+     * @param[in] diag
+     *      - Diag::NonUnit: A is non-unit triangular.
+     *      - Diag::Unit: A is unit triangular. The diagonal is not referenced.
+     * @param[in,out] A n-by-n triangular matrix in the RFP format.
+     *      On exit, the inverse of A in the RFP format.
+     * @param[in] opts Options passed to trtri_recursive on T1 and T2.
+     * @param[in] ec Exception handling configuration at runtime.
+     *
+     * @return = 0: successful exit
+     * @return i, 0 < i <= n, if A(i-1,i-1) is exactly zero. The matrix is
+     *      singular and A is not modified.
+     *
+     * @see trtri_recursive( const Uplo& uplo, const Diag& diag, matrix_t& A, const trtri_opts_t<size_type<matrix_t>>& opts, const ErrorCheck& ec )
+     *
+     * @ingroup auxiliary
+     */
+    template< typename T >
+    int trtri_recursive( const Uplo& uplo, const Diag& diag, rfpMatrix<T>& A, const trtri_opts_t<typename rfpMatrix<T>::idx_t>& opts = {}, const ErrorCheck& ec = {} )
+    {
+        using idx_t = typename rfpMatrix<T>::idx_t;
+
+        const T one( 1 );
+        const idx_t n  = A.n;
+        const idx_t n1 = A.n1();
+
+        // check arguments
+        tlapack_check_false( uplo != A.uplo, -1 );
+        tlapack_check_false( diag != Diag::NonUnit && diag != Diag::Unit, -2 );
+
+        TLAPACK_PROFILE_SCOPE( "trtri_recursive", T, (1.0/3.0)*n*n*n, 0.5*n*(n+1) );
+
+        // Quick return
+        if( n <= 0 )
+            return 0;
+
+        auto T1 = rfp_triangle1( A );
+        auto T2 = rfp_triangle2( A );
+        auto S  = rfp_square( A );
+
+        // Check for singularity before any block is inverted
+        if( diag == Diag::NonUnit ) {
+            for( idx_t i = 0; i < n; ++i ) {
+                if( ((i < n1) ? T1(i,i) : T2(i-n1,i-n1)) == T(0) ) {
+                    tlapack_error_internal( ec, i + 1,
+                        "A(info,info) is exactly zero."
+                        " The triangular matrix is singular and its inverse can not be computed." );
+                    return i + 1;
+                }
+            }
+        }
+
+        trtri_recursive( Uplo::Lower, diag, T1, opts );
+        if( A.uplo == Uplo::Lower ) {
+            // A21 = - L22^{-1} A21 L11^{-1}
+            trmm( Side::Right, Uplo::Lower, Op::NoTrans, diag, -one, T1, S );
+            trtri_recursive( Uplo::Upper, diag, T2, opts );
+            trmm( Side::Left, Uplo::Upper, Op::ConjTrans, diag, one, T2, S );
+        }
+        else {
+            // A12 = - U11^{-1} A12 U22^{-1}
+            trmm( Side::Left, Uplo::Lower, Op::ConjTrans, diag, -one, T1, S );
+            trtri_recursive( Uplo::Upper, diag, T2, opts );
+            trmm( Side::Right, Uplo::Upper, Op::NoTrans, diag, one, T2, S );
+        }
+
+        return 0;
+    }
+
+} // namespace tlapack
+
+#endif // __TLAPACK_RFPARRAY_HH__
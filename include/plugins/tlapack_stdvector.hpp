@@ -13,7 +13,7 @@
 #ifndef TLAPACK_USE_MDSPAN
     #include "legacy_api/legacyArray.hpp"
 #else
-    #include <experimental/mdspan>
+    #include "plugins/tlapack_mdspan.hpp"
 #endif
 
 namespace tlapack {
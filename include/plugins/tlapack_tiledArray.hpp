@@ -0,0 +1,629 @@
+/// @file tlapack_tiledArray.hpp
+/// @brief Tiled matrix, i.e., a matrix stored as contiguous column-major tiles
+//
+// Copyright (c) 2022, University of Colorado Denver. All rights reserved.
+//
+// This file is part of <T>LAPACK.
+// <T>LAPACK is free software: you can redistribute it and/or modify it under
+// the terms of the BSD 3-Clause license. See the accompanying LICENSE file.
+
+#ifndef __TLAPACK_TILEDARRAY_HH__
+#define __TLAPACK_TILEDARRAY_HH__
+
+#include <algorithm>
+#include <atomic>
+#include <cassert>
+#include <type_traits>
+#include <utility>
+
+#include "legacy_api/legacyArray.hpp"
+#include "plugins/tlapack_legacyArray.hpp"
+#include "base/arrayTraits.hpp"
+#include "base/parallel.hpp"
+#include "blas/gemm.hpp"
+#include "lapack/potrf.hpp"
+
+namespace tlapack {
+
+    /** Tiled matrix.
+     *
+     * The matrix is split in tiles of mb-by-nb elements. Each tile is stored
+     * contiguously in column-major order, with leading dimension mb, and the
+     * tiles are stored in column-major order of tiles. The tiles in the last
+     * row and column of tiles are padded to the full tile size, so that the
+     * tile (I,J) of the storage starts at ptr + (I + J*ldt)*mb*nb.
+     *
+     * A tiledMatrix does not own its memory. Use tiledMatrix::storage_size()
+     * to allocate it. Slices are tiled matrices too, where A(0,0) is the
+     * element (i0,j0) of the first tile.
+     *
+     * Compared with a column-major matrix, each tile is contiguous in memory,
+     * so that an operation on a tile touches few pages and two threads that
+     * work on different tiles never write to the same cache line.
+     *
+     * @tparam T Floating-point type
+     */
+    template< typename T >
+    struct tiledMatrix {
+        using idx_t = TLAPACK_SIZE_T;  ///< Index type
+        idx_t m, n;                 ///< Sizes
+        idx_t mb, nb;               ///< Sizes of the tiles
+        T* ptr;                     ///< Pointer to the tile that contains A(0,0)
+        idx_t ldt;                  ///< Number of rows of tiles of the storage
+        idx_t i0, j0;               ///< Position of A(0,0) in its tile
+
+        /// Number of elements of the storage of a m-by-n matrix
+        static constexpr idx_t
+        storage_size( idx_t m, idx_t n, idx_t mb, idx_t nb ) noexcept {
+            return ((m + mb - 1) / mb) * ((n + nb - 1) / nb) * mb * nb;
+        }
+
+        inline constexpr T&
+        operator()( idx_t i, idx_t j ) const noexcept {
+            assert( i >= 0);
+            assert( i < m);
+            assert( j >= 0);
+            assert( j < n);
+            const idx_t ii = i + i0;
+            const idx_t jj = j + j0;
+            return ptr[ (ii/mb + (jj/nb)*ldt)*(mb*nb) + ii%mb + (jj%nb)*mb ];
+        }
+
+        /// Number of rows of tiles that contain elements of the matrix
+        inline constexpr idx_t mt() const noexcept {
+            return (m == 0) ? 0 : (i0 + m + mb - 1) / mb;
+        }
+
+        /// Number of columns of tiles that contain elements of the matrix
+        inline constexpr idx_t nt() const noexcept {
+            return (n == 0) ? 0 : (j0 + n + nb - 1) / nb;
+        }
+
+        /// True if A(0,0) is the first element of a tile
+        inline constexpr bool is_aligned() const noexcept {
+            return i0 == 0 && j0 == 0;
+        }
+
+        /// Matrix that uses all the storage of m-by-n tiled matrix
+        inline constexpr tiledMatrix( idx_t m, idx_t n, idx_t mb, idx_t nb, T* ptr )
+        : m(m), n(n), mb(mb), nb(nb), ptr(ptr),
+          ldt( std::max<idx_t>( 1, (m + mb - 1) / mb ) ), i0(0), j0(0)
+        {
+            tlapack_check_false( m < 0 );
+            tlapack_check_false( n < 0 );
+            tlapack_check_false( mb <= 0 );
+            tlapack_check_false( nb <= 0 );
+        }
+
+        /// Submatrix of a tiled matrix
+        inline constexpr tiledMatrix( idx_t m, idx_t n, idx_t mb, idx_t nb, T* ptr, idx_t ldt, idx_t i0, idx_t j0 )
+        : m(m), n(n), mb(mb), nb(nb), ptr(ptr), ldt(ldt), i0(i0), j0(j0)
+        {
+            tlapack_check_false( m < 0 );
+            tlapack_check_false( n < 0 );
+            tlapack_check_false( i0 >= mb );
+            tlapack_check_false( j0 >= nb );
+        }
+    };
+
+    /** Vector in a tiled matrix, e.g., a row, a column or a diagonal.
+     *
+     * The element k is A(i+k*di, j+k*dj).
+     *
+     * @tparam T Floating-point type
+     */
+    template< typename T >
+    struct tiledVector {
+        using idx_t = TLAPACK_SIZE_T;  ///< Index type
+        tiledMatrix<T> A;           ///< Matrix that contains the vector
+        idx_t n;                    ///< Size
+        idx_t i, j;                 ///< Position of the first element in A
+        idx_t di, dj;               ///< Increments, either 0 or 1
+
+        inline constexpr T&
+        operator[]( idx_t k ) const noexcept {
+            assert( k >= 0);
+            assert( k < n);
+            return A( i + k*di, j + k*dj );
+        }
+
+        inline constexpr tiledVector( const tiledMatrix<T>& A, idx_t n, idx_t i, idx_t j, idx_t di, idx_t dj )
+        : A(A), n(n), i(i), j(j), di(di), dj(dj)
+        {
+            tlapack_check_false( n < 0 );
+        }
+    };
+
+    // -----------------------------------------------------------------------------
+    // Data description
+
+    // Number of rows
+    template< typename T >
+    inline constexpr auto
+    nrows( const tiledMatrix<T>& A ){ return A.m; }
+
+    // Number of columns
+    template< typename T >
+    inline constexpr auto
+    ncols( const tiledMatrix<T>& A ){ return A.n; }
+
+    // Read policy
+    template< typename T >
+    inline constexpr auto
+    read_policy( const tiledMatrix<T>& A ) {
+        return dense;
+    }
+
+    // Write policy
+    template< typename T >
+    inline constexpr auto
+    write_policy( const tiledMatrix<T>& A ) {
+        return dense;
+    }
+
+    // Size
+    template< typename T >
+    inline constexpr auto
+    size( const tiledVector<T>& x ){ return x.n; }
+
+    // -----------------------------------------------------------------------------
+    // Data blocks
+    //
+    // All slices cost O(1), they only move A(0,0) to another tile.
+
+    #define isSlice(SliceSpec) !std::is_convertible< SliceSpec, typename tiledMatrix<T>::idx_t >::value
+
+    // Slice
+    template< typename T, class SliceSpecRow, class SliceSpecCol,
+        typename std::enable_if< isSlice(SliceSpecRow) && isSlice(SliceSpecCol), int >::type = 0
+    >
+    inline constexpr auto
+    slice( const tiledMatrix<T>& A, SliceSpecRow&& rows, SliceSpecCol&& cols ) noexcept {
+        assert( rows.first >= 0 and rows.first <= nrows(A));
+        assert( rows.second >= 0 and rows.second <= nrows(A));
+        assert( rows.first <= rows.second );
+        assert( cols.first >= 0 and cols.first <= ncols(A));
+        assert( cols.second >= 0 and cols.second <= ncols(A));
+        assert( cols.first <= cols.second );
+        using idx_t = typename tiledMatrix<T>::idx_t;
+        const idx_t ii = A.i0 + rows.first;
+        const idx_t jj = A.j0 + cols.first;
+        return tiledMatrix<T>(
+            rows.second-rows.first, cols.second-cols.first, A.mb, A.nb,
+            A.ptr + (ii/A.mb + (jj/A.nb)*A.ldt)*(A.mb*A.nb), A.ldt,
+            ii % A.mb, jj % A.nb
+        );
+    }
+
+    #undef isSlice
+
+    // Slice
+    template< typename T, class SliceSpecCol >
+    inline constexpr auto
+    slice( const tiledMatrix<T>& A, typename tiledMatrix<T>::idx_t rowIdx, SliceSpecCol&& cols ) noexcept {
+        assert( cols.first >= 0 and cols.first <= ncols(A));
+        assert( cols.second >= 0 and cols.second <= ncols(A));
+        assert( cols.first <= cols.second );
+        assert( rowIdx >= 0 and rowIdx < nrows(A));
+        return tiledVector<T>( A, cols.second-cols.first, rowIdx, cols.first, 0, 1 );
+    }
+
+    // Slice
+    template< typename T, class SliceSpecRow >
+    inline constexpr auto
+    slice( const tiledMatrix<T>& A, SliceSpecRow&& rows, typename tiledMatrix<T>::idx_t colIdx = 0 ) noexcept {
+        assert( rows.first >= 0 and rows.first <= nrows(A));
+        assert( rows.second >= 0 and rows.second <= nrows(A));
+        assert( rows.first <= rows.second );
+        assert( colIdx >= 0 and colIdx < ncols(A));
+        return tiledVector<T>( A, rows.second-rows.first, rows.first, colIdx, 1, 0 );
+    }
+
+    // Rows
+    template< typename T, class SliceSpec >
+    inline constexpr auto
+    rows( const tiledMatrix<T>& A, SliceSpec&& rows ) noexcept {
+        using idx_t = typename tiledMatrix<T>::idx_t;
+        return slice( A, std::forward<SliceSpec>(rows), std::pair<idx_t,idx_t>{ 0, A.n } );
+    }
+
+    // Row
+    template< typename T >
+    inline constexpr auto
+    row( const tiledMatrix<T>& A, typename tiledMatrix<T>::idx_t rowIdx ) noexcept {
+        assert( rowIdx >= 0 and rowIdx < nrows(A));
+        return tiledVector<T>( A, A.n, rowIdx, 0, 0, 1 );
+    }
+
+    // Columns
+    template< typename T, class SliceSpec >
+    inline constexpr auto
+    cols( const tiledMatrix<T>& A, SliceSpec&& cols ) noexcept {
+        using idx_t = typename tiledMatrix<T>::idx_t;
+        return slice( A, std::pair<idx_t,idx_t>{ 0, A.m }, std::forward<SliceSpec>(cols) );
+    }
+
+    // Column
+    template< typename T >
+    inline constexpr auto
+    col( const tiledMatrix<T>& A, typename tiledMatrix<T>::idx_t colIdx ) noexcept {
+        assert( colIdx >= 0 and colIdx < ncols(A));
+        return tiledVector<T>( A, A.m, 0, colIdx, 1, 0 );
+    }
+
+    // Diagonal
+    template< typename T, class int_t >
+    inline constexpr auto
+    diag( const tiledMatrix<T>& A, int_t diagIdx = 0 ) noexcept {
+
+        using idx_t = typename tiledMatrix<T>::idx_t;
+
+        const idx_t i = (diagIdx >= 0) ? 0 : -diagIdx;
+        const idx_t j = (diagIdx >= 0) ? diagIdx : 0;
+        const idx_t n = (diagIdx >= 0)
+                    ? std::min( A.m+diagIdx, A.n ) - (idx_t) diagIdx
+                    : std::min( A.m, A.n-diagIdx ) + (idx_t) diagIdx;
+
+        return tiledVector<T>( A, n, i, j, 1, 1 );
+    }
+
+    // slice
+    template< typename T, class SliceSpec >
+    inline constexpr auto
+    slice( const tiledVector<T>& v, SliceSpec&& rows ) noexcept {
+        assert( rows.first >= 0 and rows.first <= size(v));
+        assert( rows.second >= 0 and rows.second <= size(v));
+        return tiledVector<T>( v.A, rows.second-rows.first,
+            v.i + rows.first*v.di, v.j + rows.first*v.dj, v.di, v.dj );
+    }
+
+    /** Tile (I,J) of a tiled matrix, i.e., the elements of A that are
+     * stored in it, as a column-major legacy matrix.
+     *
+     * @param[in] A Tiled matrix.
+     * @param[in] I Row of tiles, 0 <= I < A.mt().
+     * @param[in] J Column of tiles, 0 <= J < A.nt().
+     */
+    template< typename T >
+    inline constexpr auto
+    tile( const tiledMatrix<T>& A, typename tiledMatrix<T>::idx_t I, typename tiledMatrix<T>::idx_t J ) noexcept {
+        assert( I >= 0 and I < A.mt() );
+        assert( J >= 0 and J < A.nt() );
+        using idx_t = typename tiledMatrix<T>::idx_t;
+        const idx_t r0 = (I == 0) ? A.i0 : 0;
+        const idx_t c0 = (J == 0) ? A.j0 : 0;
+        const idx_t r1 = std::min( A.mb, A.i0 + A.m - I*A.mb );
+        const idx_t c1 = std::min( A.nb, A.j0 + A.n - J*A.nb );
+        return legacyMatrix<T,Layout::ColMajor>(
+            r1 - r0, c1 - c0,
+            A.ptr + (I + J*A.ldt)*(A.mb*A.nb) + r0 + c0*A.mb, A.mb );
+    }
+
+    // -----------------------------------------------------------------------------
+    // Tile traversal
+
+    namespace internal {
+
+        /**
+         * Calls f(I,J) for the tiles I0 <= I < I1, J0 <= J < J1. The range
+         * is split recursively in halves of its longest side, which gives a
+         * cache-oblivious order, and the halves are OpenMP tasks.
+         */
+        template< class idx_t, class f_t >
+        void for_each_tile( idx_t I0, idx_t I1, idx_t J0, idx_t J1, const f_t& f )
+        {
+            if( I1 - I0 <= 1 && J1 - J0 <= 1 ) {
+                if( I0 < I1 && J0 < J1 )
+                    f( I0, J0 );
+            }
+            else if( I1 - I0 >= J1 - J0 ) {
+                const idx_t Im = I0 + (I1 - I0) / 2;
+                const f_t* fp = &f;
+                TLAPACK_OMP(task)
+                for_each_tile( I0, Im, J0, J1, *fp );
+                for_each_tile( Im, I1, J0, J1, f );
+                TLAPACK_OMP(taskwait)
+            }
+            else {
+                const idx_t Jm = J0 + (J1 - J0) / 2;
+                const f_t* fp = &f;
+                TLAPACK_OMP(task)
+                for_each_tile( I0, I1, J0, Jm, *fp );
+                for_each_tile( I0, I1, Jm, J1, f );
+                TLAPACK_OMP(taskwait)
+            }
+        }
+
+        /**
+         * Creates the tasks of the tile Cholesky factorization of A, which
+         * has square tiles and is aligned. If potrf2 fails on the diagonal
+         * tile k, sets *failed, *kfail = k and *info to the info of potrf2,
+         * and the remaining tasks do nothing.
+         *
+         * The arguments of the tasks are copied, so that the pointers to the
+         * results are shared by all tasks.
+         */
+        template< class uplo_t, typename T, class idx_t >
+        void potrf_tile_tasks(
+            uplo_t uplo, const tiledMatrix<T> A,
+            std::atomic<bool>* failed, idx_t* kfail, int* info )
+        {
+            using real_t = real_type< T >;
+            const real_t one( 1.0 );
+            const idx_t nt = A.nt();
+
+            for( idx_t k = 0; k < nt; ++k ) {
+                T* const akk = tile( A, k, k ).ptr;
+
+                TLAPACK_OMP(task depend(inout: akk[0]))
+                {
+                    if( !failed->load( std::memory_order_relaxed ) ) {
+                        auto Akk = tile( A, k, k );
+                        const int i = potrf2( uplo, Akk, noErrorCheck );
+                        if( i != 0 ) {
+                            *kfail = k;
+                            *info = i;
+                            failed->store( true, std::memory_order_relaxed );
+                        }
+                    }
+                }
+
+                for( idx_t i = k+1; i < nt; ++i ) {
+                    T* const aik = (uplo == Uplo::Lower) ? tile( A, i, k ).ptr : tile( A, k, i ).ptr;
+
+                    TLAPACK_OMP(task depend(in: akk[0]) depend(inout: aik[0]))
+                    {
+                        if( !failed->load( std::memory_order_relaxed ) ) {
+                            const auto Akk = tile( A, k, k );
+                            if( uplo == Uplo::Lower ) {
+                                auto Aik = tile( A, i, k );
+                                trsm( Side::Right, Uplo::Lower, Op::ConjTrans, Diag::NonUnit, one, Akk, Aik );
+                            }
+                            else {
+                                auto Aki = tile( A, k, i );
+                                trsm( Side::Left, Uplo::Upper, Op::ConjTrans, Diag::NonUnit, one, Akk, Aki );
+                            }
+                        }
+                    }
+                }
+
+                for( idx_t i = k+1; i < nt; ++i ) {
+                    T* const aik = (uplo == Uplo::Lower) ? tile( A, i, k ).ptr : tile( A, k, i ).ptr;
+                    T* const aii = tile( A, i, i ).ptr;
+
+                    TLAPACK_OMP(task depend(in: aik[0]) depend(inout: aii[0]))
+                    {
+                        if( !failed->load( std::memory_order_relaxed ) ) {
+                            auto Aii = tile( A, i, i );
+                            if( uplo == Uplo::Lower )
+                                herk( Uplo::Lower, Op::NoTrans, -one, tile( A, i, k ), one, Aii );
+                            else
+                                herk( Uplo::Upper, Op::ConjTrans, -one, tile( A, k, i ), one, Aii );
+                        }
+                    }
+
+                    for( idx_t j = k+1; j < i; ++j ) {
+                        T* const ajk = (uplo == Uplo::Lower) ? tile( A, j, k ).ptr : tile( A, k, j ).ptr;
+                        T* const aij = (uplo == Uplo::Lower) ? tile( A, i, j ).ptr : tile( A, j, i ).ptr;
+
+                        TLAPACK_OMP(task depend(in: aik[0], ajk[0]) depend(inout: aij[0]))
+                        {
+                            if( !failed->load( std::memory_order_relaxed ) ) {
+                                if( uplo == Uplo::Lower ) {
+                                    auto Aij = tile( A, i, j );
+                                    gemm( Op::NoTrans, Op::ConjTrans, -one, tile( A, i, k ), tile( A, j, k ), one, Aij );
+                                }
+                                else {
+                                    auto Aji = tile( A, j, i );
+                                    gemm( Op::ConjTrans, Op::NoTrans, -one, tile( A, k, j ), tile( A, k, i ), one, Aji );
+                                }
+                            }
+                        }
+                    }
+                }
+            }
+        }
+
+    } // namespace internal
+
+    // -----------------------------------------------------------------------------
+    // Conversion
+
+    /** Copies a matrix into a tiled matrix.
+     *
+     * The tiles are copied in parallel if <T>LAPACK is compiled with OpenMP.
+     *
+     * @param[in] A m-by-n matrix.
+     * @param[out] B m-by-n tiled matrix.
+     *
+     * @ingroup auxiliary
+     */
+    template< class matrix_t, typename T >
+    void copy_to_tiled( const matrix_t& A, tiledMatrix<T>& B )
+    {
+        using idx_t = typename tiledMatrix<T>::idx_t;
+
+        tlapack_check( (idx_t) nrows(A) == B.m );
+        tlapack_check( (idx_t) ncols(A) == B.n );
+
+        internal::run_tasks( [&]() {
+            internal::for_each_tile( idx_t(0), B.mt(), idx_t(0), B.nt(), [&]( idx_t I, idx_t J ) {
+                auto Bt = tile( B, I, J );
+                const idx_t r0 = (I == 0) ? 0 : I*B.mb - B.i0;
+                const idx_t c0 = (J == 0) ? 0 : J*B.nb - B.j0;
+                for( idx_t j = 0; j < Bt.n; ++j )
+                    for( idx_t i = 0; i < Bt.m; ++i )
+                        Bt(i,j) = A( r0+i, c0+j );
+            } );
+        } );
+    }
+
+    /** Copies a tiled matrix into a matrix.
+     *
+     * The tiles are copied in parallel if <T>LAPACK is compiled with OpenMP.
+     *
+     * @param[in] A m-by-n tiled matrix.
+     * @param[out] B m-by-n matrix.
+     *
+     * @ingroup auxiliary
+     */
+    template< typename T, class matrix_t >
+    void copy_from_tiled( const tiledMatrix<T>& A, matrix_t& B )
+    {
+        using idx_t = typename tiledMatrix<T>::idx_t;
+
+        tlapack_check( A.m == (idx_t) nrows(B) );
+        tlapack_check( A.n == (idx_t) ncols(B) );
+
+        internal::run_tasks( [&]() {
+            internal::for_each_tile( idx_t(0), A.mt(), idx_t(0), A.nt(), [&]( idx_t I, idx_t J ) {
+                const auto At = tile( A, I, J );
+                const idx_t r0 = (I == 0) ? 0 : I*A.mb - A.i0;
+                const idx_t c0 = (J == 0) ? 0 : J*A.nb - A.j0;
+                for( idx_t j = 0; j < At.n; ++j )
+                    for( idx_t i = 0; i < At.m; ++i )
+                        B( r0+i, c0+j ) = At(i,j);
+            } );
+        } );
+    }
+
+    // -----------------------------------------------------------------------------
+    // Tile algorithms
+
+    /**
+     * General matrix-matrix multiply of tiled matrices,
+     * $C := \alpha op(A) \times op(B) + \beta C$.
+     *
+     * If the tiles of op(A), op(B) and C match, each tile of C is updated
+     * with the products of the tiles of op(A) and op(B) by gemm on
+     * contiguous column-major blocks, and the tiles of C are OpenMP tasks.
+     * Otherwise, the template gemm is used.
+     *
+     * @see gemm( Op transA, Op transB, const alpha_t& alpha, const matrixA_t& A, const matrixB_t& B, const beta_t& beta, matrixC_t& C )
+     *
+     * @ingroup gemm
+     */
+    template< typename T, class alpha_t, class beta_t >
+    void gemm(
+        Op transA, Op transB,
+        const alpha_t& alpha,
+        const tiledMatrix<T>& A,
+        const tiledMatrix<T>& B,
+        const beta_t& beta,
+        tiledMatrix<T>& C )
+    {
+        using idx_t = typename tiledMatrix<T>::idx_t;
+
+        const idx_t k = (transA == Op::NoTrans) ? A.n : A.m;
+
+        // Tiles of op(A) and op(B)
+        const idx_t mbA = (transA == Op::NoTrans) ? A.mb : A.nb;
+        const idx_t kbA = (transA == Op::NoTrans) ? A.nb : A.mb;
+        const idx_t kbB = (transB == Op::NoTrans) ? B.mb : B.nb;
+        const idx_t nbB = (transB == Op::NoTrans) ? B.nb : B.mb;
+
+        if( !A.is_aligned() || !B.is_aligned() || !C.is_aligned() ||
+            mbA != C.mb || nbB != C.nb || kbA != kbB || k == 0 )
+            return internal::gemm_template( transA, transB, alpha, A, B, beta, C );
+
+        tlapack_check_false( transA != Op::NoTrans && transA != Op::Trans && transA != Op::ConjTrans );
+        tlapack_check_false( transB != Op::NoTrans && transB != Op::Trans && transB != Op::ConjTrans );
+        tlapack_check_false( C.m != ((transA == Op::NoTrans) ? A.m : A.n) );
+        tlapack_check_false( C.n != ((transB == Op::NoTrans) ? B.n : B.m) );
+        tlapack_check_false( k != ((transB == Op::NoTrans) ? B.m : B.n) );
+
+        const idx_t kt = (k + kbA - 1) / kbA;
+        internal::run_tasks( [&]() {
+            internal::for_each_tile( idx_t(0), C.mt(), idx_t(0), C.nt(), [&]( idx_t I, idx_t J ) {
+                auto Cij = tile( C, I, J );
+                for( idx_t K = 0; K < kt; ++K ) {
+                    const auto Aik = (transA == Op::NoTrans) ? tile( A, I, K ) : tile( A, K, I );
+                    const auto Bkj = (transB == Op::NoTrans) ? tile( B, K, J ) : tile( B, J, K );
+                    if( K == 0 )
+                        gemm( transA, transB, alpha, Aik, Bkj, beta, Cij );
+                    else
+                        gemm( transA, transB, alpha, Aik, Bkj, beta_t(1), Cij );
+                }
+            } );
+        } );
+    }
+
+    /** Computes the Cholesky factorization of a Hermitian positive definite
+     * tiled matrix A.
+     *
+     * If A has square tiles and A(0,0) is the first element of a tile, the
+     * factorization is computed tile by tile: potrf2 on the diagonal tiles,
+     * trsm on the tiles of the panel, and herk and gemm on the trailing
+     * tiles. Each tile operation is an OpenMP task that depends on the tiles
+     * it reads and writes. Otherwise, the blocked algorithm of potrf is used.
+     * The block size opts_t::nb is not used by the tile algorithm.
+     *
+     * @see potrf( uplo_t uplo, matrix_t& A, opts_t&& opts, const ErrorCheck& ec )
+     *
+     * @ingroup posv_computational
+     */
+    template< class uplo_t, typename T, class opts_t >
+    int potrf( uplo_t uplo, tiledMatrix<T>& A, opts_t&& opts, const ErrorCheck& ec = {} )
+    {
+        using idx_t  = typename tiledMatrix<T>::idx_t;
+
+        // check arguments
+        tlapack_check( uplo == Uplo::Lower || uplo == Uplo::Upper );
+        tlapack_check( nrows(A) == ncols(A) );
+
+        if( !A.is_aligned() || A.mb != A.nb )
+            return internal::potrf_blocked( uplo, A, opts, ec );
+
+        const idx_t n  = A.n;
+        const idx_t nb = A.nb;
+        const idx_t nt = A.nt();
+
+        TLAPACK_PROFILE_SCOPE( "potrf", T, (1.0/3.0)*n*n*n, 0.5*n*(n+1) );
+
+        // Quick return
+        if( n <= 0 )
+            return 0;
+
+        // First tile where the factorization failed, and its info
+        std::atomic<bool> failed( false );
+        idx_t kfail = nt;
+        int info = 0;
+
+        internal::run_tasks( [&]() {
+            internal::potrf_tile_tasks( uplo, A, &failed, &kfail, &info );
+        } );
+
+        if( kfail != nt ) {
+            tlapack_error_internal( ec, info + kfail*nb,
+                "The leading minor of the reported order is not positive definite,"
+                " and the factorization could not be completed." );
+            return info + kfail*nb;
+        }
+
+        // Report infs and nans on the output
+        tlapack_warn_nans_in_matrix( ec, uplo, A, n+1,
+            "The factorization has some nans." );
+        tlapack_warn_infs_in_matrix( ec, uplo, A, n+1,
+            "The factorization has some infs." );
+
+        return 0;
+    }
+
+    /** Computes the Cholesky factorization of a Hermitian positive definite
+     * tiled matrix A.
+     *
+     * Version with default options defined in @see potrf_opts_t.
+     *
+     * @see potrf( uplo_t uplo, tiledMatrix<T>& A, opts_t&& opts, const ErrorCheck& ec )
+     */
+    template< class uplo_t, typename T >
+    inline
+    int potrf( uplo_t uplo, tiledMatrix<T>& A, const ErrorCheck& ec = {} )
+    {
+        using idx_t = typename tiledMatrix<T>::idx_t;
+        return potrf( uplo, A, potrf_opts_t<idx_t>{}, ec );
+    }
+
+} // namespace tlapack
+
+#endif // __TLAPACK_TILEDARRAY_HH__
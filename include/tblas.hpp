@@ -9,6 +9,8 @@
 
 // Optimized BLAS
 
+#include "base/dispatch.hpp"
+
 #ifdef USE_BLASPP_WRAPPERS
     #include "optimized/wrappers.hpp"
 #endif
@@ -36,9 +38,11 @@
 // Level 2 BLAS template implementations
 
 #include "blas/gemv.hpp"
+#include "blas/gbmv.hpp"
 #include "blas/ger.hpp"
 #include "blas/geru.hpp"
 #include "blas/hemv.hpp"
+#include "blas/hbmv.hpp"
 #include "blas/her.hpp"
 #include "blas/her2.hpp"
 #include "blas/symv.hpp"
@@ -47,13 +51,13 @@
 // #include "blas/spmv.hpp"
 // #include "blas/spr.hpp"
 // #include "blas/spr2.hpp"
-// #include "blas/sbmv.hpp"
+#include "blas/sbmv.hpp"
 #include "blas/trmv.hpp"
 #include "blas/trsv.hpp"
 // #include "blas/tpmv.hpp"
-// #include "blas/tbmv.hpp"
+#include "blas/tbmv.hpp"
 // #include "blas/tpsv.hpp"
-// #include "blas/tbsv.hpp"
+#include "blas/tbsv.hpp"
 
 // =============================================================================
 // Level 3 BLAS template implementations
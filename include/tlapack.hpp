@@ -34,7 +34,10 @@
 #include "lapack/lascl.hpp"
 #include "lapack/lassq.hpp"
 #include "lapack/transpose.hpp"
+#include "lapack/lauu2.hpp"
 #include "lapack/lauum_recursive.hpp"
+#include "lapack/trti2.hpp"
+#include "lapack/trtri_recursive.hpp"
 
 // QR factorization
 // ----------------
@@ -44,12 +47,41 @@
 #include "lapack/unm2r.hpp"
 #include "lapack/unmqr.hpp"
 
+// LQ factorization
+// ----------------
+
+#include "lapack/gelq2.hpp"
+#include "lapack/unmlq.hpp"
+
 // Solution of positive definite systems
 // ----------------
 
 #include "lapack/potrf2.hpp"
 #include "lapack/potrf.hpp"
 #include "lapack/potrs.hpp"
+#include "lapack/potri.hpp"
+#include "lapack/chol_update1.hpp"
+#include "lapack/chol_update.hpp"
+
+// Solution of band systems
+// ----------------
+
+#include "lapack/gbtf2.hpp"
+#include "lapack/gbtrf.hpp"
+#include "lapack/gbtrs.hpp"
+#include "lapack/pbtf2.hpp"
+#include "lapack/pbtrf.hpp"
+#include "lapack/pbtrs.hpp"
+
+// Solution of tridiagonal systems
+// ----------------
+
+#include "lapack/gttrf.hpp"
+#include "lapack/gttrs.hpp"
+#include "lapack/gtsv_spike.hpp"
+#include "lapack/gtsv_batched.hpp"
+#include "lapack/pttrf.hpp"
+#include "lapack/pttrs.hpp"
 
 // Sylver equation routines
 // ----------------
@@ -74,5 +106,41 @@
 #include "lapack/multishift_qr_sweep.hpp"
 #include "lapack/agressive_early_deflation.hpp"
 #include "lapack/multishift_qr.hpp"
+#include "lapack/gebal.hpp"
+#include "lapack/gebak.hpp"
+#include "lapack/gees.hpp"
+
+// Symmetric/Hermitian standard eigenvalue routines
+// ----------------
+
+#include "lapack/hetd2.hpp"
+#include "lapack/latrd.hpp"
+#include "lapack/hetrd.hpp"
+#include "lapack/unmtr.hpp"
+#include "lapack/steqr.hpp"
+#include "lapack/laed4.hpp"
+#include "lapack/laed1.hpp"
+#include "lapack/stedc.hpp"
+#include "lapack/heevd.hpp"
+
+// Singular value decomposition routines
+// ----------------
+
+#include "lapack/gebd2.hpp"
+#include "lapack/labrd.hpp"
+#include "lapack/gebrd.hpp"
+#include "lapack/ge2gb.hpp"
+#include "lapack/gbbrd.hpp"
+#include "lapack/bdsqr.hpp"
+#include "lapack/bdsdc.hpp"
+#include "lapack/gesvd.hpp"
+#include "lapack/gesdd.hpp"
+
+// Randomized low-rank approximations
+// ----------------
+
+#include "lapack/rangefinder.hpp"
+#include "lapack/randomized_svd.hpp"
+#include "lapack/randomized_heev.hpp"
 
 #endif // __TLAPACK_HH__
@@ -0,0 +1,399 @@
+/// @file benchmark.hpp
+/// @brief Minimal benchmark harness for the <T>LAPACK performance tests
+//
+// Copyright (c) 2022, University of Colorado Denver. All rights reserved.
+//
+// This file is part of <T>LAPACK.
+// <T>LAPACK is free software: you can redistribute it and/or modify it under
+// the terms of the BSD 3-Clause license. See the accompanying LICENSE file.
+
+#ifndef __TLAPACK_PERFORMANCETESTS_BENCHMARK_HH__
+#define __TLAPACK_PERFORMANCETESTS_BENCHMARK_HH__
+
+#include <algorithm>
+#include <chrono>
+#include <complex>
+#include <cstdint>
+#include <cstdlib>
+#include <fstream>
+#include <iomanip>
+#include <iostream>
+#include <map>
+#include <sstream>
+#include <string>
+#include <vector>
+
+#ifdef __linux__
+    #include <linux/perf_event.h>
+    #include <sys/ioctl.h>
+    #include <sys/syscall.h>
+    #include <unistd.h>
+#endif
+
+#include <tlapack.hpp>
+
+namespace tlapack {
+namespace benchmark {
+
+    /// Short name of a scalar type, as in the BLAS naming scheme
+    template <typename T> inline const char *type_name();
+    template <> inline const char *type_name<float>() { return "s"; }
+    template <> inline const char *type_name<double>() { return "d"; }
+    template <> inline const char *type_name<std::complex<float>>() { return "c"; }
+    template <> inline const char *type_name<std::complex<double>>() { return "z"; }
+
+    /// Short name of a layout
+    inline const char *layout_name(Layout L)
+    {
+        return (L == Layout::ColMajor) ? "col" : (L == Layout::RowMajor) ? "row" : "unspecified";
+    }
+
+    /// Random number generator shared by the benchmarks, as in the tests
+    class rand_generator
+    {
+    public:
+        using result_type = uint32_t;
+        static constexpr uint32_t min() { return 0; }
+        static constexpr uint32_t max() { return UINT32_MAX; }
+        void seed(uint64_t s) { state = s; }
+        uint32_t operator()()
+        {
+            state = state * 6364136223846793005ULL + 1442695040888963407ULL;
+            return uint32_t(state >> 32);
+        }
+
+    private:
+        uint64_t state = 1302;
+    };
+
+    /// Uniform random number in [-1, 1), or in the unit square for complex types
+    template <typename T>
+    inline T rand_helper(rand_generator &gen)
+    {
+        using real_t = real_type<T>;
+        const real_t r = real_t(2) * static_cast<real_t>(gen()) / static_cast<real_t>(gen.max()) - real_t(1);
+        if constexpr (is_complex<T>::value)
+        {
+            const real_t i = real_t(2) * static_cast<real_t>(gen()) / static_cast<real_t>(gen.max()) - real_t(1);
+            return T(r, i);
+        }
+        else
+            return r;
+    }
+
+    /// Options common to all benchmark drivers
+    struct options_t
+    {
+        std::vector<std::size_t> sizes;    ///< Problem sizes
+        std::string filter;                ///< Only run benchmarks whose name contains this string
+        double min_time = 0.1;             ///< Minimum measured time per benchmark, in seconds
+        std::size_t min_reps = 3;          ///< Minimum number of measured repetitions
+        std::string format = "console";    ///< console, csv or json
+        std::string output;                ///< Output file, standard output if empty
+        std::map<std::string, std::string> extra; ///< Options specific to a driver
+    };
+
+    /// Splits a comma-separated list of sizes
+    inline std::vector<std::size_t> parse_sizes(const std::string &s)
+    {
+        std::vector<std::size_t> sizes;
+        std::stringstream ss(s);
+        std::string item;
+        while (std::getline(ss, item, ','))
+            if (!item.empty())
+                sizes.push_back(std::stoul(item));
+        return sizes;
+    }
+
+    /**
+     * Parses the command line. Options have the form --name=value, e.g.,
+     * --sizes=64,128 --filter=gemm --min-time=0.5 --format=json
+     * --output=out.json. Unknown options are stored in options_t::extra.
+     */
+    inline options_t parse_options(int argc, char **argv, const std::vector<std::size_t> &default_sizes)
+    {
+        options_t opts;
+        opts.sizes = default_sizes;
+        for (int i = 1; i < argc; ++i)
+        {
+            std::string arg = argv[i];
+            if (arg == "--help" || arg == "-h")
+            {
+                std::cout << "Usage: " << argv[0] << " [--sizes=n1,n2,...] [--filter=substring]"
+                          << " [--min-time=seconds] [--min-reps=n] [--format=console|csv|json]"
+                          << " [--output=file]" << std::endl;
+                std::exit(0);
+            }
+            const auto eq = arg.find('=');
+            if (arg.compare(0, 2, "--") != 0 || eq == std::string::npos)
+            {
+                std::cerr << "Ignoring argument " << arg << std::endl;
+                continue;
+            }
+            const std::string key = arg.substr(2, eq - 2);
+            const std::string value = arg.substr(eq + 1);
+            if (key == "sizes")
+                opts.sizes = parse_sizes(value);
+            else if (key == "filter")
+                opts.filter = value;
+            else if (key == "min-time")
+                opts.min_time = std::stod(value);
+            else if (key == "min-reps")
+                opts.min_reps = std::stoul(value);
+            else if (key == "format")
+                opts.format = value;
+            else if (key == "output")
+                opts.output = value;
+            else
+                opts.extra[key] = value;
+        }
+        return opts;
+    }
+
+    /// Result of one benchmark
+    struct result_t
+    {
+        std::string name;       ///< Routine or phase
+        std::string variant;    ///< Options of the routine, e.g., "NoTrans,Trans"
+        std::string type;       ///< Scalar type
+        std::string layout;     ///< Matrix layout
+        std::string backend;    ///< Implementation
+        std::size_t m = 0, n = 0, k = 0;    ///< Dimensions
+        std::size_t reps = 0;   ///< Number of measured repetitions
+        double time = 0;        ///< Best time of one repetition, in seconds
+        double mean_time = 0;   ///< Mean time of one repetition, in seconds
+        double median_time = 0; ///< Median time of one repetition, in seconds
+        double flops = 0;       ///< Nominal number of floating-point operations
+        double bytes = 0;       ///< Nominal number of bytes read or written
+        std::vector<std::pair<std::string, double>> counters; ///< Extra metrics
+    };
+
+    /**
+     * Runs f repeatedly until min_time seconds and min_reps repetitions are
+     * reached, and returns the best, the mean and the median time of one
+     * repetition.
+     * setup() is called before each repetition and is not timed.
+     */
+    template <class setup_t, class f_t>
+    inline void measure(result_t &r, const options_t &opts, setup_t &&setup, f_t &&f)
+    {
+        using clock = std::chrono::steady_clock;
+
+        // Warm-up
+        setup();
+        f();
+
+        double total = 0;
+        std::vector<double> times;
+        while (times.empty() || times.size() < opts.min_reps || total < opts.min_time)
+        {
+            setup();
+            const auto start = clock::now();
+            f();
+            const double t = std::chrono::duration<double>(clock::now() - start).count();
+            times.push_back(t);
+            total += t;
+        }
+        const std::size_t reps = times.size();
+        std::sort(times.begin(), times.end());
+        r.reps = reps;
+        r.time = times.front();
+        r.mean_time = total / reps;
+        r.median_time = (reps % 2) ? times[reps / 2] : (times[reps / 2 - 1] + times[reps / 2]) / 2;
+    }
+
+    /**
+     * Hardware counters of cache misses of the calling thread, read with
+     * perf_event_open on Linux. The counters are not available on other
+     * systems, or if the kernel does not allow them, e.g., if
+     * /proc/sys/kernel/perf_event_paranoid is larger than 2.
+     */
+    class cache_counters
+    {
+    public:
+        /// Names of the counters, as in result_t::counters
+        static constexpr const char *names[2] = {"L1d_misses", "LLC_misses"};
+
+        cache_counters()
+        {
+#ifdef __linux__
+            const uint64_t configs[2] = {
+                PERF_COUNT_HW_CACHE_L1D | (PERF_COUNT_HW_CACHE_OP_READ << 8) |
+                    (PERF_COUNT_HW_CACHE_RESULT_MISS << 16),
+                PERF_COUNT_HW_CACHE_LL | (PERF_COUNT_HW_CACHE_OP_READ << 8) |
+                    (PERF_COUNT_HW_CACHE_RESULT_MISS << 16)};
+            for (int k = 0; k < 2; ++k)
+            {
+                perf_event_attr attr = {};
+                attr.size = sizeof(attr);
+                attr.type = PERF_TYPE_HW_CACHE;
+                attr.config = configs[k];
+                attr.disabled = 1;
+                attr.exclude_kernel = 1;
+                attr.exclude_hv = 1;
+                fd_[k] = int(syscall(__NR_perf_event_open, &attr, 0, -1, -1, 0));
+            }
+#endif
+        }
+
+        ~cache_counters()
+        {
+#ifdef __linux__
+            for (int fd : fd_)
+                if (fd >= 0)
+                    close(fd);
+#endif
+        }
+
+        cache_counters(const cache_counters &) = delete;
+        cache_counters &operator=(const cache_counters &) = delete;
+
+        /// True if at least one counter is available
+        bool available() const { return fd_[0] >= 0 || fd_[1] >= 0; }
+
+        /**
+         * Runs f once and adds the number of misses of each available
+         * counter to r.counters.
+         */
+        template <class f_t>
+        void count(result_t &r, f_t &&f)
+        {
+#ifdef __linux__
+            for (int fd : fd_)
+                if (fd >= 0)
+                {
+                    ioctl(fd, PERF_EVENT_IOC_RESET, 0);
+                    ioctl(fd, PERF_EVENT_IOC_ENABLE, 0);
+                }
+#endif
+            f();
+#ifdef __linux__
+            for (int k = 0; k < 2; ++k)
+                if (fd_[k] >= 0)
+                {
+                    ioctl(fd_[k], PERF_EVENT_IOC_DISABLE, 0);
+                    uint64_t misses = 0;
+                    if (read(fd_[k], &misses, sizeof(misses)) == sizeof(misses))
+                        r.counters.push_back({names[k], double(misses)});
+                }
+#endif
+        }
+
+    private:
+        int fd_[2] = {-1, -1};
+    };
+
+    /// Collects the results and writes them in the requested format
+    class reporter
+    {
+    public:
+        explicit reporter(const options_t &opts) : opts_(opts) {}
+
+        /// True if the benchmark should run, given the filter of the options
+        bool selected(const result_t &r) const
+        {
+            return opts_.filter.empty() || full_name(r).find(opts_.filter) != std::string::npos;
+        }
+
+        void add(const result_t &r)
+        {
+            results_.push_back(r);
+            if (opts_.format == "console")
+                print_console(std::cout, r, results_.size() == 1);
+        }
+
+        /// Writes the csv or json output
+        void finish() const
+        {
+            if (opts_.format == "console")
+                return;
+            std::ofstream file;
+            if (!opts_.output.empty())
+                file.open(opts_.output);
+            std::ostream &out = opts_.output.empty() ? std::cout : file;
+            if (opts_.format == "csv")
+                write_csv(out);
+            else
+                write_json(out);
+        }
+
+    private:
+        /// Rate in units of 10^9 per second, 0 if the time is not measurable
+        static double rate(double amount, double time)
+        {
+            return (time > 0) ? 1e-9 * amount / time : 0.0;
+        }
+
+        static std::string full_name(const result_t &r)
+        {
+            std::string s = r.type + r.name;
+            if (!r.variant.empty())
+                s += "<" + r.variant + ">";
+            return s + "/" + r.layout;
+        }
+
+        static void print_console(std::ostream &out, const result_t &r, bool header)
+        {
+            if (header)
+                out << std::left << std::setw(44) << "benchmark" << std::right
+                    << std::setw(7) << "m" << std::setw(7) << "n" << std::setw(7) << "k"
+                    << std::setw(13) << "time (s)" << std::setw(10) << "GFLOP/s"
+                    << std::setw(10) << "GB/s" << std::setw(8) << "reps" << std::endl;
+            out << std::left << std::setw(44) << full_name(r) << std::right
+                << std::setw(7) << r.m << std::setw(7) << r.n << std::setw(7) << r.k
+                << std::scientific << std::setprecision(3) << std::setw(13) << r.time
+                << std::fixed << std::setprecision(2)
+                << std::setw(10) << rate(r.flops, r.time)
+                << std::setw(10) << rate(r.bytes, r.time)
+                << std::setw(8) << r.reps << std::defaultfloat << std::setprecision(4);
+            for (const auto &c : r.counters)
+                out << "  " << c.first << "=" << c.second;
+            out << std::setprecision(6) << std::endl;
+        }
+
+        void write_csv(std::ostream &out) const
+        {
+            out << "name,variant,type,layout,backend,m,n,k,reps,time,mean_time,median_time,gflops,gbps,counters\n";
+            for (const auto &r : results_)
+            {
+                out << r.name << ",\"" << r.variant << "\"," << r.type << "," << r.layout << ","
+                    << r.backend << "," << r.m << "," << r.n << "," << r.k << "," << r.reps << ","
+                    << std::setprecision(6) << r.time << "," << r.mean_time << "," << r.median_time << ","
+                    << rate(r.flops, r.time) << "," << rate(r.bytes, r.time) << ",\"";
+                for (std::size_t i = 0; i < r.counters.size(); ++i)
+                    out << (i ? ";" : "") << r.counters[i].first << "=" << r.counters[i].second;
+                out << "\"\n";
+            }
+        }
+
+        void write_json(std::ostream &out) const
+        {
+            out << "{\"benchmarks\":[";
+            for (std::size_t i = 0; i < results_.size(); ++i)
+            {
+                const auto &r = results_[i];
+                out << (i ? ",\n" : "\n") << std::setprecision(6)
+                    << "{\"name\":\"" << full_name(r) << "\",\"routine\":\"" << r.name
+                    << "\",\"variant\":\"" << r.variant << "\",\"type\":\"" << r.type
+                    << "\",\"layout\":\"" << r.layout << "\",\"backend\":\"" << r.backend
+                    << "\",\"m\":" << r.m << ",\"n\":" << r.n << ",\"k\":" << r.k
+                    << ",\"reps\":" << r.reps << ",\"time\":" << r.time
+                    << ",\"mean_time\":" << r.mean_time
+                    << ",\"median_time\":" << r.median_time
+                    << ",\"gflops\":" << rate(r.flops, r.time)
+                    << ",\"gbps\":" << rate(r.bytes, r.time);
+                for (const auto &c : r.counters)
+                    out << ",\"" << c.first << "\":" << c.second;
+                out << "}";
+            }
+            out << "\n]}\n";
+        }
+
+        const options_t &opts_;
+        std::vector<result_t> results_;
+    };
+
+} // namespace benchmark
+} // namespace tlapack
+
+#endif // __TLAPACK_PERFORMANCETESTS_BENCHMARK_HH__
@@ -0,0 +1,282 @@
+/// @file benchmark_blas.cpp
+/// @brief Performance of the BLAS routines of <T>LAPACK
+//
+// Copyright (c) 2022, University of Colorado Denver. All rights reserved.
+//
+// This file is part of <T>LAPACK.
+// <T>LAPACK is free software: you can redistribute it and/or modify it under
+// the terms of the BSD 3-Clause license. See the accompanying LICENSE file.
+//
+// Benchmarks every routine in include/blas, with all trans, uplo, side and
+// diag variants, for float, double, complex<float> and complex<double>, and
+// for column- and row-major legacy matrices. The vectors of the Level 1
+// routines have length n*n, so that they touch as much memory as the Level 2
+// routines for the same n.
+//
+// If the executable is compiled with USE_BLASPP_WRAPPERS, the calls are
+// forwarded to the optimized BLAS library and the results are labelled
+// "blaspp" instead of "template". Run both executables with the same
+// arguments to compare the two paths.
+//
+// Usage: benchmark_blas [--sizes=64,256] [--filter=gemm] [--types=sdcz]
+//                       [--layouts=col,row] [--min-time=0.1]
+//                       [--format=console|csv|json] [--output=file]
+
+#include <plugins/tlapack_stdvector.hpp>
+#include "../benchmark.hpp"
+
+using namespace tlapack;
+using namespace tlapack::benchmark;
+
+#ifdef USE_BLASPP_WRAPPERS
+static const char *const backend = "blaspp";
+#else
+static const char *const backend = "template";
+#endif
+
+inline const char *op_name(Op op)
+{
+    return (op == Op::NoTrans) ? "NoTrans" : (op == Op::Trans) ? "Trans" : "ConjTrans";
+}
+inline const char *uplo_name(Uplo uplo) { return (uplo == Uplo::Upper) ? "Upper" : "Lower"; }
+inline const char *side_name(Side side) { return (side == Side::Left) ? "Left" : "Right"; }
+inline const char *diag_name(Diag diag) { return (diag == Diag::Unit) ? "Unit" : "NonUnit"; }
+
+/// Joins the names of the variants of a routine
+template <class... names_t>
+std::string variant(const names_t &...names)
+{
+    std::string s;
+    for (const char *name : {names...})
+        s += (s.empty() ? "" : ",") + std::string(name);
+    return s;
+}
+
+/// Benchmarks of all BLAS routines for one scalar type and one layout
+template <typename T, Layout L>
+class blas_benchmarks
+{
+    using matrix_t = legacyMatrix<T, L>;
+    using vector_t = legacyVector<T>;
+    using idx_t = size_type<matrix_t>;
+    using real_t = real_type<T>;
+
+public:
+    blas_benchmarks(const options_t &opts, reporter &rep) : opts(opts), rep(rep) {}
+
+    void run(idx_t n)
+    {
+        allocate(n);
+        level1(n * n);
+        level2(n);
+        level3(n);
+    }
+
+private:
+    const options_t &opts;
+    reporter &rep;
+
+    // Data and copies of the data restored before each repetition
+    std::vector<T> A_, A0_, B_, B0_, C_, x_, x0_, y_, y0_;
+
+    void allocate(idx_t n)
+    {
+        rand_generator gen;
+        const idx_t len = n * n;
+        for (auto v : {&A_, &A0_, &B_, &B0_, &C_, &x_, &x0_, &y_, &y0_})
+            v->resize(len);
+        for (idx_t i = 0; i < len; ++i)
+        {
+            A0_[i] = rand_helper<T>(gen) / real_t(n);
+            B0_[i] = rand_helper<T>(gen);
+            C_[i] = rand_helper<T>(gen);
+            x0_[i] = rand_helper<T>(gen);
+            y0_[i] = rand_helper<T>(gen);
+        }
+        // Small off-diagonal entries, so that the triangular solves with
+        // unit and non-unit diagonal do not overflow
+        auto A0 = matrix(A0_, n);
+        for (idx_t i = 0; i < n; ++i)
+            A0(i, i) += T(real_t(1));
+    }
+
+    matrix_t matrix(std::vector<T> &v, idx_t n) { return matrix_t(n, n, v.data(), n); }
+    vector_t vector(std::vector<T> &v, idx_t n) { return vector_t(n, v.data()); }
+
+    result_t make(const char *name, const std::string &var, idx_t m, idx_t n, idx_t k, double flops, double elements)
+    {
+        result_t r;
+        r.name = name;
+        r.variant = var;
+        r.type = type_name<T>();
+        r.layout = layout_name(L);
+        r.backend = backend;
+        r.m = m;
+        r.n = n;
+        r.k = k;
+        r.flops = profile_flops<T>(flops);
+        r.bytes = elements * sizeof(T);
+        return r;
+    }
+
+    /// Restores the operands that the routines overwrite
+    void restore()
+    {
+        A_ = A0_;
+        x_ = x0_;
+        y_ = y0_;
+        B_ = B0_;
+    }
+
+    template <class f_t>
+    void bench(result_t r, f_t &&f)
+    {
+        if (!rep.selected(r))
+            return;
+        measure(r, opts, [&]() { restore(); }, f);
+        rep.add(r);
+    }
+
+    void level1(idx_t len)
+    {
+        auto x = vector(x_, len);
+        auto y = vector(y_, len);
+        const T alpha = T(real_t(0.5));
+        volatile real_t sink = 0;
+
+        bench(make("asum", "", len, 0, 0, len, len), [&]() { sink = asum(x); });
+        bench(make("axpy", "", len, 0, 0, 2.0 * len, 3.0 * len), [&]() { axpy(alpha, x, y); });
+        bench(make("copy", "", len, 0, 0, 0, 2.0 * len), [&]() { tlapack::copy(x, y); });
+        bench(make("dot", "", len, 0, 0, 2.0 * len, 2.0 * len), [&]() { sink = real(dot(x, y)); });
+        bench(make("dotu", "", len, 0, 0, 2.0 * len, 2.0 * len), [&]() { sink = real(dotu(x, y)); });
+        bench(make("iamax", "", len, 0, 0, len, len), [&]() { sink = real_t(iamax(x)); });
+        bench(make("nrm2", "", len, 0, 0, 2.0 * len, len), [&]() { sink = nrm2(x); });
+        bench(make("rot", "", len, 0, 0, 6.0 * len, 4.0 * len), [&]() { rot(x, y, real_t(0.6), T(real_t(0.8))); });
+        if constexpr (!is_complex<T>::value)
+        {
+            const T h[4] = {T(0.6), T(-0.8), T(0.8), T(0.6)};
+            bench(make("rotm", "-1", len, 0, 0, 6.0 * len, 4.0 * len), [&]() { rotm<-1>(x, y, h); });
+        }
+        bench(make("scal", "", len, 0, 0, len, 2.0 * len), [&]() { scal(alpha, x); });
+        bench(make("swap", "", len, 0, 0, 0, 4.0 * len), [&]() { tlapack::swap(x, y); });
+        (void)sink;
+    }
+
+    void level2(idx_t n)
+    {
+        auto A = matrix(A_, n);
+        auto x = vector(x_, n);
+        auto y = vector(y_, n);
+        const T alpha = T(real_t(0.5));
+        const T beta = T(real_t(0.5));
+        const double nn = double(n) * n;
+
+        for (Op trans : {Op::NoTrans, Op::Trans, Op::ConjTrans})
+            bench(make("gemv", variant(op_name(trans)), n, n, 0, 2 * nn, nn + 3.0 * n),
+                  [&]() { gemv(trans, alpha, A, x, beta, y); });
+
+        bench(make("ger", "", n, n, 0, 2 * nn, 2 * nn + 2.0 * n), [&]() { ger(alpha, x, y, A); });
+        bench(make("geru", "", n, n, 0, 2 * nn, 2 * nn + 2.0 * n), [&]() { geru(alpha, x, y, A); });
+
+        for (Uplo uplo : {Uplo::Upper, Uplo::Lower})
+        {
+            const std::string var = variant(uplo_name(uplo));
+            bench(make("hemv", var, n, n, 0, 2 * nn, nn / 2 + 3.0 * n), [&]() { hemv(uplo, alpha, A, x, beta, y); });
+            bench(make("symv", var, n, n, 0, 2 * nn, nn / 2 + 3.0 * n), [&]() { symv(uplo, alpha, A, x, beta, y); });
+            bench(make("her", var, n, n, 0, nn, nn + n), [&]() { her(uplo, real_t(0.5), x, A); });
+            bench(make("syr", var, n, n, 0, nn, nn + n), [&]() { syr(uplo, alpha, x, A); });
+            bench(make("her2", var, n, n, 0, 2 * nn, nn + 2.0 * n), [&]() { her2(uplo, alpha, x, y, A); });
+            bench(make("syr2", var, n, n, 0, 2 * nn, nn + 2.0 * n), [&]() { syr2(uplo, alpha, x, y, A); });
+
+            for (Op trans : {Op::NoTrans, Op::Trans, Op::ConjTrans})
+                for (Diag diag : {Diag::NonUnit, Diag::Unit})
+                {
+                    const std::string var3 = variant(uplo_name(uplo), op_name(trans), diag_name(diag));
+                    bench(make("trmv", var3, n, n, 0, nn, nn / 2 + 2.0 * n), [&]() { trmv(uplo, trans, diag, A, x); });
+                    bench(make("trsv", var3, n, n, 0, nn, nn / 2 + 2.0 * n), [&]() { trsv(uplo, trans, diag, A, x); });
+                }
+        }
+    }
+
+    void level3(idx_t n)
+    {
+        auto A = matrix(A_, n);
+        auto B = matrix(B_, n);
+        auto C = matrix(C_, n);
+        const T alpha = T(real_t(0.5));
+        const T beta = T(real_t(0.5));
+        const double nn = double(n) * n;
+        const double nnn = nn * n;
+
+        for (Op transA : {Op::NoTrans, Op::Trans, Op::ConjTrans})
+            for (Op transB : {Op::NoTrans, Op::Trans, Op::ConjTrans})
+                bench(make("gemm", variant(op_name(transA), op_name(transB)), n, n, n, 2 * nnn, 4 * nn),
+                      [&]() { gemm(transA, transB, alpha, A, B, beta, C); });
+
+        for (Side side : {Side::Left, Side::Right})
+            for (Uplo uplo : {Uplo::Upper, Uplo::Lower})
+            {
+                const std::string var = variant(side_name(side), uplo_name(uplo));
+                bench(make("hemm", var, n, n, n, 2 * nnn, 3.5 * nn), [&]() { hemm(side, uplo, alpha, A, B, beta, C); });
+                bench(make("symm", var, n, n, n, 2 * nnn, 3.5 * nn), [&]() { symm(side, uplo, alpha, A, B, beta, C); });
+            }
+
+        for (Uplo uplo : {Uplo::Upper, Uplo::Lower})
+        {
+            for (Op trans : {Op::NoTrans, Op::ConjTrans})
+            {
+                const std::string var = variant(uplo_name(uplo), op_name(trans));
+                bench(make("herk", var, n, n, n, nnn, 2 * nn), [&]() { herk(uplo, trans, real_t(0.5), A, real_t(0.5), C); });
+                bench(make("her2k", var, n, n, n, 2 * nnn, 3 * nn), [&]() { her2k(uplo, trans, alpha, A, B, real_t(0.5), C); });
+            }
+            for (Op trans : {Op::NoTrans, Op::Trans})
+            {
+                const std::string var = variant(uplo_name(uplo), op_name(trans));
+                bench(make("syrk", var, n, n, n, nnn, 2 * nn), [&]() { syrk(uplo, trans, alpha, A, beta, C); });
+                bench(make("syr2k", var, n, n, n, 2 * nnn, 3 * nn), [&]() { syr2k(uplo, trans, alpha, A, B, beta, C); });
+            }
+        }
+
+        for (Side side : {Side::Left, Side::Right})
+            for (Uplo uplo : {Uplo::Upper, Uplo::Lower})
+                for (Op trans : {Op::NoTrans, Op::Trans, Op::ConjTrans})
+                    for (Diag diag : {Diag::NonUnit, Diag::Unit})
+                    {
+                        const std::string var = variant(side_name(side), uplo_name(uplo), op_name(trans), diag_name(diag));
+                        bench(make("trmm", var, n, n, n, nnn, 2.5 * nn), [&]() { trmm(side, uplo, trans, diag, alpha, A, B); });
+                        bench(make("trsm", var, n, n, n, nnn, 2.5 * nn), [&]() { trsm(side, uplo, trans, diag, alpha, A, B); });
+                    }
+    }
+};
+
+template <typename T>
+void run_type(const options_t &opts, reporter &rep, const std::string &layouts)
+{
+    for (std::size_t n : opts.sizes)
+    {
+        if (layouts.find("col") != std::string::npos)
+            blas_benchmarks<T, Layout::ColMajor>(opts, rep).run(n);
+        if (layouts.find("row") != std::string::npos)
+            blas_benchmarks<T, Layout::RowMajor>(opts, rep).run(n);
+    }
+}
+
+int main(int argc, char **argv)
+{
+    const options_t opts = parse_options(argc, argv, {32, 128, 512});
+    const std::string types = opts.extra.count("types") ? opts.extra.at("types") : "sdcz";
+    const std::string layouts = opts.extra.count("layouts") ? opts.extra.at("layouts") : "col,row";
+
+    reporter rep(opts);
+    if (types.find('s') != std::string::npos)
+        run_type<float>(opts, rep, layouts);
+    if (types.find('d') != std::string::npos)
+        run_type<double>(opts, rep, layouts);
+    if (types.find('c') != std::string::npos)
+        run_type<std::complex<float>>(opts, rep, layouts);
+    if (types.find('z') != std::string::npos)
+        run_type<std::complex<double>>(opts, rep, layouts);
+    rep.finish();
+
+    return 0;
+}
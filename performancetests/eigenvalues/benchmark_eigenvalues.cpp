@@ -0,0 +1,475 @@
+/// @file benchmark_eigenvalues.cpp
+/// @brief Performance of the nonsymmetric eigenvalue routines of <T>LAPACK
+//
+// Copyright (c) 2022, University of Colorado Denver. All rights reserved.
+//
+// This file is part of <T>LAPACK.
+// <T>LAPACK is free software: you can redistribute it and/or modify it under
+// the terms of the BSD 3-Clause license. See the accompanying LICENSE file.
+//
+// For each matrix family, scalar type and size, measures the phases of the
+// computation of the Schur form A = Q T Q^H:
+//
+//   gehrd          reduction to Hessenberg form
+//   unghr          generation of Q
+//   lahqr          Schur form of the Hessenberg matrix, double-shift QR
+//   multishift_qr  Schur form of the Hessenberg matrix, multishift QR
+//                  with aggressive early deflation (AED)
+//   aed            one call to agressive_early_deflation on the Hessenberg
+//                  matrix, with the recommended window size
+//
+// The Schur rows report the number of AED calls, sweeps and shifts, and the
+// backward error ||A - Q T Q^H||_F / ||A||_F and the loss of orthogonality
+// ||Q^H Q - I||_F. If <T>LAPACK is compiled with TLAPACK_PROFILE, they also
+// report the self time of each routine called, e.g., self:gemm.
+//
+// If a reference LAPACK library was found by CMake, the same phases are
+// measured with xGEHRD, xORGHR/xUNGHR and xHSEQR, labelled "lapack".
+//
+// Matrix families:
+//   random             entries uniform in [-1, 1)
+//   clustered          eigenvalues in 4 clusters of radius 1e-6, hidden by
+//                      a similarity with 3 random reflectors
+//   graded             D R D, with R random and D = diag(10^(-8 i/n))
+//   nearly_triangular  random upper triangular plus a perturbation of
+//                      size sqrt(eps) below the diagonal
+//   companion          companion matrix of a random polynomial
+//
+// Usage: benchmark_eigenvalues [--sizes=100,300,1000] [--types=d]
+//          [--families=random,clustered,graded,nearly_triangular,companion]
+//          [--methods=lahqr,multishift_qr] [--lahqr-max=1000] [--check=1]
+//          [--min-time=0] [--min-reps=1] [--format=console|csv|json]
+//          [--output=file]
+//
+// Each size needs about 6 n^2 scalars of memory, e.g., 4.8 GB for n = 10000
+// in double precision.
+
+#include <plugins/tlapack_stdvector.hpp>
+#include "../benchmark.hpp"
+
+using namespace tlapack;
+using namespace tlapack::benchmark;
+
+#ifdef TLAPACK_BENCHMARK_LAPACK
+extern "C"
+{
+    void sgehrd_(const int *n, const int *ilo, const int *ihi, float *a, const int *lda, float *tau, float *work, const int *lwork, int *info);
+    void dgehrd_(const int *n, const int *ilo, const int *ihi, double *a, const int *lda, double *tau, double *work, const int *lwork, int *info);
+    void cgehrd_(const int *n, const int *ilo, const int *ihi, std::complex<float> *a, const int *lda, std::complex<float> *tau, std::complex<float> *work, const int *lwork, int *info);
+    void zgehrd_(const int *n, const int *ilo, const int *ihi, std::complex<double> *a, const int *lda, std::complex<double> *tau, std::complex<double> *work, const int *lwork, int *info);
+
+    void sorghr_(const int *n, const int *ilo, const int *ihi, float *a, const int *lda, const float *tau, float *work, const int *lwork, int *info);
+    void dorghr_(const int *n, const int *ilo, const int *ihi, double *a, const int *lda, const double *tau, double *work, const int *lwork, int *info);
+    void cunghr_(const int *n, const int *ilo, const int *ihi, std::complex<float> *a, const int *lda, const std::complex<float> *tau, std::complex<float> *work, const int *lwork, int *info);
+    void zunghr_(const int *n, const int *ilo, const int *ihi, std::complex<double> *a, const int *lda, const std::complex<double> *tau, std::complex<double> *work, const int *lwork, int *info);
+
+    void shseqr_(const char *job, const char *compz, const int *n, const int *ilo, const int *ihi, float *h, const int *ldh, float *wr, float *wi, float *z, const int *ldz, float *work, const int *lwork, int *info, std::size_t, std::size_t);
+    void dhseqr_(const char *job, const char *compz, const int *n, const int *ilo, const int *ihi, double *h, const int *ldh, double *wr, double *wi, double *z, const int *ldz, double *work, const int *lwork, int *info, std::size_t, std::size_t);
+    void chseqr_(const char *job, const char *compz, const int *n, const int *ilo, const int *ihi, std::complex<float> *h, const int *ldh, std::complex<float> *w, std::complex<float> *z, const int *ldz, std::complex<float> *work, const int *lwork, int *info, std::size_t, std::size_t);
+    void zhseqr_(const char *job, const char *compz, const int *n, const int *ilo, const int *ihi, std::complex<double> *h, const int *ldh, std::complex<double> *w, std::complex<double> *z, const int *ldz, std::complex<double> *work, const int *lwork, int *info, std::size_t, std::size_t);
+}
+
+/// Overloads of the reference LAPACK routines used in the benchmark
+namespace reference
+{
+#define TLAPACK_BENCHMARK_GEHRD(T, gehrd_, unghr_)                                   \
+    inline int gehrd(int n, T *a, T *tau, std::vector<T> &work)                       \
+    {                                                                                 \
+        int ilo = 1, info = 0, lwork = -1;                                            \
+        T query;                                                                      \
+        gehrd_(&n, &ilo, &n, a, &n, tau, &query, &lwork, &info);                      \
+        lwork = int(real(query));                                                     \
+        work.resize(lwork);                                                           \
+        gehrd_(&n, &ilo, &n, a, &n, tau, work.data(), &lwork, &info);                 \
+        return info;                                                                  \
+    }                                                                                 \
+    inline int unghr(int n, T *a, const T *tau, std::vector<T> &work)                 \
+    {                                                                                 \
+        int ilo = 1, info = 0, lwork = -1;                                            \
+        T query;                                                                      \
+        unghr_(&n, &ilo, &n, a, &n, tau, &query, &lwork, &info);                      \
+        lwork = int(real(query));                                                     \
+        work.resize(lwork);                                                           \
+        unghr_(&n, &ilo, &n, a, &n, tau, work.data(), &lwork, &info);                 \
+        return info;                                                                  \
+    }
+    TLAPACK_BENCHMARK_GEHRD(float, sgehrd_, sorghr_)
+    TLAPACK_BENCHMARK_GEHRD(double, dgehrd_, dorghr_)
+    TLAPACK_BENCHMARK_GEHRD(std::complex<float>, cgehrd_, cunghr_)
+    TLAPACK_BENCHMARK_GEHRD(std::complex<double>, zgehrd_, zunghr_)
+#undef TLAPACK_BENCHMARK_GEHRD
+
+#define TLAPACK_BENCHMARK_HSEQR_REAL(T, hseqr_)                                                             \
+    inline int hseqr(int n, T *h, T *z, std::vector<T> &work)                                               \
+    {                                                                                                       \
+        int ilo = 1, info = 0, lwork = -1;                                                                  \
+        std::vector<T> wr(n), wi(n);                                                                        \
+        T query;                                                                                            \
+        hseqr_("S", "V", &n, &ilo, &n, h, &n, wr.data(), wi.data(), z, &n, &query, &lwork, &info, 1, 1);    \
+        lwork = int(query);                                                                                 \
+        work.resize(lwork);                                                                                 \
+        hseqr_("S", "V", &n, &ilo, &n, h, &n, wr.data(), wi.data(), z, &n, work.data(), &lwork, &info, 1, 1); \
+        return info;                                                                                        \
+    }
+#define TLAPACK_BENCHMARK_HSEQR_COMPLEX(T, hseqr_)                                                 \
+    inline int hseqr(int n, T *h, T *z, std::vector<T> &work)                                      \
+    {                                                                                              \
+        int ilo = 1, info = 0, lwork = -1;                                                         \
+        std::vector<T> w(n);                                                                       \
+        T query;                                                                                   \
+        hseqr_("S", "V", &n, &ilo, &n, h, &n, w.data(), z, &n, &query, &lwork, &info, 1, 1);       \
+        lwork = int(real(query));                                                                  \
+        work.resize(lwork);                                                                        \
+        hseqr_("S", "V", &n, &ilo, &n, h, &n, w.data(), z, &n, work.data(), &lwork, &info, 1, 1);  \
+        return info;                                                                               \
+    }
+    TLAPACK_BENCHMARK_HSEQR_REAL(float, shseqr_)
+    TLAPACK_BENCHMARK_HSEQR_REAL(double, dhseqr_)
+    TLAPACK_BENCHMARK_HSEQR_COMPLEX(std::complex<float>, chseqr_)
+    TLAPACK_BENCHMARK_HSEQR_COMPLEX(std::complex<double>, zhseqr_)
+#undef TLAPACK_BENCHMARK_HSEQR_REAL
+#undef TLAPACK_BENCHMARK_HSEQR_COMPLEX
+} // namespace reference
+#endif
+
+/// Returns true if the comma-separated list contains the item
+inline bool contains(const std::string &list, const std::string &item)
+{
+    std::stringstream ss(list);
+    std::string s;
+    while (std::getline(ss, s, ','))
+        if (s == item)
+            return true;
+    return false;
+}
+
+/// Generates a matrix of the given family
+template <class matrix_t>
+void generate(const std::string &family, matrix_t &A, rand_generator &gen)
+{
+    using T = type_t<matrix_t>;
+    using idx_t = size_type<matrix_t>;
+    using real_t = real_type<T>;
+
+    const idx_t n = nrows(A);
+    const T zero(0);
+
+    if (family == "random")
+    {
+        for (idx_t j = 0; j < n; ++j)
+            for (idx_t i = 0; i < n; ++i)
+                A(i, j) = rand_helper<T>(gen);
+    }
+    else if (family == "graded")
+    {
+        std::vector<real_t> d(n);
+        for (idx_t i = 0; i < n; ++i)
+            d[i] = pow(real_t(10), real_t(-8) * real_t(i) / real_t(n));
+        for (idx_t j = 0; j < n; ++j)
+            for (idx_t i = 0; i < n; ++i)
+                A(i, j) = d[i] * rand_helper<T>(gen) * d[j];
+    }
+    else if (family == "nearly_triangular")
+    {
+        const real_t delta = sqrt(ulp<real_t>());
+        for (idx_t j = 0; j < n; ++j)
+            for (idx_t i = 0; i < n; ++i)
+                A(i, j) = (i <= j) ? rand_helper<T>(gen) : delta * rand_helper<T>(gen);
+    }
+    else if (family == "companion")
+    {
+        laset(Uplo::General, zero, zero, A);
+        for (idx_t j = 0; j < n; ++j)
+            A(0, j) = -rand_helper<T>(gen);
+        for (idx_t i = 1; i < n; ++i)
+            A(i, i - 1) = T(1);
+    }
+    else if (family == "clustered")
+    {
+        // Upper triangular matrix with clustered eigenvalues
+        const real_t centers[] = {1, -1, 2, 4};
+        const real_t radius = real_t(1e-6);
+        laset(Uplo::General, zero, zero, A);
+        for (idx_t j = 0; j < n; ++j)
+        {
+            for (idx_t i = 0; i < j; ++i)
+                A(i, j) = rand_helper<T>(gen) / sqrt(real_t(n));
+            A(j, j) = centers[j % 4] + radius * rand_helper<T>(gen);
+        }
+
+        // Similarity with 3 random reflectors I - 2 u u^H
+        std::vector<T> u_(n), y_(n);
+        auto u = legacyVector<T>(n, u_.data());
+        auto y = legacyVector<T>(n, y_.data());
+        for (int r = 0; r < 3; ++r)
+        {
+            for (idx_t i = 0; i < n; ++i)
+                u[i] = rand_helper<T>(gen);
+            scal(real_t(1) / nrm2(u), u);
+            gemv(Op::ConjTrans, T(1), A, u, zero, y);
+            ger(T(-2), u, y, A);
+            gemv(Op::NoTrans, T(1), A, u, zero, y);
+            ger(T(-2), y, u, A);
+        }
+    }
+    else
+        throw std::invalid_argument("Unknown matrix family " + family);
+}
+
+/// Benchmarks of the eigenvalue routines for one scalar type
+template <typename T>
+class eigenvalue_benchmarks
+{
+    using matrix_t = legacyMatrix<T, Layout::ColMajor>;
+    using idx_t = size_type<matrix_t>;
+    using real_t = real_type<T>;
+
+public:
+    eigenvalue_benchmarks(const options_t &opts, reporter &rep) : opts(opts), rep(rep)
+    {
+        methods = opts.extra.count("methods") ? opts.extra.at("methods") : "lahqr,multishift_qr";
+        lahqr_max = opts.extra.count("lahqr-max") ? std::stoul(opts.extra.at("lahqr-max")) : 1000;
+        check = opts.extra.count("check") ? (opts.extra.at("check") != "0") : true;
+    }
+
+    void run(const std::string &family, idx_t n)
+    {
+        rand_generator gen;
+        for (auto v : {&A0_, &Hf_, &Q0_, &H0_, &H_, &Q_})
+            v->resize(n * n);
+        tau_.resize(n);
+        work_.resize(n);
+
+        auto A0 = matrix(A0_, n);
+        auto Hf = matrix(Hf_, n);
+        auto Q0 = matrix(Q0_, n);
+        auto H0 = matrix(H0_, n);
+        auto H = matrix(H_, n);
+        auto Q = matrix(Q_, n);
+        generate(family, A0, gen);
+
+        // gehrd
+        result_t r = make("gehrd", family, n, (10.0 / 3.0) * n * n * n);
+        produce(r, [&]() { H_ = A0_; }, [&]() { gehrd(0, n, H, tau_); });
+        Hf_ = H_;
+
+        // unghr
+        r = make("unghr", family, n, (4.0 / 3.0) * n * n * n);
+        produce(r, [&]() { Q_ = Hf_; }, [&]() { unghr(0, n, Q, tau_, work_); });
+        Q0_ = Q_;
+
+        // Hessenberg matrix
+        H0_ = Hf_;
+        for (idx_t j = 0; j < n; ++j)
+            for (idx_t i = j + 2; i < n; ++i)
+                H0(i, j) = T(0);
+
+        std::vector<std::complex<real_t>> w(n);
+
+        // Schur form with lahqr
+        if (contains(methods, "lahqr") && n <= lahqr_max)
+        {
+            r = make("lahqr", family, n, 0);
+            int info = 0;
+            bench(r, [&]() { H_ = H0_; Q_ = Q0_; }, [&]() { info = lahqr(true, true, 0, n, H, w, Q); },
+                  [&](result_t &r) {
+                      r.counters.push_back({"info", info});
+                      add_errors(r, A0, H, Q);
+                  });
+        }
+
+        // Schur form with multishift_qr
+        if (contains(methods, "multishift_qr"))
+        {
+            r = make("multishift_qr", family, n, 0);
+            francis_opts_t<idx_t, T> fopts;
+            int info = 0;
+            bench(r, [&]() { H_ = H0_; Q_ = Q0_; }, [&]() { info = multishift_qr(true, true, 0, n, H, w, Q, fopts); },
+                  [&](result_t &r) {
+                      r.counters.push_back({"info", info});
+                      r.counters.push_back({"n_aed", fopts.n_aed});
+                      r.counters.push_back({"n_sweep", fopts.n_sweep});
+                      r.counters.push_back({"n_shifts", fopts.n_shifts_total});
+                      add_errors(r, A0, H, Q);
+                  });
+
+            // One AED call with the recommended window
+            if (n >= fopts.nmin)
+            {
+                r = make("aed", family, n, 0);
+                idx_t nw = std::min<idx_t>(fopts.deflation_window_recommender(n, n), (n - 3) / 3);
+                idx_t ns = 0, nd = 0;
+                bench(r, [&]() { H_ = H0_; Q_ = Q0_; },
+                      [&]() { agressive_early_deflation(true, true, idx_t(0), n, nw, H, w, Q, ns, nd, fopts); },
+                      [&](result_t &r) {
+                          r.counters.push_back({"nw", nw});
+                          r.counters.push_back({"n_deflated", nd});
+                      });
+            }
+        }
+
+#ifdef TLAPACK_BENCHMARK_LAPACK
+        const int ni = int(n);
+        r = make("gehrd", family, n, (10.0 / 3.0) * n * n * n, "lapack");
+        produce(r, [&]() { H_ = A0_; }, [&]() { reference::gehrd(ni, H_.data(), tau_.data(), work_); });
+        Hf_ = H_;
+
+        r = make("unghr", family, n, (4.0 / 3.0) * n * n * n, "lapack");
+        produce(r, [&]() { Q_ = Hf_; }, [&]() { reference::unghr(ni, Q_.data(), tau_.data(), work_); });
+        Q0_ = Q_;
+
+        H0_ = Hf_;
+        for (idx_t j = 0; j < n; ++j)
+            for (idx_t i = j + 2; i < n; ++i)
+                H0(i, j) = T(0);
+
+        r = make("hseqr", family, n, 0, "lapack");
+        int info = 0;
+        bench(r, [&]() { H_ = H0_; Q_ = Q0_; }, [&]() { info = reference::hseqr(ni, H_.data(), Q_.data(), work_); },
+              [&](result_t &r) {
+                  r.counters.push_back({"info", info});
+                  add_errors(r, A0, H, Q);
+              });
+#endif
+    }
+
+private:
+    const options_t &opts;
+    reporter &rep;
+    std::string methods;
+    std::size_t lahqr_max;
+    bool check;
+
+    // Original matrix, output of gehrd, output of unghr, Hessenberg
+    // matrix, and the matrices of the current run
+    std::vector<T> A0_, Hf_, Q0_, H0_, H_, Q_, tau_, work_;
+
+    matrix_t matrix(std::vector<T> &v, idx_t n) { return matrix_t(n, n, v.data(), n); }
+
+    result_t make(const char *name, const std::string &family, idx_t n, double flops, const char *backend = "template")
+    {
+        result_t r;
+        r.name = name;
+        r.variant = family;
+        r.type = type_name<T>();
+        r.layout = layout_name(Layout::ColMajor);
+        r.backend = backend;
+        r.m = n;
+        r.n = n;
+        r.flops = profile_flops<T>(flops);
+        r.bytes = double(n) * n * sizeof(T);
+        return r;
+    }
+
+    /// Measures a phase whose output is the input of the next phases, so it
+    /// runs at least once even if the filter does not select it
+    template <class setup_t, class f_t>
+    void produce(result_t &r, setup_t &&setup, f_t &&f)
+    {
+        if (rep.selected(r))
+            bench(r, setup, f);
+        else
+        {
+            setup();
+            f();
+        }
+    }
+
+    template <class setup_t, class f_t>
+    void bench(result_t &r, setup_t &&setup, f_t &&f)
+    {
+        bench(r, setup, f, [](result_t &) {});
+    }
+
+    /// Measures f and adds the counters computed by finish() from the last run
+    template <class setup_t, class f_t, class finish_t>
+    void bench(result_t &r, setup_t &&setup, f_t &&f, finish_t &&finish)
+    {
+        if (!rep.selected(r))
+            return;
+#ifdef TLAPACK_PROFILE
+        reset_profile();
+#endif
+        measure(r, opts, setup, f);
+#ifdef TLAPACK_PROFILE
+        // Self time per run of each routine, including the warm-up run
+        const auto report = profile_report();
+#endif
+        finish(r);
+#ifdef TLAPACK_PROFILE
+        for (const auto &e : report)
+            r.counters.push_back({"self:" + e.name, e.self_time / (r.reps + 1)});
+#endif
+        rep.add(r);
+    }
+
+    /// Adds the backward error and the loss of orthogonality of A = Q T Q^H
+    void add_errors(result_t &r, const matrix_t &A, const matrix_t &T_, const matrix_t &Q)
+    {
+        if (!check)
+            return;
+        const idx_t n = nrows(A);
+        std::vector<T> W_(n * n), R_(A0_), S_(n * n);
+        auto W = matrix(W_, n);
+        auto R = matrix(R_, n);
+        auto S = matrix(S_, n);
+        const real_t normA = lange(frob_norm, A);
+
+        // The Schur form, without the entries below the first subdiagonal
+        // that multishift_qr uses as workspace
+        laset(Uplo::General, T(0), T(0), S);
+        lacpy(Uplo::Upper, T_, S);
+        for (idx_t i = 1; i < n; ++i)
+            S(i, i - 1) = T_(i, i - 1);
+
+        // R = A - Q S Q^H
+        gemm(Op::NoTrans, Op::NoTrans, T(1), Q, S, T(0), W);
+        gemm(Op::NoTrans, Op::ConjTrans, T(-1), W, Q, T(1), R);
+        r.counters.push_back({"backward_error", lange(frob_norm, R) / normA});
+
+        // W = Q^H Q - I
+        laset(Uplo::General, T(0), T(1), W);
+        gemm(Op::ConjTrans, Op::NoTrans, T(1), Q, Q, T(-1), W);
+        r.counters.push_back({"orthogonality", lange(frob_norm, W)});
+    }
+};
+
+int main(int argc, char **argv)
+{
+    options_t opts = parse_options(argc, argv, {100, 300, 1000});
+    // Each run is expensive, so measure one repetition unless asked otherwise
+    bool min_time_given = false, min_reps_given = false;
+    for (int i = 1; i < argc; ++i)
+    {
+        min_time_given |= std::string(argv[i]).compare(0, 11, "--min-time=") == 0;
+        min_reps_given |= std::string(argv[i]).compare(0, 11, "--min-reps=") == 0;
+    }
+    if (!min_time_given)
+        opts.min_time = 0;
+    if (!min_reps_given)
+        opts.min_reps = 1;
+
+    const std::string types = opts.extra.count("types") ? opts.extra.at("types") : "d";
+    const std::string families = opts.extra.count("families")
+                                     ? opts.extra.at("families")
+                                     : "random,clustered,graded,nearly_triangular,companion";
+
+    reporter rep(opts);
+    std::stringstream ss(families);
+    std::string family;
+    while (std::getline(ss, family, ','))
+        for (std::size_t n : opts.sizes)
+        {
+            if (types.find('s') != std::string::npos)
+                eigenvalue_benchmarks<float>(opts, rep).run(family, n);
+            if (types.find('d') != std::string::npos)
+                eigenvalue_benchmarks<double>(opts, rep).run(family, n);
+            if (types.find('c') != std::string::npos)
+                eigenvalue_benchmarks<std::complex<float>>(opts, rep).run(family, n);
+            if (types.find('z') != std::string::npos)
+                eigenvalue_benchmarks<std::complex<double>>(opts, rep).run(family, n);
+        }
+    rep.finish();
+
+    return 0;
+}
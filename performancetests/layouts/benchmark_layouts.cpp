@@ -0,0 +1,165 @@
+/// @file benchmark_layouts.cpp
+/// @brief Performance of the recursive routines in the column-major and in the Morton layout
+//
+// Copyright (c) 2022, University of Colorado Denver. All rights reserved.
+//
+// This file is part of <T>LAPACK.
+// <T>LAPACK is free software: you can redistribute it and/or modify it under
+// the terms of the BSD 3-Clause license. See the accompanying LICENSE file.
+//
+// Measures the routines that recurse by halving the matrix on a column-major
+// legacy matrix, labelled "col", and on a mortonMatrix, labelled "morton":
+//
+//   transpose        B = A^T, with transpose_opts_t::nx = nb
+//   potrf2           recursive Cholesky factorization
+//   lauum_recursive  U U^H or L^H L, with lauum_opts_t::nx = nb
+//   copy_to_morton   conversion from the column-major layout (morton only)
+//   copy_from_morton conversion to the column-major layout (morton only)
+//
+// The leaves of the Morton layout are nb-by-nb. If the hardware counters are
+// available, each row also reports the L1 data cache and last level cache
+// read misses of one repetition, see benchmark::cache_counters. The
+// differences show for n >= 4096, when the matrix does not fit in the last
+// level cache.
+//
+// Usage: benchmark_layouts [--sizes=1024,4096] [--types=d] [--nb=32]
+
+#include <plugins/tlapack_stdvector.hpp>
+#include <plugins/tlapack_mortonArray.hpp>
+#include "../benchmark.hpp"
+
+using namespace tlapack;
+using namespace tlapack::benchmark;
+
+/// Benchmarks of the recursive routines for one scalar type
+template <typename T>
+class layout_benchmarks
+{
+    using idx_t = size_type<legacyMatrix<T>>;
+    using real_t = real_type<T>;
+
+public:
+    layout_benchmarks(const options_t &opts, reporter &rep, idx_t nb) : opts(opts), rep(rep), nb(nb) {}
+
+    void run(idx_t n)
+    {
+        rand_generator gen;
+        A0_.resize(n * n);
+        A_.resize(n * n);
+        B_.resize(n * n);
+        Am0_.resize(n * n);
+
+        // Hermitian positive definite matrix
+        auto A0 = legacyMatrix<T>(n, n, A0_.data(), n);
+        for (idx_t j = 0; j < n; ++j)
+            for (idx_t i = j; i < n; ++i)
+                A0(i, j) = rand_helper<T>(gen);
+        for (idx_t j = 0; j < n; ++j)
+        {
+            A0(j, j) = T(real(A0(j, j)) + real_t(n));
+            for (idx_t i = 0; i < j; ++i)
+                A0(i, j) = conj(A0(j, i));
+        }
+        auto Am0 = mortonMatrix<T>(n, n, nb, nb, Am0_.data());
+        copy_to_morton(A0, Am0);
+
+        auto A = legacyMatrix<T>(n, n, A_.data(), n);
+        auto B = legacyMatrix<T>(n, n, B_.data(), n);
+        auto Am = mortonMatrix<T>(n, n, nb, nb, A_.data());
+        auto Bm = mortonMatrix<T>(n, n, nb, nb, B_.data());
+
+        const auto restore_col = [&]() { std::copy(A0_.begin(), A0_.end(), A_.begin()); };
+        const auto restore_morton = [&]() { std::copy(Am0_.begin(), Am0_.end(), A_.begin()); };
+
+        transpose_opts_t<idx_t> topts;
+        topts.nx = nb;
+        lauum_opts_t<idx_t> lopts;
+        lopts.nx = nb;
+
+        const double nd = double(n);
+        const double nbytes = nd * nd * sizeof(T);
+
+        bench("transpose", "col", n, 0, 2 * nbytes, restore_col, [&]() { transpose(A, B, topts); });
+        bench("transpose", "morton", n, 0, 2 * nbytes, restore_morton, [&]() { transpose(Am, Bm, topts); });
+
+        bench("potrf2", "col", n, nd * nd * nd / 3, nbytes, restore_col, [&]() { potrf2(Uplo::Lower, A); });
+        bench("potrf2", "morton", n, nd * nd * nd / 3, nbytes, restore_morton, [&]() { potrf2(Uplo::Lower, Am); });
+
+        bench("lauum_recursive", "col", n, nd * nd * nd / 3, nbytes, restore_col,
+              [&]() { lauum_recursive(Uplo::Lower, A, lopts); });
+        bench("lauum_recursive", "morton", n, nd * nd * nd / 3, nbytes, restore_morton,
+              [&]() { lauum_recursive(Uplo::Lower, Am, lopts); });
+
+        bench("copy_to_morton", "morton", n, 0, 2 * nbytes, []() {}, [&]() { copy_to_morton(A0, Bm); });
+        bench("copy_from_morton", "morton", n, 0, 2 * nbytes, []() {}, [&]() { copy_from_morton(Am0, B); });
+    }
+
+private:
+    const options_t &opts;
+    reporter &rep;
+    const idx_t nb;
+    cache_counters counters;
+
+    // Data and copies of the data restored before each repetition
+    std::vector<T> A0_, A_, B_, Am0_;
+
+    template <class setup_t, class f_t>
+    void bench(const char *name, const char *layout, idx_t n, double flops, double bytes,
+               const setup_t &setup, const f_t &f)
+    {
+        result_t r;
+        r.name = name;
+        r.variant = "nb=" + std::to_string(nb);
+        r.type = type_name<T>();
+        r.layout = layout;
+        r.backend = "template";
+        r.m = n;
+        r.n = n;
+        r.flops = is_complex<T>::value ? 4 * flops : flops;
+        r.bytes = bytes;
+        if (!rep.selected(r))
+            return;
+        measure(r, opts, setup, f);
+        if (counters.available())
+        {
+            setup();
+            counters.count(r, f);
+        }
+        rep.add(r);
+    }
+};
+
+int main(int argc, char **argv)
+{
+    options_t opts = parse_options(argc, argv, {1024, 4096});
+    // Each run is expensive, so measure one repetition unless asked otherwise
+    bool min_time_given = false, min_reps_given = false;
+    for (int i = 1; i < argc; ++i)
+    {
+        min_time_given |= std::string(argv[i]).compare(0, 11, "--min-time=") == 0;
+        min_reps_given |= std::string(argv[i]).compare(0, 11, "--min-reps=") == 0;
+    }
+    if (!min_time_given)
+        opts.min_time = 0;
+    if (!min_reps_given)
+        opts.min_reps = 1;
+
+    const std::string types = opts.extra.count("types") ? opts.extra.at("types") : "d";
+    const std::size_t nb = opts.extra.count("nb") ? std::stoul(opts.extra.at("nb")) : 32;
+
+    reporter rep(opts);
+    for (std::size_t n : opts.sizes)
+    {
+        if (types.find('s') != std::string::npos)
+            layout_benchmarks<float>(opts, rep, nb).run(n);
+        if (types.find('d') != std::string::npos)
+            layout_benchmarks<double>(opts, rep, nb).run(n);
+        if (types.find('c') != std::string::npos)
+            layout_benchmarks<std::complex<float>>(opts, rep, nb).run(n);
+        if (types.find('z') != std::string::npos)
+            layout_benchmarks<std::complex<double>>(opts, rep, nb).run(n);
+    }
+    rep.finish();
+
+    return 0;
+}
@@ -0,0 +1,254 @@
+/// @file perf_regression.cpp
+/// @brief Performance regression tests against stored baselines
+//
+// Copyright (c) 2022, University of Colorado Denver. All rights reserved.
+//
+// This file is part of <T>LAPACK.
+// <T>LAPACK is free software: you can redistribute it and/or modify it under
+// the terms of the BSD 3-Clause license. See the accompanying LICENSE file.
+//
+// Runs one kernel at a pinned size and compares the median time with the
+// baseline stored in a JSON file:
+//
+//   perf_regression --kernel=gemm --baseline=baseline.json [--threshold=1.25]
+//
+// The test fails (exit code 1) if median > threshold * baseline, and is
+// skipped (exit code 77) if the baseline has no entry for the kernel.
+//
+// Writes a new baseline file with the medians of all kernels:
+//
+//   perf_regression --write-baseline=baseline.json [--machine=description]
+//
+// Both modes accept --min-reps and --min-time.
+
+#include <plugins/tlapack_stdvector.hpp>
+#include "../benchmark.hpp"
+
+#include <functional>
+
+using namespace tlapack;
+using namespace tlapack::benchmark;
+
+namespace {
+
+using T = double;
+using matrix_t = legacyMatrix<T, Layout::ColMajor>;
+using idx_t = size_type<matrix_t>;
+
+/// Exit code that CTest reports as a skipped test
+constexpr int skip_return_code = 77;
+
+/// A kernel of the regression suite, run at a pinned size
+struct kernel_t
+{
+    const char *name;
+    idx_t n;
+    std::function<void(result_t &, const options_t &)> run;
+};
+
+/// Random n-by-n matrix stored in v
+matrix_t random_matrix(std::vector<T> &v, idx_t n, rand_generator &gen)
+{
+    v.resize(n * n);
+    for (auto &x : v)
+        x = rand_helper<T>(gen);
+    return matrix_t(n, n, v.data(), n);
+}
+
+/// The kernels and their pinned sizes. Changing a size invalidates the
+/// corresponding baseline.
+const std::vector<kernel_t> &kernels()
+{
+    static const std::vector<kernel_t> list = {
+        {"gemm", 256, [](result_t &r, const options_t &opts) {
+             rand_generator gen;
+             std::vector<T> A_, B_, C_;
+             const idx_t n = r.n;
+             auto A = random_matrix(A_, n, gen);
+             auto B = random_matrix(B_, n, gen);
+             auto C = random_matrix(C_, n, gen);
+             measure(r, opts, []() {}, [&]() { gemm(Op::NoTrans, Op::NoTrans, T(1), A, B, T(1), C); });
+         }},
+        {"potrf", 512, [](result_t &r, const options_t &opts) {
+             rand_generator gen;
+             std::vector<T> A0_, A_;
+             const idx_t n = r.n;
+             auto A0 = random_matrix(A0_, n, gen);
+             for (idx_t i = 0; i < n; ++i)
+                 A0(i, i) = T(n);
+             auto A = random_matrix(A_, n, gen);
+             measure(r, opts, [&]() { A_ = A0_; }, [&]() { potrf(Uplo::Lower, A); });
+         }},
+        {"gehrd", 256, [](result_t &r, const options_t &opts) {
+             rand_generator gen;
+             std::vector<T> A0_, A_, tau(r.n);
+             const idx_t n = r.n;
+             random_matrix(A0_, n, gen);
+             auto A = random_matrix(A_, n, gen);
+             measure(r, opts, [&]() { A_ = A0_; }, [&]() { gehrd(0, n, A, tau); });
+         }},
+        {"multishift_qr", 300, [](result_t &r, const options_t &opts) {
+             rand_generator gen;
+             std::vector<T> H0_, H_, Q_;
+             std::vector<std::complex<T>> w(r.n);
+             const idx_t n = r.n;
+             auto H0 = random_matrix(H0_, n, gen);
+             for (idx_t j = 0; j < n; ++j)
+                 for (idx_t i = j + 2; i < n; ++i)
+                     H0(i, j) = T(0);
+             auto H = random_matrix(H_, n, gen);
+             auto Q = random_matrix(Q_, n, gen);
+             measure(r, opts,
+                     [&]() {
+                         H_ = H0_;
+                         laset(Uplo::General, T(0), T(1), Q);
+                     },
+                     [&]() { multishift_qr(true, true, idx_t(0), n, H, w, Q); });
+         }},
+        {"geqr2", 256, [](result_t &r, const options_t &opts) {
+             rand_generator gen;
+             std::vector<T> A0_, A_, tau(r.n), work(r.n);
+             const idx_t n = r.n;
+             random_matrix(A0_, n, gen);
+             auto A = random_matrix(A_, n, gen);
+             measure(r, opts, [&]() { A_ = A0_; }, [&]() { geqr2(A, tau, work); });
+         }},
+        {"transpose", 1024, [](result_t &r, const options_t &opts) {
+             rand_generator gen;
+             std::vector<T> A_, B_;
+             const idx_t n = r.n;
+             auto A = random_matrix(A_, n, gen);
+             auto B = random_matrix(B_, n, gen);
+             measure(r, opts, []() {}, [&]() { transpose(A, B); });
+         }},
+    };
+    return list;
+}
+
+/**
+ * Reads the value of "key" in the object of the kernel in a baseline file
+ * written by write_baseline(). Returns false if it is not there.
+ */
+bool read_baseline(const std::string &json, const std::string &kernel, const std::string &key, double &value)
+{
+    const auto obj = json.find("\"" + kernel + "\":");
+    if (obj == std::string::npos)
+        return false;
+    const auto end = json.find('}', obj);
+    const auto pos = json.find("\"" + key + "\":", obj);
+    if (pos == std::string::npos || pos > end)
+        return false;
+    value = std::strtod(json.c_str() + pos + key.size() + 3, nullptr);
+    return true;
+}
+
+/// Runs all the kernels and writes their median times
+int write_baseline(const options_t &opts, const std::string &filename)
+{
+    const std::string machine = opts.extra.count("machine") ? opts.extra.at("machine") : "unknown";
+
+    std::ostringstream out;
+    out << "{\n  \"machine\": \"" << machine << "\",\n";
+#ifdef __VERSION__
+    out << "  \"compiler\": \"" << __VERSION__ << "\",\n";
+#endif
+    out << "  \"kernels\": {";
+    const auto &list = kernels();
+    for (std::size_t i = 0; i < list.size(); ++i)
+    {
+        result_t r;
+        r.n = list[i].n;
+        list[i].run(r, opts);
+        std::cout << list[i].name << " n=" << r.n << " median=" << r.median_time << " s" << std::endl;
+        out << (i ? ",\n" : "\n") << std::setprecision(6)
+            << "    \"" << list[i].name << "\": {\"n\": " << r.n
+            << ", \"median_time\": " << r.median_time << "}";
+    }
+    out << "\n  }\n}\n";
+
+    std::ofstream file(filename);
+    file << out.str();
+    if (!file)
+    {
+        std::cerr << "Could not write " << filename << std::endl;
+        return 1;
+    }
+    return 0;
+}
+
+/// Runs one kernel and compares its median time with the baseline
+int check_kernel(const options_t &opts, const std::string &name, const std::string &filename, double threshold)
+{
+    const auto &list = kernels();
+    const auto k = std::find_if(list.begin(), list.end(), [&](const kernel_t &k) { return name == k.name; });
+    if (k == list.end())
+    {
+        std::cerr << "Unknown kernel " << name << std::endl;
+        return 1;
+    }
+
+    std::ifstream file(filename);
+    std::stringstream json;
+    json << file.rdbuf();
+    double baseline = 0, n = 0;
+    if (!file || !read_baseline(json.str(), name, "median_time", baseline) || baseline <= 0)
+    {
+        std::cout << "No baseline for " << name << " in " << filename << std::endl;
+        return skip_return_code;
+    }
+    if (read_baseline(json.str(), name, "n", n) && idx_t(n) != k->n)
+    {
+        std::cout << "The baseline of " << name << " was measured with n=" << idx_t(n)
+                  << ", but the test uses n=" << k->n << ". Refresh the baselines." << std::endl;
+        return skip_return_code;
+    }
+
+    result_t r;
+    r.n = k->n;
+    k->run(r, opts);
+
+    const double ratio = r.median_time / baseline;
+    std::cout << name << " n=" << r.n << " median=" << r.median_time << " s baseline=" << baseline
+              << " s ratio=" << ratio << " threshold=" << threshold << " reps=" << r.reps << std::endl;
+    if (ratio > threshold)
+    {
+        std::cout << "Performance regression: " << name << " is " << 100 * (ratio - 1)
+                  << "% slower than the baseline" << std::endl;
+        return 1;
+    }
+    return 0;
+}
+
+} // namespace
+
+int main(int argc, char **argv)
+{
+    options_t opts = parse_options(argc, argv, {});
+    // Enough repetitions for a stable median, unless asked otherwise
+    bool min_time_given = false, min_reps_given = false;
+    for (int i = 1; i < argc; ++i)
+    {
+        min_time_given |= std::string(argv[i]).compare(0, 11, "--min-time=") == 0;
+        min_reps_given |= std::string(argv[i]).compare(0, 11, "--min-reps=") == 0;
+    }
+    if (!min_time_given)
+        opts.min_time = 0.5;
+    if (!min_reps_given)
+        opts.min_reps = 11;
+
+    // The baselines are measured with the built-in defaults, regardless of
+    // the tuning file
+    tuning().clear();
+
+    if (opts.extra.count("write-baseline"))
+        return write_baseline(opts, opts.extra.at("write-baseline"));
+
+    if (!opts.extra.count("kernel") || !opts.extra.count("baseline"))
+    {
+        std::cerr << "Usage: " << argv[0] << " --kernel=name --baseline=file [--threshold=ratio]" << std::endl
+                  << "       " << argv[0] << " --write-baseline=file [--machine=description]" << std::endl;
+        return 1;
+    }
+    const double threshold = opts.extra.count("threshold") ? std::stod(opts.extra.at("threshold")) : 1.25;
+    return check_kernel(opts, opts.extra.at("kernel"), opts.extra.at("baseline"), threshold);
+}
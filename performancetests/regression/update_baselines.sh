@@ -0,0 +1,24 @@
+#!/bin/sh
+# Copyright (c) 2022, University of Colorado Denver. All rights reserved.
+#
+# This file is part of <T>LAPACK.
+# <T>LAPACK is free software: you can redistribute it and/or modify it under
+# the terms of the BSD 3-Clause license. See the accompanying LICENSE file.
+#
+# Refreshes baseline.json with the median times measured on this machine.
+# Run it on the reference machine, with no other load, and commit the result.
+#
+# Usage: update_baselines.sh [build directory]
+
+set -e
+
+src_dir=$(cd "$(dirname "$0")/../.." && pwd)
+build_dir=${1:-"$src_dir/build-perf"}
+
+cmake -S "$src_dir" -B "$build_dir" -DCMAKE_BUILD_TYPE=Release \
+  -DBUILD_BENCHMARKS=ON -DBUILD_TESTING=OFF -DBUILD_EXAMPLES=OFF
+cmake --build "$build_dir" --target perf_regression
+
+"$build_dir/performancetests/perf_regression" \
+  --write-baseline="$src_dir/performancetests/regression/baseline.json" \
+  --machine="$(uname -sm)"
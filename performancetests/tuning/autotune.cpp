@@ -0,0 +1,257 @@
+/// @file autotune.cpp
+/// @brief Empirical tuning of the block sizes and thresholds of <T>LAPACK
+//
+// Copyright (c) 2022, University of Colorado Denver. All rights reserved.
+//
+// This file is part of <T>LAPACK.
+// <T>LAPACK is free software: you can redistribute it and/or modify it under
+// the terms of the BSD 3-Clause license. See the accompanying LICENSE file.
+//
+// Sweeps the tunable parameters on this machine and writes a tuning file
+// (see tlapack::tuning_table) to be loaded by <T>LAPACK at startup, either
+// with the environment variable TLAPACK_TUNING_FILE or the CMake option of
+// the same name.
+//
+//   potrf          nb
+//   gehrd          nb, nx_switch
+//   multishift_qr  nmin, nshift, nw, nibble
+//   transpose      nx
+//
+// Each size n gives the size bucket (previous size, n], and the largest size
+// covers all larger problems. The parameters are swept one at a time, in the
+// order above, for increasing sizes. Each candidate is measured through the
+// tuning table, so that the nested calls, e.g., the AED windows of
+// multishift_qr, use the values already chosen for the smaller sizes.
+//
+// Usage: autotune [--sizes=100,300,1000] [--types=d]
+//          [--routines=potrf,gehrd,multishift_qr,transpose]
+//          [--min-time=0.1] [--min-reps=3] [--output=tlapack_tuning.txt]
+
+#include <plugins/tlapack_stdvector.hpp>
+#include "../benchmark.hpp"
+
+#include <functional>
+
+using namespace tlapack;
+using namespace tlapack::benchmark;
+
+/// Returns true if the comma-separated list contains the item
+inline bool contains(const std::string &list, const std::string &item)
+{
+    std::stringstream ss(list);
+    std::string s;
+    while (std::getline(ss, s, ','))
+        if (s == item)
+            return true;
+    return false;
+}
+
+/// Tuning of all routines for one scalar type
+template <typename T>
+class autotuner
+{
+    using matrix_t = legacyMatrix<T, Layout::ColMajor>;
+    using idx_t = size_type<matrix_t>;
+    using real_t = real_type<T>;
+
+public:
+    autotuner(const options_t &opts, const std::string &routines) : opts(opts), routines(routines) {}
+
+    void run(idx_t n, std::size_t n_max)
+    {
+        rand_generator gen;
+        A0_.resize(n * n);
+        for (auto &x : A0_)
+            x = rand_helper<T>(gen);
+        A_.resize(n * n);
+        B_.resize(n * n);
+
+        if (contains(routines, "potrf"))
+            tune_potrf(n, n_max);
+        if (contains(routines, "gehrd"))
+            tune_gehrd(n, n_max);
+        if (contains(routines, "multishift_qr"))
+            tune_multishift_qr(n, n_max);
+        if (contains(routines, "transpose"))
+            tune_transpose(n, n_max);
+    }
+
+private:
+    const options_t &opts;
+    std::string routines;
+    std::vector<T> A0_, A_, B_;
+
+    matrix_t matrix(std::vector<T> &v, idx_t n) { return matrix_t(n, n, v.data(), n); }
+
+    /**
+     * Measures f with each candidate value of the parameter in the tuning
+     * table, and keeps the fastest one.
+     */
+    template <class setup_t, class f_t>
+    void sweep(const char *routine, const char *param, idx_t n, std::size_t n_max,
+               const std::vector<std::size_t> &candidates, setup_t &&setup, f_t &&f)
+    {
+        std::cout << type_name<T>() << routine << " n=" << n << " " << param << ":";
+        std::size_t best = 0;
+        double best_time = 0;
+        for (std::size_t c : candidates)
+        {
+            tuning().set(routine, param, tuning_type<T>(), n_max, c);
+            result_t r;
+            measure(r, opts, setup, f);
+            std::cout << " " << c << " (" << std::scientific << std::setprecision(2) << r.median_time
+                      << std::defaultfloat << " s)" << std::flush;
+            if (best_time == 0 || r.median_time < best_time)
+            {
+                best = c;
+                best_time = r.median_time;
+            }
+        }
+        tuning().set(routine, param, tuning_type<T>(), n_max, best);
+        std::cout << " -> " << best << std::endl;
+    }
+
+    /// Candidates that are at most n, and at least one candidate
+    static std::vector<std::size_t> up_to(idx_t n, std::vector<std::size_t> candidates)
+    {
+        std::vector<std::size_t> list;
+        for (std::size_t c : candidates)
+            if (c <= std::size_t(n) || list.empty())
+                list.push_back(c);
+        return list;
+    }
+
+    void tune_potrf(idx_t n, std::size_t n_max)
+    {
+        auto A = matrix(A_, n);
+        // Diagonally dominant copy of A0
+        auto setup = [&]() {
+            A_ = A0_;
+            for (idx_t i = 0; i < n; ++i)
+                A(i, i) = T(real_t(n));
+        };
+        sweep("potrf", "nb", n, n_max, up_to(n, {8, 16, 24, 32, 48, 64, 96, 128, 192, 256}),
+              setup, [&]() { potrf(Uplo::Lower, A); });
+    }
+
+    void tune_gehrd(idx_t n, std::size_t n_max)
+    {
+        auto A = matrix(A_, n);
+        std::vector<T> tau(n);
+        auto setup = [&]() { A_ = A0_; };
+        auto f = [&]() { gehrd(0, n, A, tau); };
+
+        sweep("gehrd", "nb", n, n_max, up_to(n, {8, 16, 24, 32, 48, 64, 96, 128}), setup, f);
+        sweep("gehrd", "nx_switch", n, n_max, up_to(n, {16, 32, 64, 128, 256, 512}), setup, f);
+    }
+
+    void tune_multishift_qr(idx_t n, std::size_t n_max)
+    {
+        std::vector<T> H0_(A0_);
+        auto H0 = matrix(H0_, n);
+        auto H = matrix(A_, n);
+        auto Z = matrix(B_, n);
+        std::vector<std::complex<real_t>> w(n);
+        for (idx_t j = 0; j < n; ++j)
+            for (idx_t i = j + 2; i < n; ++i)
+                H0(i, j) = T(0);
+
+        auto setup = [&]() {
+            A_ = H0_;
+            laset(Uplo::General, T(0), T(1), Z);
+        };
+        auto f = [&]() {
+            francis_opts_t<idx_t, T> fopts;
+            multishift_qr(true, true, idx_t(0), n, H, w, Z, fopts);
+        };
+
+        // Values of the built-in tables, as reference for the candidates
+        francis_opts_t<idx_t, T> defaults;
+        const std::size_t ns = std::max<std::size_t>(2, defaults.nshift_recommender(n, n));
+        const std::size_t nw = std::max<std::size_t>(2, defaults.deflation_window_recommender(n, n));
+        const std::size_t nw_max = std::max<std::size_t>(2, (n - 3) / 3);
+
+        // A value of nmin larger than n means that lahqr is used
+        std::vector<std::size_t> nmin_candidates;
+        for (std::size_t c : {30, 50, 75, 100, 150, 200})
+            if (nmin_candidates.empty() || nmin_candidates.back() <= std::size_t(n))
+                nmin_candidates.push_back(c);
+        sweep("multishift_qr", "nmin", n, n_max, nmin_candidates, setup, f);
+        std::size_t nmin;
+        tuning().lookup("multishift_qr", "nmin", tuning_type<T>(), n, nmin);
+        if (nmin > std::size_t(n))
+            return; // lahqr is faster, the other parameters have no effect
+
+        std::vector<std::size_t> ns_candidates;
+        for (std::size_t c : {ns / 2, 3 * ns / 4, ns, 3 * ns / 2, 2 * ns})
+            if (c >= 2 && c / 2 * 2 <= nw_max)
+                ns_candidates.push_back(c / 2 * 2);
+        ns_candidates.erase(std::unique(ns_candidates.begin(), ns_candidates.end()), ns_candidates.end());
+        if (ns_candidates.empty())
+            ns_candidates.push_back(2);
+        sweep("multishift_qr", "nshift", n, n_max, ns_candidates, setup, f);
+
+        std::vector<std::size_t> nw_candidates;
+        for (std::size_t c : {nw / 2, 3 * nw / 4, nw, 3 * nw / 2, 2 * nw})
+            if (c >= 2 && c <= nw_max)
+                nw_candidates.push_back(c);
+        nw_candidates.erase(std::unique(nw_candidates.begin(), nw_candidates.end()), nw_candidates.end());
+        if (nw_candidates.empty())
+            nw_candidates.push_back(nw_max);
+        sweep("multishift_qr", "nw", n, n_max, nw_candidates, setup, f);
+
+        sweep("multishift_qr", "nibble", n, n_max, {8, 14, 20, 30}, setup, f);
+    }
+
+    void tune_transpose(idx_t n, std::size_t n_max)
+    {
+        auto A = matrix(A0_, n);
+        auto B = matrix(B_, n);
+        sweep("transpose", "nx", n, n_max, up_to(n, {4, 8, 16, 32, 64, 128, 256}),
+              []() {}, [&]() { transpose(A, B); });
+    }
+};
+
+int main(int argc, char **argv)
+{
+    options_t opts = parse_options(argc, argv, {100, 300, 1000});
+    const std::string types = opts.extra.count("types") ? opts.extra.at("types") : "d";
+    const std::string routines = opts.extra.count("routines") ? opts.extra.at("routines")
+                                                              : "potrf,gehrd,multishift_qr,transpose";
+    const std::string output = opts.output.empty() ? "tlapack_tuning.txt" : opts.output;
+
+    std::sort(opts.sizes.begin(), opts.sizes.end());
+    if (opts.sizes.empty())
+    {
+        std::cerr << "No sizes given" << std::endl;
+        return 1;
+    }
+
+    // Start from the built-in defaults
+    tuning().clear();
+
+    for (std::size_t i = 0; i < opts.sizes.size(); ++i)
+    {
+        const std::size_t n = opts.sizes[i];
+        const std::size_t n_max = (i + 1 < opts.sizes.size()) ? n : tuning_table::inf;
+        if (types.find('s') != std::string::npos)
+            autotuner<float>(opts, routines).run(n, n_max);
+        if (types.find('d') != std::string::npos)
+            autotuner<double>(opts, routines).run(n, n_max);
+        if (types.find('c') != std::string::npos)
+            autotuner<std::complex<float>>(opts, routines).run(n, n_max);
+        if (types.find('z') != std::string::npos)
+            autotuner<std::complex<double>>(opts, routines).run(n, n_max);
+    }
+
+    std::ofstream file(output);
+    tuning().write(file);
+    if (!file)
+    {
+        std::cerr << "Could not write " << output << std::endl;
+        return 1;
+    }
+    std::cout << "Wrote " << output << std::endl;
+
+    return 0;
+}
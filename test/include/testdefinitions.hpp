@@ -10,7 +10,7 @@
 #ifndef __TESTDEFINITIONS_HH__
 #define __TESTDEFINITIONS_HH__
 
-#include <legacy_api/legacyArray.hpp>
+#include <plugins/tlapack_legacyArray.hpp>
 #include <tlapack.hpp>
 
 namespace tlapack
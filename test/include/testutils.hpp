@@ -199,6 +199,24 @@ namespace tlapack
         return check_similarity_transform(A, Q, B, res, work);
     }
 
+    /**
+     * Saves the tuning table and restores it on destruction, so that a test
+     * can change the table without losing the one loaded from
+     * TLAPACK_TUNING_FILE for the other tests.
+     */
+    class tuning_guard
+    {
+
+    private:
+        const tuning_table saved = tuning();
+
+    public:
+        ~tuning_guard()
+        {
+            tuning() = saved;
+        }
+    };
+
 }
 
 #endif // __TESTUTILS_HH__
\ No newline at end of file
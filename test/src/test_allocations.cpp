@@ -0,0 +1,309 @@
+/// @file test_allocations.cpp
+/// @brief Count the heap allocations done by <T>LAPACK routines
+//
+// Copyright (c) 2022, University of Colorado Denver. All rights reserved.
+//
+// This file is part of <T>LAPACK.
+// <T>LAPACK is free software: you can redistribute it and/or modify it under
+// the terms of the BSD 3-Clause license. See the accompanying LICENSE file.
+
+#include <catch2/catch.hpp>
+#include <plugins/tlapack_stdvector.hpp>
+#include <tlapack.hpp>
+#include <legacy_api/lapack.hpp>
+#include <testutils.hpp>
+#include <testdefinitions.hpp>
+
+#include <cstdlib>
+#include <new>
+
+// Number of calls to the global operator new in the current thread while
+// counting is enabled
+static thread_local std::size_t n_allocations = 0;
+static thread_local bool counting = false;
+
+// The replacements below release with free the memory they obtained with
+// malloc. GCC flags it as a mismatch between operator new and free
+#if defined(__GNUC__) && !defined(__clang__) && __GNUC__ >= 11
+#pragma GCC diagnostic push
+#pragma GCC diagnostic ignored "-Wmismatched-new-delete"
+#endif
+
+void *operator new(std::size_t size)
+{
+    if (counting)
+        ++n_allocations;
+    if (void *ptr = std::malloc(size ? size : 1))
+        return ptr;
+    throw std::bad_alloc();
+}
+
+void operator delete(void *ptr) noexcept
+{
+    std::free(ptr);
+}
+
+void operator delete(void *ptr, std::size_t) noexcept
+{
+    std::free(ptr);
+}
+
+#if defined(__GNUC__) && !defined(__clang__) && __GNUC__ >= 11
+#pragma GCC diagnostic pop
+#endif
+
+/// Returns the number of allocations done by f()
+template <class F>
+std::size_t count_allocations(F &&f)
+{
+    n_allocations = 0;
+    counting = true;
+    f();
+    counting = false;
+    return n_allocations;
+}
+
+using namespace tlapack;
+
+TEST_CASE("Allocation counter sees the heap", "[utils][allocations]")
+{
+    CHECK(count_allocations([]() { std::vector<int> v(10); }) == 1);
+    CHECK(count_allocations([]() {}) == 0);
+}
+
+TEST_CASE("Probing the host does not allocate", "[utils][allocations]")
+{
+    // The routines probe the host on their first call to tuned()
+    CHECK(count_allocations([]() { probe_host(); }) == 0);
+}
+
+TEMPLATE_LIST_TEST_CASE("Eigenvalue routines do not allocate", "[eigenvalues][allocations]", types_to_test)
+{
+    using matrix_t = TestType;
+    using T = type_t<matrix_t>;
+    using idx_t = size_type<matrix_t>;
+    using real_t = real_type<T>;
+    using complex_t = std::complex<real_t>;
+
+    rand_generator gen;
+
+    const idx_t n = 60;
+    std::unique_ptr<T[]> A_(new T[n * n]);
+    std::unique_ptr<T[]> H_(new T[n * n]);
+    std::unique_ptr<T[]> Q_(new T[n * n]);
+    auto A = legacyMatrix<T, layout<matrix_t>>(n, n, &A_[0], n);
+    auto H = legacyMatrix<T, layout<matrix_t>>(n, n, &H_[0], n);
+    auto Q = legacyMatrix<T, layout<matrix_t>>(n, n, &Q_[0], n);
+    std::vector<complex_t> w(n);
+    std::vector<T> tau(n);
+
+    for (idx_t j = 0; j < n; ++j)
+        for (idx_t i = 0; i < n; ++i)
+            A(i, j) = rand_helper<T>(gen);
+
+    workspace_arena arena(std::size_t(1) << 24);
+
+    SECTION("gehrd")
+    {
+        gehrd_opts_t<idx_t, T> opts;
+        opts.arena = &arena;
+        lacpy(Uplo::General, A, H);
+        CHECK(count_allocations([&]() { gehrd(0, n, H, tau, opts); }) == 0);
+    }
+
+    SECTION("gees")
+    {
+        gees_opts_t<idx_t, T> opts;
+        opts.arena = &arena;
+        opts.francis.nmin = 15;
+        lacpy(Uplo::General, A, H);
+        int info = 0;
+        CHECK(count_allocations([&]() { info = gees(true, true, H, w, Q, opts); }) == 0);
+        CHECK(info == 0);
+    }
+
+    // The QR algorithms start from a Hessenberg matrix
+    for (idx_t j = 0; j < n; ++j)
+        for (idx_t i = j + 2; i < n; ++i)
+            A(i, j) = T(0);
+    lacpy(Uplo::General, A, H);
+    laset(Uplo::General, T(0), T(1), Q);
+
+    SECTION("lahqr")
+    {
+        int info = 0;
+        CHECK(count_allocations([&]() { info = lahqr(true, true, 0, n, H, w, Q); }) == 0);
+        CHECK(info == 0);
+    }
+
+    SECTION("multishift_qr")
+    {
+        // Small nmin so that AED, move_bulge and schur_swap are used
+        francis_opts_t<idx_t, T> opts;
+        opts.nmin = 15;
+        opts.arena = &arena;
+        int info = 0;
+        CHECK(count_allocations([&]() { info = multishift_qr(true, true, 0, n, H, w, Q, opts); }) == 0);
+        CHECK(info == 0);
+        CHECK(opts.n_aed > 0);
+    }
+
+    SECTION("schur_swap")
+    {
+        // Block upper triangular matrix with 2x2 blocks in the real case,
+        // so that lasy2 is also used
+        const idx_t nb = (is_complex<T>::value) ? 1 : 2;
+        for (idx_t j = 0; j < n; ++j)
+            for (idx_t i = j + 1; i < n; ++i)
+                H(i, j) = T(0);
+        if (nb == 2)
+        {
+            H(1, 0) = -abs(H(0, 1)) - real_t(1);
+            H(3, 2) = -abs(H(2, 3)) - real_t(1);
+            H(0, 1) = abs(H(0, 1));
+            H(2, 3) = abs(H(2, 3));
+        }
+        int info = 0;
+        CHECK(count_allocations([&]() { info = schur_swap(true, H, Q, idx_t(0), nb, nb); }) == 0);
+        CHECK(info == 0);
+    }
+}
+
+TEMPLATE_LIST_TEST_CASE("Hermitian eigensolver and SVD do not allocate", "[eigenvalues][svd][allocations]", types_to_test)
+{
+    using matrix_t = TestType;
+    using T = type_t<matrix_t>;
+    using idx_t = size_type<matrix_t>;
+    using real_t = real_type<T>;
+
+    rand_generator gen;
+
+    const idx_t m = 50;
+    const idx_t n = 40;
+    std::unique_ptr<T[]> A_(new T[m * n]);
+    std::unique_ptr<T[]> U_(new T[m * n]);
+    std::unique_ptr<T[]> VT_(new T[n * n]);
+    auto A = legacyMatrix<T, layout<matrix_t>>(m, n, &A_[0], layout<matrix_t> == Layout::ColMajor ? m : n);
+    auto U = legacyMatrix<T, layout<matrix_t>>(m, n, &U_[0], layout<matrix_t> == Layout::ColMajor ? m : n);
+    auto VT = legacyMatrix<T, layout<matrix_t>>(n, n, &VT_[0], n);
+    std::vector<real_t> s(n);
+
+    for (idx_t j = 0; j < n; ++j)
+        for (idx_t i = 0; i < m; ++i)
+            A(i, j) = rand_helper<T>(gen);
+
+    workspace_arena arena(std::size_t(1) << 24);
+
+    SECTION("heevd")
+    {
+        auto B = slice(A, std::pair<idx_t, idx_t>{0, n}, std::pair<idx_t, idx_t>{0, n});
+        heevd_opts_t<idx_t, T> opts;
+        opts.smlsiz = 8;
+        opts.arena = &arena;
+        int info = 0;
+        CHECK(count_allocations([&]() { info = heevd(true, Uplo::Lower, B, s, opts); }) == 0);
+        CHECK(info == 0);
+    }
+
+    const bool two_stage = GENERATE(false, true);
+    const bool divide_and_conquer = GENERATE(false, true);
+
+    DYNAMIC_SECTION("gesvd two_stage = " << two_stage << " divide_and_conquer = " << divide_and_conquer)
+    {
+        gesvd_opts_t<idx_t, T> opts;
+        opts.nb = 8;
+        opts.two_stage = two_stage;
+        opts.divide_and_conquer = divide_and_conquer;
+        opts.smlsiz = 8;
+        opts.arena = &arena;
+        int info = 0;
+        CHECK(count_allocations([&]() { info = gesvd(true, true, A, s, U, VT, opts); }) == 0);
+        CHECK(info == 0);
+    }
+}
+
+TEMPLATE_LIST_TEST_CASE("Factorizations and random generators do not allocate", "[allocations]", types_to_test)
+{
+    using matrix_t = TestType;
+    using T = type_t<matrix_t>;
+    using idx_t = size_type<matrix_t>;
+    using real_t = real_type<T>;
+
+    rand_generator gen;
+
+    const idx_t n = 40;
+    std::unique_ptr<T[]> A_(new T[n * n]);
+    auto A = legacyMatrix<T, layout<matrix_t>>(n, n, &A_[0], n);
+    std::vector<T> tau(n);
+    std::vector<T> work(n);
+
+    SECTION("larnv")
+    {
+        uint64_t seed = 1302;
+        CHECK(count_allocations([&]() { larnv<3>(seed, tau); }) == 0);
+    }
+
+    for (idx_t j = 0; j < n; ++j)
+        for (idx_t i = 0; i < n; ++i)
+            A(i, j) = rand_helper<T>(gen);
+
+    SECTION("potrf")
+    {
+        for (idx_t i = 0; i < n; ++i)
+            A(i, i) = real_t(2 * n);
+        int info = 0;
+        CHECK(count_allocations([&]() { info = potrf(Uplo::Lower, A); }) == 0);
+        CHECK(info == 0);
+    }
+
+    SECTION("geqr2 and ung2r")
+    {
+        CHECK(count_allocations([&]() {
+                  geqr2(A, tau, work);
+                  ung2r(n, A, tau, work);
+              }) == 0);
+    }
+}
+
+TEST_CASE("Legacy wrappers do not allocate if the default arena is large enough", "[allocations]")
+{
+    using T = double;
+
+    const idx_t m = 30;
+    const idx_t n = 20;
+    std::vector<T> A(m * n);
+    std::vector<T> C(m * n);
+    std::vector<T> tau(n);
+
+    rand_generator gen;
+    for (auto &a : A)
+        a = rand_helper<T>(gen);
+    for (auto &c : C)
+        c = rand_helper<T>(gen);
+
+    default_arena().reserve(std::size_t(1) << 20);
+    CHECK(count_allocations([&]() {
+              geqr2(m, n, A.data(), m, tau.data());
+              unmqr(Side::Left, Op::NoTrans, m, n, n, A.data(), m, tau.data(), C.data(), m);
+              ung2r(m, n, n, A.data(), m, tau.data());
+          }) == 0);
+}
+
+#ifdef TLAPACK_NO_HIDDEN_ALLOCATION
+TEST_CASE("Missing workspace fails loudly", "[allocations]")
+{
+    using T = double;
+    using idx_t = size_type<legacyMatrix<T>>;
+
+    const idx_t n = 30;
+    std::vector<T> A_(n * n, T(1));
+    auto A = legacyMatrix<T>(n, n, &A_[0], n);
+    std::vector<T> tau(n);
+
+    workspace_arena arena;
+    gehrd_opts_t<idx_t, T> opts;
+    opts.arena = &arena;
+    CHECK_THROWS_AS(gehrd(0, n, A, tau, opts), workspace_error);
+    CHECK(arena.depth() == 0);
+}
+#endif
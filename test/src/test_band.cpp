@@ -0,0 +1,309 @@
+/// @file test_band.cpp
+/// @brief Test the band BLAS and the band LU and Cholesky factorizations
+//
+// Copyright (c) 2022, University of Colorado Denver. All rights reserved.
+//
+// This file is part of <T>LAPACK.
+// <T>LAPACK is free software: you can redistribute it and/or modify it under
+// the terms of the BSD 3-Clause license. See the accompanying LICENSE file.
+
+#include <catch2/catch.hpp>
+#include <plugins/tlapack_stdvector.hpp>
+#include <tlapack.hpp>
+#include <testutils.hpp>
+#include <testdefinitions.hpp>
+
+using namespace tlapack;
+
+TEMPLATE_LIST_TEST_CASE("Band BLAS give the same result as the dense BLAS", "[band]", types_to_test)
+{
+    srand(1);
+
+    using matrix_t = TestType;
+    using T = type_t<matrix_t>;
+    using idx_t = size_type<matrix_t>;
+    typedef real_type<T> real_t;
+
+    const idx_t n = GENERATE(7, 20);
+    const idx_t kl = GENERATE(0, 1, 4);
+    const idx_t ku = GENERATE(0, 2, 5);
+    const Op trans = GENERATE(Op::NoTrans, Op::Trans, Op::ConjTrans);
+    const idx_t m = n + 2;
+
+    const real_t tol = real_t(1.0e2) * n * uroundoff<real_t>();
+
+    // Dense copy Ad of the m-by-n band matrix Ab
+    std::vector<T> Ad_(m * n, T(0)), Ab_((kl + ku + 1) * n);
+    auto Ad = legacyMatrix<T>(m, n, &Ad_[0], m);
+    auto Ab = legacyBandedMatrix<T>(m, n, kl, ku, &Ab_[0]);
+    for (idx_t j = 0; j < n; ++j)
+        for (idx_t i = (j > ku) ? j - ku : 0; i < std::min(m, j + kl + 1); ++i)
+            Ad(i, j) = Ab(i, j) = rand_helper<T>();
+
+    std::vector<T> x(m), y(m);
+    for (auto &xi : x)
+        xi = rand_helper<T>();
+    for (auto &yi : y)
+        yi = rand_helper<T>();
+
+    DYNAMIC_SECTION("n = " << n << " kl = " << kl << " ku = " << ku
+                           << " trans = " << (trans == Op::NoTrans ? "N" : trans == Op::Trans ? "T" : "C"))
+    {
+        // gbmv
+        {
+            const idx_t lx = (trans == Op::NoTrans) ? n : m;
+            const idx_t ly = (trans == Op::NoTrans) ? m : n;
+            std::vector<T> xs(x.begin(), x.begin() + lx), ys(y.begin(), y.begin() + ly), zs(ys);
+            gbmv(trans, T(2), Ab, xs, T(-1), ys);
+            gemv(trans, T(2), Ad, xs, T(-1), zs);
+            for (idx_t i = 0; i < ly; ++i)
+                CHECK(abs1(ys[i] - zs[i]) <= tol);
+        }
+
+        // Square band matrices with the bandwidth of one triangle
+        const Uplo uplo = (kl > 0) ? Uplo::Lower : Uplo::Upper;
+        const idx_t k = (uplo == Uplo::Lower) ? kl : ku;
+        std::vector<T> S_(n * n, T(0)), Sb_((k + 1) * n);
+        auto S = legacyMatrix<T>(n, n, &S_[0], n);
+        auto Sb = (uplo == Uplo::Lower) ? legacyBandedMatrix<T>(n, n, k, 0, &Sb_[0])
+                                        : legacyBandedMatrix<T>(n, n, 0, k, &Sb_[0]);
+        for (idx_t j = 0; j < n; ++j)
+        {
+            const idx_t i0 = (uplo == Uplo::Lower) ? j : ((j > k) ? j - k : 0);
+            const idx_t i1 = (uplo == Uplo::Lower) ? std::min(n, j + k + 1) : j + 1;
+            // Small off-diagonal elements keep the unit triangle well conditioned
+            for (idx_t i = i0; i < i1; ++i)
+                S(i, j) = Sb(i, j) = rand_helper<T>() / real_t(2 * (k + 1));
+            S(j, j) = Sb(j, j) = rand_helper<T>() + T(2);
+        }
+        std::vector<T> xs(x.begin(), x.begin() + n), ys(y.begin(), y.begin() + n), zs(ys);
+
+        // hbmv and sbmv
+        ys.assign(y.begin(), y.begin() + n);
+        zs = ys;
+        hbmv(uplo, T(2), Sb, xs, T(-1), ys);
+        hemv(uplo, T(2), S, xs, T(-1), zs);
+        for (idx_t i = 0; i < n; ++i)
+            CHECK(abs1(ys[i] - zs[i]) <= tol);
+
+        ys.assign(y.begin(), y.begin() + n);
+        zs = ys;
+        sbmv(uplo, T(2), Sb, xs, T(-1), ys);
+        symv(uplo, T(2), S, xs, T(-1), zs);
+        for (idx_t i = 0; i < n; ++i)
+            CHECK(abs1(ys[i] - zs[i]) <= tol);
+
+        // tbmv and tbsv
+        for (const Diag diag : {Diag::NonUnit, Diag::Unit})
+        {
+            ys = xs;
+            zs = xs;
+            tbmv(uplo, trans, diag, Sb, ys);
+            trmv(uplo, trans, diag, S, zs);
+            for (idx_t i = 0; i < n; ++i)
+                CHECK(abs1(ys[i] - zs[i]) <= tol);
+
+            tbsv(uplo, trans, diag, Sb, ys);
+            for (idx_t i = 0; i < n; ++i)
+                CHECK(abs1(ys[i] - xs[i]) <= tol);
+        }
+    }
+}
+
+TEMPLATE_LIST_TEST_CASE("Band LU factorization solves the system", "[band][gbtrf]", types_to_test)
+{
+    srand(1);
+
+    using matrix_t = TestType;
+    using T = type_t<matrix_t>;
+    using idx_t = size_type<matrix_t>;
+    typedef real_type<T> real_t;
+
+    const idx_t n = GENERATE(23, 60);
+    const idx_t kl = GENERATE(1, 4, 9);
+    const idx_t ku = GENERATE(0, 3);
+    const idx_t nb = GENERATE(1, 3, 8);
+    const idx_t nrhs = 3;
+
+    const real_t tol = real_t(1.0e2) * n * uroundoff<real_t>();
+
+    // The band storage holds kl+ku superdiagonals for the fill-in
+    std::vector<T> Ad_(n * n, T(0)), Ab_((2 * kl + ku + 1) * n);
+    std::vector<T> B_(n * nrhs), X_(n * nrhs);
+    auto Ad = legacyMatrix<T>(n, n, &Ad_[0], n);
+    auto Ab = legacyBandedMatrix<T>(n, n, kl, kl + ku, &Ab_[0]);
+    auto B = legacyMatrix<T>(n, nrhs, &B_[0], n);
+    auto X = legacyMatrix<T>(n, nrhs, &X_[0], n);
+    for (idx_t j = 0; j < n; ++j)
+        for (idx_t i = (j > ku) ? j - ku : 0; i < std::min(n, j + kl + 1); ++i)
+            Ad(i, j) = Ab(i, j) = rand_helper<T>();
+    for (auto &b : B_)
+        b = rand_helper<T>();
+
+    std::vector<idx_t> piv(n);
+
+    DYNAMIC_SECTION("n = " << n << " kl = " << kl << " ku = " << ku << " nb = " << nb)
+    {
+        const real_t normA = lange(max_norm, Ad);
+
+        gbtrf_opts_t<idx_t, T> opts;
+        opts.nb = nb;
+        REQUIRE(gbtrf(Ab, piv, opts) == 0);
+
+        for (const Op trans : {Op::NoTrans, Op::Trans, Op::ConjTrans})
+        {
+            lacpy(Uplo::General, B, X);
+            gbtrs(trans, Ab, piv, X);
+
+            // B - op(A) X
+            std::vector<T> R_(B_);
+            auto R = legacyMatrix<T>(n, nrhs, &R_[0], n);
+            gemm(trans, Op::NoTrans, T(-1), Ad, X, T(1), R);
+            CHECK(lange(max_norm, R) <= tol * normA * lange(max_norm, X));
+        }
+    }
+}
+
+TEMPLATE_LIST_TEST_CASE("Band Cholesky factorization solves the system", "[band][pbtrf]", types_to_test)
+{
+    srand(1);
+
+    using matrix_t = TestType;
+    using T = type_t<matrix_t>;
+    using idx_t = size_type<matrix_t>;
+    typedef real_type<T> real_t;
+
+    const Uplo uplo = GENERATE(Uplo::Lower, Uplo::Upper);
+    const idx_t n = GENERATE(23, 60);
+    const idx_t kd = GENERATE(1, 5, 12);
+    const idx_t nb = GENERATE(1, 4, 16);
+    const idx_t nrhs = 3;
+
+    const real_t tol = real_t(1.0e2) * n * uroundoff<real_t>();
+
+    std::vector<T> Ad_(n * n, T(0)), Ab_((kd + 1) * n);
+    std::vector<T> B_(n * nrhs), X_(n * nrhs);
+    auto Ad = legacyMatrix<T>(n, n, &Ad_[0], n);
+    auto Ab = (uplo == Uplo::Lower) ? legacyBandedMatrix<T>(n, n, kd, 0, &Ab_[0])
+                                    : legacyBandedMatrix<T>(n, n, 0, kd, &Ab_[0]);
+    auto B = legacyMatrix<T>(n, nrhs, &B_[0], n);
+    auto X = legacyMatrix<T>(n, nrhs, &X_[0], n);
+
+    // Hermitian positive definite band matrix
+    for (idx_t j = 0; j < n; ++j)
+    {
+        for (idx_t i = j + 1; i < std::min(n, j + kd + 1); ++i)
+        {
+            Ad(i, j) = rand_helper<T>();
+            Ad(j, i) = conj(Ad(i, j));
+        }
+        Ad(j, j) = T(real(rand_helper<T>()) + 2 * kd + 1);
+    }
+    for (idx_t j = 0; j < n; ++j)
+        for (idx_t i = 0; i < n; ++i)
+            if ((uplo == Uplo::Lower) ? (i >= j && i <= j + kd) : (j >= i && j <= i + kd))
+                Ab(i, j) = Ad(i, j);
+    for (auto &b : B_)
+        b = rand_helper<T>();
+
+    DYNAMIC_SECTION("n = " << n << " kd = " << kd << " nb = " << nb
+                           << " uplo = " << (uplo == Uplo::Upper ? "upper" : "lower"))
+    {
+        const real_t normA = lange(max_norm, Ad);
+
+        pbtrf_opts_t<idx_t, T> opts;
+        opts.nb = nb;
+        REQUIRE(pbtrf(uplo, Ab, opts) == 0);
+
+        lacpy(Uplo::General, B, X);
+        pbtrs(uplo, Ab, X);
+
+        // B - A X
+        gemm(Op::NoTrans, Op::NoTrans, T(-1), Ad, X, T(1), B);
+        CHECK(lange(max_norm, B) <= tol * normA * lange(max_norm, X));
+    }
+}
+
+TEMPLATE_LIST_TEST_CASE("Band LU factorization reports a singular matrix", "[band][gbtrf]", types_to_test)
+{
+    srand(1);
+
+    using matrix_t = TestType;
+    using T = type_t<matrix_t>;
+    using idx_t = size_type<matrix_t>;
+    typedef real_type<T> real_t;
+
+    const idx_t n = 20;
+    const idx_t kl = 4;
+    const idx_t ku = 2;
+    const idx_t c = GENERATE(0, 5, 9, 19);
+
+    const real_t tol = real_t(1.0e2) * n * uroundoff<real_t>();
+
+    // The column c is zero, so that U(c,c) is the first zero pivot
+    std::vector<T> A1_((2 * kl + ku + 1) * n), A2_((2 * kl + ku + 1) * n);
+    auto A1 = legacyBandedMatrix<T>(n, n, kl, kl + ku, &A1_[0]);
+    auto A2 = legacyBandedMatrix<T>(n, n, kl, kl + ku, &A2_[0]);
+    for (idx_t j = 0; j < n; ++j)
+        for (idx_t i = (j > ku) ? j - ku : 0; i < std::min(n, j + kl + 1); ++i)
+            A1(i, j) = A2(i, j) = (j == c) ? T(0) : rand_helper<T>();
+
+    std::vector<idx_t> piv1(n), piv2(n);
+
+    DYNAMIC_SECTION("c = " << c)
+    {
+        CHECK(gbtf2(A1, piv1, noErrorCheck) == int(c + 1));
+
+        // The blocked code completes the factorization as gbtf2 does
+        gbtrf_opts_t<idx_t, T> opts;
+        opts.nb = 3;
+        CHECK(gbtrf(A2, piv2, opts, noErrorCheck) == int(c + 1));
+        CHECK(piv1 == piv2);
+        for (idx_t j = 0; j < n; ++j)
+            for (idx_t i = (j > kl + ku) ? j - kl - ku : 0; i < std::min(n, j + kl + 1); ++i)
+                CHECK(abs1(A1(i, j) - A2(i, j)) <= tol);
+    }
+}
+
+TEMPLATE_LIST_TEST_CASE("Band Cholesky factorization reports a matrix that is not positive definite", "[band][pbtrf]", types_to_test)
+{
+    srand(1);
+
+    using matrix_t = TestType;
+    using T = type_t<matrix_t>;
+    using idx_t = size_type<matrix_t>;
+
+    const Uplo uplo = GENERATE(Uplo::Lower, Uplo::Upper);
+    const idx_t n = 20;
+    const idx_t kd = 5;
+    const idx_t k = GENERATE(0, 6, 19);
+    const idx_t nb = GENERATE(1, 4);
+
+    std::vector<T> Ab_((kd + 1) * n);
+    auto Ab = (uplo == Uplo::Lower) ? legacyBandedMatrix<T>(n, n, kd, 0, &Ab_[0])
+                                    : legacyBandedMatrix<T>(n, n, 0, kd, &Ab_[0]);
+
+    // Diagonally dominant band matrix with a negative diagonal entry at
+    // (k,k), so that the leading minor of order k+1 is the first one that
+    // is not positive definite
+    for (idx_t j = 0; j < n; ++j)
+    {
+        for (idx_t i = j + 1; i < std::min(n, j + kd + 1); ++i)
+        {
+            if (uplo == Uplo::Lower)
+                Ab(i, j) = rand_helper<T>();
+            else
+                Ab(j, i) = rand_helper<T>();
+        }
+        Ab(j, j) = T(2 * kd + 2);
+    }
+    Ab(k, k) = T(-1);
+
+    DYNAMIC_SECTION("k = " << k << " nb = " << nb
+                           << " uplo = " << (uplo == Uplo::Upper ? "upper" : "lower"))
+    {
+        pbtrf_opts_t<idx_t, T> opts;
+        opts.nb = nb;
+        CHECK(pbtrf(uplo, Ab, opts, noErrorCheck) == int(k + 1));
+    }
+}
@@ -0,0 +1,200 @@
+/// @file test_chol_update.cpp
+/// @brief Test the update and downdate of Cholesky factorizations
+//
+// Copyright (c) 2022, University of Colorado Denver. All rights reserved.
+//
+// This file is part of <T>LAPACK.
+// <T>LAPACK is free software: you can redistribute it and/or modify it under
+// the terms of the BSD 3-Clause license. See the accompanying LICENSE file.
+
+#include <catch2/catch.hpp>
+#include <plugins/tlapack_stdvector.hpp>
+#include <tlapack.hpp>
+#include <testutils.hpp>
+#include <testdefinitions.hpp>
+
+using namespace tlapack;
+
+namespace {
+
+/// Returns the max norm of the triangle uplo of A - F^H F if uplo is Upper,
+/// or of A - F F^H if uplo is Lower, where F is the triangle uplo of C
+template <class matrix_t>
+real_type<type_t<matrix_t>> chol_residual(Uplo uplo, const matrix_t &A, const matrix_t &C)
+{
+    using T = type_t<matrix_t>;
+    using idx_t = size_type<matrix_t>;
+
+    const idx_t n = nrows(A);
+
+    std::vector<T> F_(n * n), E_(n * n);
+    auto F = legacyMatrix<T>(n, n, &F_[0], n);
+    auto E = legacyMatrix<T>(n, n, &E_[0], n);
+    laset(Uplo::General, T(0), T(0), F);
+    lacpy(uplo, C, F);
+    lacpy(uplo, A, E);
+    herk(uplo, (uplo == Uplo::Upper) ? Op::ConjTrans : Op::NoTrans, real_type<T>(-1), F, real_type<T>(1), E);
+
+    return lanhe(max_norm, uplo, E);
+}
+
+} // namespace
+
+TEMPLATE_LIST_TEST_CASE("Rank-1 update and downdate of the Cholesky factor", "[chol_update]", types_to_test)
+{
+    srand(1);
+
+    using matrix_t = TestType;
+    using T = type_t<matrix_t>;
+    using idx_t = size_type<matrix_t>;
+    typedef real_type<T> real_t;
+
+    const Uplo uplo = GENERATE(Uplo::Lower, Uplo::Upper);
+    const idx_t n = GENERATE(1, 2, 9, 30);
+
+    const real_t tol = real_t(1.0e2) * n * uroundoff<real_t>();
+
+    std::unique_ptr<T[]> A_(new T[n * n]);
+    std::unique_ptr<T[]> B_(new T[n * n]);
+    std::unique_ptr<T[]> C_(new T[n * n]);
+    std::vector<T> x(n), y(n);
+
+    auto A = legacyMatrix<T, layout<matrix_t>>(n, n, &A_[0], n);
+    auto B = legacyMatrix<T, layout<matrix_t>>(n, n, &B_[0], n);
+    auto C = legacyMatrix<T, layout<matrix_t>>(n, n, &C_[0], n);
+
+    // Hermitian positive definite A and B = A + x x^H
+    for (idx_t j = 0; j < n; ++j)
+        for (idx_t i = 0; i < n; ++i)
+            A(i, j) = rand_helper<T>() / real_t(n);
+    for (idx_t j = 0; j < n; ++j)
+    {
+        for (idx_t i = 0; i < j; ++i)
+            A(i, j) = conj(A(j, i));
+        A(j, j) = T(real(A(j, j)) + 2);
+    }
+    for (idx_t i = 0; i < n; ++i)
+        x[i] = rand_helper<T>();
+    lacpy(Uplo::General, A, B);
+    for (idx_t j = 0; j < n; ++j)
+        for (idx_t i = 0; i < n; ++i)
+            B(i, j) += x[i] * conj(x[j]);
+
+    DYNAMIC_SECTION("n = " << n << " uplo = " << (uplo == Uplo::Upper ? "upper" : "lower"))
+    {
+        const real_t normB = lanhe(max_norm, uplo, B);
+
+        // Update the factor of A
+        lacpy(Uplo::General, A, C);
+        REQUIRE(potrf(uplo, C) == 0);
+        y = x;
+        REQUIRE(chol_update1(uplo, C, y) == 0);
+        CHECK(chol_residual(uplo, B, C) <= tol * normB);
+
+        // Downdate it back
+        y = x;
+        REQUIRE(chol_downdate1(uplo, C, y) == 0);
+        CHECK(chol_residual(uplo, A, C) <= tol * normB);
+    }
+}
+
+TEMPLATE_LIST_TEST_CASE("Blocked rank-k update and downdate of the Cholesky factor", "[chol_update]", types_to_test)
+{
+    srand(1);
+
+    using matrix_t = TestType;
+    using T = type_t<matrix_t>;
+    using idx_t = size_type<matrix_t>;
+    typedef real_type<T> real_t;
+
+    const Uplo uplo = GENERATE(Uplo::Lower, Uplo::Upper);
+    const idx_t n = GENERATE(1, 10, 37);
+    const idx_t k = GENERATE(1, 3, 8);
+    const idx_t nb = GENERATE(1, 2, 5, 32);
+
+    const real_t tol = real_t(1.0e2) * (n + k) * uroundoff<real_t>();
+
+    std::unique_ptr<T[]> A_(new T[n * n]);
+    std::unique_ptr<T[]> B_(new T[n * n]);
+    std::unique_ptr<T[]> C_(new T[n * n]);
+    std::unique_ptr<T[]> X_(new T[n * k]);
+    std::unique_ptr<T[]> Y_(new T[n * k]);
+
+    auto A = legacyMatrix<T, layout<matrix_t>>(n, n, &A_[0], n);
+    auto B = legacyMatrix<T, layout<matrix_t>>(n, n, &B_[0], n);
+    auto C = legacyMatrix<T, layout<matrix_t>>(n, n, &C_[0], n);
+    auto X = legacyMatrix<T, layout<matrix_t>>(n, k, &X_[0], layout<matrix_t> == Layout::RowMajor ? k : n);
+    auto Y = legacyMatrix<T, layout<matrix_t>>(n, k, &Y_[0], layout<matrix_t> == Layout::RowMajor ? k : n);
+
+    // Hermitian positive definite A and B = A + X X^H
+    for (idx_t j = 0; j < n; ++j)
+        for (idx_t i = 0; i < n; ++i)
+            A(i, j) = rand_helper<T>() / real_t(n);
+    for (idx_t j = 0; j < n; ++j)
+    {
+        for (idx_t i = 0; i < j; ++i)
+            A(i, j) = conj(A(j, i));
+        A(j, j) = T(real(A(j, j)) + 2);
+    }
+    for (idx_t j = 0; j < k; ++j)
+        for (idx_t i = 0; i < n; ++i)
+            X(i, j) = rand_helper<T>();
+    lacpy(Uplo::General, A, B);
+    gemm(Op::NoTrans, Op::ConjTrans, T(1), X, X, T(1), B);
+
+    DYNAMIC_SECTION("n = " << n << " k = " << k << " nb = " << nb
+                           << " uplo = " << (uplo == Uplo::Upper ? "upper" : "lower"))
+    {
+        const real_t normB = lanhe(max_norm, uplo, B);
+
+        chol_update_opts_t<idx_t, T> opts;
+        opts.nb = nb;
+
+        // Update the factor of A
+        lacpy(Uplo::General, A, C);
+        REQUIRE(potrf(uplo, C) == 0);
+        lacpy(Uplo::General, X, Y);
+        REQUIRE(chol_update(uplo, C, Y, opts) == 0);
+        CHECK(chol_residual(uplo, B, C) <= tol * normB);
+
+        // Downdate it back
+        lacpy(Uplo::General, X, Y);
+        REQUIRE(chol_downdate(uplo, C, Y, opts) == 0);
+        CHECK(chol_residual(uplo, A, C) <= tol * normB);
+    }
+}
+
+TEMPLATE_LIST_TEST_CASE("Downdates that break positive definiteness are reported", "[chol_update]", types_to_test)
+{
+    using matrix_t = TestType;
+    using T = type_t<matrix_t>;
+    using idx_t = size_type<matrix_t>;
+
+    const Uplo uplo = GENERATE(Uplo::Lower, Uplo::Upper);
+    const idx_t n = 6;
+    const idx_t k = 4;
+
+    std::unique_ptr<T[]> A_(new T[n * n]);
+    std::unique_ptr<T[]> X_(new T[n * k]);
+
+    auto A = legacyMatrix<T, layout<matrix_t>>(n, n, &A_[0], n);
+    auto X = legacyMatrix<T, layout<matrix_t>>(n, k, &X_[0], layout<matrix_t> == Layout::RowMajor ? k : n);
+
+    // A = I, and A - X X^H has a zero eigenvalue in the direction of e_3
+    laset(Uplo::General, T(0), T(1), A);
+    laset(Uplo::General, T(0), T(0), X);
+    X(3, 1) = T(1);
+
+    DYNAMIC_SECTION("uplo = " << (uplo == Uplo::Upper ? "upper" : "lower"))
+    {
+        std::vector<T> x(n);
+        for (idx_t i = 0; i < n; ++i)
+            x[i] = X(i, 1);
+        CHECK(chol_downdate1(uplo, A, x, noErrorCheck) == 4);
+
+        laset(Uplo::General, T(0), T(1), A);
+        chol_update_opts_t<idx_t, T> opts;
+        opts.nb = 2;
+        CHECK(chol_downdate(uplo, A, X, opts, noErrorCheck) == 4);
+    }
+}
@@ -0,0 +1,199 @@
+/// @file test_gees.cpp
+/// @brief Test the balancing routines and the Schur decomposition driver
+//
+// Copyright (c) 2022, University of Colorado Denver. All rights reserved.
+//
+// This file is part of <T>LAPACK.
+// <T>LAPACK is free software: you can redistribute it and/or modify it under
+// the terms of the BSD 3-Clause license. See the accompanying LICENSE file.
+
+#include <catch2/catch.hpp>
+#include <plugins/tlapack_stdvector.hpp>
+#include <tlapack.hpp>
+#include <testutils.hpp>
+#include <testdefinitions.hpp>
+
+using namespace tlapack;
+
+template <typename matrix_t>
+void generate_unbalanced(const std::string &matrix_type, matrix_t &A)
+{
+    using T = type_t<matrix_t>;
+    using idx_t = size_type<matrix_t>;
+    using real_t = real_type<T>;
+
+    const idx_t n = nrows(A);
+    rand_generator gen;
+
+    for (idx_t j = 0; j < n; ++j)
+        for (idx_t i = 0; i < n; ++i)
+            A(i, j) = rand_helper<T>(gen);
+
+    if (matrix_type == "Badly scaled")
+    {
+        // A := D A D^{-1} with D = diag(2^(-n/2), ..., 2^(n/2))
+        for (idx_t j = 0; j < n; ++j)
+            for (idx_t i = 0; i < n; ++i)
+                A(i, j) *= std::pow(real_t(2), real_t(int(i) - int(j)));
+    }
+    if (matrix_type == "Reducible")
+    {
+        // Isolate eigenvalues in the first and last two rows and columns
+        // after a symmetric permutation
+        for (idx_t j = 0; j < n; ++j)
+        {
+            if (j % 3 == 0)
+                for (idx_t i = 0; i < n; ++i)
+                    if (i != j)
+                        A(i, j) = T(0);
+            if (j % 4 == 1)
+                for (idx_t i = 0; i < n; ++i)
+                    if (i != j)
+                        A(j, i) = T(0);
+        }
+    }
+}
+
+TEMPLATE_LIST_TEST_CASE("Balancing is a similarity transformation", "[eigenvalues][gebal]", types_to_test)
+{
+    srand(1);
+
+    using matrix_t = TestType;
+    using T = type_t<matrix_t>;
+    using idx_t = size_type<matrix_t>;
+    using real_t = real_type<T>;
+
+    auto matrix_type = GENERATE(as<std::string>{}, "Random", "Badly scaled", "Reducible");
+    const idx_t n = GENERATE(1, 2, 5, 10, 30);
+    const bool want_permute = GENERATE(false, true);
+    const bool want_scale = GENERATE(false, true);
+
+    const real_t eps = uroundoff<real_t>();
+    const real_t tol = n * 1.0e2 * eps;
+
+    // Define the matrices and vectors
+    std::unique_ptr<T[]> A_(new T[n * n]);
+    std::unique_ptr<T[]> B_(new T[n * n]);
+    std::unique_ptr<T[]> V_(new T[n * n]);
+    std::unique_ptr<T[]> R_(new T[n * n]);
+
+    auto A = legacyMatrix<T, layout<matrix_t>>(n, n, &A_[0], n);
+    auto B = legacyMatrix<T, layout<matrix_t>>(n, n, &B_[0], n);
+    auto V = legacyMatrix<T, layout<matrix_t>>(n, n, &V_[0], n);
+    auto R = legacyMatrix<T, layout<matrix_t>>(n, n, &R_[0], n);
+    std::vector<real_t> scale(n);
+
+    generate_unbalanced(matrix_type, A);
+
+    DYNAMIC_SECTION("GEBAL with"
+                    << " matrix = " << matrix_type << " n = " << n
+                    << " permute = " << want_permute << " scale = " << want_scale)
+    {
+        lacpy(Uplo::General, A, B);
+        idx_t ilo, ihi;
+        int info = gebal(want_permute, want_scale, B, ilo, ihi, scale);
+        REQUIRE(info == 0);
+        CHECK(ilo <= ihi);
+        CHECK(ihi <= n);
+        if (!want_permute)
+        {
+            CHECK(ilo == 0);
+            CHECK(ihi == n);
+        }
+
+        // Isolated eigenvalues
+        for (idx_t j = 0; j < n; ++j)
+            for (idx_t i = j + 1; i < n; ++i)
+                if (j < ilo || i >= ihi)
+                    CHECK(B(i, j) == T(0));
+
+        // A V = V B with V = P D
+        laset(Uplo::General, T(0), T(1), V);
+        gebak(want_permute, want_scale, Side::Right, ilo, ihi, scale, V);
+        gemm(Op::NoTrans, Op::NoTrans, T(1), A, V, T(0), R);
+        gemm(Op::NoTrans, Op::NoTrans, T(-1), V, B, T(1), R);
+        CHECK(lange(frob_norm, R) <= tol * lange(frob_norm, A) * lange(max_norm, V));
+
+        // The 1-norm is not increased by much
+        if (want_scale)
+            CHECK(lange(one_norm, B) <= real_t(2) * lange(one_norm, A));
+    }
+}
+
+TEMPLATE_LIST_TEST_CASE("Schur decomposition with balancing", "[eigenvalues][gees]", types_to_test)
+{
+    srand(1);
+
+    using matrix_t = TestType;
+    using T = type_t<matrix_t>;
+    using idx_t = size_type<matrix_t>;
+    using real_t = real_type<T>;
+    using complex_t = std::complex<real_t>;
+
+    auto matrix_type = GENERATE(as<std::string>{}, "Random", "Badly scaled", "Reducible");
+    const idx_t n = GENERATE(1, 5, 30, 100);
+    const bool want_scale = GENERATE(false, true);
+
+    const real_t eps = uroundoff<real_t>();
+    const real_t tol = n * 1.0e2 * eps;
+
+    // Define the matrices and vectors
+    std::unique_ptr<T[]> A_(new T[n * n]);
+    std::unique_ptr<T[]> H_(new T[n * n]);
+    std::unique_ptr<T[]> Z_(new T[n * n]);
+    std::unique_ptr<T[]> R_(new T[n * n]);
+
+    auto A = legacyMatrix<T, layout<matrix_t>>(n, n, &A_[0], n);
+    auto H = legacyMatrix<T, layout<matrix_t>>(n, n, &H_[0], n);
+    auto Z = legacyMatrix<T, layout<matrix_t>>(n, n, &Z_[0], n);
+    auto R = legacyMatrix<T, layout<matrix_t>>(n, n, &R_[0], n);
+    std::vector<complex_t> w(n), w2(n);
+
+    generate_unbalanced(matrix_type, A);
+
+    DYNAMIC_SECTION("GEES with"
+                    << " matrix = " << matrix_type << " n = " << n << " scale = " << want_scale)
+    {
+        gees_opts_t<idx_t, T> opts;
+        opts.scale = want_scale;
+        opts.nb = 4;
+        opts.nx_switch = 2;
+        opts.francis.nmin = 15;
+
+        lacpy(Uplo::General, A, H);
+        int info = gees(true, true, H, w, Z, opts);
+        REQUIRE(info == 0);
+
+        // T is quasi-triangular
+        for (idx_t j = 0; j < n; ++j)
+            for (idx_t i = j + 2; i < n; ++i)
+                CHECK(H(i, j) == T(0));
+
+        // A Z = Z T
+        gemm(Op::NoTrans, Op::NoTrans, T(1), A, Z, T(0), R);
+        gemm(Op::NoTrans, Op::NoTrans, T(-1), Z, H, T(1), R);
+        CHECK(lange(frob_norm, R) <= tol * lange(frob_norm, A) * lange(frob_norm, Z));
+
+        if (!want_scale)
+        {
+            std::unique_ptr<T[]> res_(new T[n * n]);
+            auto res = legacyMatrix<T, layout<matrix_t>>(n, n, &res_[0], n);
+            CHECK(check_orthogonality(Z, res) <= tol);
+        }
+
+        // The eigenvalues computed without the Schur form must agree
+        lacpy(Uplo::General, A, H);
+        info = gees(false, false, H, w2, Z, opts);
+        REQUIRE(info == 0);
+        real_t wnorm(0);
+        for (idx_t i = 0; i < n; ++i)
+            wnorm = std::max(wnorm, abs(w[i]));
+        for (idx_t i = 0; i < n; ++i)
+        {
+            real_t dist = abs(w[i] - w2[0]);
+            for (idx_t j = 1; j < n; ++j)
+                dist = std::min(dist, abs(w[i] - w2[j]));
+            CHECK(dist <= std::sqrt(tol) * std::max(wnorm, real_t(1)));
+        }
+    }
+}
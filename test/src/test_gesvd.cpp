@@ -0,0 +1,233 @@
+/// @file test_gesvd.cpp
+/// @brief Test the singular value decomposition routines
+//
+// Copyright (c) 2022, University of Colorado Denver. All rights reserved.
+//
+// This file is part of <T>LAPACK.
+// <T>LAPACK is free software: you can redistribute it and/or modify it under
+// the terms of the BSD 3-Clause license. See the accompanying LICENSE file.
+
+#include <catch2/catch.hpp>
+#include <plugins/tlapack_stdvector.hpp>
+#include <tlapack.hpp>
+#include <testutils.hpp>
+#include <testdefinitions.hpp>
+
+using namespace tlapack;
+
+TEMPLATE_LIST_TEST_CASE("Bidiagonal reduction is backward stable", "[svd][gebrd]", types_to_test)
+{
+    srand(1);
+
+    using matrix_t = TestType;
+    using T = type_t<matrix_t>;
+    using idx_t = size_type<matrix_t>;
+    using real_t = real_type<T>;
+    using pair = pair<idx_t, idx_t>;
+
+    const idx_t m = GENERATE(1, 5, 10, 33);
+    const idx_t n = GENERATE(1, 4, 10);
+    const idx_t nb = GENERATE(2, 3);
+
+    if (m < n)
+        return;
+
+    rand_generator gen;
+    const real_t eps = uroundoff<real_t>();
+    const real_t tol = m * 1.0e2 * eps;
+
+    // Define the matrices and vectors
+    std::unique_ptr<T[]> A_(new T[m * n]);
+    std::unique_ptr<T[]> H_(new T[m * n]);
+    std::unique_ptr<T[]> Q_(new T[m * n]);
+    std::unique_ptr<T[]> P_(new T[n * n]);
+    std::unique_ptr<T[]> R_(new T[m * n]);
+    std::unique_ptr<T[]> QB_(new T[m * n]);
+    std::unique_ptr<T[]> res_(new T[n * n]);
+
+    auto A = legacyMatrix<T, layout<matrix_t>>(m, n, &A_[0], layout<matrix_t> == Layout::ColMajor ? m : n);
+    auto H = legacyMatrix<T, layout<matrix_t>>(m, n, &H_[0], layout<matrix_t> == Layout::ColMajor ? m : n);
+    auto Q = legacyMatrix<T, layout<matrix_t>>(m, n, &Q_[0], layout<matrix_t> == Layout::ColMajor ? m : n);
+    auto P = legacyMatrix<T, layout<matrix_t>>(n, n, &P_[0], n);
+    auto R = legacyMatrix<T, layout<matrix_t>>(m, n, &R_[0], layout<matrix_t> == Layout::ColMajor ? m : n);
+    auto QB = legacyMatrix<T, layout<matrix_t>>(m, n, &QB_[0], layout<matrix_t> == Layout::ColMajor ? m : n);
+    auto res = legacyMatrix<T, layout<matrix_t>>(n, n, &res_[0], n);
+    std::vector<T> tauq(n), taup(n);
+
+    for (idx_t j = 0; j < n; ++j)
+        for (idx_t i = 0; i < m; ++i)
+            A(i, j) = rand_helper<T>(gen);
+    lacpy(Uplo::General, A, H);
+
+    const bool two_stage = GENERATE(false, true);
+    DYNAMIC_SECTION("GEBRD with"
+                    << " m = " << m << " n = " << n << " nb = " << nb << " two_stage = " << two_stage)
+    {
+        const idx_t kd = (two_stage) ? nb : 1;
+        std::vector<real_t> d(n), e(n);
+
+        // Q = Q * I, P = I
+        laset(Uplo::General, T(0), T(1), Q);
+        laset(Uplo::General, T(0), T(1), P);
+
+        if (!two_stage)
+        {
+            gebrd_opts_t<idx_t, T> opts;
+            opts.nb = nb;
+            opts.nx_switch = 2;
+            gebrd(H, tauq, taup, opts);
+            for (idx_t i = 0; i < n; ++i)
+            {
+                CHECK(imag(H(i, i)) == real_t(0));
+                d[i] = real(H(i, i));
+                if (i + 1 < n)
+                {
+                    CHECK(imag(H(i, i + 1)) == real_t(0));
+                    e[i] = real(H(i, i + 1));
+                }
+            }
+        }
+        else
+        {
+            ge2gb_opts_t<idx_t, T> opts;
+            opts.nb = nb;
+            ge2gb(H, tauq, taup, opts);
+
+            // Copy the band to band storage
+            const idx_t ku = std::min<idx_t>(kd + 1, n - 1);
+            const idx_t kl = std::min<idx_t>(1, n - 1);
+            std::vector<T> band_((kl + ku + 1) * n, T(0));
+            auto B = legacyBandedMatrix<T>(n, n, kl, ku, band_.data());
+            for (idx_t j = 0; j < n; ++j)
+                for (idx_t i = (j > kd) ? j - kd : 0; i <= j; ++i)
+                    B(i, j) = H(i, j);
+
+            auto U2 = slice(Q, pair{0, n}, pair{0, n});
+            gbbrd(true, true, kd, B, d, e, U2, P);
+        }
+
+        std::unique_ptr<T[]> W_(new T[nb * (n + nb)]);
+        auto W = legacyMatrix<T, layout<matrix_t>>(nb, n + nb, &W_[0], layout<matrix_t> == Layout::ColMajor ? nb : n + nb);
+        struct
+        {
+            idx_t nb;
+            decltype(W) *workPtr;
+        } unmqr_opts = {nb, &W};
+        unmqr(Side::Left, Op::NoTrans, H, tauq, Q, std::move(unmqr_opts));
+        if (n > kd)
+        {
+            auto Ap = slice(H, pair{0, n - kd}, pair{kd, n});
+            auto taup1 = slice(taup, pair{0, n - kd});
+            auto P1 = slice(P, pair{kd, n}, pair{0, n});
+            unmlq_opts_t<idx_t, T> unmlq_opts;
+            unmlq_opts.nb = nb;
+            unmlq(Side::Left, Op::ConjTrans, Ap, taup1, P1, unmlq_opts);
+        }
+
+        CHECK(check_orthogonality(Q, res) <= tol);
+        CHECK(check_orthogonality(P, res) <= tol);
+
+        // R = A - Q B P^H
+        laset(Uplo::General, T(0), T(0), QB);
+        for (idx_t j = 0; j < n; ++j)
+            for (idx_t i = 0; i < m; ++i)
+                QB(i, j) = Q(i, j) * d[j] + ((j > 0) ? Q(i, j - 1) * e[j - 1] : T(0));
+        lacpy(Uplo::General, A, R);
+        gemm(Op::NoTrans, Op::ConjTrans, T(-1), QB, P, T(1), R);
+
+        CHECK(lange(frob_norm, R) <= tol * lange(frob_norm, A));
+    }
+}
+
+TEMPLATE_LIST_TEST_CASE("Singular value decomposition is backward stable", "[svd][gesvd]", types_to_test)
+{
+    srand(1);
+
+    using matrix_t = TestType;
+    using T = type_t<matrix_t>;
+    using idx_t = size_type<matrix_t>;
+    using real_t = real_type<T>;
+
+    auto matrix_type = GENERATE(as<std::string>{}, "Random", "Rank one");
+    const idx_t m = GENERATE(1, 5, 10, 33);
+    const idx_t n = GENERATE(1, 4, 20);
+    const idx_t k = std::min(m, n);
+
+    rand_generator gen;
+    const real_t eps = uroundoff<real_t>();
+    const real_t tol = std::max(m, n) * 1.0e2 * eps;
+
+    // Define the matrices and vectors
+    std::unique_ptr<T[]> A_(new T[m * n]);
+    std::unique_ptr<T[]> H_(new T[m * n]);
+    std::unique_ptr<T[]> U_(new T[m * k]);
+    std::unique_ptr<T[]> VT_(new T[k * n]);
+    std::unique_ptr<T[]> R_(new T[m * n]);
+    std::unique_ptr<T[]> res_(new T[k * k]);
+
+    auto A = legacyMatrix<T, layout<matrix_t>>(m, n, &A_[0], layout<matrix_t> == Layout::ColMajor ? m : n);
+    auto H = legacyMatrix<T, layout<matrix_t>>(m, n, &H_[0], layout<matrix_t> == Layout::ColMajor ? m : n);
+    auto U = legacyMatrix<T, layout<matrix_t>>(m, k, &U_[0], layout<matrix_t> == Layout::ColMajor ? m : k);
+    auto VT = legacyMatrix<T, layout<matrix_t>>(k, n, &VT_[0], layout<matrix_t> == Layout::ColMajor ? k : n);
+    auto R = legacyMatrix<T, layout<matrix_t>>(m, n, &R_[0], layout<matrix_t> == Layout::ColMajor ? m : n);
+    auto res = legacyMatrix<T, layout<matrix_t>>(k, k, &res_[0], k);
+    std::vector<real_t> s(k), s2(k);
+
+    if (matrix_type == "Random")
+    {
+        for (idx_t j = 0; j < n; ++j)
+            for (idx_t i = 0; i < m; ++i)
+                A(i, j) = rand_helper<T>(gen);
+    }
+    if (matrix_type == "Rank one")
+    {
+        for (idx_t j = 0; j < n; ++j)
+            for (idx_t i = 0; i < m; ++i)
+                A(i, j) = T(1);
+    }
+
+    const bool two_stage = GENERATE(false, true);
+    const bool divide_and_conquer = GENERATE(false, true);
+    DYNAMIC_SECTION("GESVD with"
+                    << " matrix = " << matrix_type << " m = " << m << " n = " << n
+                    << " two_stage = " << two_stage << " divide_and_conquer = " << divide_and_conquer)
+    {
+        gesvd_opts_t<idx_t, T> opts;
+        opts.nb = 3;
+        opts.nx_switch = 2;
+        opts.two_stage = two_stage;
+        opts.divide_and_conquer = divide_and_conquer;
+        opts.smlsiz = 2;
+
+        lacpy(Uplo::General, A, H);
+        int info = gesvd(true, true, H, s, U, VT, opts);
+        REQUIRE(info == 0);
+
+        for (idx_t i = 0; i + 1 < k; ++i)
+            CHECK(s[i] >= s[i + 1]);
+        for (idx_t i = 0; i < k; ++i)
+            CHECK(s[i] >= real_t(0));
+
+        CHECK(check_orthogonality(U, res) <= tol);
+        CHECK(check_orthogonality(VT, res) <= tol);
+
+        // R = A - U diag(s) VT
+        lacpy(Uplo::General, A, R);
+        for (idx_t j = 0; j < k; ++j)
+        {
+            auto uj = col(U, j);
+            scal(s[j], uj);
+        }
+        gemm(Op::NoTrans, Op::NoTrans, T(-1), U, VT, T(1), R);
+
+        auto normA = lange(frob_norm, A);
+        CHECK(lange(frob_norm, R) <= tol * normA);
+
+        // The singular values computed without singular vectors must agree
+        lacpy(Uplo::General, A, H);
+        info = gesdd(false, false, H, s2, U, VT, opts);
+        REQUIRE(info == 0);
+        for (idx_t i = 0; i < k; ++i)
+            CHECK(abs(s[i] - s2[i]) <= tol * std::max(normA, real_t(1)));
+    }
+}
@@ -0,0 +1,196 @@
+/// @file test_heevd.cpp
+/// @brief Test the Hermitian eigenvalue routines
+//
+// Copyright (c) 2022, University of Colorado Denver. All rights reserved.
+//
+// This file is part of <T>LAPACK.
+// <T>LAPACK is free software: you can redistribute it and/or modify it under
+// the terms of the BSD 3-Clause license. See the accompanying LICENSE file.
+
+#include <catch2/catch.hpp>
+#include <plugins/tlapack_stdvector.hpp>
+#include <tlapack.hpp>
+#include <testutils.hpp>
+#include <testdefinitions.hpp>
+
+using namespace tlapack;
+
+template <typename matrix_t>
+void generate_hermitian(const std::string &matrix_type, matrix_t &A)
+{
+    using T = type_t<matrix_t>;
+    using idx_t = size_type<matrix_t>;
+
+    const idx_t n = nrows(A);
+    rand_generator gen;
+
+    if (matrix_type == "Random")
+    {
+        for (idx_t j = 0; j < n; ++j)
+        {
+            for (idx_t i = 0; i < j; ++i)
+            {
+                A(i, j) = rand_helper<T>(gen);
+                A(j, i) = conj(A(i, j));
+            }
+            A(j, j) = real(rand_helper<T>(gen));
+        }
+    }
+    if (matrix_type == "Rank one")
+    {
+        // Eigenvalues 0 (multiplicity n-1) and n, the worst case for the
+        // deflation in the divide and conquer method
+        for (idx_t j = 0; j < n; ++j)
+            for (idx_t i = 0; i < n; ++i)
+                A(i, j) = T(1);
+    }
+}
+
+TEMPLATE_LIST_TEST_CASE("Tridiagonal reduction is backward stable", "[eigenvalues][hetrd]", types_to_test)
+{
+    srand(1);
+
+    using matrix_t = TestType;
+    using T = type_t<matrix_t>;
+    using idx_t = size_type<matrix_t>;
+    using real_t = real_type<T>;
+
+    const idx_t n = GENERATE(1, 2, 3, 5, 10, 33);
+    const Uplo uplo = GENERATE(Uplo::Lower, Uplo::Upper);
+    const idx_t nb = GENERATE(2, 3);
+
+    const real_t eps = uroundoff<real_t>();
+    const real_t tol = n * 1.0e2 * eps;
+
+    // Define the matrices and vectors
+    std::unique_ptr<T[]> A_(new T[n * n]);
+    std::unique_ptr<T[]> H_(new T[n * n]);
+    std::unique_ptr<T[]> Q_(new T[n * n]);
+    std::unique_ptr<T[]> B_(new T[n * n]);
+    std::unique_ptr<T[]> res_(new T[n * n]);
+    std::unique_ptr<T[]> work_(new T[n * n]);
+
+    auto A = legacyMatrix<T, layout<matrix_t>>(n, n, &A_[0], n);
+    auto H = legacyMatrix<T, layout<matrix_t>>(n, n, &H_[0], n);
+    auto Q = legacyMatrix<T, layout<matrix_t>>(n, n, &Q_[0], n);
+    auto B = legacyMatrix<T, layout<matrix_t>>(n, n, &B_[0], n);
+    auto res = legacyMatrix<T, layout<matrix_t>>(n, n, &res_[0], n);
+    auto work = legacyMatrix<T, layout<matrix_t>>(n, n, &work_[0], n);
+    std::vector<T> tau(n);
+
+    generate_hermitian("Random", A);
+    lacpy(Uplo::General, A, H);
+
+    DYNAMIC_SECTION("HETRD with"
+                    << " n = " << n << " uplo = " << (uplo == Uplo::Lower ? "Lower" : "Upper") << " nb = " << nb)
+    {
+        hetrd_opts_t<idx_t, T> opts;
+        opts.nb = nb;
+        opts.nx_switch = 2;
+        hetrd(uplo, H, tau, opts);
+
+        // Q = Q * I
+        laset(Uplo::General, T(0), T(1), Q);
+        unmtr_opts_t<idx_t, T> unmtr_opts;
+        unmtr_opts.nb = nb;
+        unmtr(Side::Left, uplo, Op::NoTrans, H, tau, Q, unmtr_opts);
+
+        // B = T
+        laset(Uplo::General, T(0), T(0), B);
+        for (idx_t i = 0; i < n; ++i)
+            B(i, i) = H(i, i);
+        for (idx_t i = 0; i + 1 < n; ++i)
+        {
+            B(i + 1, i) = (uplo == Uplo::Lower) ? H(i + 1, i) : H(i, i + 1);
+            B(i, i + 1) = B(i + 1, i);
+            CHECK(imag(B(i, i + 1)) == real_t(0));
+        }
+
+        auto orth_res_norm = check_orthogonality(Q, res);
+        CHECK(orth_res_norm <= tol);
+
+        auto normA = lange(frob_norm, A);
+        auto simil_res_norm = check_similarity_transform(A, Q, B, res, work);
+        CHECK(simil_res_norm <= tol * normA);
+
+        // Q^H * Q using the other side and transposition
+        lacpy(Uplo::General, Q, B);
+        unmtr(Side::Right, uplo, Op::ConjTrans, H, tau, B, unmtr_opts);
+        // B should be I
+        for (idx_t i = 0; i < n; ++i)
+            B(i, i) -= T(1);
+        CHECK(lange(frob_norm, B) <= tol);
+    }
+}
+
+TEMPLATE_LIST_TEST_CASE("Divide and conquer eigensolver is backward stable", "[eigenvalues][heevd]", types_to_test)
+{
+    srand(1);
+
+    using matrix_t = TestType;
+    using T = type_t<matrix_t>;
+    using idx_t = size_type<matrix_t>;
+    using real_t = real_type<T>;
+
+    auto matrix_type = GENERATE(as<std::string>{}, "Random", "Rank one");
+    const idx_t n = GENERATE(1, 2, 5, 10, 40);
+    const Uplo uplo = GENERATE(Uplo::Lower, Uplo::Upper);
+    const idx_t smlsiz = GENERATE(2, 25);
+
+    const real_t eps = uroundoff<real_t>();
+    const real_t tol = n * 1.0e2 * eps;
+
+    // Define the matrices and vectors
+    std::unique_ptr<T[]> A_(new T[n * n]);
+    std::unique_ptr<T[]> Z_(new T[n * n]);
+    std::unique_ptr<T[]> B_(new T[n * n]);
+    std::unique_ptr<T[]> res_(new T[n * n]);
+    std::unique_ptr<T[]> work_(new T[n * n]);
+
+    auto A = legacyMatrix<T, layout<matrix_t>>(n, n, &A_[0], n);
+    auto Z = legacyMatrix<T, layout<matrix_t>>(n, n, &Z_[0], n);
+    auto B = legacyMatrix<T, layout<matrix_t>>(n, n, &B_[0], n);
+    auto res = legacyMatrix<T, layout<matrix_t>>(n, n, &res_[0], n);
+    auto work = legacyMatrix<T, layout<matrix_t>>(n, n, &work_[0], n);
+    std::vector<real_t> w(n), w2(n);
+
+    generate_hermitian(matrix_type, A);
+
+    const bool parallel = GENERATE(false, true);
+    DYNAMIC_SECTION("HEEVD with"
+                    << " matrix = " << matrix_type << " n = " << n << " uplo = " << (uplo == Uplo::Lower ? "Lower" : "Upper")
+                    << " smlsiz = " << smlsiz << " parallel = " << parallel)
+    {
+        heevd_opts_t<idx_t, T> opts;
+        opts.nb = 2;
+        opts.nx_switch = 2;
+        opts.smlsiz = smlsiz;
+        opts.parallel = parallel;
+
+        lacpy(Uplo::General, A, Z);
+        int info = heevd(true, uplo, Z, w, opts);
+        REQUIRE(info == 0);
+
+        for (idx_t i = 0; i + 1 < n; ++i)
+            CHECK(w[i] <= w[i + 1]);
+
+        // Z^H A Z = diag(w)
+        laset(Uplo::General, T(0), T(0), B);
+        for (idx_t i = 0; i < n; ++i)
+            B(i, i) = w[i];
+
+        auto orth_res_norm = check_orthogonality(Z, res);
+        CHECK(orth_res_norm <= tol);
+
+        auto normA = lange(frob_norm, A);
+        auto simil_res_norm = check_similarity_transform(A, Z, B, res, work);
+        CHECK(simil_res_norm <= tol * normA);
+
+        // The eigenvalues computed without eigenvectors must agree
+        lacpy(Uplo::General, A, Z);
+        info = heevd(false, uplo, Z, w2, opts);
+        REQUIRE(info == 0);
+        for (idx_t i = 0; i < n; ++i)
+            CHECK(abs(w[i] - w2[i]) <= tol * std::max(normA, real_t(1)));
+    }
+}
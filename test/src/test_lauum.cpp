@@ -26,6 +26,7 @@ TEMPLATE_LIST_TEST_CASE("LAUUM is stable", "[lauum]", types_to_test)
 
     Uplo uplo = GENERATE(Uplo::Lower, Uplo::Upper);
     idx_t n = GENERATE(1, 2, 6, 9);
+    idx_t nx = GENERATE(1, 2, 4, 16);
 
     const real_t eps = uroundoff<real_t>();
     const real_t tol = 1.0e2 * n * eps;
@@ -43,9 +44,11 @@ TEMPLATE_LIST_TEST_CASE("LAUUM is stable", "[lauum]", types_to_test)
 
     lacpy(Uplo::General, A, C);
 
-    DYNAMIC_SECTION("n = " << n << " uplo = " << (uplo == Uplo::Upper ? "upper" : "lower"))
+    DYNAMIC_SECTION("n = " << n << " nx = " << nx << " uplo = " << (uplo == Uplo::Upper ? "upper" : "lower"))
     {
-        lauum_recursive(uplo, A);
+        lauum_opts_t<idx_t> opts;
+        opts.nx = nx;
+        lauum_recursive(uplo, A, opts);
 
         // Calculate residual
         real_t normC = lantr(max_norm, uplo, Diag::NonUnit, C);
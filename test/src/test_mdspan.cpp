@@ -0,0 +1,126 @@
+/// @file test_mdspan.cpp
+/// @brief Test mdspan matrices in the BLAS wrappers
+//
+// Copyright (c) 2022, University of Colorado Denver. All rights reserved.
+//
+// This file is part of <T>LAPACK.
+// <T>LAPACK is free software: you can redistribute it and/or modify it under
+// the terms of the BSD 3-Clause license. See the accompanying LICENSE file.
+
+// The mdspan plugin must be loaded before <T>LAPACK
+#include <plugins/tlapack_mdspan.hpp>
+
+#include <catch2/catch.hpp>
+#include <tlapack.hpp>
+#include <testutils.hpp>
+
+#include <complex>
+#include <vector>
+
+using namespace tlapack;
+
+namespace {
+
+using std::experimental::dextents;
+using std::experimental::layout_stride;
+
+template <typename T>
+using strided_matrix_t = mdspan<T, dextents<2>, layout_stride>;
+
+/// Strides of a nr-by-nc matrix of the given kind:
+///     - 0: column major with a padded leading dimension;
+///     - 1: row major with a padded leading dimension;
+///     - 2: no unit stride, which the optimized BLAS cannot represent.
+std::array<std::size_t, 2> strides(int kind, std::size_t nr, std::size_t nc)
+{
+    if (kind == 0)
+        return {1, nr + 2};
+    else if (kind == 1)
+        return {nc + 3, 1};
+    else
+        return {2, 2 * nr + 1};
+}
+
+/// Returns a nr-by-nc matrix of the given kind in the memory of buf
+template <typename T>
+strided_matrix_t<T> strided_matrix(std::vector<T> &buf, int kind, std::size_t nr, std::size_t nc)
+{
+    using mapping_t = layout_stride::mapping<dextents<2>>;
+    const auto s = strides(kind, nr, nc);
+    return strided_matrix_t<T>(&buf[0], mapping_t(dextents<2>(nr, nc), s));
+}
+
+/// Size of the memory of a nr-by-nc matrix of the given kind
+inline std::size_t buffer_size(int kind, std::size_t nr, std::size_t nc)
+{
+    const auto s = strides(kind, nr, nc);
+    return (nr - 1) * s[0] + (nc - 1) * s[1] + 1;
+}
+
+} // namespace
+
+TEMPLATE_TEST_CASE("gemm with strided mdspan matrices", "[mdspan][optBLAS]", float, double, std::complex<float>, std::complex<double>)
+{
+    srand(1);
+
+    using T = TestType;
+    using idx_t = std::size_t;
+    typedef real_type<T> real_t;
+
+    const idx_t m = 7, n = 5, k = 6;
+    const T alpha = rand_helper<T>();
+    const T beta = rand_helper<T>();
+    const real_t tol = real_t(1.0e2) * k * uroundoff<real_t>();
+
+    const int kindA = GENERATE(0, 1, 2);
+    const int kindB = GENERATE(0, 1, 2);
+    const int kindC = GENERATE(0, 1, 2);
+
+    // Send every call that the wrappers can forward to the optimized BLAS
+    const tuning_guard guard;
+    tuning().set("gemm", "optblas_nmin", '*', tuning_table::inf, 0);
+
+    DYNAMIC_SECTION("A is " << kindA << " B is " << kindB << " C is " << kindC)
+    {
+        std::vector<T> A_(buffer_size(kindA, m, k));
+        std::vector<T> B_(buffer_size(kindB, k, n));
+        std::vector<T> C_(buffer_size(kindC, m, n));
+        for (auto &x : A_)
+            x = rand_helper<T>();
+        for (auto &x : B_)
+            x = rand_helper<T>();
+        for (auto &x : C_)
+            x = rand_helper<T>();
+        std::vector<T> D_(C_);
+
+        const auto A = strided_matrix(A_, kindA, m, k);
+        const auto B = strided_matrix(B_, kindB, k, n);
+        auto C = strided_matrix(C_, kindC, m, n);
+        auto D = strided_matrix(D_, kindC, m, n);
+
+        // D = alpha A B + beta D, entry by entry
+        for (idx_t j = 0; j < n; ++j)
+            for (idx_t i = 0; i < m; ++i)
+            {
+                T s(0);
+                for (idx_t l = 0; l < k; ++l)
+                    s += A(i, l) * B(l, j);
+                D(i, j) = alpha * s + beta * D(i, j);
+            }
+
+        reset_optblas_counters();
+        gemm(Op::NoTrans, Op::NoTrans, alpha, A, B, beta, C);
+
+        // The entries of C_ that are not in C must not change
+        real_t err(0);
+        for (idx_t i = 0; i < C_.size(); ++i)
+            err = std::max(err, abs1(C_[i] - D_[i]));
+        CHECK(err <= tol);
+
+#ifdef USE_BLASPP_WRAPPERS
+        // Only matrices without a unit stride use the template BLAS
+        const bool forwarded = (kindA != 2) && (kindB != 2) && (kindC != 2);
+        CHECK(optblas_counters()[std::size_t(optblas_routine::gemm)].optblas_calls == (forwarded ? 1u : 0u));
+#endif
+    }
+}
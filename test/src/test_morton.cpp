@@ -0,0 +1,268 @@
+/// @file test_morton.cpp
+/// @brief Test the matrix in the recursive Z-order layout
+//
+// Copyright (c) 2022, University of Colorado Denver. All rights reserved.
+//
+// This file is part of <T>LAPACK.
+// <T>LAPACK is free software: you can redistribute it and/or modify it under
+// the terms of the BSD 3-Clause license. See the accompanying LICENSE file.
+
+#include <catch2/catch.hpp>
+#include <plugins/tlapack_stdvector.hpp>
+#include <plugins/tlapack_mortonArray.hpp>
+#include <tlapack.hpp>
+#include <testutils.hpp>
+#include <testdefinitions.hpp>
+
+using namespace tlapack;
+
+TEMPLATE_LIST_TEST_CASE("Morton matrices can be sliced and converted", "[morton]", types_to_test)
+{
+    srand(1);
+
+    using matrix_t = TestType;
+    using T = type_t<matrix_t>;
+    using idx_t = size_type<matrix_t>;
+    using pair = std::pair<idx_t, idx_t>;
+
+    const idx_t m = GENERATE(1, 7, 12, 33);
+    const idx_t n = GENERATE(1, 9, 20);
+    const idx_t mb = GENERATE(1, 3, 4);
+    const idx_t nb = GENERATE(2, 16);
+
+    std::vector<T> A_(m * n);
+    std::vector<T> B_(m * n);
+    std::vector<T> Am_(mortonMatrix<T>::storage_size(m, n, mb, nb));
+
+    auto A = legacyMatrix<T, layout<matrix_t>>(m, n, &A_[0], layout<matrix_t> == Layout::ColMajor ? m : n);
+    auto B = legacyMatrix<T, layout<matrix_t>>(m, n, &B_[0], layout<matrix_t> == Layout::ColMajor ? m : n);
+    auto Am = mortonMatrix<T>(m, n, mb, nb, &Am_[0]);
+
+    for (idx_t j = 0; j < n; ++j)
+        for (idx_t i = 0; i < m; ++i)
+            A(i, j) = rand_helper<T>();
+
+    DYNAMIC_SECTION("m = " << m << " n = " << n << " mb = " << mb << " nb = " << nb)
+    {
+        copy_to_morton(A, Am);
+        copy_from_morton(Am, B);
+        for (idx_t j = 0; j < n; ++j)
+            for (idx_t i = 0; i < m; ++i)
+            {
+                CHECK(Am(i, j) == A(i, j));
+                CHECK(B(i, j) == A(i, j));
+            }
+
+        // Each element is stored once
+        std::vector<int> count(m * n, 0);
+        for (idx_t j = 0; j < n; ++j)
+            for (idx_t i = 0; i < m; ++i)
+                ++count[&Am(i, j) - &Am_[0]];
+        for (idx_t k = 0; k < m * n; ++k)
+            CHECK(count[k] == 1);
+
+        // Halving the matrix as the recursive routines do reaches
+        // contiguous leaves
+        auto C = Am;
+        while (!C.is_leaf())
+        {
+            const idx_t m1 = (C.m > mb) ? C.m / 2 : C.m;
+            const idx_t n1 = (C.n > nb) ? C.n / 2 : C.n;
+            auto C11 = slice(C, pair{m1 % C.m, C.m}, pair{n1 % C.n, C.n});
+            REQUIRE(C11.i0 == 0);
+            REQUIRE(C11.j0 == 0);
+            REQUIRE(C11.M == nrows(C11));
+            REQUIRE(C11.N == ncols(C11));
+            C = C11;
+        }
+        auto Cl = leaf(C);
+        CHECK(Cl.ptr + Cl.m * Cl.n == &Am_[0] + m * n);
+        for (idx_t j = 0; j < ncols(C); ++j)
+            for (idx_t i = 0; i < nrows(C); ++i)
+                CHECK(Cl(i, j) == A(m - nrows(C) + i, n - ncols(C) + j));
+
+        // Slices of slices
+        const idx_t i0 = m / 3, j0 = n / 2;
+        auto S = slice(Am, pair{i0, m}, pair{j0, n});
+        auto S2 = slice(S, pair{m / 3, m - i0}, pair{0, n - j0});
+        for (idx_t j = 0; j < ncols(S2); ++j)
+            for (idx_t i = 0; i < nrows(S2); ++i)
+                CHECK(S2(i, j) == A(i0 + m / 3 + i, j0 + j));
+
+        auto d = diag(S, 0);
+        for (idx_t k = 0; k < size(d); ++k)
+            CHECK(d[k] == A(i0 + k, j0 + k));
+        auto r = slice(S, 0, pair{0, n - j0});
+        for (idx_t k = 0; k < size(r); ++k)
+            CHECK(r[k] == A(i0, j0 + k));
+        auto c = slice(S, pair{0, m - i0}, 0);
+        for (idx_t k = 0; k < size(c); ++k)
+            CHECK(c[k] == A(i0 + k, j0));
+
+        // Conversion of a slice
+        std::fill(B_.begin(), B_.end(), T(0));
+        auto B2 = slice(B, pair{i0, m}, pair{j0, n});
+        copy_from_morton(S, B2);
+        for (idx_t j = 0; j < ncols(S); ++j)
+            for (idx_t i = 0; i < nrows(S); ++i)
+                CHECK(B2(i, j) == S(i, j));
+    }
+}
+
+TEMPLATE_LIST_TEST_CASE("Recursive routines give the same result in the Morton layout", "[morton]", types_to_test)
+{
+    srand(1);
+
+    using matrix_t = TestType;
+    using T = type_t<matrix_t>;
+    using idx_t = size_type<matrix_t>;
+    typedef real_type<T> real_t;
+
+    const Uplo uplo = GENERATE(Uplo::Lower, Uplo::Upper);
+    const idx_t n = GENERATE(1, 10, 37);
+    const idx_t nb = GENERATE(4, 8);
+
+    const real_t tol = real_t(1.0e2) * n * uroundoff<real_t>();
+
+    std::vector<T> A_(n * n), B_(n * n), C_(n * n);
+    std::vector<T> Am_(mortonMatrix<T>::storage_size(n, n, nb, nb));
+    std::vector<T> Bm_(mortonMatrix<T>::storage_size(n, n, nb, nb));
+
+    auto A = legacyMatrix<T>(n, n, &A_[0], n);
+    auto B = legacyMatrix<T>(n, n, &B_[0], n);
+    auto C = legacyMatrix<T>(n, n, &C_[0], n);
+    auto Am = mortonMatrix<T>(n, n, nb, nb, &Am_[0]);
+    auto Bm = mortonMatrix<T>(n, n, nb, nb, &Bm_[0]);
+
+    for (idx_t j = 0; j < n; ++j)
+    {
+        for (idx_t i = 0; i < n; ++i)
+            A(i, j) = rand_helper<T>();
+        A(j, j) = T(real(A(j, j)) + n);
+    }
+    for (idx_t j = 0; j < n; ++j)
+        for (idx_t i = 0; i < j; ++i)
+            A(i, j) = conj(A(j, i));
+
+    DYNAMIC_SECTION("n = " << n << " nb = " << nb << " uplo = " << (uplo == Uplo::Upper ? "upper" : "lower"))
+    {
+        const real_t normA = lange(max_norm, A);
+
+        // potrf2
+        copy_to_morton(A, Am);
+        lacpy(Uplo::General, A, B);
+        REQUIRE(potrf2(uplo, Am) == 0);
+        REQUIRE(potrf2(uplo, B) == 0);
+        copy_from_morton(Am, C);
+        for (idx_t j = 0; j < n; ++j)
+            for (idx_t i = 0; i < n; ++i)
+                CHECK(abs1(C(i, j) - B(i, j)) <= tol * normA);
+
+        // lauum_recursive
+        lauum_opts_t<idx_t> opts;
+        opts.nx = 2;
+        lauum_recursive(uplo, Am, opts);
+        lauum_recursive(uplo, B, opts);
+        copy_from_morton(Am, C);
+        for (idx_t j = 0; j < n; ++j)
+            for (idx_t i = 0; i < n; ++i)
+                CHECK(abs1(C(i, j) - B(i, j)) <= tol * normA);
+
+        // conjtranspose
+        transpose_opts_t<idx_t> topts;
+        topts.nx = 2;
+        conjtranspose(Am, Bm, topts);
+        copy_from_morton(Bm, C);
+        for (idx_t j = 0; j < n; ++j)
+            for (idx_t i = 0; i < n; ++i)
+                CHECK(C(i, j) == conj(Am(j, i)));
+    }
+}
+
+TEMPLATE_LIST_TEST_CASE("Level 3 BLAS give the same result in the Morton layout", "[morton]", types_to_test)
+{
+    srand(1);
+
+    using matrix_t = TestType;
+    using T = type_t<matrix_t>;
+    using idx_t = size_type<matrix_t>;
+    using pair = std::pair<idx_t, idx_t>;
+    typedef real_type<T> real_t;
+
+    const Side side = GENERATE(Side::Left, Side::Right);
+    const Uplo uplo = GENERATE(Uplo::Lower, Uplo::Upper);
+    const Op trans = GENERATE(Op::NoTrans, Op::Trans, Op::ConjTrans);
+    const idx_t m = GENERATE(9, 21);
+    const idx_t n = 14;
+    const idx_t nb = 4;
+
+    const idx_t k = (side == Side::Left) ? m : n;
+    const real_t tol = real_t(1.0e2) * k * uroundoff<real_t>();
+
+    // A is a slice that does not start at a split of the layout
+    std::vector<T> A_(k * k), B_(m * n), C_(m * n);
+    std::vector<T> Am_(mortonMatrix<T>::storage_size(k + 1, k + 1, nb, nb));
+    std::vector<T> Bm_(mortonMatrix<T>::storage_size(m, n, nb, nb));
+
+    auto A = legacyMatrix<T>(k, k, &A_[0], k);
+    auto B = legacyMatrix<T>(m, n, &B_[0], m);
+    auto C = legacyMatrix<T>(m, n, &C_[0], m);
+    auto Am0 = mortonMatrix<T>(k + 1, k + 1, nb, nb, &Am_[0]);
+    auto Am = slice(Am0, pair{1, k + 1}, pair{1, k + 1});
+    auto Bm = mortonMatrix<T>(m, n, nb, nb, &Bm_[0]);
+
+    for (idx_t j = 0; j < k; ++j)
+    {
+        for (idx_t i = 0; i < k; ++i)
+            A(i, j) = rand_helper<T>();
+        A(j, j) = T(real(A(j, j)) + k);
+    }
+    for (auto &x : B_)
+        x = rand_helper<T>();
+
+    DYNAMIC_SECTION("m = " << m << " side = " << (side == Side::Left ? "left" : "right")
+                           << " uplo = " << (uplo == Uplo::Upper ? "upper" : "lower")
+                           << " trans = " << (trans == Op::NoTrans ? "N" : trans == Op::Trans ? "T" : "C"))
+    {
+        const real_t normB = lange(max_norm, B);
+        copy_to_morton(A, Am);
+
+        // trsm
+        copy_to_morton(B, Bm);
+        trsm(side, uplo, trans, Diag::NonUnit, T(2), Am, Bm);
+        lacpy(Uplo::General, B, C);
+        trsm(side, uplo, trans, Diag::NonUnit, T(2), A, C);
+        for (idx_t j = 0; j < n; ++j)
+            for (idx_t i = 0; i < m; ++i)
+                CHECK(abs1(Bm(i, j) - C(i, j)) <= tol * normB);
+
+        // trmm
+        copy_to_morton(B, Bm);
+        trmm(side, uplo, trans, Diag::Unit, T(2), Am, Bm);
+        lacpy(Uplo::General, B, C);
+        trmm(side, uplo, trans, Diag::Unit, T(2), A, C);
+        for (idx_t j = 0; j < n; ++j)
+            for (idx_t i = 0; i < m; ++i)
+                CHECK(abs1(Bm(i, j) - C(i, j)) <= tol * k * normB);
+
+        // gemm with op(A) on the side of trsm and trmm
+        copy_to_morton(B, Bm);
+        std::vector<T> Cm_(m * n);
+        auto Cm = mortonMatrix<T>(m, n, nb, nb, &Cm_[0]);
+        copy_to_morton(B, Cm);
+        lacpy(Uplo::General, B, C);
+        if (side == Side::Left)
+        {
+            gemm(trans, Op::NoTrans, T(2), Am, Bm, T(-1), Cm);
+            gemm(trans, Op::NoTrans, T(2), A, B, T(-1), C);
+        }
+        else
+        {
+            gemm(Op::NoTrans, trans, T(2), Bm, Am, T(-1), Cm);
+            gemm(Op::NoTrans, trans, T(2), B, A, T(-1), C);
+        }
+        for (idx_t j = 0; j < n; ++j)
+            for (idx_t i = 0; i < m; ++i)
+                CHECK(abs1(Cm(i, j) - C(i, j)) <= tol * k * normB);
+    }
+}
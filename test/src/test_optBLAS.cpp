@@ -8,9 +8,11 @@
 // the terms of the BSD 3-Clause license. See the accompanying LICENSE file.
 
 #include <catch2/catch.hpp>
+#include <testutils.hpp>
 #include <testdefinitions.hpp>
 
 #include <complex>
+#include <sstream>
 
 using namespace tlapack;
 
@@ -40,6 +42,48 @@ TEST_CASE("has_compatible_layout gives the correct result", "[optBLAS]")
     CHECK( has_compatible_layout< matrixB_t, matrixB_t, matrixB_t > );
 }
 
+TEST_CASE("allow_optblas_mixed_v accepts different layouts", "[optBLAS]")
+{
+    using matrixA_t = legacyMatrix< double, Layout::ColMajor >;
+    using matrixB_t = legacyMatrix< double, Layout::RowMajor >;
+    using matrixC_t = legacyMatrix< long double, Layout::ColMajor >;
+
+    CHECK( allow_optblas_mixed_v< pair< matrixA_t, double >, pair< matrixB_t, double > > == allow_optblas_v<double> );
+    CHECK( allow_optblas_mixed_v< pair< matrixA_t, double >, pair< matrixA_t, double > >
+        == allow_optblas_v< pair< matrixA_t, double >, pair< matrixA_t, double > > );
+    CHECK(!allow_optblas_v< pair< matrixA_t, double >, pair< matrixB_t, double > > );
+    CHECK(!allow_optblas_mixed_v< pair< matrixA_t, double >, pair< matrixC_t, double > > );
+}
+
+TEST_CASE("legacyStridedMatrix finds the layout at run time", "[optBLAS]")
+{
+    using matrix_t = legacyStridedMatrix< float >;
+    float A[64];
+
+    // Unit stride between the rows
+    matrix_t A1( 4, 3, A, 1, 5 );
+    CHECK( A1.layout == Layout::ColMajor );
+    CHECK( A1.ldim == 5 );
+
+    // Unit stride between the columns
+    matrix_t A2( 4, 3, A, 7, 1 );
+    CHECK( A2.layout == Layout::RowMajor );
+    CHECK( A2.ldim == 7 );
+
+    // A single row or column has any stride in the other direction
+    matrix_t A3( 1, 6, A, 0, 2 );
+    CHECK( A3.layout == Layout::ColMajor );
+    CHECK( A3.ldim == 2 );
+    matrix_t A4( 6, 1, A, 2, 0 );
+    CHECK( A4.layout == Layout::RowMajor );
+    CHECK( A4.ldim == 2 );
+
+    // Strides the BLAS cannot represent
+    CHECK( matrix_t( 4, 3, A, 2, 10 ).layout == Layout::Unspecified );
+    CHECK( matrix_t( 4, 3, A, 1, 2 ).layout == Layout::Unspecified );
+    CHECK( matrix_t( 4, 3, A, 1, -4 ).layout == Layout::Unspecified );
+}
+
 TEST_CASE("allow_optblas_v does not allow bool, int, long int, char", "[optBLAS]")
 {
     CHECK(!allow_optblas_v<bool> );
@@ -80,4 +124,164 @@ TEMPLATE_LIST_TEST_CASE("allow_optblas_v gives the correct result", "[optBLAS]",
     
     // Test pair< matrix_t, T > and pair< matrix_t, T >
     CHECK( allow_optblas_v< pair< matrix_t, T >, pair< matrix_t, T > > == allow_optblas_v<T> );
-}
\ No newline at end of file
+}
+
+TEST_CASE("Small problems are dispatched to the template BLAS", "[optBLAS]")
+{
+    const tuning_guard guard;
+    tuning().clear();
+    reset_optblas_counters();
+
+    CHECK( optblas_nmin<double>("gemm") == optblas_nmin_default );
+    CHECK( internal::use_template_blas<double>( optblas_routine::gemm, 4 ) );
+    CHECK(!internal::use_template_blas<double>( optblas_routine::gemm, optblas_nmin_default ) );
+
+    // The threshold of the tuning table is per routine and type
+    tuning().set( "gemm", "optblas_nmin", 'd', tuning_table::inf, 32 );
+    tuning().set( "trsm", "optblas_nmin", '*', tuning_table::inf, 0 );
+    CHECK( internal::use_template_blas<double>( optblas_routine::gemm, 20 ) );
+    CHECK(!internal::use_template_blas<float>( optblas_routine::gemm, 20 ) );
+    CHECK(!internal::use_template_blas<double>( optblas_routine::trsm, 1 ) );
+
+    const auto& gemm_counter = optblas_counters()[ std::size_t(optblas_routine::gemm) ];
+    const auto& trsm_counter = optblas_counters()[ std::size_t(optblas_routine::trsm) ];
+    CHECK( gemm_counter.template_calls == 2 );
+    CHECK( gemm_counter.optblas_calls == 2 );
+    CHECK( trsm_counter.template_calls == 0 );
+    CHECK( trsm_counter.optblas_calls == 1 );
+
+    std::ostringstream out;
+    print_optblas_counters( out );
+    CHECK( out.str().find("gemm") != std::string::npos );
+    CHECK( out.str().find("gemv") == std::string::npos );
+
+    reset_optblas_counters();
+    CHECK( gemm_counter.template_calls == 0 );
+}
+
+TEMPLATE_LIST_TEST_CASE("Mixed-layout calls give the same result as the template BLAS", "[optBLAS]", types_to_test)
+{
+    srand(1);
+
+    using matrix_t = TestType;
+    using T = type_t<matrix_t>;
+    using idx_t = size_type<matrix_t>;
+    typedef real_type<T> real_t;
+
+    // The output has the layout of matrix_t and A has the other one
+    constexpr Layout L = layout<matrix_t>;
+    constexpr Layout L2 = (L == Layout::ColMajor) ? Layout::RowMajor : Layout::ColMajor;
+    using other_t = legacyMatrix<T, L2>;
+
+    const idx_t m = 5, n = 4, k = 3;
+    const T alpha = rand_helper<T>();
+    const T beta = rand_helper<T>();
+    const real_t tol = real_t(1.0e2) * (m + n + k) * uroundoff<real_t>();
+
+    // Send every call that the wrappers can forward to the optimized BLAS
+    const tuning_guard guard;
+    for (const char *routine : {"gemm", "trmm", "trsm"})
+        tuning().set(routine, "optblas_nmin", '*', tuning_table::inf, 0);
+
+    const auto ld = [](Layout layout, idx_t nr, idx_t nc) { return (layout == Layout::ColMajor) ? nr : nc; };
+    const auto fill = [](auto &M) {
+        for (idx_t j = 0; j < ncols(M); ++j)
+            for (idx_t i = 0; i < nrows(M); ++i)
+                M(i, j) = rand_helper<T>();
+    };
+    const auto max_diff = [](const matrix_t &X, const matrix_t &Y) {
+        real_t d(0);
+        for (idx_t j = 0; j < ncols(X); ++j)
+            for (idx_t i = 0; i < nrows(X); ++i)
+                d = std::max(d, abs1(X(i, j) - Y(i, j)));
+        return d;
+    };
+
+    const Op trans = GENERATE(Op::NoTrans, Op::Trans, Op::ConjTrans);
+
+#ifdef USE_BLASPP_WRAPPERS
+    // Op::ConjTrans of an operand in the other layout has no equivalent in
+    // the optimized BLAS if T is complex
+    const bool forwarded = (trans != Op::ConjTrans) || !is_complex<T>::value;
+#endif
+
+    DYNAMIC_SECTION("trans = " << (trans == Op::NoTrans ? "N" : trans == Op::Trans ? "T" : "C"))
+    {
+        // gemm with A and B in the other layout
+        for (const Op transB : {Op::NoTrans, Op::Trans, Op::ConjTrans})
+        {
+            const idx_t am = (trans == Op::NoTrans) ? m : k, an = (trans == Op::NoTrans) ? k : m;
+            const idx_t bm = (transB == Op::NoTrans) ? k : n, bn = (transB == Op::NoTrans) ? n : k;
+            std::vector<T> A_(am * an), B_(bm * bn), C_(m * n), D_(m * n);
+            other_t A(am, an, &A_[0], ld(L2, am, an));
+            other_t B(bm, bn, &B_[0], ld(L2, bm, bn));
+            matrix_t C(m, n, &C_[0], ld(L, m, n));
+            matrix_t D(m, n, &D_[0], ld(L, m, n));
+            fill(A);
+            fill(B);
+            fill(C);
+            D_ = C_;
+
+            reset_optblas_counters();
+            gemm(trans, transB, alpha, A, B, beta, C);
+            internal::gemm_template(trans, transB, alpha, A, B, beta, D);
+            CHECK(max_diff(C, D) <= tol);
+#ifdef USE_BLASPP_WRAPPERS
+            const bool fwd = forwarded && ((transB != Op::ConjTrans) || !is_complex<T>::value);
+            CHECK(optblas_counters()[std::size_t(optblas_routine::gemm)].optblas_calls == (fwd ? 1u : 0u));
+#endif
+        }
+
+        // trmm and trsm with A in the other layout
+        for (const Side side : {Side::Left, Side::Right})
+            for (const Uplo uplo : {Uplo::Lower, Uplo::Upper})
+                for (const Diag diag : {Diag::NonUnit, Diag::Unit})
+                {
+                    const idx_t p = (side == Side::Left) ? m : n;
+                    std::vector<T> A_(p * p), B_(m * n), C_(m * n);
+                    other_t A(p, p, &A_[0], p);
+                    matrix_t B(m, n, &B_[0], ld(L, m, n));
+                    matrix_t C(m, n, &C_[0], ld(L, m, n));
+                    fill(A);
+                    for (idx_t i = 0; i < p; ++i)
+                        A(i, i) += T(p);
+
+                    fill(B);
+                    C_ = B_;
+                    reset_optblas_counters();
+                    trmm(side, uplo, trans, diag, alpha, A, B);
+                    internal::trmm_template(side, uplo, trans, diag, alpha, A, C);
+                    CHECK(max_diff(B, C) <= tol);
+
+                    fill(B);
+                    C_ = B_;
+                    trsm(side, uplo, trans, diag, alpha, A, B);
+                    internal::trsm_template(side, uplo, trans, diag, alpha, A, C);
+                    CHECK(max_diff(B, C) <= tol);
+#ifdef USE_BLASPP_WRAPPERS
+                    CHECK(optblas_counters()[std::size_t(optblas_routine::trmm)].optblas_calls == (forwarded ? 1u : 0u));
+                    CHECK(optblas_counters()[std::size_t(optblas_routine::trsm)].optblas_calls == (forwarded ? 1u : 0u));
+#endif
+                }
+
+        // syrk with A in the other layout. It does not accept Op::ConjTrans
+        if (trans != Op::ConjTrans)
+            for (const Uplo uplo : {Uplo::Lower, Uplo::Upper})
+            {
+                const idx_t am = (trans == Op::NoTrans) ? n : k, an = (trans == Op::NoTrans) ? k : n;
+                std::vector<T> A_(am * an), C_(n * n), D_(n * n);
+                other_t A(am, an, &A_[0], ld(L2, am, an));
+                matrix_t C(n, n, &C_[0], n);
+                matrix_t D(n, n, &D_[0], n);
+                fill(A);
+                fill(C);
+                D_ = C_;
+
+                syrk(uplo, trans, alpha, A, beta, C);
+                internal::syrk_template(uplo, trans, alpha, A, beta, D);
+                CHECK(max_diff(C, D) <= tol);
+            }
+    }
+
+    reset_optblas_counters();
+}
@@ -0,0 +1,44 @@
+/// @file test_potrf.cpp
+/// @brief Test the Cholesky factorization
+//
+// Copyright (c) 2022, University of Colorado Denver. All rights reserved.
+//
+// This file is part of <T>LAPACK.
+// <T>LAPACK is free software: you can redistribute it and/or modify it under
+// the terms of the BSD 3-Clause license. See the accompanying LICENSE file.
+
+#include <catch2/catch.hpp>
+#include <plugins/tlapack_stdvector.hpp>
+#include <tlapack.hpp>
+#include <testutils.hpp>
+#include <testdefinitions.hpp>
+
+using namespace tlapack;
+
+TEMPLATE_LIST_TEST_CASE("POTRF reports a matrix that is not positive definite", "[potrf]", types_to_test)
+{
+    using matrix_t = TestType;
+    using T = type_t<matrix_t>;
+    using idx_t = size_type<matrix_t>;
+
+    const Uplo uplo = GENERATE(Uplo::Lower, Uplo::Upper);
+    const idx_t n = 10;
+    const idx_t k = GENERATE(0, 3, 4, 9);
+    const idx_t nb = GENERATE(1, 3, 4, 32);
+
+    std::unique_ptr<T[]> A_(new T[n * n]);
+    auto A = legacyMatrix<T, layout<matrix_t>>(n, n, &A_[0], n);
+
+    // Identity with a negative entry at A(k,k), so that the leading minor
+    // of order k+1 is the first one that is not positive definite
+    laset(Uplo::General, T(0), T(1), A);
+    A(k, k) = T(-1);
+
+    DYNAMIC_SECTION("k = " << k << " nb = " << nb
+                           << " uplo = " << (uplo == Uplo::Upper ? "upper" : "lower"))
+    {
+        potrf_opts_t<idx_t> opts;
+        opts.nb = nb;
+        CHECK(potrf(uplo, A, opts, noErrorCheck) == int(k + 1));
+    }
+}
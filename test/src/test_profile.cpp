@@ -0,0 +1,105 @@
+/// @file test_profile.cpp
+/// @brief Test the per-routine profiling of <T>LAPACK
+//
+// Copyright (c) 2022, University of Colorado Denver. All rights reserved.
+//
+// This file is part of <T>LAPACK.
+// <T>LAPACK is free software: you can redistribute it and/or modify it under
+// the terms of the BSD 3-Clause license. See the accompanying LICENSE file.
+
+#include <catch2/catch.hpp>
+#include <plugins/tlapack_stdvector.hpp>
+#include <tlapack.hpp>
+#include <testutils.hpp>
+#include <testdefinitions.hpp>
+
+#include <sstream>
+#include <thread>
+
+using namespace tlapack;
+
+/// Returns the statistics of the given routine, or an empty entry
+inline profile_entry find_profile(const std::string &name)
+{
+    for (const auto &e : profile_report())
+        if (e.name == name)
+            return e;
+    return profile_entry();
+}
+
+TEMPLATE_LIST_TEST_CASE("Profile of a blocked Cholesky factorization", "[utils][profile]", types_to_test)
+{
+    using matrix_t = TestType;
+    using T = type_t<matrix_t>;
+    using idx_t = size_type<matrix_t>;
+    using real_t = real_type<T>;
+
+    rand_generator gen;
+
+    const idx_t n = 40;
+    const idx_t nb = 8;
+    std::unique_ptr<T[]> A_(new T[n * n]);
+    auto A = legacyMatrix<T, layout<matrix_t>>(n, n, &A_[0], n);
+
+    for (idx_t j = 0; j < n; ++j)
+        for (idx_t i = 0; i < n; ++i)
+            A(i, j) = rand_helper<T>(gen);
+    for (idx_t i = 0; i < n; ++i)
+        A(i, i) = real_t(2 * n);
+
+    potrf_opts_t<idx_t> opts;
+    opts.nb = nb;
+
+    reset_profile();
+    int info = potrf(Uplo::Lower, A, opts);
+    REQUIRE(info == 0);
+
+#ifdef TLAPACK_PROFILE
+    const profile_entry potrf_entry = find_profile("potrf");
+    CHECK(potrf_entry.calls == 1);
+    CHECK(potrf_entry.max_depth == 0);
+    CHECK(potrf_entry.flops > 0);
+    CHECK(potrf_entry.self_time <= potrf_entry.time);
+
+    // One herk and one potrf2 per block column, called from potrf
+    for (const char *name : {"herk", "potrf2"})
+    {
+        const profile_entry e = find_profile(name);
+        CHECK(e.calls >= n / nb);
+        CHECK(e.max_depth >= 1);
+    }
+
+    // Nested calls are not counted in the self time of potrf
+    CHECK(potrf_entry.time >= find_profile("herk").time + find_profile("gemm").time);
+
+    // The statistics are cleared but the routines are still listed
+    reset_profile();
+    CHECK(profile_report().empty());
+#else
+    CHECK(profile_report().empty());
+#endif
+
+    std::ostringstream out;
+    print_profile(out);
+    CHECK(out.str().find("routine") != std::string::npos);
+}
+
+#ifdef TLAPACK_PROFILE
+TEST_CASE("Profile merges the statistics of all threads", "[utils][profile]")
+{
+    using T = double;
+
+    std::vector<T> x(100, T(1));
+    std::vector<T> y(100, T(2));
+
+    reset_profile();
+    std::thread t([&]() { axpy(T(1), x, y); });
+    t.join();
+    axpy(T(1), x, y);
+
+    const profile_entry e = find_profile("axpy");
+    CHECK(e.calls == 2);
+    CHECK(e.flops == 2 * 2 * 100);
+    CHECK(e.bytes == 2 * 3 * 100 * sizeof(T));
+}
+#endif
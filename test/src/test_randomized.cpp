@@ -0,0 +1,180 @@
+/// @file test_randomized.cpp
+/// @brief Test the randomized low-rank approximations
+//
+// Copyright (c) 2022, University of Colorado Denver. All rights reserved.
+//
+// This file is part of <T>LAPACK.
+// <T>LAPACK is free software: you can redistribute it and/or modify it under
+// the terms of the BSD 3-Clause license. See the accompanying LICENSE file.
+
+#include <catch2/catch.hpp>
+#include <plugins/tlapack_stdvector.hpp>
+#include <tlapack.hpp>
+#include <testutils.hpp>
+#include <testdefinitions.hpp>
+
+using namespace tlapack;
+
+TEMPLATE_LIST_TEST_CASE("Randomized SVD recovers low-rank matrices", "[svd][randomized_svd]", types_to_test)
+{
+    srand(1);
+
+    using matrix_t = TestType;
+    using T = type_t<matrix_t>;
+    using idx_t = size_type<matrix_t>;
+    using real_t = real_type<T>;
+
+    const idx_t m = GENERATE(40, 100);
+    const idx_t n = GENERATE(30, 120);
+    const idx_t r = GENERATE(1, 5);
+    const idx_t n_power_iter = GENERATE(0, 2);
+    const bool parallel = GENERATE(false, true);
+
+    rand_generator gen;
+    const real_t eps = uroundoff<real_t>();
+    const real_t tol = std::max(m, n) * 1.0e2 * eps;
+
+    // Define the matrices and vectors
+    std::unique_ptr<T[]> A_(new T[m * n]);
+    std::unique_ptr<T[]> X_(new T[m * r]);
+    std::unique_ptr<T[]> Y_(new T[r * n]);
+    std::unique_ptr<T[]> U_(new T[m * r]);
+    std::unique_ptr<T[]> VT_(new T[r * n]);
+    std::unique_ptr<T[]> res_(new T[r * r]);
+
+    auto A = legacyMatrix<T, layout<matrix_t>>(m, n, &A_[0], layout<matrix_t> == Layout::ColMajor ? m : n);
+    auto X = legacyMatrix<T, layout<matrix_t>>(m, r, &X_[0], layout<matrix_t> == Layout::ColMajor ? m : r);
+    auto Y = legacyMatrix<T, layout<matrix_t>>(r, n, &Y_[0], layout<matrix_t> == Layout::ColMajor ? r : n);
+    auto U = legacyMatrix<T, layout<matrix_t>>(m, r, &U_[0], layout<matrix_t> == Layout::ColMajor ? m : r);
+    auto VT = legacyMatrix<T, layout<matrix_t>>(r, n, &VT_[0], layout<matrix_t> == Layout::ColMajor ? r : n);
+    auto res = legacyMatrix<T, layout<matrix_t>>(r, r, &res_[0], r);
+    std::vector<real_t> s(r), s2(r);
+
+    // A = X Y has rank r
+    for (idx_t j = 0; j < r; ++j)
+        for (idx_t i = 0; i < m; ++i)
+            X(i, j) = rand_helper<T>(gen);
+    for (idx_t j = 0; j < n; ++j)
+        for (idx_t i = 0; i < r; ++i)
+            Y(i, j) = rand_helper<T>(gen);
+    gemm(Op::NoTrans, Op::NoTrans, T(1), X, Y, T(0), A);
+
+    DYNAMIC_SECTION("Randomized SVD with"
+                    << " m = " << m << " n = " << n << " r = " << r
+                    << " n_power_iter = " << n_power_iter << " parallel = " << parallel)
+    {
+        randomized_svd_opts_t<idx_t, T> opts;
+        opts.oversampling = 5;
+        opts.n_power_iter = n_power_iter;
+        opts.parallel = parallel;
+        opts.nb = 3;
+
+        int iseed = 42;
+        int info = randomized_svd(true, true, A, s, U, VT, iseed, opts);
+        REQUIRE(info == 0);
+        CHECK(iseed == 42 + int(std::min(r + 5, std::min(m, n))));
+
+        for (idx_t i = 0; i + 1 < r; ++i)
+            CHECK(s[i] >= s[i + 1]);
+
+        CHECK(check_orthogonality(U, res) <= tol);
+        CHECK(check_orthogonality(VT, res) <= tol);
+
+        // A - U diag(s) VT = 0
+        for (idx_t j = 0; j < r; ++j)
+        {
+            auto uj = col(U, j);
+            scal(s[j], uj);
+        }
+        const real_t normA = lange(frob_norm, A);
+        gemm(Op::NoTrans, Op::NoTrans, T(-1), U, VT, T(1), A);
+        CHECK(lange(frob_norm, A) <= tol * normA);
+
+        // The same seed gives the same singular values
+        gemm(Op::NoTrans, Op::NoTrans, T(1), X, Y, T(0), A);
+        iseed = 42;
+        info = randomized_svd(false, false, A, s2, U, VT, iseed, opts);
+        REQUIRE(info == 0);
+        for (idx_t i = 0; i < r; ++i)
+            CHECK(abs(s[i] - s2[i]) <= tol * normA);
+    }
+}
+
+TEMPLATE_LIST_TEST_CASE("Randomized eigensolver recovers low-rank matrices", "[eigenvalues][randomized_heev]", types_to_test)
+{
+    srand(1);
+
+    using matrix_t = TestType;
+    using T = type_t<matrix_t>;
+    using idx_t = size_type<matrix_t>;
+    using real_t = real_type<T>;
+
+    const idx_t n = GENERATE(40, 100);
+    const idx_t r = GENERATE(1, 5);
+    const bool parallel = GENERATE(false, true);
+
+    rand_generator gen;
+    const real_t eps = uroundoff<real_t>();
+    const real_t tol = n * 1.0e2 * eps;
+
+    // Define the matrices and vectors
+    std::unique_ptr<T[]> A_(new T[n * n]);
+    std::unique_ptr<T[]> X_(new T[n * r]);
+    std::unique_ptr<T[]> Z_(new T[n * r]);
+    std::unique_ptr<T[]> W_(new T[n * r]);
+    std::unique_ptr<T[]> res_(new T[r * r]);
+
+    auto A = legacyMatrix<T, layout<matrix_t>>(n, n, &A_[0], n);
+    auto X = legacyMatrix<T, layout<matrix_t>>(n, r, &X_[0], layout<matrix_t> == Layout::ColMajor ? n : r);
+    auto Z = legacyMatrix<T, layout<matrix_t>>(n, r, &Z_[0], layout<matrix_t> == Layout::ColMajor ? n : r);
+    auto W = legacyMatrix<T, layout<matrix_t>>(n, r, &W_[0], layout<matrix_t> == Layout::ColMajor ? n : r);
+    auto res = legacyMatrix<T, layout<matrix_t>>(r, r, &res_[0], r);
+    std::vector<real_t> w(r);
+
+    // A = X D X^H has rank r, with eigenvalues of both signs
+    for (idx_t j = 0; j < r; ++j)
+        for (idx_t i = 0; i < n; ++i)
+            X(i, j) = rand_helper<T>(gen);
+    lacpy(Uplo::General, X, W);
+    for (idx_t j = 0; j < r; ++j)
+    {
+        auto wj = col(W, j);
+        scal(real_t((j % 2 == 0) ? 1 : -2), wj);
+    }
+    gemm(Op::NoTrans, Op::ConjTrans, T(1), W, X, T(0), A);
+    for (idx_t j = 0; j < n; ++j)
+    {
+        A(j, j) = real(A(j, j));
+        for (idx_t i = j + 1; i < n; ++i)
+            A(i, j) = conj(A(j, i));
+    }
+
+    DYNAMIC_SECTION("Randomized HEEV with"
+                    << " n = " << n << " r = " << r << " parallel = " << parallel)
+    {
+        randomized_heev_opts_t<idx_t, T> opts;
+        opts.oversampling = 5;
+        opts.parallel = parallel;
+        opts.nb = 3;
+
+        int iseed = 7;
+        int info = randomized_heev(true, A, w, Z, iseed, opts);
+        REQUIRE(info == 0);
+
+        for (idx_t i = 0; i + 1 < r; ++i)
+            CHECK(w[i] <= w[i + 1]);
+
+        CHECK(check_orthogonality(Z, res) <= tol);
+
+        // A Z = Z diag(w)
+        const real_t normA = lange(frob_norm, A);
+        lacpy(Uplo::General, Z, W);
+        for (idx_t j = 0; j < r; ++j)
+        {
+            auto wj = col(W, j);
+            scal(w[j], wj);
+        }
+        gemm(Op::NoTrans, Op::NoTrans, T(1), A, Z, T(-1), W);
+        CHECK(lange(frob_norm, W) <= tol * normA);
+    }
+}
@@ -0,0 +1,206 @@
+/// @file test_rfp.cpp
+/// @brief Test the matrix in the rectangular full packed format
+//
+// Copyright (c) 2022, University of Colorado Denver. All rights reserved.
+//
+// This file is part of <T>LAPACK.
+// <T>LAPACK is free software: you can redistribute it and/or modify it under
+// the terms of the BSD 3-Clause license. See the accompanying LICENSE file.
+
+#include <catch2/catch.hpp>
+#include <plugins/tlapack_stdvector.hpp>
+#include <plugins/tlapack_rfpArray.hpp>
+#include <tlapack.hpp>
+#include <testutils.hpp>
+#include <testdefinitions.hpp>
+
+using namespace tlapack;
+
+TEMPLATE_LIST_TEST_CASE("RFP matrices can be converted", "[rfp]", types_to_test)
+{
+    srand(1);
+
+    using matrix_t = TestType;
+    using T = type_t<matrix_t>;
+    using idx_t = size_type<matrix_t>;
+
+    const Uplo uplo = GENERATE(Uplo::Lower, Uplo::Upper);
+    const idx_t n = GENERATE(1, 2, 5, 8);
+
+    std::vector<T> A_(n * n);
+    std::vector<T> B_(n * n, T(0));
+    std::vector<T> Ar_(rfpMatrix<T>::storage_size(n));
+
+    auto A = legacyMatrix<T, layout<matrix_t>>(n, n, &A_[0], n);
+    auto B = legacyMatrix<T, layout<matrix_t>>(n, n, &B_[0], n);
+    auto Ar = rfpMatrix<T>(n, uplo, &Ar_[0]);
+
+    for (idx_t j = 0; j < n; ++j)
+        for (idx_t i = 0; i < n; ++i)
+            A(i, j) = rand_helper<T>();
+
+    DYNAMIC_SECTION("n = " << n << " uplo = " << (uplo == Uplo::Upper ? "upper" : "lower"))
+    {
+        copy_to_rfp(A, Ar);
+        copy_from_rfp(Ar, B);
+        for (idx_t j = 0; j < n; ++j)
+            for (idx_t i = 0; i < n; ++i)
+            {
+                if ((uplo == Uplo::Upper) ? (i <= j) : (i >= j))
+                    CHECK(B(i, j) == A(i, j));
+                else
+                    CHECK(B(i, j) == T(0));
+            }
+
+        // Each element of the storage is used once
+        const idx_t n1 = Ar.n1();
+        std::vector<int> count(Ar_.size(), 0);
+        for (idx_t j = 0; j < n; ++j)
+            for (idx_t i = 0; i < n; ++i)
+            {
+                const bool stored = (uplo == Uplo::Lower)
+                                        ? ((j < n1) ? (i >= j) : (i >= n1 && i <= j))
+                                        : ((j >= n1) ? (i <= j) : (i >= j && i < n1));
+                if (stored)
+                    ++count[&Ar(i, j) - &Ar_[0]];
+            }
+        for (std::size_t k = 0; k < count.size(); ++k)
+            CHECK(count[k] == 1);
+        CHECK(access_granted(read_policy(Ar), write_policy(Ar)));
+        CHECK(access_denied(uplo, write_policy(Ar)));
+        CHECK(access_denied(dense, write_policy(Ar)));
+
+        // The blocks of the storage
+        auto T1 = rfp_triangle1(Ar);
+        auto T2 = rfp_triangle2(Ar);
+        auto S = rfp_square(Ar);
+        for (idx_t j = 0; j < n1; ++j)
+            for (idx_t i = j; i < n1; ++i)
+                CHECK(T1(i, j) == ((uplo == Uplo::Lower || i == j) ? A(i, j) : conj(A(j, i))));
+        for (idx_t j = 0; j < n - n1; ++j)
+            for (idx_t i = 0; i <= j; ++i)
+                CHECK(T2(i, j) == ((uplo == Uplo::Upper || i == j) ? A(n1 + i, n1 + j) : conj(A(n1 + j, n1 + i))));
+        for (idx_t j = 0; j < ncols(S); ++j)
+            for (idx_t i = 0; i < nrows(S); ++i)
+                CHECK(S(i, j) == ((uplo == Uplo::Lower) ? A(n1 + i, j) : A(i, n1 + j)));
+    }
+}
+
+TEMPLATE_LIST_TEST_CASE("Routines give the same result in the RFP format", "[rfp]", types_to_test)
+{
+    srand(1);
+
+    using matrix_t = TestType;
+    using T = type_t<matrix_t>;
+    using idx_t = size_type<matrix_t>;
+    typedef real_type<T> real_t;
+
+    const Uplo uplo = GENERATE(Uplo::Lower, Uplo::Upper);
+    const idx_t n = GENERATE(1, 2, 10, 37);
+    const idx_t nrhs = 3;
+
+    const real_t tol = real_t(1.0e2) * n * uroundoff<real_t>();
+
+    std::vector<T> A_(n * n), B_(n * n), C_(n * n);
+    std::vector<T> X_(n * nrhs), Y_(n * nrhs);
+    std::vector<T> Ar_(rfpMatrix<T>::storage_size(n));
+
+    auto A = legacyMatrix<T>(n, n, &A_[0], n);
+    auto B = legacyMatrix<T>(n, n, &B_[0], n);
+    auto C = legacyMatrix<T>(n, n, &C_[0], n);
+    auto X = legacyMatrix<T>(n, nrhs, &X_[0], n);
+    auto Y = legacyMatrix<T>(n, nrhs, &Y_[0], n);
+    auto Ar = rfpMatrix<T>(n, uplo, &Ar_[0]);
+
+    for (idx_t j = 0; j < n; ++j)
+    {
+        for (idx_t i = 0; i < n; ++i)
+            A(i, j) = rand_helper<T>();
+        A(j, j) = T(real(A(j, j)) + n);
+    }
+    for (idx_t j = 0; j < n; ++j)
+        for (idx_t i = 0; i < j; ++i)
+            A(i, j) = conj(A(j, i));
+    for (auto &x : X_)
+        x = rand_helper<T>();
+
+    const auto check_same = [&]()
+    {
+        copy_from_rfp(Ar, C);
+        for (idx_t j = 0; j < n; ++j)
+            for (idx_t i = 0; i < n; ++i)
+                if ((uplo == Uplo::Upper) ? (i <= j) : (i >= j))
+                    CHECK(abs1(C(i, j) - B(i, j)) <= tol * n);
+    };
+
+    DYNAMIC_SECTION("n = " << n << " uplo = " << (uplo == Uplo::Upper ? "upper" : "lower"))
+    {
+        // potrf
+        copy_to_rfp(A, Ar);
+        lacpy(Uplo::General, A, B);
+        REQUIRE(potrf(uplo, Ar) == 0);
+        REQUIRE(potrf(uplo, B) == 0);
+        check_same();
+
+        // potrs
+        lacpy(Uplo::General, X, Y);
+        potrs(uplo, Ar, X);
+        potrs(uplo, B, Y);
+        for (idx_t j = 0; j < nrhs; ++j)
+            for (idx_t i = 0; i < n; ++i)
+                CHECK(abs1(X(i, j) - Y(i, j)) <= tol * n);
+
+        // trtri
+        trtri_opts_t<idx_t> topts;
+        topts.nx = 4;
+        REQUIRE(trtri_recursive(uplo, Diag::NonUnit, Ar, topts) == 0);
+        REQUIRE(trtri_recursive(uplo, Diag::NonUnit, B, topts) == 0);
+        check_same();
+
+        // lauum_recursive, which gives the inverse of A with trtri
+        lauum_opts_t<idx_t> lopts;
+        lopts.nx = 4;
+        lauum_recursive(uplo, Ar, lopts);
+        lauum_recursive(uplo, B, lopts);
+        check_same();
+
+        // Unit triangular matrices
+        copy_to_rfp(A, Ar);
+        lacpy(Uplo::General, A, B);
+        trtri_recursive(uplo, Diag::Unit, Ar, topts);
+        trtri_recursive(uplo, Diag::Unit, B, topts);
+        for (idx_t j = 0; j < n; ++j)
+            B(j, j) = A(j, j);
+        check_same();
+    }
+}
+
+TEMPLATE_LIST_TEST_CASE("Singular triangular RFP matrices are reported", "[rfp][trtri]", types_to_test)
+{
+    using matrix_t = TestType;
+    using T = type_t<matrix_t>;
+    using idx_t = size_type<matrix_t>;
+
+    const Uplo uplo = GENERATE(Uplo::Lower, Uplo::Upper);
+    const idx_t n = 7;
+    const idx_t k = GENERATE(0, 2, 3, 6);
+
+    std::vector<T> A_(n * n, T(0));
+    std::vector<T> Ar_(rfpMatrix<T>::storage_size(n));
+
+    auto A = legacyMatrix<T, layout<matrix_t>>(n, n, &A_[0], n);
+    auto Ar = rfpMatrix<T>(n, uplo, &Ar_[0]);
+
+    // Identity with a zero at A(k,k), which lies in T1 or T2 depending on k
+    for (idx_t j = 0; j < n; ++j)
+        A(j, j) = T(1);
+    A(k, k) = T(0);
+    copy_to_rfp(A, Ar);
+    const std::vector<T> Ar0 = Ar_;
+
+    DYNAMIC_SECTION("k = " << k << " uplo = " << (uplo == Uplo::Upper ? "upper" : "lower"))
+    {
+        CHECK(trtri_recursive(uplo, Diag::NonUnit, Ar, trtri_opts_t<idx_t>{}, noErrorCheck) == int(k + 1));
+        CHECK(Ar_ == Ar0);
+    }
+}
@@ -0,0 +1,241 @@
+/// @file test_tiled.cpp
+/// @brief Test the tiled matrix and its tile algorithms
+//
+// Copyright (c) 2022, University of Colorado Denver. All rights reserved.
+//
+// This file is part of <T>LAPACK.
+// <T>LAPACK is free software: you can redistribute it and/or modify it under
+// the terms of the BSD 3-Clause license. See the accompanying LICENSE file.
+
+#include <catch2/catch.hpp>
+#include <plugins/tlapack_stdvector.hpp>
+#include <plugins/tlapack_tiledArray.hpp>
+#include <tlapack.hpp>
+#include <testutils.hpp>
+#include <testdefinitions.hpp>
+
+using namespace tlapack;
+
+TEMPLATE_LIST_TEST_CASE("Tiled matrices can be sliced and converted", "[tiled]", types_to_test)
+{
+    srand(1);
+
+    using matrix_t = TestType;
+    using T = type_t<matrix_t>;
+    using idx_t = size_type<matrix_t>;
+    using pair = std::pair<idx_t, idx_t>;
+
+    const idx_t m = GENERATE(1, 7, 12);
+    const idx_t n = GENERATE(1, 9);
+    const idx_t mb = GENERATE(1, 3, 4);
+    const idx_t nb = GENERATE(2, 16);
+
+    std::vector<T> A_(m * n);
+    std::vector<T> B_(m * n);
+    std::vector<T> At_(tiledMatrix<T>::storage_size(m, n, mb, nb));
+
+    auto A = legacyMatrix<T, layout<matrix_t>>(m, n, &A_[0], layout<matrix_t> == Layout::ColMajor ? m : n);
+    auto B = legacyMatrix<T, layout<matrix_t>>(m, n, &B_[0], layout<matrix_t> == Layout::ColMajor ? m : n);
+    auto At = tiledMatrix<T>(m, n, mb, nb, &At_[0]);
+
+    for (idx_t j = 0; j < n; ++j)
+        for (idx_t i = 0; i < m; ++i)
+            A(i, j) = rand_helper<T>();
+
+    DYNAMIC_SECTION("m = " << m << " n = " << n << " mb = " << mb << " nb = " << nb)
+    {
+        copy_to_tiled(A, At);
+        copy_from_tiled(At, B);
+        for (idx_t j = 0; j < n; ++j)
+            for (idx_t i = 0; i < m; ++i)
+            {
+                CHECK(At(i, j) == A(i, j));
+                CHECK(B(i, j) == A(i, j));
+            }
+
+        // The tiles are contiguous
+        for (idx_t J = 0; J < At.nt(); ++J)
+            for (idx_t I = 0; I < At.mt(); ++I)
+            {
+                auto Aij = tile(At, I, J);
+                CHECK(Aij.ptr == &At_[(I + J * At.mt()) * mb * nb]);
+                CHECK(Aij(0, 0) == A(I * mb, J * nb));
+            }
+
+        // Slices of slices
+        const idx_t i0 = m / 3, j0 = n / 2;
+        auto S = slice(At, pair{i0, m}, pair{j0, n});
+        auto S2 = slice(S, pair{m / 3, m - i0}, pair{0, n - j0});
+        for (idx_t j = 0; j < ncols(S2); ++j)
+            for (idx_t i = 0; i < nrows(S2); ++i)
+                CHECK(S2(i, j) == A(i0 + m / 3 + i, j0 + j));
+
+        auto d = diag(S, 0);
+        for (idx_t k = 0; k < size(d); ++k)
+            CHECK(d[k] == A(i0 + k, j0 + k));
+        auto r = slice(S, 0, pair{0, n - j0});
+        for (idx_t k = 0; k < size(r); ++k)
+            CHECK(r[k] == A(i0, j0 + k));
+        auto c = slice(S, pair{0, m - i0}, 0);
+        for (idx_t k = 0; k < size(c); ++k)
+            CHECK(c[k] == A(i0 + k, j0));
+    }
+}
+
+TEMPLATE_LIST_TEST_CASE("Tiled gemm gives the same result as gemm", "[tiled][gemm]", types_to_test)
+{
+    srand(1);
+
+    using matrix_t = TestType;
+    using T = type_t<matrix_t>;
+    using idx_t = size_type<matrix_t>;
+    typedef real_type<T> real_t;
+
+    const Op transA = GENERATE(Op::NoTrans, Op::ConjTrans);
+    const Op transB = GENERATE(Op::NoTrans, Op::Trans);
+    const idx_t m = GENERATE(5, 13);
+    const idx_t n = 11, k = 10;
+    const idx_t nb = GENERATE(3, 4, 32);
+
+    const real_t tol = real_t(1.0e2) * k * uroundoff<real_t>();
+
+    const idx_t mA = (transA == Op::NoTrans) ? m : k;
+    const idx_t nA = (transA == Op::NoTrans) ? k : m;
+    const idx_t mB = (transB == Op::NoTrans) ? k : n;
+    const idx_t nB = (transB == Op::NoTrans) ? n : k;
+
+    std::vector<T> A_(mA * nA), B_(mB * nB), C_(m * n), D_(m * n);
+    std::vector<T> At_(tiledMatrix<T>::storage_size(mA, nA, nb, nb));
+    std::vector<T> Bt_(tiledMatrix<T>::storage_size(mB, nB, nb, nb));
+    std::vector<T> Ct_(tiledMatrix<T>::storage_size(m, n, nb, nb));
+
+    auto A = legacyMatrix<T>(mA, nA, &A_[0], mA);
+    auto B = legacyMatrix<T>(mB, nB, &B_[0], mB);
+    auto C = legacyMatrix<T>(m, n, &C_[0], m);
+    auto D = legacyMatrix<T>(m, n, &D_[0], m);
+    auto At = tiledMatrix<T>(mA, nA, nb, nb, &At_[0]);
+    auto Bt = tiledMatrix<T>(mB, nB, nb, nb, &Bt_[0]);
+    auto Ct = tiledMatrix<T>(m, n, nb, nb, &Ct_[0]);
+
+    for (auto &x : A_) x = rand_helper<T>();
+    for (auto &x : B_) x = rand_helper<T>();
+    for (auto &x : C_) x = rand_helper<T>();
+
+    DYNAMIC_SECTION("m = " << m << " nb = " << nb)
+    {
+        copy_to_tiled(A, At);
+        copy_to_tiled(B, Bt);
+        copy_to_tiled(C, Ct);
+
+        gemm(transA, transB, real_t(2), A, B, real_t(-1), C);
+        gemm(transA, transB, real_t(2), At, Bt, real_t(-1), Ct);
+        copy_from_tiled(Ct, D);
+
+        for (idx_t j = 0; j < n; ++j)
+            for (idx_t i = 0; i < m; ++i)
+                CHECK(abs1(D(i, j) - C(i, j)) <= tol);
+    }
+}
+
+TEMPLATE_LIST_TEST_CASE("Tiled Cholesky factorization is backward stable", "[tiled][potrf]", types_to_test)
+{
+    srand(1);
+
+    using matrix_t = TestType;
+    using T = type_t<matrix_t>;
+    using idx_t = size_type<matrix_t>;
+    using pair = std::pair<idx_t, idx_t>;
+    typedef real_type<T> real_t;
+
+    const Uplo uplo = GENERATE(Uplo::Lower, Uplo::Upper);
+    const idx_t n = GENERATE(1, 10, 19);
+    const idx_t mb = GENERATE(4, 5);
+    const idx_t nb = GENERATE(4, 5);
+    const bool sliced = GENERATE(false, true);
+
+    const real_t tol = real_t(1.0e2) * n * uroundoff<real_t>();
+
+    // The leading n-by-n block of A, or a slice of A that starts in the
+    // middle of a tile
+    const idx_t off = sliced ? 2 : 0;
+    std::vector<T> A_(n * n), L_(n * n);
+    std::vector<T> At_(tiledMatrix<T>::storage_size(n + off, n + off, mb, nb));
+
+    auto A = legacyMatrix<T>(n, n, &A_[0], n);
+    auto L = legacyMatrix<T>(n, n, &L_[0], n);
+    auto At0 = tiledMatrix<T>(n + off, n + off, mb, nb, &At_[0]);
+    auto At = slice(At0, pair{off, n + off}, pair{off, n + off});
+
+    for (idx_t j = 0; j < n; ++j)
+    {
+        for (idx_t i = 0; i < n; ++i)
+            A(i, j) = rand_helper<T>();
+        A(j, j) = T(real(A(j, j)) + n);
+    }
+    for (idx_t j = 0; j < n; ++j)
+        for (idx_t i = 0; i < j; ++i)
+            A(i, j) = conj(A(j, i));
+
+    DYNAMIC_SECTION("n = " << n << " mb = " << mb << " nb = " << nb << " sliced = " << sliced
+                           << " uplo = " << (uplo == Uplo::Upper ? "upper" : "lower"))
+    {
+        copy_to_tiled(A, At);
+        int info = potrf(uplo, At);
+        REQUIRE(info == 0);
+        copy_from_tiled(At, L);
+
+        // A - L L^H or A - U^H U
+        const real_t normA = lanhe(max_norm, uplo, A);
+        if (uplo == Uplo::Lower)
+        {
+            for (idx_t j = 0; j < n; ++j)
+                for (idx_t i = 0; i < j; ++i)
+                    L(i, j) = T(0);
+            herk(Uplo::Lower, Op::NoTrans, real_t(1), L, real_t(-1), A);
+        }
+        else
+        {
+            for (idx_t j = 0; j < n; ++j)
+                for (idx_t i = j + 1; i < n; ++i)
+                    L(i, j) = T(0);
+            herk(Uplo::Upper, Op::ConjTrans, real_t(1), L, real_t(-1), A);
+        }
+
+        CHECK(lanhe(max_norm, uplo, A) / normA <= tol);
+    }
+}
+
+TEMPLATE_LIST_TEST_CASE("Tiled Cholesky factorization reports a matrix that is not positive definite", "[tiled][potrf]", types_to_test)
+{
+    using matrix_t = TestType;
+    using T = type_t<matrix_t>;
+    using idx_t = size_type<matrix_t>;
+    using pair = std::pair<idx_t, idx_t>;
+
+    const Uplo uplo = GENERATE(Uplo::Lower, Uplo::Upper);
+    const idx_t n = 13;
+    const idx_t k = GENERATE(0, 3, 4, 12);
+    const bool sliced = GENERATE(false, true);
+
+    // A slice that starts in the middle of a tile uses the blocked fallback
+    const idx_t off = sliced ? 2 : 0;
+    std::vector<T> A_(n * n);
+    std::vector<T> At_(tiledMatrix<T>::storage_size(n + off, n + off, 4, 4));
+
+    auto A = legacyMatrix<T>(n, n, &A_[0], n);
+    auto At0 = tiledMatrix<T>(n + off, n + off, 4, 4, &At_[0]);
+    auto At = slice(At0, pair{off, n + off}, pair{off, n + off});
+
+    // Identity with a negative entry at A(k,k)
+    laset(Uplo::General, T(0), T(1), A);
+    A(k, k) = T(-1);
+
+    DYNAMIC_SECTION("k = " << k << " sliced = " << sliced
+                           << " uplo = " << (uplo == Uplo::Upper ? "upper" : "lower"))
+    {
+        copy_to_tiled(A, At);
+        potrf_opts_t<idx_t> opts;
+        opts.nb = 4;
+        CHECK(potrf(uplo, At, opts, noErrorCheck) == int(k + 1));
+    }
+}
@@ -0,0 +1,154 @@
+/// @file test_trace.cpp
+/// @brief Test the timeline tracer of <T>LAPACK
+//
+// Copyright (c) 2022, University of Colorado Denver. All rights reserved.
+//
+// This file is part of <T>LAPACK.
+// <T>LAPACK is free software: you can redistribute it and/or modify it under
+// the terms of the BSD 3-Clause license. See the accompanying LICENSE file.
+
+#include <catch2/catch.hpp>
+#include <plugins/tlapack_stdvector.hpp>
+#include <tlapack.hpp>
+#include <testutils.hpp>
+#include <testdefinitions.hpp>
+
+#include <sstream>
+#include <thread>
+
+using namespace tlapack;
+
+/// Returns the number of events with the given name in the trace
+inline std::size_t count_events(const std::string &json, const std::string &name)
+{
+    const std::string key = "{\"name\":\"" + name + "\",";
+    std::size_t count = 0;
+    for (auto pos = json.find(key); pos != std::string::npos; pos = json.find(key, pos + 1))
+        ++count;
+    return count;
+}
+
+TEMPLATE_LIST_TEST_CASE("Trace of the multishift QR algorithm", "[eigenvalues][trace]", types_to_test)
+{
+    using matrix_t = TestType;
+    using T = type_t<matrix_t>;
+    using idx_t = size_type<matrix_t>;
+    using real_t = real_type<T>;
+    using complex_t = std::complex<real_t>;
+
+    rand_generator gen;
+
+    const idx_t n = 60;
+    std::unique_ptr<T[]> H_(new T[n * n]);
+    std::unique_ptr<T[]> Q_(new T[n * n]);
+    auto H = legacyMatrix<T, layout<matrix_t>>(n, n, &H_[0], n);
+    auto Q = legacyMatrix<T, layout<matrix_t>>(n, n, &Q_[0], n);
+    std::vector<complex_t> w(n);
+
+    for (idx_t j = 0; j < n; ++j)
+        for (idx_t i = 0; i < n; ++i)
+            H(i, j) = (i > j + 1) ? T(0) : rand_helper<T>(gen);
+    laset(Uplo::General, T(0), T(1), Q);
+
+    francis_opts_t<idx_t, T> opts;
+    opts.nmin = 15;
+
+    clear_trace();
+    int info = multishift_qr(true, true, 0, n, H, w, Q, opts);
+    REQUIRE(info == 0);
+
+    std::ostringstream out;
+    write_chrome_trace(out);
+    const std::string json = out.str();
+
+    CHECK(json.find("{\"traceEvents\":[") == 0);
+    CHECK(json.find("\"displayTimeUnit\":\"ns\"}") != std::string::npos);
+
+#ifdef TLAPACK_TRACE
+    // AED may call multishift_qr recursively, so there can be more events
+    // than the counters of the outer call
+    CHECK(count_events(json, "multishift_qr") >= 1);
+    CHECK(count_events(json, "multishift_qr.aed") >= std::size_t(opts.n_aed));
+    CHECK(count_events(json, "multishift_qr.sweep") >= std::size_t(opts.n_sweep));
+    CHECK(count_events(json, "multishift_qr.iteration") >= count_events(json, "multishift_qr.aed"));
+    CHECK(count_events(json, "multishift_QR_sweep.introduce") == count_events(json, "multishift_qr.sweep"));
+    CHECK(json.find("\"args\":{\"kwtop\":") != std::string::npos);
+    CHECK(json.find("\"ph\":\"X\"") != std::string::npos);
+
+    clear_trace();
+    std::ostringstream empty;
+    write_chrome_trace(empty);
+    CHECK(count_events(empty.str(), "multishift_qr") == 0);
+#else
+    CHECK(json.find("\"ph\":\"X\"") == std::string::npos);
+#endif
+}
+
+TEMPLATE_LIST_TEST_CASE("Trace of the blocked Hessenberg and Cholesky factorizations", "[trace]", types_to_test)
+{
+    using matrix_t = TestType;
+    using T = type_t<matrix_t>;
+    using idx_t = size_type<matrix_t>;
+    using real_t = real_type<T>;
+
+    rand_generator gen;
+
+    const idx_t n = 40;
+    const idx_t nb = 8;
+    std::unique_ptr<T[]> A_(new T[n * n]);
+    auto A = legacyMatrix<T, layout<matrix_t>>(n, n, &A_[0], n);
+    std::vector<T> tau(n);
+
+    for (idx_t j = 0; j < n; ++j)
+        for (idx_t i = 0; i < n; ++i)
+            A(i, j) = rand_helper<T>(gen);
+
+    clear_trace();
+
+    gehrd_opts_t<idx_t, T> gehrd_opts;
+    gehrd_opts.nb = nb;
+    gehrd_opts.nx_switch = 2;
+    gehrd(0, n, A, tau, gehrd_opts);
+
+    for (idx_t j = 0; j < n; ++j)
+        for (idx_t i = 0; i < n; ++i)
+            A(i, j) = (i == j) ? T(real_t(2 * n)) : rand_helper<T>(gen);
+    potrf_opts_t<idx_t> potrf_opts;
+    potrf_opts.nb = nb;
+    REQUIRE(potrf(Uplo::Lower, A, potrf_opts) == 0);
+
+    std::ostringstream out;
+    write_chrome_trace(out);
+    const std::string json = out.str();
+
+#ifdef TLAPACK_TRACE
+    CHECK(count_events(json, "gehrd.panel") >= 1);
+    CHECK(count_events(json, "potrf.block") == n / nb);
+    CHECK(count_events(json, "potrf") == 1);
+    CHECK(json.find("\"args\":{\"j\":0,\"nb\":8,\"n\":40}") != std::string::npos);
+#else
+    CHECK(count_events(json, "potrf") == 0);
+#endif
+}
+
+#ifdef TLAPACK_TRACE
+TEST_CASE("Trace keeps the events of each thread", "[trace]")
+{
+    using T = double;
+
+    std::vector<T> x(100, T(1));
+    std::vector<T> y(100, T(2));
+
+    clear_trace();
+    std::thread t([&]() { axpy(T(1), x, y); });
+    t.join();
+    axpy(T(1), x, y);
+
+    std::ostringstream out;
+    write_chrome_trace(out);
+    const std::string json = out.str();
+
+    CHECK(count_events(json, "axpy") == 2);
+    CHECK(count_events(json, "thread_name") >= 2);
+}
+#endif
@@ -0,0 +1,265 @@
+/// @file test_tridiag.cpp
+/// @brief Test the tridiagonal solvers
+//
+// Copyright (c) 2022, University of Colorado Denver. All rights reserved.
+//
+// This file is part of <T>LAPACK.
+// <T>LAPACK is free software: you can redistribute it and/or modify it under
+// the terms of the BSD 3-Clause license. See the accompanying LICENSE file.
+
+#include <catch2/catch.hpp>
+#include <plugins/tlapack_stdvector.hpp>
+#include <tlapack.hpp>
+#include <testutils.hpp>
+#include <testdefinitions.hpp>
+
+using namespace tlapack;
+
+namespace {
+
+/// Sets the dense n-by-n matrix A with subdiagonal dl, diagonal d and
+/// superdiagonal du
+template <class matrix_t, class vector_t, class vectorD_t>
+void tridiag_to_dense(const vector_t &dl, const vectorD_t &d, const vector_t &du, matrix_t &A)
+{
+    using T = type_t<matrix_t>;
+    using idx_t = size_type<matrix_t>;
+    const idx_t n = ncols(A);
+    for (idx_t j = 0; j < n; ++j)
+        for (idx_t i = 0; i < n; ++i)
+            A(i, j) = T(0);
+    for (idx_t i = 0; i < n; ++i)
+    {
+        A(i, i) = d[i];
+        if (i + 1 < n)
+        {
+            A(i + 1, i) = dl[i];
+            A(i, i + 1) = du[i];
+        }
+    }
+}
+
+} // namespace
+
+TEMPLATE_LIST_TEST_CASE("GTTRF and GTTRS solve tridiagonal systems", "[tridiag][gttrf]", types_to_test)
+{
+    srand(1);
+
+    using matrix_t = TestType;
+    using T = type_t<matrix_t>;
+    using idx_t = size_type<matrix_t>;
+    typedef real_type<T> real_t;
+
+    const idx_t n = GENERATE(1, 2, 3, 10, 41);
+    const Op trans = GENERATE(Op::NoTrans, Op::Trans, Op::ConjTrans);
+    const idx_t nrhs = 2;
+
+    const real_t tol = real_t(1.0e2) * n * uroundoff<real_t>();
+
+    // Random matrix, so that rows are interchanged
+    std::vector<T> dl(n), d(n), du(n), du2(n);
+    std::vector<idx_t> piv(n);
+    for (idx_t i = 0; i < n; ++i)
+    {
+        dl[i] = rand_helper<T>();
+        d[i] = rand_helper<T>();
+        du[i] = rand_helper<T>();
+    }
+
+    std::vector<T> A_(n * n), B_(n * nrhs), X_(n * nrhs);
+    auto A = legacyMatrix<T>(n, n, &A_[0], n);
+    auto B = legacyMatrix<T>(n, nrhs, &B_[0], n);
+    auto X = legacyMatrix<T>(n, nrhs, &X_[0], n);
+    tridiag_to_dense(dl, d, du, A);
+    for (auto &b : B_)
+        b = rand_helper<T>();
+
+    DYNAMIC_SECTION("n = " << n << " trans = " << (trans == Op::NoTrans ? "N" : trans == Op::Trans ? "T" : "C"))
+    {
+        const real_t normA = lange(max_norm, A);
+
+        REQUIRE(gttrf(dl, d, du, du2, piv) == 0);
+        lacpy(Uplo::General, B, X);
+        gttrs(trans, dl, d, du, du2, piv, X);
+
+        gemm(trans, Op::NoTrans, T(-1), A, X, T(1), B);
+        CHECK(lange(max_norm, B) <= tol * normA * lange(max_norm, X));
+    }
+}
+
+TEMPLATE_LIST_TEST_CASE("PTTRF and PTTRS solve positive definite tridiagonal systems", "[tridiag][pttrf]", types_to_test)
+{
+    srand(1);
+
+    using matrix_t = TestType;
+    using T = type_t<matrix_t>;
+    using idx_t = size_type<matrix_t>;
+    typedef real_type<T> real_t;
+
+    const idx_t n = GENERATE(1, 2, 10, 41);
+    const idx_t nrhs = 2;
+
+    const real_t tol = real_t(1.0e2) * n * uroundoff<real_t>();
+
+    std::vector<real_t> d(n);
+    std::vector<T> e(n), econj(n);
+    for (idx_t i = 0; i < n; ++i)
+    {
+        d[i] = real(rand_helper<T>()) + 3;
+        e[i] = rand_helper<T>();
+        econj[i] = conj(e[i]);
+    }
+
+    std::vector<T> A_(n * n), B_(n * nrhs), X_(n * nrhs);
+    auto A = legacyMatrix<T>(n, n, &A_[0], n);
+    auto B = legacyMatrix<T>(n, nrhs, &B_[0], n);
+    auto X = legacyMatrix<T>(n, nrhs, &X_[0], n);
+    tridiag_to_dense(e, d, econj, A);
+    for (auto &b : B_)
+        b = rand_helper<T>();
+
+    DYNAMIC_SECTION("n = " << n)
+    {
+        const real_t normA = lange(max_norm, A);
+
+        REQUIRE(pttrf(d, e) == 0);
+        lacpy(Uplo::General, B, X);
+        pttrs(d, e, X);
+
+        gemm(Op::NoTrans, Op::NoTrans, T(-1), A, X, T(1), B);
+        CHECK(lange(max_norm, B) <= tol * normA * lange(max_norm, X));
+    }
+}
+
+TEMPLATE_LIST_TEST_CASE("The partitioned tridiagonal solver solves the system", "[tridiag][gtsv_spike]", types_to_test)
+{
+    srand(1);
+
+    using matrix_t = TestType;
+    using T = type_t<matrix_t>;
+    using idx_t = size_type<matrix_t>;
+    typedef real_type<T> real_t;
+
+    const idx_t n = GENERATE(5, 31, 200);
+    const idx_t nb = GENERATE(2, 3, 4, 7, 64);
+    const bool parallel = GENERATE(false, true);
+    const idx_t nrhs = 3;
+
+    const real_t tol = real_t(1.0e2) * n * uroundoff<real_t>();
+
+    // Diagonally dominant matrix
+    std::vector<T> dl(n), d(n), du(n);
+    for (idx_t i = 0; i < n; ++i)
+    {
+        dl[i] = rand_helper<T>();
+        d[i] = rand_helper<T>() + T(4);
+        du[i] = rand_helper<T>();
+    }
+
+    std::vector<T> A_(n * n), B_(n * nrhs), X_(n * nrhs);
+    auto A = legacyMatrix<T>(n, n, &A_[0], n);
+    auto B = legacyMatrix<T>(n, nrhs, &B_[0], n);
+    auto X = legacyMatrix<T>(n, nrhs, &X_[0], n);
+    tridiag_to_dense(dl, d, du, A);
+    for (auto &b : B_)
+        b = rand_helper<T>();
+
+    DYNAMIC_SECTION("n = " << n << " nb = " << nb << " parallel = " << parallel)
+    {
+        const real_t normA = lange(max_norm, A);
+
+        gtsv_spike_opts_t<idx_t, T> opts;
+        opts.nb = nb;
+        opts.parallel = parallel;
+        lacpy(Uplo::General, B, X);
+        REQUIRE(gtsv_spike(dl, d, du, X, opts) == 0);
+
+        gemm(Op::NoTrans, Op::NoTrans, T(-1), A, X, T(1), B);
+        CHECK(lange(max_norm, B) <= tol * normA * lange(max_norm, X));
+    }
+}
+
+TEMPLATE_LIST_TEST_CASE("The batched tridiagonal solver solves each system", "[tridiag][gtsv_batched]", types_to_test)
+{
+    srand(1);
+
+    using matrix_t = TestType;
+    using T = type_t<matrix_t>;
+    using idx_t = size_type<matrix_t>;
+    typedef real_type<T> real_t;
+
+    const idx_t n = GENERATE(1, 2, 17);
+    const idx_t nbatch = GENERATE(1, 13);
+
+    const real_t tol = real_t(1.0e2) * n * uroundoff<real_t>();
+
+    // Interleaved systems
+    const idx_t n1 = (n > 1) ? n - 1 : 1;
+    std::vector<T> DL_(nbatch * n1), D_(nbatch * n), DU_(nbatch * n1), B_(nbatch * n);
+    auto DL = legacyMatrix<T>(nbatch, n - 1, &DL_[0], nbatch);
+    auto D = legacyMatrix<T>(nbatch, n, &D_[0], nbatch);
+    auto DU = legacyMatrix<T>(nbatch, n - 1, &DU_[0], nbatch);
+    auto B = legacyMatrix<T>(nbatch, n, &B_[0], nbatch);
+    for (auto &x : DL_)
+        x = rand_helper<T>();
+    for (auto &x : D_)
+        x = rand_helper<T>() + T(4);
+    for (auto &x : DU_)
+        x = rand_helper<T>();
+    for (auto &x : B_)
+        x = rand_helper<T>();
+    const std::vector<T> D0_(D_), B0_(B_);
+
+    DYNAMIC_SECTION("n = " << n << " nbatch = " << nbatch)
+    {
+        REQUIRE(gtsv_batched(DL, D, DU, B) == 0);
+
+        // Residual of each system
+        for (idx_t s = 0; s < nbatch; ++s)
+        {
+            real_t normA(0), normX(0), normR(0);
+            for (idx_t i = 0; i < n; ++i)
+            {
+                T r = B0_[s + i * nbatch] - D0_[s + i * nbatch] * B(s, i);
+                if (i > 0)
+                    r -= DL(s, i - 1) * B(s, i - 1);
+                if (i + 1 < n)
+                    r -= DU(s, i) * B(s, i + 1);
+                normR = std::max(normR, abs1(r));
+                normX = std::max(normX, abs1(B(s, i)));
+                normA = std::max(normA, abs1(D0_[s + i * nbatch]));
+            }
+            CHECK(normR <= tol * normA * normX);
+        }
+    }
+}
+
+TEMPLATE_LIST_TEST_CASE("The batched tridiagonal solver stops at a zero pivot", "[tridiag][gtsv_batched]", types_to_test)
+{
+    using matrix_t = TestType;
+    using T = type_t<matrix_t>;
+    using idx_t = size_type<matrix_t>;
+
+    const idx_t n = 3;
+    const idx_t nbatch = 4;
+
+    std::vector<T> DL_(nbatch * (n - 1), T(1)), D_(nbatch * n, T(4)), DU_(nbatch * (n - 1), T(1)), B_(nbatch * n, T(1));
+    auto DL = legacyMatrix<T>(nbatch, n - 1, &DL_[0], nbatch);
+    auto D = legacyMatrix<T>(nbatch, n, &D_[0], nbatch);
+    auto DU = legacyMatrix<T>(nbatch, n - 1, &DU_[0], nbatch);
+    auto B = legacyMatrix<T>(nbatch, n, &B_[0], nbatch);
+
+    // The second pivot of the system 2 is 1 - 1 * 1 = 0
+    D(2, 0) = T(1);
+    D(2, 1) = T(1);
+
+    CHECK(gtsv_batched(DL, D, DU, B, noErrorCheck) == 2);
+    for (idx_t i = 0; i < n; ++i)
+        for (idx_t s = 0; s < nbatch; ++s)
+        {
+            CHECK(!isnan(D(s, i)));
+            CHECK(!isinf(D(s, i)));
+            CHECK(!isnan(B(s, i)));
+            CHECK(!isinf(B(s, i)));
+        }
+}
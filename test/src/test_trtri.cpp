@@ -0,0 +1,198 @@
+/// @file test_trtri.cpp
+/// @brief Test TRTRI
+//
+// Copyright (c) 2022, University of Colorado Denver. All rights reserved.
+//
+// This file is part of <T>LAPACK.
+// <T>LAPACK is free software: you can redistribute it and/or modify it under
+// the terms of the BSD 3-Clause license. See the accompanying LICENSE file.
+
+#include <catch2/catch.hpp>
+#include <plugins/tlapack_stdvector.hpp>
+#include <tlapack.hpp>
+#include <testutils.hpp>
+#include <testdefinitions.hpp>
+
+using namespace tlapack;
+
+TEMPLATE_LIST_TEST_CASE("TRTRI computes the inverse", "[trtri]", types_to_test)
+{
+    srand(1);
+
+    using matrix_t = TestType;
+    using T = type_t<matrix_t>;
+    using idx_t = size_type<matrix_t>;
+    typedef real_type<T> real_t;
+
+    Uplo uplo = GENERATE(Uplo::Lower, Uplo::Upper);
+    Diag diag = GENERATE(Diag::NonUnit, Diag::Unit);
+    idx_t n = GENERATE(1, 2, 6, 9);
+    idx_t nx = GENERATE(1, 2, 4, 16);
+
+    const real_t eps = uroundoff<real_t>();
+    const real_t tol = 1.0e2 * n * eps;
+
+    std::unique_ptr<T[]> A_(new T[n * n]);
+    std::unique_ptr<T[]> C_(new T[n * n]);
+
+    auto A = legacyMatrix<T, layout<matrix_t>>(n, n, &A_[0], n);
+    auto C = legacyMatrix<T, layout<matrix_t>>(n, n, &C_[0], n);
+
+    // Generate a well-conditioned triangular matrix
+    for (idx_t j = 0; j < n; ++j)
+    {
+        for (idx_t i = 0; i < n; ++i)
+            A(i, j) = rand_helper<T>() / real_t(n);
+        A(j, j) = T(real(A(j, j)) + 1);
+    }
+
+    lacpy(Uplo::General, A, C);
+
+    DYNAMIC_SECTION("n = " << n << " nx = " << nx
+                           << " uplo = " << (uplo == Uplo::Upper ? "upper" : "lower")
+                           << " diag = " << (diag == Diag::Unit ? "unit" : "non-unit"))
+    {
+        trtri_opts_t<idx_t> opts;
+        opts.nx = nx;
+        REQUIRE(trtri_recursive(uplo, diag, C, opts) == 0);
+
+        // The other triangle is not referenced
+        for (idx_t j = 0; j < n; ++j)
+            for (idx_t i = 0; i < n; ++i)
+                if ((uplo == Uplo::Upper) ? (i > j) : (i < j))
+                    CHECK(C(i, j) == A(i, j));
+
+        // C = A * inv(A) - I
+        for (idx_t j = 0; j < n; ++j)
+            for (idx_t i = 0; i < n; ++i)
+                if ((uplo == Uplo::Upper) ? (i > j) : (i < j))
+                    C(i, j) = T(0);
+        if (diag == Diag::Unit)
+            for (idx_t j = 0; j < n; ++j)
+                C(j, j) = T(1);
+        trmm(Side::Left, uplo, Op::NoTrans, diag, T(1), A, C);
+        for (idx_t j = 0; j < n; ++j)
+            C(j, j) -= T(1);
+
+        CHECK(lange(max_norm, C) <= tol);
+    }
+}
+
+TEMPLATE_LIST_TEST_CASE("TRTRI reports a singular matrix", "[trtri]", types_to_test)
+{
+    using matrix_t = TestType;
+    using T = type_t<matrix_t>;
+    using idx_t = size_type<matrix_t>;
+
+    Uplo uplo = GENERATE(Uplo::Lower, Uplo::Upper);
+    const idx_t n = 9;
+    const idx_t k = GENERATE(0, 4, 8);
+
+    std::unique_ptr<T[]> A_(new T[n * n]);
+    auto A = legacyMatrix<T, layout<matrix_t>>(n, n, &A_[0], n);
+
+    // Identity with a zero at A(k,k)
+    laset(Uplo::General, T(0), T(1), A);
+    A(k, k) = T(0);
+
+    DYNAMIC_SECTION("k = " << k << " uplo = " << (uplo == Uplo::Upper ? "upper" : "lower"))
+    {
+        trtri_opts_t<idx_t> opts;
+        opts.nx = 2;
+        CHECK(trtri_recursive(uplo, Diag::NonUnit, A, opts, noErrorCheck) == int(k + 1));
+    }
+}
+
+TEMPLATE_LIST_TEST_CASE("POTRI computes the inverse of a positive definite matrix", "[trtri][potri]", types_to_test)
+{
+    srand(1);
+
+    using matrix_t = TestType;
+    using T = type_t<matrix_t>;
+    using idx_t = size_type<matrix_t>;
+    typedef real_type<T> real_t;
+
+    Uplo uplo = GENERATE(Uplo::Lower, Uplo::Upper);
+    idx_t n = GENERATE(1, 2, 7, 40);
+    idx_t nx = GENERATE(1, 5, 16);
+    bool parallel = GENERATE(false, true);
+
+    const real_t eps = uroundoff<real_t>();
+    const real_t tol = 1.0e2 * n * eps;
+
+    std::unique_ptr<T[]> A_(new T[n * n]);
+    std::unique_ptr<T[]> C_(new T[n * n]);
+    std::unique_ptr<T[]> E_(new T[n * n]());
+
+    auto A = legacyMatrix<T, layout<matrix_t>>(n, n, &A_[0], n);
+    auto C = legacyMatrix<T, layout<matrix_t>>(n, n, &C_[0], n);
+    auto E = legacyMatrix<T, layout<matrix_t>>(n, n, &E_[0], n);
+
+    // Generate a well-conditioned Hermitian positive definite matrix
+    for (idx_t j = 0; j < n; ++j)
+        for (idx_t i = 0; i < n; ++i)
+            A(i, j) = rand_helper<T>() / real_t(n);
+    for (idx_t j = 0; j < n; ++j)
+    {
+        for (idx_t i = 0; i < j; ++i)
+            A(i, j) = conj(A(j, i));
+        A(j, j) = T(real(A(j, j)) + 2);
+    }
+
+    lacpy(Uplo::General, A, C);
+
+    DYNAMIC_SECTION("n = " << n << " nx = " << nx << " parallel = " << parallel
+                           << " uplo = " << (uplo == Uplo::Upper ? "upper" : "lower"))
+    {
+        REQUIRE(potrf(uplo, C) == 0);
+
+        potri_opts_t<idx_t> opts;
+        opts.nx = nx;
+        opts.parallel = parallel;
+        REQUIRE(potri(uplo, C, opts) == 0);
+
+        // E = A * inv(A) - I
+        for (idx_t j = 0; j < n; ++j)
+            for (idx_t i = 0; i < n; ++i)
+                if ((uplo == Uplo::Upper) ? (i > j) : (i < j))
+                    C(i, j) = conj(C(j, i));
+        gemm(Op::NoTrans, Op::NoTrans, T(1), A, C, T(0), E);
+        for (idx_t j = 0; j < n; ++j)
+            E(j, j) -= T(1);
+
+        CHECK(lange(max_norm, E) <= tol);
+    }
+}
+
+TEMPLATE_LIST_TEST_CASE("POTRI reports a singular factor", "[trtri][potri]", types_to_test)
+{
+    using matrix_t = TestType;
+    using T = type_t<matrix_t>;
+    using idx_t = size_type<matrix_t>;
+
+    Uplo uplo = GENERATE(Uplo::Lower, Uplo::Upper);
+    const idx_t n = 9;
+    const idx_t k = GENERATE(0, 4, 8);
+
+    std::unique_ptr<T[]> A_(new T[n * n]);
+    std::unique_ptr<T[]> C_(new T[n * n]);
+    auto A = legacyMatrix<T, layout<matrix_t>>(n, n, &A_[0], n);
+    auto C = legacyMatrix<T, layout<matrix_t>>(n, n, &C_[0], n);
+
+    // Factor of the identity with a zero at A(k,k)
+    laset(Uplo::General, T(0), T(1), A);
+    A(k, k) = T(0);
+    lacpy(Uplo::General, A, C);
+
+    DYNAMIC_SECTION("k = " << k << " uplo = " << (uplo == Uplo::Upper ? "upper" : "lower"))
+    {
+        potri_opts_t<idx_t> opts;
+        opts.nx = 2;
+        CHECK(potri(uplo, C, opts, noErrorCheck) == int(k + 1));
+
+        // A is not modified
+        for (idx_t j = 0; j < n; ++j)
+            for (idx_t i = 0; i < n; ++i)
+                CHECK(C(i, j) == A(i, j));
+    }
+}
@@ -0,0 +1,220 @@
+/// @file test_tuning.cpp
+/// @brief Test the tuning table and the tuned defaults of the options
+//
+// Copyright (c) 2022, University of Colorado Denver. All rights reserved.
+//
+// This file is part of <T>LAPACK.
+// <T>LAPACK is free software: you can redistribute it and/or modify it under
+// the terms of the BSD 3-Clause license. See the accompanying LICENSE file.
+
+#include <catch2/catch.hpp>
+#include <plugins/tlapack_stdvector.hpp>
+#include <tlapack.hpp>
+#include <testutils.hpp>
+#include <testdefinitions.hpp>
+
+#include <sstream>
+
+using namespace tlapack;
+
+TEST_CASE("Tuning table lookup", "[tuning]")
+{
+    tuning_table table;
+    std::istringstream in(
+        "# routine param type n_max value\n"
+        "potrf nb d 100 16\n"
+        "potrf nb d inf 64\n"
+        "potrf nb * 500 48\n"
+        "\n"
+        "gehrd nb d\n");
+    CHECK(!table.read(in)); // The last line is incomplete
+    CHECK(table.entries().size() == 3);
+
+    std::size_t value = 0;
+    CHECK(table.lookup("potrf", "nb", 'd', 50, value));
+    CHECK(value == 16);
+    CHECK(table.lookup("potrf", "nb", 'd', 100, value));
+    CHECK(value == 16);
+    CHECK(table.lookup("potrf", "nb", 'd', 101, value));
+    CHECK(value == 64);
+    CHECK(table.lookup("potrf", "nb", 's', 200, value));
+    CHECK(value == 48);
+    CHECK(!table.lookup("potrf", "nb", 's', 501, value));
+    CHECK(!table.lookup("gehrd", "nb", 'd', 10, value));
+
+    // The written table reads back to the same entries
+    std::ostringstream out;
+    table.write(out);
+    tuning_table copy;
+    std::istringstream in2(out.str());
+    CHECK(copy.read(in2));
+    REQUIRE(copy.entries().size() == 3);
+    // Copy inf, since CHECK binds its operands to references and C++14 has
+    // no definition of the static member
+    const std::size_t inf = tuning_table::inf;
+    CHECK(copy.entries()[1].n_max == inf);
+    CHECK(copy.entries()[1].value == 64);
+}
+
+TEMPLATE_LIST_TEST_CASE("Tuned defaults of the options", "[tuning]", types_to_test)
+{
+    using matrix_t = TestType;
+    using T = type_t<matrix_t>;
+    using idx_t = size_type<matrix_t>;
+    using real_t = real_type<T>;
+
+    const char type = tuning_type<T>();
+    const idx_t n = 40;
+
+    const tuning_guard guard;
+    tuning().clear();
+    tuning().set("gehrd", "nb", type, tuning_table::inf, 8);
+    tuning().set("multishift_qr", "nshift", type, 30, 4);
+    tuning().set("multishift_qr", "nshift", type, tuning_table::inf, 6);
+    tuning().set("multishift_qr", "nmin", type, tuning_table::inf, 20);
+    tuning().set("potrf", "nb", type, tuning_table::inf, 7);
+    tuning().set("transpose", "nx", type, tuning_table::inf, 2);
+
+    std::unique_ptr<T[]> A_(new T[n * n]);
+    std::unique_ptr<T[]> B_(new T[n * n]);
+    auto A = legacyMatrix<T, layout<matrix_t>>(n, n, &A_[0], n);
+    auto B = legacyMatrix<T, layout<matrix_t>>(n, n, &B_[0], n);
+    std::vector<T> tau(n);
+
+    SECTION("gehrd")
+    {
+        gehrd_opts_t<idx_t, T> opts;
+        CHECK(get_work_gehrd(0, n, A, tau, opts) == (n + 8) * 8);
+
+        // An explicit value is not replaced
+        opts.nb = 4;
+        CHECK(get_work_gehrd(0, n, A, tau, opts) == (n + 4) * 4);
+
+        // Copies keep track of explicit values
+        gees_opts_t<idx_t, T> gees_opts;
+        gehrd_opts_t<idx_t, T> gehrd_opts;
+        gehrd_opts.nb = gees_opts.nb;
+        CHECK(!gehrd_opts.nb.is_set());
+        CHECK(get_work_gehrd(0, n, A, tau, gehrd_opts) == (n + 8) * 8);
+    }
+
+    SECTION("multishift_qr")
+    {
+        francis_opts_t<idx_t, T> opts;
+        CHECK(opts.nshift_recommender(20, 20) == 4);
+        CHECK(opts.nshift_recommender(100, 100) == 6);
+
+        std::vector<std::complex<real_t>> w(n);
+        CHECK(get_work_multishift_qr(true, true, idx_t(0), n, A, w, B, opts) > 0);
+        opts.nmin = 75;
+        CHECK(get_work_multishift_qr(true, true, idx_t(0), n, A, w, B, opts) == 0);
+
+        // The Schur form is still correct with the tuned parameters
+        rand_generator gen;
+        for (idx_t j = 0; j < n; ++j)
+            for (idx_t i = 0; i < n; ++i)
+                A(i, j) = (i > j + 1) ? T(0) : rand_helper<T>(gen);
+        std::unique_ptr<T[]> H_(new T[n * n]);
+        auto H = legacyMatrix<T, layout<matrix_t>>(n, n, &H_[0], n);
+        lacpy(Uplo::General, A, H);
+        laset(Uplo::General, T(0), T(1), B);
+        francis_opts_t<idx_t, T> tuned_opts;
+        REQUIRE(multishift_qr(true, true, idx_t(0), n, H, w, B, tuned_opts) == 0);
+
+        // Clean the lower triangular part that was used as workspace
+        for (idx_t j = 0; j < n; ++j)
+            for (idx_t i = j + 2; i < n; ++i)
+                H(i, j) = T(0);
+
+        const real_t tol = real_t(n) * real_t(1.0e2) * uroundoff<real_t>();
+        std::unique_ptr<T[]> res_(new T[n * n]);
+        std::unique_ptr<T[]> work_(new T[n * n]);
+        auto res = legacyMatrix<T, layout<matrix_t>>(n, n, &res_[0], n);
+        auto work = legacyMatrix<T, layout<matrix_t>>(n, n, &work_[0], n);
+
+        CHECK(check_orthogonality(B, res) <= tol);
+        const real_t normA = lange(frob_norm, A);
+        CHECK(check_similarity_transform(A, B, H, res, work) <= tol * normA);
+    }
+
+    SECTION("potrf and transpose")
+    {
+        rand_generator gen;
+        for (idx_t j = 0; j < n; ++j)
+            for (idx_t i = 0; i < n; ++i)
+                A(i, j) = (i == j) ? T(real_t(2 * n)) : rand_helper<T>(gen);
+
+        // With an explicit value and with the tuned one, the factorizations
+        // are equal up to rounding
+        lacpy(Uplo::General, A, B);
+        potrf_opts_t<idx_t> opts;
+        opts.nb = 32;
+        REQUIRE(potrf(Uplo::Lower, A, opts) == 0);
+        REQUIRE(potrf(Uplo::Lower, B) == 0);
+        const real_t tol = real_t(n) * ulp<real_t>() * real_t(2 * n);
+        for (idx_t j = 0; j < n; ++j)
+            for (idx_t i = j; i < n; ++i)
+                CHECK(abs(A(i, j) - B(i, j)) <= tol);
+
+        transpose(A, B);
+        for (idx_t j = 0; j < n; ++j)
+            for (idx_t i = 0; i < n; ++i)
+                CHECK(B(j, i) == A(i, j));
+    }
+}
+
+TEST_CASE("Defaults derived from the host", "[tuning]")
+{
+    const host_info &h = host();
+    CHECK(h.l1d > 0);
+    CHECK(h.l2 > 0);
+    CHECK(h.cache_line > 0);
+    CHECK(h.cores > 0);
+
+    // Larger caches give larger blocks, within the bounds of the model
+    host_info small, large;
+    small.l1d = 8 * 1024;
+    small.l2 = 64 * 1024;
+    small.l3 = 0;
+    large.l1d = 64 * 1024;
+    large.l2 = 2 * 1024 * 1024;
+    large.l3 = 64 * 1024 * 1024;
+    const host_defaults_t ds = host_defaults(small, sizeof(double), 1000);
+    const host_defaults_t dl = host_defaults(large, sizeof(double), 1000);
+    CHECK(ds.potrf_nb <= dl.potrf_nb);
+    CHECK(ds.gemm_kc <= dl.gemm_kc);
+    CHECK(ds.gemm_nc <= dl.gemm_nc);
+    CHECK(ds.transpose_nx <= dl.transpose_nx);
+    for (const host_defaults_t &d : {ds, dl})
+    {
+        CHECK(d.potrf_nb >= 16);
+        CHECK(d.potrf_nb <= 256);
+        CHECK(d.gehrd_nb >= 16);
+        CHECK(d.gehrd_nb <= 64);
+        CHECK(d.gemm_mc >= 1);
+        CHECK(d.gemm_kc >= 32);
+        CHECK(d.gemm_nc >= 4);
+        CHECK(d.transpose_nx >= 4);
+        CHECK(d.lauum_nx >= 4);
+        CHECK(d.trtri_nx >= 4);
+    }
+
+    // The tuning table has precedence over the model, and explicit values
+    // over both
+    const tuning_guard guard;
+    tuning().clear();
+    std::size_t value = 0;
+    CHECK(host_model("potrf", "nb", sizeof(double), 100, value));
+    CHECK(value == host_defaults<double>(100).potrf_nb);
+    CHECK(!host_model("potrf", "unknown", sizeof(double), 100, value));
+#ifndef TLAPACK_NO_HOST_MODEL
+    CHECK(tuned<double>(tunable<std::size_t>(tuning_default, 1), "potrf", "nb", 100) == value);
+#endif
+    tuning().set("potrf", "nb", 'd', tuning_table::inf, 7);
+    CHECK(tuned<double>(tunable<std::size_t>(tuning_default, 1), "potrf", "nb", 100) == 7);
+    CHECK(tuned<double>(tunable<std::size_t>(5), "potrf", "nb", 100) == 5);
+
+    std::ostringstream out;
+    print_host_info(out);
+    CHECK(out.str().find("potrf.nb=") != std::string::npos);
+}
@@ -0,0 +1,211 @@
+/// @file test_workspace.cpp
+/// @brief Test the workspace arena
+//
+// Copyright (c) 2022, University of Colorado Denver. All rights reserved.
+//
+// This file is part of <T>LAPACK.
+// <T>LAPACK is free software: you can redistribute it and/or modify it under
+// the terms of the BSD 3-Clause license. See the accompanying LICENSE file.
+
+#include <catch2/catch.hpp>
+#include <plugins/tlapack_stdvector.hpp>
+#include <tlapack.hpp>
+#include <testutils.hpp>
+#include <testdefinitions.hpp>
+
+using namespace tlapack;
+
+TEST_CASE("Workspace arena is a stack", "[utils][workspace]")
+{
+    workspace_arena arena(1024);
+    CHECK(arena.capacity() >= 1024);
+    const std::size_t n_alloc = arena.n_allocations();
+
+    double *a = arena.push<double>(10);
+    std::complex<float> *b = arena.push<std::complex<float>>(7);
+    CHECK(reinterpret_cast<std::uintptr_t>(a) % workspace_arena::alignment == 0);
+    CHECK(reinterpret_cast<std::uintptr_t>(b) % workspace_arena::alignment == 0);
+    CHECK((void *)b > (void *)(a + 10));
+    CHECK(arena.depth() == 2);
+    for (int i = 0; i < 7; ++i)
+        CHECK(b[i] == std::complex<float>(0));
+
+    arena.pop(b);
+    double *c = arena.push<double>(3);
+    CHECK((void *)c == (void *)b);
+    arena.pop(c);
+    arena.pop(a);
+    CHECK(arena.depth() == 0);
+    CHECK(arena.used() == 0);
+    CHECK(arena.n_allocations() == n_alloc);
+}
+
+#ifndef TLAPACK_NO_HIDDEN_ALLOCATION
+TEST_CASE("Workspace arena grows to the peak usage", "[utils][workspace]")
+{
+    workspace_arena arena;
+
+    for (int rep = 0; rep < 3; ++rep)
+    {
+        const std::size_t n_alloc = arena.n_allocations();
+        float *a = arena.push<float>(1000);
+        float *b = arena.push<float>(5000);
+        for (int i = 0; i < 1000; ++i)
+            a[i] = float(i);
+        for (int i = 0; i < 5000; ++i)
+            b[i] = float(i);
+        arena.pop(b);
+        arena.pop(a);
+
+        // The first repetition allocates, the others reuse the buffer
+        if (rep > 0)
+            CHECK(arena.n_allocations() == n_alloc);
+    }
+    CHECK(arena.capacity() >= arena.high_water());
+}
+#endif
+
+TEST_CASE("External buffer is used by the arena", "[utils][workspace]")
+{
+    std::vector<char> buffer(4096 + workspace_arena::alignment);
+    workspace_arena arena(buffer.data(), buffer.size());
+    int *a = arena.push<int>(100);
+    CHECK((char *)a >= buffer.data());
+    CHECK((char *)(a + 100) <= buffer.data() + buffer.size());
+    arena.pop(a);
+    CHECK(arena.n_allocations() == 0);
+}
+
+#ifndef TLAPACK_NO_HIDDEN_ALLOCATION
+TEMPLATE_LIST_TEST_CASE("Multishift QR does not allocate in steady state", "[eigenvalues][workspace]", types_to_test)
+{
+    using matrix_t = TestType;
+    using T = type_t<matrix_t>;
+    using idx_t = size_type<matrix_t>;
+    using real_t = real_type<T>;
+    using complex_t = std::complex<real_t>;
+
+    rand_generator gen;
+
+    const idx_t n = 100;
+    std::unique_ptr<T[]> A_(new T[n * n]);
+    std::unique_ptr<T[]> H_(new T[n * n]);
+    std::unique_ptr<T[]> Q_(new T[n * n]);
+    auto A = legacyMatrix<T, layout<matrix_t>>(n, n, &A_[0], n);
+    auto H = legacyMatrix<T, layout<matrix_t>>(n, n, &H_[0], n);
+    auto Q = legacyMatrix<T, layout<matrix_t>>(n, n, &Q_[0], n);
+    std::vector<complex_t> w(n);
+
+    for (idx_t j = 0; j < n; ++j)
+        for (idx_t i = 0; i < std::min(n, j + 2); ++i)
+            A(i, j) = rand_helper<T>(gen);
+    for (idx_t j = 0; j < n; ++j)
+        for (idx_t i = j + 2; i < n; ++i)
+            A(i, j) = T(0);
+
+    workspace_arena arena;
+    francis_opts_t<idx_t, T> opts;
+    opts.nmin = 15;
+    opts.arena = &arena;
+
+    std::size_t n_alloc = 0;
+    for (int rep = 0; rep < 3; ++rep)
+    {
+        lacpy(Uplo::General, A, H);
+        laset(Uplo::General, T(0), T(1), Q);
+        int info = multishift_qr(true, true, 0, n, H, w, Q, opts);
+        REQUIRE(info == 0);
+        CHECK(opts.n_aed > 0);
+        CHECK(arena.depth() == 0);
+
+        // The nested calls from AED use the same arena
+        if (rep > 0)
+            CHECK(arena.n_allocations() == n_alloc);
+        n_alloc = arena.n_allocations();
+    }
+    CHECK(arena.high_water() > 0);
+}
+#endif
+
+TEMPLATE_LIST_TEST_CASE("Workspace queries of the QR algorithm are sufficient", "[eigenvalues][workspace]", types_to_test)
+{
+    using matrix_t = TestType;
+    using T = type_t<matrix_t>;
+    using idx_t = size_type<matrix_t>;
+    using real_t = real_type<T>;
+    using complex_t = std::complex<real_t>;
+
+    rand_generator gen;
+
+    const idx_t n = GENERATE(30, 100, 160);
+    const idx_t nmin = GENERATE(15, 75);
+    std::unique_ptr<T[]> A_(new T[n * n]);
+    std::unique_ptr<T[]> H_(new T[n * n]);
+    std::unique_ptr<T[]> Q_(new T[n * n]);
+    auto A = legacyMatrix<T, layout<matrix_t>>(n, n, &A_[0], n);
+    auto H = legacyMatrix<T, layout<matrix_t>>(n, n, &H_[0], n);
+    auto Q = legacyMatrix<T, layout<matrix_t>>(n, n, &Q_[0], n);
+    std::vector<complex_t> w(n);
+    std::vector<T> tau(n);
+
+    for (idx_t j = 0; j < n; ++j)
+        for (idx_t i = 0; i < n; ++i)
+            A(i, j) = rand_helper<T>(gen);
+
+    DYNAMIC_SECTION("n = " << n << " nmin = " << nmin)
+    {
+        // gehrd
+        {
+            workspace_arena arena;
+            gehrd_opts_t<idx_t, T> opts;
+            opts.arena = &arena;
+            lacpy(Uplo::General, A, H);
+            const std::size_t worksize = get_worksize_gehrd(0, n, H, tau, opts);
+            arena.reserve(worksize);
+            gehrd(0, n, H, tau, opts);
+            CHECK(arena.high_water() == worksize);
+        }
+
+        for (idx_t j = 0; j < n; ++j)
+            for (idx_t i = j + 2; i < n; ++i)
+                A(i, j) = T(0);
+
+        // multishift_qr borrowing from an arena reserved with the query
+        {
+            workspace_arena arena;
+            francis_opts_t<idx_t, T> opts;
+            opts.nmin = nmin;
+            opts.arena = &arena;
+            lacpy(Uplo::General, A, H);
+            laset(Uplo::General, T(0), T(1), Q);
+
+            const std::size_t worksize = get_worksize_multishift_qr(true, true, 0, n, H, w, Q, opts);
+            arena.reserve(worksize);
+            const std::size_t n_alloc = arena.n_allocations();
+
+            int info = multishift_qr(true, true, 0, n, H, w, Q, opts);
+            REQUIRE(info == 0);
+            CHECK(arena.high_water() <= worksize);
+            CHECK(arena.n_allocations() == n_alloc);
+        }
+
+        // multishift_qr with a workspace given by the query
+        {
+            workspace_arena arena;
+            francis_opts_t<idx_t, T> opts;
+            opts.nmin = nmin;
+            opts.arena = &arena;
+            lacpy(Uplo::General, A, H);
+            laset(Uplo::General, T(0), T(1), Q);
+
+            opts.lwork = get_work_multishift_qr(true, true, 0, n, H, w, Q, opts);
+            std::vector<T> work(opts.lwork);
+            opts._work = work.data();
+            CHECK(get_worksize_multishift_qr(true, true, 0, n, H, w, Q, opts) == 0);
+
+            int info = multishift_qr(true, true, 0, n, H, w, Q, opts);
+            REQUIRE(info == 0);
+            CHECK(arena.high_water() == 0);
+        }
+    }
+}
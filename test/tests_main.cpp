@@ -4,5 +4,27 @@
 // <T>LAPACK is free software: you can redistribute it and/or modify it under
 // the terms of the BSD 3-Clause license. See the accompanying LICENSE file.
 
-#define CATCH_CONFIG_MAIN
-#include <catch2/catch.hpp>
\ No newline at end of file
+#define CATCH_CONFIG_RUNNER
+#include <catch2/catch.hpp>
+#include <base/workspace.hpp>
+#include <base/profile.hpp>
+
+int main( int argc, char* argv[] )
+{
+#ifdef TLAPACK_NO_HIDDEN_ALLOCATION
+    // The tests call most routines without workspace. Reserve the default
+    // arena of the main thread up front, so that these calls borrow from it
+    // and any hidden allocation fails loudly.
+    tlapack::default_arena().reserve( std::size_t(1) << 28 );
+#endif
+#ifdef TLAPACK_PROFILE
+    // Create the collector of the main thread, which is the only allocation
+    // done by the profiler
+    tlapack::thread_profile();
+#endif
+#ifdef TLAPACK_TRACE
+    // Same for the trace buffer of the main thread
+    tlapack::thread_trace();
+#endif
+    return Catch::Session().run( argc, argv );
+}